@@ -183,7 +183,9 @@
 #ifndef vtkArrayDispatch_h
 #define vtkArrayDispatch_h
 
+#include "vtkAOSDataArrayTemplate.h" // For PointArrays
 #include "vtkArrayDispatchArrayList.h"
+#include "vtkSOADataArrayTemplate.h" // For PointArrays
 #include "vtkType.h"
 #include "vtkTypeList.h"
 
@@ -208,6 +210,18 @@ typedef vtkTypeList::Unique<
  */
 typedef vtkTypeList::Append<Reals, Integrals>::Result AllTypes;
 
+/**
+ * A Typelist containing the arrays used to store point coordinates: float
+ * and double arrays in array-of-structs and struct-of-arrays layouts. Unlike
+ * Arrays, it always contains the struct-of-arrays types, whatever the value of
+ * VTK_DISPATCH_SOA_ARRAYS, so that geometric kernels dispatching on it keep
+ * a fast path for vtkPoints using the SOA layout (see
+ * vtkPoints::SetDataLayout()).
+ */
+typedef vtkTypeList::Create<vtkAOSDataArrayTemplate<float>, vtkAOSDataArrayTemplate<double>,
+  vtkSOADataArrayTemplate<float>, vtkSOADataArrayTemplate<double>>
+  PointArrays;
+
 //------------------------------------------------------------------------------
 /**
  * Dispatch a single array against all array types in the application-wide
@@ -8,6 +8,12 @@
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSOADataArrayTemplate.h"
+
+#include <array>
+#include <limits>
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -110,13 +116,136 @@ void vtkPoints::GetPoints(vtkIdList* ptIds, vtkPoints* outPoints)
   }
 }
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Create an empty coordinate array of the given type and layout.
+vtkDataArray* NewPointsArray(int dataType, int layout)
+{
+  if (layout == vtkPoints::SOA_LAYOUT)
+  {
+    switch (dataType)
+    {
+      case VTK_FLOAT:
+        return vtkSOADataArrayTemplate<float>::New();
+      case VTK_DOUBLE:
+        return vtkSOADataArrayTemplate<double>::New();
+      default:
+        break;
+    }
+  }
+  return vtkDataArray::CreateDataArray(dataType);
+}
+
+//------------------------------------------------------------------------------
+// Copy the coordinates to an array of another layout.
+struct CopyPointsWorker
+{
+  template <typename SrcArrayT, typename DstArrayT>
+  void operator()(SrcArrayT* src, DstArrayT* dst) const
+  {
+    const auto srcTuples = vtk::DataArrayTupleRange<3>(src);
+    auto dstTuples = vtk::DataArrayTupleRange<3>(dst);
+    vtkSMPTools::For(0, srcTuples.size(), [&](vtkIdType begin, vtkIdType end) {
+      double point[3];
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        srcTuples.GetTuple(ptId, point);
+        dstTuples.SetTuple(ptId, point);
+      }
+    });
+  }
+};
+
+//------------------------------------------------------------------------------
+// Bounds of points stored in one contiguous array per coordinate. Each
+// coordinate is reduced by a separate loop that the compiler can vectorize.
+// Like vtkDataArray::ComputeScalarRange(), NaN values are ignored.
+template <typename ValueType>
+struct SOABoundsFunctor
+{
+  const ValueType* Coordinates[3];
+  double* Bounds;
+  vtkSMPThreadLocal<std::array<ValueType, 6>> LocalBounds;
+
+  void Initialize()
+  {
+    std::array<ValueType, 6>& bounds = this->LocalBounds.Local();
+    for (int comp = 0; comp < 3; ++comp)
+    {
+      bounds[2 * comp] = std::numeric_limits<ValueType>::max();
+      bounds[2 * comp + 1] = std::numeric_limits<ValueType>::lowest();
+    }
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::array<ValueType, 6>& bounds = this->LocalBounds.Local();
+    for (int comp = 0; comp < 3; ++comp)
+    {
+      const ValueType* x = this->Coordinates[comp];
+      ValueType xMin = bounds[2 * comp];
+      ValueType xMax = bounds[2 * comp + 1];
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        xMin = x[ptId] < xMin ? x[ptId] : xMin;
+        xMax = x[ptId] > xMax ? x[ptId] : xMax;
+      }
+      bounds[2 * comp] = xMin;
+      bounds[2 * comp + 1] = xMax;
+    }
+  }
+
+  void Reduce()
+  {
+    for (const auto& bounds : this->LocalBounds)
+    {
+      for (int comp = 0; comp < 3; ++comp)
+      {
+        if (bounds[2 * comp] <= bounds[2 * comp + 1])
+        {
+          this->Bounds[2 * comp] = std::min<double>(this->Bounds[2 * comp], bounds[2 * comp]);
+          this->Bounds[2 * comp + 1] =
+            std::max<double>(this->Bounds[2 * comp + 1], bounds[2 * comp + 1]);
+        }
+      }
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+bool ComputeSOABounds(vtkDataArray* data, double bounds[6])
+{
+  auto array = vtkSOADataArrayTemplate<ValueType>::FastDownCast(data);
+  if (!array || !array->HasComponentArrays())
+  {
+    return false;
+  }
+  SOABoundsFunctor<ValueType> functor;
+  for (int comp = 0; comp < 3; ++comp)
+  {
+    functor.Coordinates[comp] = array->GetComponentArrayPointer(comp);
+    bounds[2 * comp] = VTK_DOUBLE_MAX;
+    bounds[2 * comp + 1] = VTK_DOUBLE_MIN;
+  }
+  functor.Bounds = bounds;
+  vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+  return true;
+}
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 // Determine (xmin,xmax, ymin,ymax, zmin,zmax) bounds of points.
 void vtkPoints::ComputeBounds()
 {
   if (this->GetMTime() > this->ComputeTime)
   {
-    this->Data->ComputeScalarRange(this->Bounds);
+    if (!ComputeSOABounds<float>(this->Data, this->Bounds) &&
+      !ComputeSOABounds<double>(this->Data, this->Bounds))
+    {
+      this->Data->ComputeScalarRange(this->Bounds);
+    }
     this->ComputeTime.Modified();
   }
 }
@@ -187,13 +316,52 @@ void vtkPoints::SetDataType(int dataType)
     return;
   }
 
+  const int layout = this->GetDataLayout();
   this->Data->Delete();
-  this->Data = vtkDataArray::CreateDataArray(dataType);
+  this->Data = NewPointsArray(dataType, layout);
   this->Data->SetNumberOfComponents(3);
   this->Data->SetName("Points");
   this->Modified();
 }
 
+//------------------------------------------------------------------------------
+int vtkPoints::GetDataLayout() const
+{
+  return this->Data->GetArrayType() == vtkAbstractArray::SoADataArrayTemplate ? SOA_LAYOUT
+                                                                              : AOS_LAYOUT;
+}
+
+//------------------------------------------------------------------------------
+void vtkPoints::SetDataLayout(int layout)
+{
+  if (layout == this->GetDataLayout())
+  {
+    return;
+  }
+  const int dataType = this->Data->GetDataType();
+  if (dataType != VTK_FLOAT && dataType != VTK_DOUBLE)
+  {
+    vtkErrorMacro(<< "The layout of " << this->Data->GetDataTypeAsString()
+                  << " points cannot be changed, only float and double points are supported.");
+    return;
+  }
+
+  vtkDataArray* data = NewPointsArray(dataType, layout);
+  data->SetNumberOfComponents(3);
+  data->SetNumberOfTuples(this->Data->GetNumberOfTuples());
+  data->SetName(this->Data->GetName());
+
+  using Dispatcher = vtkArrayDispatch::Dispatch2ByArray<vtkArrayDispatch::PointArrays,
+    vtkArrayDispatch::PointArrays>;
+  CopyPointsWorker worker;
+  if (!Dispatcher::Execute(this->Data, data, worker))
+  {
+    worker(this->Data, data);
+  }
+  this->SetData(data);
+  data->Delete();
+}
+
 //------------------------------------------------------------------------------
 // Set the data for this object. The tuple dimension must be consistent with
 // the object.
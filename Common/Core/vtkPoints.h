@@ -74,6 +74,32 @@ public:
   void SetDataTypeToFloat() { this->SetDataType(VTK_FLOAT); }
   void SetDataTypeToDouble() { this->SetDataType(VTK_DOUBLE); }
 
+  /**
+   * Memory layouts of the coordinates of the points.
+   */
+  enum DataLayouts
+  {
+    AOS_LAYOUT = 0, // x0 y0 z0 x1 y1 z1 ... (vtkFloatArray, vtkDoubleArray)
+    SOA_LAYOUT = 1  // x0 x1 ... y0 y1 ... z0 z1 ... (vtkSOADataArrayTemplate)
+  };
+
+  ///@{
+  /**
+   * Specify the memory layout of the coordinates. The default, AOS_LAYOUT,
+   * stores the points one after the other. SOA_LAYOUT stores one contiguous
+   * array per coordinate, which the geometric kernels (bounds, implicit
+   * function evaluation, linear transforms) process with vectorizable loops.
+   * Changing the layout converts the current points, and is only supported
+   * for float and double points. SetDataType() keeps the layout.
+   */
+  VTK_MARSHALEXCLUDE(VTK_MARSHAL_EXCLUDE_REASON_IS_REDUNDANT)
+  virtual void SetDataLayout(int layout);
+  VTK_MARSHALEXCLUDE(VTK_MARSHAL_EXCLUDE_REASON_IS_REDUNDANT)
+  int GetDataLayout() const;
+  void SetDataLayoutToAOS() { this->SetDataLayout(AOS_LAYOUT); }
+  void SetDataLayoutToSOA() { this->SetDataLayout(SOA_LAYOUT); }
+  ///@}
+
   /**
    * Return a void pointer. For image pipeline interface and other
    * special pointer manipulation.
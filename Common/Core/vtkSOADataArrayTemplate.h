@@ -185,6 +185,14 @@ public:
    */
   ValueType* GetComponentArrayPointer(int comp);
 
+  /**
+   * Return true if the values are stored in one contiguous block per
+   * component, i.e. if GetComponentArrayPointer() can be used. This is no
+   * longer the case after GetVoidPointer(), which moves the values to a
+   * single array-of-structs buffer.
+   */
+  bool HasComponentArrays() const { return this->StorageType == StorageTypeEnum::SOA; }
+
   /**
    * Use of this method is discouraged, it creates a deep copy of the data into
    * a contiguous AoS-ordered buffer and prints a warning.
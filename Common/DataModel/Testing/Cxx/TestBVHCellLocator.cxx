@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compare the queries of vtkBVHCellLocator with the ones of
+// vtkStaticCellLocator, and the batched line intersections with their
+// single line counterpart.
+
+#include "vtkBVHCellLocator.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+#include "vtkStaticCellLocator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+bool SameValue(double a, double b)
+{
+  return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(b));
+}
+
+void RandomPoint(vtkMinimalStandardRandomSequence* random, double lo, double hi, double x[3])
+{
+  for (int c = 0; c < 3; ++c)
+  {
+    x[c] = random->GetNextRangeValue(lo, hi);
+  }
+}
+}
+
+int TestBVHCellLocator(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(8775);
+  int numErrors = 0;
+
+  // Point location and closest point queries in a volume.
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(21, 21, 21);
+  image->SetSpacing(0.05, 0.05, 0.05);
+
+  vtkNew<vtkBVHCellLocator> bvh;
+  bvh->SetDataSet(image);
+  bvh->BuildLocator();
+  vtkNew<vtkStaticCellLocator> reference;
+  reference->SetDataSet(image);
+  reference->BuildLocator();
+  if (bvh->GetNumberOfNodes() < 1)
+  {
+    std::cerr << "The hierarchy was not built" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkGenericCell> cell;
+  for (int i = 0; i < 1000 && numErrors < 10; ++i)
+  {
+    double x[3], pcoords[3], weights[8];
+    int subId;
+    RandomPoint(random, -0.1, 1.1, x);
+    vtkIdType cellId = bvh->FindCell(x, 0.0, cell, subId, pcoords, weights);
+    vtkIdType expected = reference->FindCell(x, 0.0, cell, subId, pcoords, weights);
+    // Points on shared faces may be found in either cell.
+    if ((cellId < 0) != (expected < 0))
+    {
+      std::cerr << "FindCell mismatch at " << x[0] << ", " << x[1] << ", " << x[2] << std::endl;
+      ++numErrors;
+    }
+
+    double closest[3], dist2, refDist2;
+    vtkIdType closestId;
+    bvh->FindClosestPoint(x, closest, closestId, subId, dist2);
+    reference->FindClosestPoint(x, closest, closestId, subId, refDist2);
+    if (!SameValue(dist2, refDist2))
+    {
+      std::cerr << "FindClosestPoint mismatch: " << dist2 << " != " << refDist2 << std::endl;
+      ++numErrors;
+    }
+  }
+
+  // A volume large enough for the top levels to be partitioned in parallel.
+  vtkNew<vtkImageData> largeImage;
+  largeImage->SetDimensions(61, 61, 61);
+  largeImage->SetSpacing(1.0 / 60, 1.0 / 60, 1.0 / 60);
+  bvh->SetDataSet(largeImage);
+  bvh->BuildLocator();
+  for (int i = 0; i < 1000 && numErrors < 10; ++i)
+  {
+    double x[3], pcoords[3], weights[8];
+    int subId;
+    RandomPoint(random, 0.0, 1.0, x);
+    vtkIdType cellId = bvh->FindCell(x, 0.0, cell, subId, pcoords, weights);
+    int ijk[3];
+    if (cellId < 0 || !largeImage->ComputeStructuredCoordinates(x, ijk, pcoords) ||
+      cellId != largeImage->ComputeCellId(ijk))
+    {
+      std::cerr << "FindCell mismatch in the large volume at " << x[0] << ", " << x[1] << ", "
+                << x[2] << std::endl;
+      ++numErrors;
+    }
+  }
+
+  // Line intersections with a surface.
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+  sphere->Update();
+  vtkPolyData* surface = sphere->GetOutput();
+
+  bvh->SetDataSet(surface);
+  bvh->BuildLocator();
+  reference->SetDataSet(surface);
+  reference->BuildLocator();
+
+  const vtkIdType numLines = 2000;
+  vtkNew<vtkDoubleArray> p1;
+  p1->SetNumberOfComponents(3);
+  p1->SetNumberOfTuples(numLines);
+  vtkNew<vtkDoubleArray> p2;
+  p2->SetNumberOfComponents(3);
+  p2->SetNumberOfTuples(numLines);
+  for (vtkIdType i = 0; i < numLines; ++i)
+  {
+    double a[3], b[3];
+    RandomPoint(random, -1.0, 1.0, a);
+    RandomPoint(random, -1.0, 1.0, b);
+    p1->SetTuple(i, a);
+    p2->SetTuple(i, b);
+  }
+
+  vtkNew<vtkIdTypeArray> cellIds;
+  vtkNew<vtkDoubleArray> ts;
+  vtkNew<vtkDoubleArray> hits;
+  bvh->IntersectWithLines(p1, p2, 0.0, cellIds, ts, hits);
+  if (cellIds->GetNumberOfValues() != numLines || ts->GetNumberOfValues() != numLines ||
+    hits->GetNumberOfTuples() != numLines)
+  {
+    std::cerr << "IntersectWithLines returned wrongly sized arrays" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkIdType numHits = 0;
+  vtkNew<vtkIdList> allHits;
+  for (vtkIdType i = 0; i < numLines && numErrors < 10; ++i)
+  {
+    double a[3], b[3], t, refT, x[3], pcoords[3];
+    int subId;
+    vtkIdType cellId, refCellId;
+    p1->GetTuple(i, a);
+    p2->GetTuple(i, b);
+    int hit = bvh->IntersectWithLine(a, b, 0.0, t, x, pcoords, subId, cellId, cell);
+    int refHit = reference->IntersectWithLine(a, b, 0.0, refT, x, pcoords, subId, refCellId, cell);
+    if (hit != refHit || (hit && !SameValue(t, refT)))
+    {
+      std::cerr << "IntersectWithLine mismatch for line " << i << std::endl;
+      ++numErrors;
+      continue;
+    }
+    if ((cellIds->GetValue(i) >= 0) != (hit != 0) || (hit && !SameValue(ts->GetValue(i), t)))
+    {
+      std::cerr << "IntersectWithLines mismatch for line " << i << std::endl;
+      ++numErrors;
+    }
+    numHits += hit;
+
+    // All the intersected cells
+    bvh->IntersectWithLine(a, b, 0.0, nullptr, allHits, cell);
+    if ((allHits->GetNumberOfIds() > 0) != (hit != 0))
+    {
+      std::cerr << "IntersectWithLine (all hits) mismatch for line " << i << std::endl;
+      ++numErrors;
+    }
+  }
+  if (numHits == 0)
+  {
+    std::cerr << "No line intersected the sphere" << std::endl;
+    ++numErrors;
+  }
+
+  return numErrors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
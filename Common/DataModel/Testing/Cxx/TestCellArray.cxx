@@ -3,6 +3,7 @@
 
 #include "vtkCellArray.h"
 
+#include "vtkAffineArray.h"
 #include "vtkCellArrayIterator.h"
 #include "vtkDataArrayRange.h"
 #include "vtkIdList.h"
@@ -14,12 +15,14 @@
 #include "vtkNew.h"
 #include "vtkPolyData.h"
 #include "vtkQuad.h"
+#include "vtkSMPTools.h"
 #include "vtkSetGet.h"
 #include "vtkSmartPointer.h"
 #include "vtkTypeInt32Array.h"
 #include "vtkTypeInt64Array.h"
 
 #include <algorithm>
+#include <atomic>
 #include <initializer_list>
 #include <stdexcept>
 #include <type_traits>
@@ -978,6 +981,254 @@ void TestAppend64(vtkSmartPointer<vtkCellArray> cellArray)
   TestAppendImpl(cellArray, NewCellArray(true));
 }
 
+void TestAppendCellArrays(vtkSmartPointer<vtkCellArray> cellArray)
+{
+  vtkLogScopeFunction(INFO);
+
+  std::vector<vtkSmartPointer<vtkCellArray>> pieces;
+  pieces.push_back(NewCellArray(false));
+  pieces.push_back(nullptr);
+  pieces.push_back(NewCellArray(true));
+  pieces[0]->InsertNextCell({ 0, 1, 2 });
+  pieces[0]->InsertNextCell({ 3, 5 });
+  pieces[2]->InsertNextCell({ 3, 5, 6, 7 });
+  pieces[2]->InsertNextCell({ 3, 2, 4 });
+
+  std::vector<vtkCellArray*> rawPieces;
+  for (const auto& piece : pieces)
+  {
+    rawPieces.push_back(piece);
+  }
+  const vtkIdType pointOffsets[3] = { 0, 100, 10 };
+
+  cellArray->InsertNextCell({ 9, 7, 8 });
+  cellArray->AppendCellArrays(rawPieces.data(), 3, pointOffsets);
+  TEST_ASSERT(cellArray->IsValid());
+  TEST_ASSERT(cellArray->GetNumberOfCells() == 5);
+
+  auto validate = [&](const vtkIdType cellId, const std::initializer_list<vtkIdType>& ref) {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    cellArray->GetCellAtId(cellId, npts, pts);
+    TEST_ASSERT(ref.size() == static_cast<std::size_t>(npts));
+    TEST_ASSERT(std::equal(ref.begin(), ref.end(), pts));
+  };
+
+  validate(0, { 9, 7, 8 });
+  validate(1, { 0, 1, 2 });
+  validate(2, { 3, 5 });
+  validate(3, { 13, 15, 16, 17 });
+  validate(4, { 13, 12, 14 });
+
+  // A single piece appended to an empty cell array is shared.
+  vtkNew<vtkCellArray> shared;
+  shared->AppendCellArrays(rawPieces.data(), 1);
+  TEST_ASSERT(shared->GetOffsetsArray() == pieces[0]->GetOffsetsArray());
+  TEST_ASSERT(shared->GetConnectivityArray() == pieces[0]->GetConnectivityArray());
+
+  // Enough cells to split the copies between threads.
+  auto big = NewCellArray(cellArray->IsStorage64Bit());
+  for (vtkIdType i = 0; i < 100000; ++i)
+  {
+    big->InsertNextCell({ i, i + 1, i + 2, i + 3 });
+  }
+  vtkCellArray* bigPieces[2] = { big, big };
+  const vtkIdType bigOffsets[2] = { 0, 1 };
+  vtkNew<vtkCellArray> concat;
+  concat->AppendCellArrays(bigPieces, 2, bigOffsets);
+  TEST_ASSERT(concat->IsValid());
+  TEST_ASSERT(concat->GetNumberOfCells() == 200000);
+  vtkIdType npts;
+  const vtkIdType* pts;
+  concat->GetCellAtId(150000, npts, pts);
+  TEST_ASSERT(npts == 4 && pts[0] == 50001 && pts[3] == 50004);
+}
+
+void TestSetDataFromCellSizes(vtkSmartPointer<vtkCellArray> cellArray)
+{
+  vtkLogScopeFunction(INFO);
+
+  const vtkIdType numCells = 50000;
+  vtkNew<vtkIntArray> sizes;
+  sizes->SetNumberOfValues(numCells);
+  vtkIdType connSize = 0;
+  for (vtkIdType i = 0; i < numCells; ++i)
+  {
+    sizes->SetValue(i, static_cast<int>(i % 5 + 1));
+    connSize += i % 5 + 1;
+  }
+
+  auto conn = vtkSmartPointer<vtkDataArray>::Take(
+    cellArray->IsStorage64Bit() ? static_cast<vtkDataArray*>(vtkTypeInt64Array::New())
+                                : static_cast<vtkDataArray*>(vtkTypeInt32Array::New()));
+  conn->SetNumberOfValues(connSize);
+  for (vtkIdType i = 0; i < connSize; ++i)
+  {
+    conn->SetTuple1(i, static_cast<double>(i));
+  }
+
+  TEST_ASSERT(cellArray->SetDataFromCellSizes(sizes, conn));
+  TEST_ASSERT(cellArray->IsValid());
+  TEST_ASSERT(cellArray->GetNumberOfCells() == numCells);
+  TEST_ASSERT(cellArray->GetConnectivityArray() == conn);
+  vtkIdType offset = 0;
+  for (vtkIdType i = 0; i < numCells; ++i)
+  {
+    TEST_ASSERT(cellArray->GetOffset(i) == offset);
+    offset += i % 5 + 1;
+  }
+  TEST_ASSERT(cellArray->GetOffset(numCells) == connSize);
+
+  // Sizes not matching the connectivity are rejected.
+  sizes->SetValue(0, 2);
+  vtkObject::GlobalWarningDisplayOff();
+  const bool rejected = !cellArray->SetDataFromCellSizes(sizes, conn);
+  vtkObject::GlobalWarningDisplayOn();
+  TEST_ASSERT(rejected);
+}
+
+// Sum of the cell sizes, using the cell accessors of the Visit() state only.
+struct SumCellSizesImpl
+{
+  template <typename CellStateT>
+  vtkIdType operator()(CellStateT& state) const
+  {
+    vtkIdType sum = 0;
+    for (vtkIdType cellId = 0; cellId < state.GetNumberOfCells(); ++cellId)
+    {
+      sum += state.GetCellSize(cellId);
+    }
+    return sum;
+  }
+};
+
+void TestFixedSizeStorage(vtkSmartPointer<vtkCellArray> cellArray)
+{
+  vtkLogScopeFunction(INFO);
+
+  const vtkIdType numCells = 20000;
+  auto conn = vtkSmartPointer<vtkDataArray>::Take(
+    cellArray->IsStorage64Bit() ? static_cast<vtkDataArray*>(vtkTypeInt64Array::New())
+                                : static_cast<vtkDataArray*>(vtkTypeInt32Array::New()));
+  conn->SetNumberOfValues(4 * numCells);
+  for (vtkIdType i = 0; i < 4 * numCells; ++i)
+  {
+    conn->SetTuple1(i, static_cast<double>(i));
+  }
+
+  // SetData() stores the offsets, SetFixedSizeData() does not.
+  TEST_ASSERT(cellArray->SetData(4, conn));
+  TEST_ASSERT(!cellArray->IsStorageFixedSize());
+  TEST_ASSERT(cellArray->GetOffsetsArray()->GetNumberOfValues() == numCells + 1);
+
+  // No offsets are stored, but the cells are accessed as usual.
+  TEST_ASSERT(cellArray->SetFixedSizeData(4, conn));
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+  TEST_ASSERT(cellArray->GetFixedCellSize() == 4);
+  TEST_ASSERT(cellArray->IsValid());
+  TEST_ASSERT(cellArray->IsHomogeneous() == 4);
+  TEST_ASSERT(cellArray->GetMaxCellSize() == 4);
+  TEST_ASSERT(cellArray->GetNumberOfCells() == numCells);
+  TEST_ASSERT(cellArray->GetNumberOfOffsets() == numCells + 1);
+  TEST_ASSERT(cellArray->GetOffset(numCells) == 4 * numCells);
+  TEST_ASSERT(cellArray->GetCellSize(7) == 4);
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    cellArray->GetCellAtId(7, npts, pts);
+    TEST_ASSERT(npts == 4 && pts[0] == 28 && pts[3] == 31);
+  }
+  {
+    vtkIdType cellId = 0;
+    auto iter = vtk::TakeSmartPointer(cellArray->NewIterator());
+    for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell(), ++cellId)
+    {
+      vtkIdList* cell = iter->GetCurrentCell();
+      TEST_ASSERT(cell->GetNumberOfIds() == 4 && cell->GetId(1) == 4 * cellId + 1);
+    }
+    TEST_ASSERT(cellId == numCells);
+  }
+  cellArray->ReplaceCellAtId(2, { 3, 2, 1, 0 });
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+
+  // Visit() functors using the cell accessors do not need the offsets.
+  TEST_ASSERT(cellArray->Visit(SumCellSizesImpl{}) == 4 * numCells);
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+  cellArray->ReplaceCellAtId(2, { 8, 9, 10, 11 });
+
+  // Shallow copies share the fixed size storage.
+  vtkNew<vtkCellArray> copy;
+  copy->ShallowCopy(cellArray);
+  TEST_ASSERT(copy->IsStorageFixedSize() && copy->GetNumberOfCells() == numCells);
+  copy->DeepCopy(cellArray);
+  TEST_ASSERT(copy->IsStorageFixedSize() && copy->GetNumberOfCells() == numCells);
+
+  // Cells of the same size keep the storage fixed, other sizes expand it.
+  const vtkIdType quad[4] = { 1, 2, 3, 4 };
+  cellArray->InsertNextCell(4, quad);
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+  TEST_ASSERT(cellArray->GetNumberOfCells() == numCells + 1);
+  cellArray->InsertNextCell({ 5, 6, 7 });
+  TEST_ASSERT(!cellArray->IsStorageFixedSize());
+  TEST_ASSERT(cellArray->IsValid());
+  TEST_ASSERT(cellArray->GetNumberOfCells() == numCells + 2);
+  TEST_ASSERT(cellArray->GetCellSize(numCells) == 4 && cellArray->GetCellSize(numCells + 1) == 3);
+  TEST_ASSERT(cellArray->GetOffset(numCells + 2) == 4 * numCells + 7);
+
+  // The copies are not affected.
+  TEST_ASSERT(copy->IsStorageFixedSize() && copy->GetNumberOfCells() == numCells);
+
+  // Explicit offsets are created once for the methods returning them, even
+  // when called concurrently.
+  std::atomic<int> wrongOffsets(0);
+  vtkCellArray* copyPtr = copy;
+  vtkSMPTools::For(0, 64,
+    [copyPtr, numCells, &wrongOffsets](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        vtkDataArray* offsetsArray = copyPtr->GetOffsetsArray();
+        if (offsetsArray->GetNumberOfValues() != numCells + 1 ||
+          offsetsArray->GetComponent(numCells, 0) != 4 * numCells)
+        {
+          ++wrongOffsets;
+        }
+      }
+    });
+  TEST_ASSERT(wrongOffsets == 0);
+  TEST_ASSERT(!copy->IsStorageFixedSize());
+  TEST_ASSERT(copy->GetOffsetsArray()->GetComponent(numCells, 0) == 4 * numCells);
+  TEST_ASSERT(copy->ConvertToFixedSizeStorage());
+  TEST_ASSERT(copy->IsStorageFixedSize() && copy->GetFixedCellSize() == 4);
+  TEST_ASSERT(!cellArray->ConvertToFixedSizeStorage());
+
+  // Conversions between 32 and 64 bit storage keep the implicit offsets.
+  if (copy->IsStorage64Bit())
+  {
+    TEST_ASSERT(copy->ConvertTo32BitStorage());
+  }
+  else
+  {
+    TEST_ASSERT(copy->ConvertTo64BitStorage());
+  }
+  TEST_ASSERT(copy->IsStorageFixedSize() && copy->GetNumberOfCells() == numCells);
+  TEST_ASSERT(copy->GetCellSize(numCells - 1) == 4);
+
+  // Affine offsets starting at 0 select the fixed size storage.
+  vtkNew<vtkAffineArray<vtkTypeInt64>> offsets;
+  offsets->ConstructBackend(3, 0);
+  offsets->SetNumberOfValues(numCells + 1);
+  vtkNew<vtkTypeInt64Array> conn64;
+  conn64->SetNumberOfValues(3 * numCells);
+  conn64->FillValue(0);
+  TEST_ASSERT(copy->SetData(offsets, conn64));
+  TEST_ASSERT(copy->IsStorageFixedSize() && copy->GetFixedCellSize() == 3);
+  TEST_ASSERT(copy->GetNumberOfCells() == numCells);
+
+  copy->Reset();
+  TEST_ASSERT(!copy->IsStorageFixedSize() && copy->GetNumberOfCells() == 0);
+}
+
 void TestLegacyFormatImportExportAppend(vtkSmartPointer<vtkCellArray> cellArray)
 {
   vtkLogScopeFunction(INFO);
@@ -1388,6 +1639,9 @@ void RunTests(bool use64BitStorage)
   TestShallowCopy(NewCellArray(use64BitStorage));
   TestAppend32(NewCellArray(use64BitStorage));
   TestAppend64(NewCellArray(use64BitStorage));
+  TestAppendCellArrays(NewCellArray(use64BitStorage));
+  TestSetDataFromCellSizes(NewCellArray(use64BitStorage));
+  TestFixedSizeStorage(NewCellArray(use64BitStorage));
   TestLegacyFormatImportExportAppend(NewCellArray(use64BitStorage));
 
   RunLegacyTests(use64BitStorage);
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Merge the corners of the voxels of a grid from multiple threads, and check
+// that the result is identical to the one of vtkMergePoints in a serial loop,
+// with one key per corner and with one key per voxel.
+
+#include "vtkCellArray.h"
+#include "vtkConcurrentMergePoints.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkMergePoints.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+
+#include <vector>
+
+namespace
+{
+const int Dim = 24;
+
+void GetCorner(vtkIdType voxelId, int corner, double x[3])
+{
+  int i = static_cast<int>(voxelId % Dim);
+  int j = static_cast<int>((voxelId / Dim) % Dim);
+  int k = static_cast<int>(voxelId / (Dim * Dim));
+  x[0] = 0.1 * (i + (corner & 1));
+  x[1] = 0.1 * (j + ((corner >> 1) & 1));
+  x[2] = 0.1 * (k + ((corner >> 2) & 1));
+}
+
+const vtkIdType NumberOfVoxels = Dim * Dim * Dim;
+const double Bounds[6] = { 0.0, 0.1 * Dim, 0.0, 0.1 * Dim, 0.0, 0.1 * Dim };
+
+// Insert the corners concurrently, and compare the merged points to the
+// serial merge. The keys are the indices of the serial insertions, or the
+// voxel ids, the corners of a voxel being inserted in their serial order.
+int CompareWithSerialMerge(vtkPoints* refPoints, vtkCellArray* refCells, bool keyPerCorner)
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkConcurrentMergePoints> concurrentMerge;
+  concurrentMerge->InitPointInsertion(points, Bounds, 8 * NumberOfVoxels);
+  std::vector<vtkIdType> connectivity(8 * NumberOfVoxels);
+  vtkNew<vtkDoubleArray> provisionalX;
+  provisionalX->SetName("X");
+  provisionalX->SetNumberOfTuples(8 * NumberOfVoxels);
+  vtkSMPTools::For(0, NumberOfVoxels,
+    [&](vtkIdType voxelId, vtkIdType end)
+    {
+      for (; voxelId < end; ++voxelId)
+      {
+        for (int corner = 0; corner < 8; ++corner)
+        {
+          double x[3];
+          GetCorner(voxelId, corner, x);
+          vtkIdType& id = connectivity[8 * voxelId + corner];
+          const vtkIdType key = keyPerCorner ? 8 * voxelId + corner : voxelId;
+          if (concurrentMerge->InsertUniquePoint(x, id, key))
+          {
+            // the points are merged and stored in float precision
+            provisionalX->SetValue(id, static_cast<float>(x[0]));
+          }
+        }
+      }
+    });
+  if (concurrentMerge->GetNumberOfInsertedPoints() != refPoints->GetNumberOfPoints())
+  {
+    std::cerr << "Wrong number of unique points: " << concurrentMerge->GetNumberOfInsertedPoints()
+              << " != " << refPoints->GetNumberOfPoints() << std::endl;
+    return 1;
+  }
+  concurrentMerge->Finalize();
+
+  vtkNew<vtkCellArray> cells;
+  for (vtkIdType voxelId = 0; voxelId < NumberOfVoxels; ++voxelId)
+  {
+    cells->InsertNextCell(8, connectivity.data() + 8 * voxelId);
+  }
+  concurrentMerge->RenumberCells(cells);
+
+  vtkNew<vtkPointData> provisionalPD;
+  provisionalX->SetNumberOfTuples(points->GetNumberOfPoints());
+  provisionalPD->AddArray(provisionalX);
+  vtkNew<vtkPointData> pd;
+  concurrentMerge->ReorderPointData(provisionalPD, pd);
+  vtkDataArray* finalX = pd->GetArray("X");
+
+  int numErrors = 0;
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints() && numErrors < 10; ++ptId)
+  {
+    double p[3], q[3];
+    points->GetPoint(ptId, p);
+    refPoints->GetPoint(ptId, q);
+    if (p[0] != q[0] || p[1] != q[1] || p[2] != q[2])
+    {
+      std::cerr << "Point " << ptId << " differs from the serial merge" << std::endl;
+      ++numErrors;
+    }
+    if (!finalX || finalX->GetComponent(ptId, 0) != p[0])
+    {
+      std::cerr << "Point data of point " << ptId << " was not reordered" << std::endl;
+      ++numErrors;
+    }
+  }
+
+  vtkNew<vtkIdList> cell;
+  vtkNew<vtkIdList> refCell;
+  for (vtkIdType voxelId = 0; voxelId < NumberOfVoxels && numErrors < 10; ++voxelId)
+  {
+    cells->GetCellAtId(voxelId, cell);
+    refCells->GetCellAtId(voxelId, refCell);
+    for (int corner = 0; corner < 8; ++corner)
+    {
+      if (cell->GetId(corner) != refCell->GetId(corner))
+      {
+        std::cerr << "Connectivity of voxel " << voxelId << " differs from the serial merge"
+                  << std::endl;
+        ++numErrors;
+        break;
+      }
+    }
+  }
+  if (numErrors)
+  {
+    std::cerr << "Failed with one key per " << (keyPerCorner ? "corner" : "voxel") << std::endl;
+  }
+  return numErrors;
+}
+}
+
+int TestConcurrentMergePoints(int, char*[])
+{
+  // Reference: serial insertion.
+  vtkNew<vtkPoints> refPoints;
+  vtkNew<vtkMergePoints> merge;
+  merge->InitPointInsertion(refPoints, Bounds, 8 * NumberOfVoxels);
+  vtkNew<vtkCellArray> refCells;
+  for (vtkIdType voxelId = 0; voxelId < NumberOfVoxels; ++voxelId)
+  {
+    vtkIdType ids[8];
+    for (int corner = 0; corner < 8; ++corner)
+    {
+      double x[3];
+      GetCorner(voxelId, corner, x);
+      merge->InsertUniquePoint(x, ids[corner]);
+    }
+    refCells->InsertNextCell(8, ids);
+  }
+
+  int numErrors = CompareWithSerialMerge(refPoints, refCells, true);
+  numErrors += CompareWithSerialMerge(refPoints, refCells, false);
+
+  // Merged points are found, others are not.
+  double x[3] = { 0.1, 0.2, 0.3 };
+  double y[3] = { 0.15, 0.2, 0.3 };
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkConcurrentMergePoints> concurrentMerge;
+  concurrentMerge->InitPointInsertion(points, Bounds, 8);
+  vtkIdType id;
+  concurrentMerge->InsertUniquePoint(x, id);
+  if (concurrentMerge->IsInsertedPoint(x) != id || concurrentMerge->IsInsertedPoint(y) != -1)
+  {
+    std::cerr << "IsInsertedPoint failed" << std::endl;
+    ++numErrors;
+  }
+
+  return numErrors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
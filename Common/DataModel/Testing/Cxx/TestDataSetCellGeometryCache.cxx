@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check the cell bounds and centers cached by vtkDataSet, their invalidation
+// when the dataset is modified, and their use by the cell locators and by
+// vtkExtractGeometry.
+
+#include "vtkBox.h"
+#include "vtkCellArray.h"
+#include "vtkCellLocator.h"
+#include "vtkExtractGeometry.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkStaticCellLocator.h"
+#include "vtkTestUtilities.h"
+#include "vtkTransform.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <iostream>
+
+namespace
+{
+bool CheckBounds(vtkDataSet* dataSet, const std::vector<double>& cellBounds)
+{
+  if (cellBounds.size() != static_cast<size_t>(6 * dataSet->GetNumberOfCells()))
+  {
+    std::cerr << "Wrong number of cell bounds" << std::endl;
+    return false;
+  }
+  for (vtkIdType cellId = 0; cellId < dataSet->GetNumberOfCells(); ++cellId)
+  {
+    double bounds[6];
+    dataSet->GetCellBounds(cellId, bounds);
+    for (int i = 0; i < 6; ++i)
+    {
+      if (bounds[i] != cellBounds[6 * cellId + i])
+      {
+        std::cerr << "Wrong bounds for cell " << cellId << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Extract the cells inside a box with the cell bounds of the dataset, and
+// compare with the evaluation of the box at the points, that an identity
+// transform forces.
+bool CheckExtractBox(vtkDataSet* dataSet, const double bounds[6], vtkIdType expectedCells)
+{
+  vtkNew<vtkBox> box;
+  box->SetBounds(bounds);
+  vtkNew<vtkExtractGeometry> extract;
+  extract->SetInputData(dataSet);
+  extract->SetImplicitFunction(box);
+  extract->ExtractInsideOn();
+  extract->ExtractBoundaryCellsOff();
+  extract->Update();
+
+  vtkNew<vtkBox> transformedBox;
+  transformedBox->SetBounds(bounds);
+  vtkNew<vtkTransform> identity;
+  transformedBox->SetTransform(identity);
+  vtkNew<vtkExtractGeometry> reference;
+  reference->SetInputData(dataSet);
+  reference->SetImplicitFunction(transformedBox);
+  reference->ExtractInsideOn();
+  reference->ExtractBoundaryCellsOff();
+  reference->Update();
+
+  vtkUnstructuredGrid* output = extract->GetOutput();
+  if (output->GetNumberOfCells() != expectedCells ||
+    reference->GetOutput()->GetNumberOfCells() != expectedCells)
+  {
+    std::cerr << "Extracted " << output->GetNumberOfCells() << " cells with the cell bounds and "
+              << reference->GetOutput()->GetNumberOfCells() << " with the points instead of "
+              << expectedCells << std::endl;
+    return false;
+  }
+  if (!vtkTestUtilities::CompareDataObjects(output, reference->GetOutput()))
+  {
+    std::cerr << "The cells extracted with the cell bounds differ" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestDataSetCellGeometryCache(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(5, 4, 3);
+  image->SetSpacing(1.0, 1.0, 1.0);
+
+  // Computed on the first call, then shared.
+  if (image->IsCellBoundsCacheValid() || image->IsCellCentersCacheValid())
+  {
+    std::cerr << "The cache should be empty" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::shared_ptr<std::vector<double>> bounds = image->GetCellBoundsCache();
+  std::shared_ptr<std::vector<double>> centers = image->GetCellCentersCache();
+  if (!CheckBounds(image, *bounds) || !image->IsCellBoundsCacheValid() ||
+    !image->IsCellCentersCacheValid() || image->GetCellBoundsCache() != bounds ||
+    image->GetCellCentersCache() != centers)
+  {
+    std::cerr << "The cache should be valid" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType cellId = 0; cellId < image->GetNumberOfCells(); ++cellId)
+  {
+    const double* cellBounds = bounds->data() + 6 * cellId;
+    const double* center = centers->data() + 3 * cellId;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (center[i] != 0.5 * (cellBounds[2 * i] + cellBounds[2 * i + 1]))
+      {
+        std::cerr << "Wrong center for cell " << cellId << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Modifying the dataset invalidates the cache, but the previous vectors
+  // are left untouched.
+  const double previousMax = (*bounds)[1];
+  image->SetSpacing(2.0, 1.0, 1.0);
+  if (image->IsCellBoundsCacheValid() || image->IsCellCentersCacheValid())
+  {
+    std::cerr << "The cache should be invalid after a modification" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::shared_ptr<std::vector<double>> newBounds = image->GetCellBoundsCache();
+  if (newBounds == bounds || (*bounds)[1] != previousMax || !CheckBounds(image, *newBounds))
+  {
+    std::cerr << "The cache should be recomputed" << std::endl;
+    return EXIT_FAILURE;
+  }
+  image->ReleaseCellGeometryCache();
+  if (image->IsCellBoundsCacheValid())
+  {
+    std::cerr << "The cache should be released" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Locators share the cell bounds of the dataset.
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkCellArray> polys;
+  for (int j = 0; j < 10; ++j)
+  {
+    for (int i = 0; i < 10; ++i)
+    {
+      points->InsertNextPoint(i, j, 0.0);
+    }
+  }
+  for (vtkIdType j = 0; j < 9; ++j)
+  {
+    for (vtkIdType i = 0; i < 9; ++i)
+    {
+      const vtkIdType quad[4] = { i + 10 * j, i + 1 + 10 * j, i + 11 + 10 * j, i + 10 + 10 * j };
+      polys->InsertNextCell(4, quad);
+    }
+  }
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->SetPolys(polys);
+
+  vtkNew<vtkStaticCellLocator> staticLocator;
+  staticLocator->SetDataSet(polyData);
+  staticLocator->BuildLocator();
+  if (!polyData->IsCellBoundsCacheValid() ||
+    !CheckBounds(polyData, *polyData->GetCellBoundsCache()))
+  {
+    std::cerr << "vtkStaticCellLocator did not use the cache" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkCellLocator> cellLocator;
+  cellLocator->SetDataSet(polyData);
+  cellLocator->BuildLocator();
+  double x[3] = { 4.5, 2.5, 0.0 };
+  double closest[3], dist2;
+  vtkIdType cellId;
+  int subId;
+  staticLocator->FindClosestPoint(x, closest, cellId, subId, dist2);
+  vtkIdType cellId2;
+  cellLocator->FindClosestPoint(x, closest, cellId2, subId, dist2);
+  if (cellId != 22 || cellId2 != 22)
+  {
+    std::cerr << "Wrong closest cell: " << cellId << ", " << cellId2 << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // vtkExtractGeometry keeps the cells strictly inside a box, so the cells
+  // with points on the sides of the box are left out.
+  const double box[6] = { 2.0, 6.0, 1.5, 5.0, -1.0, 1.0 };
+  const double flatBox[6] = { 2.0, 6.0, 1.5, 5.0, 0.0, 1.0 };
+  const double wholeBox[6] = { -1.0, 10.0, -1.0, 10.0, -1.0, 1.0 };
+  if (!CheckExtractBox(polyData, box, 4) || !CheckExtractBox(polyData, flatBox, 0) ||
+    !CheckExtractBox(polyData, wholeBox, 81))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,230 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Build the half-edges of small triangle meshes, edit them, and check the
+// topology after each operation.
+
+#include "vtkCellArray.h"
+#include "vtkHalfEdgeMesh.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+
+#include <iostream>
+
+namespace
+{
+// Triangulated grid of Dim x Dim vertices, two triangles per quad.
+const vtkIdType Dim = 4;
+
+void MakeGrid(vtkCellArray* polys)
+{
+  for (vtkIdType j = 0; j + 1 < Dim; ++j)
+  {
+    for (vtkIdType i = 0; i + 1 < Dim; ++i)
+    {
+      const vtkIdType v0 = i + Dim * j;
+      const vtkIdType tri0[3] = { v0, v0 + 1, v0 + Dim + 1 };
+      const vtkIdType tri1[3] = { v0, v0 + Dim + 1, v0 + Dim };
+      polys->InsertNextCell(3, tri0);
+      polys->InsertNextCell(3, tri1);
+    }
+  }
+}
+
+vtkIdType CountBoundaryEdges(vtkHalfEdgeMesh* mesh)
+{
+  vtkIdType count = 0;
+  for (vtkIdType edge = 0; edge < mesh->GetNumberOfHalfEdges(); ++edge)
+  {
+    if (!mesh->IsHalfEdgeDeleted(edge) && mesh->IsBoundaryEdge(edge))
+    {
+      ++count;
+    }
+  }
+  return count;
+}
+
+vtkIdType CountFaces(vtkHalfEdgeMesh* mesh)
+{
+  vtkIdType count = 0;
+  for (vtkIdType face = 0; face < mesh->GetNumberOfFaces(); ++face)
+  {
+    count += mesh->IsFaceDeleted(face) ? 0 : 1;
+  }
+  return count;
+}
+}
+
+int TestHalfEdgeMesh(int, char*[])
+{
+  vtkNew<vtkCellArray> polys;
+  MakeGrid(polys);
+  vtkNew<vtkHalfEdgeMesh> mesh;
+  if (!mesh->BuildFromPolys(polys, Dim * Dim) || !mesh->IsValid() ||
+    mesh->GetNumberOfFaces() != 18 || mesh->GetNumberOfHalfEdges() != 54 ||
+    mesh->GetNumberOfNonManifoldEdges() != 0 || CountBoundaryEdges(mesh) != 12)
+  {
+    std::cerr << "Wrong half-edges for the grid" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Half-edges follow the connectivity of the cells.
+  if (mesh->GetFaceEdge(1) != 3 || mesh->GetOrigin(4) != 5 || mesh->GetDestination(4) != 4 ||
+    mesh->GetTwin(2) != 3)
+  {
+    std::cerr << "The half-edges do not follow the connectivity of the cells" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Vertex queries
+  vtkNew<vtkIdList> ids;
+  if (mesh->IsBoundaryVertex(5) || !mesh->IsBoundaryVertex(1))
+  {
+    std::cerr << "Wrong boundary vertices" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const vtkIdType vertices[3] = { 5, 0, 3 };
+  const vtkIdType numNeighbors[3] = { 6, 3, 2 };
+  for (int i = 0; i < 3; ++i)
+  {
+    mesh->GetVertexNeighbors(vertices[i], ids);
+    if (ids->GetNumberOfIds() != numNeighbors[i])
+    {
+      std::cerr << "Vertex " << vertices[i] << " has " << ids->GetNumberOfIds()
+                << " neighbors instead of " << numNeighbors[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (mesh->GetDestination(mesh->FindHalfEdge(5, 6)) != 6 || mesh->FindHalfEdge(0, 6) != -1)
+  {
+    std::cerr << "FindHalfEdge failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Flip the diagonal of the central quad.
+  if (!mesh->FlipEdge(mesh->FindHalfEdge(5, 10)) || !mesh->IsValid() ||
+    mesh->FindHalfEdge(5, 10) != -1 || mesh->FindHalfEdge(10, 5) != -1 ||
+    (mesh->FindHalfEdge(6, 9) < 0 && mesh->FindHalfEdge(9, 6) < 0))
+  {
+    std::cerr << "FlipEdge failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (mesh->FlipEdge(mesh->FindHalfEdge(0, 1)))
+  {
+    std::cerr << "A boundary edge was flipped" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Split a boundary edge and an interior edge.
+  const vtkIdType m0 = mesh->SplitEdge(mesh->FindHalfEdge(0, 1));
+  if (m0 != 16)
+  {
+    std::cerr << "SplitEdge returned " << m0 << " instead of 16" << std::endl;
+    return EXIT_FAILURE;
+  }
+  mesh->GetVertexNeighbors(m0, ids);
+  if (!mesh->IsValid() || CountFaces(mesh) != 19 || CountBoundaryEdges(mesh) != 13 ||
+    !mesh->IsBoundaryVertex(m0) || ids->GetNumberOfIds() != 3)
+  {
+    std::cerr << "SplitEdge failed on a boundary edge" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const vtkIdType m1 = mesh->SplitEdge(mesh->FindHalfEdge(5, 6));
+  if (m1 != 17)
+  {
+    std::cerr << "SplitEdge returned " << m1 << " instead of 17" << std::endl;
+    return EXIT_FAILURE;
+  }
+  mesh->GetVertexNeighbors(m1, ids);
+  if (!mesh->IsValid() || CountFaces(mesh) != 21 || ids->GetNumberOfIds() != 4)
+  {
+    std::cerr << "SplitEdge failed on an interior edge" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Collapse the interior edge back.
+  const vtkIdType collapsed = mesh->FindHalfEdge(5, m1);
+  if (!mesh->IsCollapsible(collapsed) || !mesh->CollapseEdge(collapsed) || !mesh->IsValid())
+  {
+    std::cerr << "CollapseEdge failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+  mesh->GetVertexNeighbors(5, ids);
+  if (CountFaces(mesh) != 19 || mesh->GetVertexEdge(m1) != -1 ||
+    mesh->GetDestination(mesh->FindHalfEdge(5, 6)) != 6 || ids->GetNumberOfIds() != 5)
+  {
+    std::cerr << "Wrong topology after CollapseEdge" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Export, and rebuild from the exported cells.
+  vtkNew<vtkCellArray> exported;
+  vtkNew<vtkIdList> faceIds;
+  mesh->ExportPolys(exported, faceIds);
+  if (exported->GetNumberOfCells() != 19 || faceIds->GetNumberOfIds() != 19)
+  {
+    std::cerr << "Wrong number of exported cells" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType cellId = 0; cellId < faceIds->GetNumberOfIds(); ++cellId)
+  {
+    if (mesh->IsFaceDeleted(faceIds->GetId(cellId)))
+    {
+      std::cerr << "Cell " << cellId << " was exported from a deleted face" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  vtkNew<vtkHalfEdgeMesh> rebuilt;
+  if (!rebuilt->BuildFromPolys(exported, mesh->GetNumberOfVertices()) || !rebuilt->IsValid() ||
+    CountBoundaryEdges(rebuilt) != 13)
+  {
+    std::cerr << "Wrong half-edges for the exported cells" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // An interior edge joining two boundary vertices cannot be collapsed.
+  vtkNew<vtkCellArray> square;
+  const vtkIdType tri0[3] = { 0, 1, 2 };
+  const vtkIdType tri1[3] = { 0, 2, 3 };
+  square->InsertNextCell(3, tri0);
+  square->InsertNextCell(3, tri1);
+  if (!mesh->BuildFromPolys(square, 4) || mesh->IsCollapsible(mesh->FindHalfEdge(0, 2)) ||
+    !mesh->IsCollapsible(mesh->FindHalfEdge(0, 1)))
+  {
+    std::cerr << "Wrong link condition" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!mesh->CollapseEdge(mesh->FindHalfEdge(0, 1)) || !mesh->IsValid() || CountFaces(mesh) != 1)
+  {
+    std::cerr << "CollapseEdge failed on a boundary edge" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Non-manifold edges have no twin.
+  vtkNew<vtkCellArray> fin;
+  const vtkIdType fin0[3] = { 0, 1, 2 };
+  const vtkIdType fin1[3] = { 1, 0, 3 };
+  const vtkIdType fin2[3] = { 0, 1, 4 };
+  fin->InsertNextCell(3, fin0);
+  fin->InsertNextCell(3, fin1);
+  fin->InsertNextCell(3, fin2);
+  if (!mesh->BuildFromPolys(fin, 5) || !mesh->IsValid() ||
+    mesh->GetNumberOfNonManifoldEdges() != 1 || mesh->GetTwin(0) != vtkHalfEdgeMesh::NON_MANIFOLD ||
+    mesh->SplitEdge(0) != -1)
+  {
+    std::cerr << "Wrong non-manifold edges" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Out of range point ids are rejected.
+  vtkObject::GlobalWarningDisplayOff();
+  const bool built = mesh->BuildFromPolys(fin, 3);
+  vtkObject::GlobalWarningDisplayOn();
+  if (built || mesh->GetNumberOfFaces() != 0)
+  {
+    std::cerr << "Out of range point ids were accepted" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check the queries of vtkKdTree, vtkKdTreePointLocator and
+// vtkOctreePointLocator built in parallel on enough points to use
+// concurrent subtrees, against brute force results.
+
+#include "vtkIdList.h"
+#include "vtkKdTree.h"
+#include "vtkKdTreePointLocator.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkOctreePointLocator.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+void BruteForceWithinRadius(
+  vtkPoints* points, double R, const double x[3], std::vector<vtkIdType>& result)
+{
+  result.clear();
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints(); ++i)
+  {
+    double p[3];
+    points->GetPoint(i, p);
+    // The locators store float coordinates.
+    float fp[3] = { static_cast<float>(p[0]), static_cast<float>(p[1]),
+      static_cast<float>(p[2]) };
+    double d2 = (fp[0] - x[0]) * (fp[0] - x[0]) + (fp[1] - x[1]) * (fp[1] - x[1]) +
+      (fp[2] - x[2]) * (fp[2] - x[2]);
+    if (d2 <= R * R)
+    {
+      result.push_back(i);
+    }
+  }
+}
+
+bool SameIds(vtkIdList* ids, std::vector<vtkIdType> expected)
+{
+  std::vector<vtkIdType> found(ids->begin(), ids->end());
+  std::sort(found.begin(), found.end());
+  std::sort(expected.begin(), expected.end());
+  return found == expected;
+}
+}
+
+int TestKdTreeParallelBuild(int, char*[])
+{
+  const vtkIdType numPts = 200000;
+  const int numQueries = 50;
+  const double R = 0.03;
+
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(3317);
+
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    double x[3];
+    for (int c = 0; c < 3; ++c)
+    {
+      x[c] = random->GetNextRangeValue(0.0, 1.0);
+    }
+    points->SetPoint(i, x);
+  }
+  vtkNew<vtkPolyData> polydata;
+  polydata->SetPoints(points);
+
+  vtkNew<vtkKdTree> kdTree;
+  kdTree->BuildLocatorFromPoints(points);
+  vtkNew<vtkKdTreePointLocator> kdLocator;
+  kdLocator->SetDataSet(polydata);
+  kdLocator->BuildLocator();
+  vtkNew<vtkOctreePointLocator> octree;
+  octree->SetDataSet(polydata);
+  octree->BuildLocator();
+
+  if (kdTree->GetNumberOfRegions() < 2 || octree->GetNumberOfLeafNodes() < 8)
+  {
+    std::cerr << "The trees were not subdivided" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  int numErrors = 0;
+  std::vector<vtkIdType> expected;
+  vtkNew<vtkIdList> ids;
+  for (int q = 0; q < numQueries && numErrors < 10; ++q)
+  {
+    double x[3], p[3], dist2;
+    for (int c = 0; c < 3; ++c)
+    {
+      x[c] = random->GetNextRangeValue(0.0, 1.0);
+    }
+
+    // Every point lies in the region containing it.
+    vtkIdType ptId = static_cast<vtkIdType>(random->GetNextRangeValue(0, numPts - 1));
+    points->GetPoint(ptId, p);
+    int region = kdTree->GetRegionContainingPoint(p[0], p[1], p[2]);
+    double bounds[6];
+    kdTree->GetRegionBounds(region, bounds);
+    if (region < 0 || p[0] < bounds[0] || p[0] > bounds[1] || p[1] < bounds[2] ||
+      p[1] > bounds[3] || p[2] < bounds[4] || p[2] > bounds[5])
+    {
+      std::cerr << "GetRegionContainingPoint failed for point " << ptId << std::endl;
+      ++numErrors;
+    }
+
+    BruteForceWithinRadius(points, R, x, expected);
+    kdTree->FindPointsWithinRadius(R, x, ids);
+    if (!SameIds(ids, expected))
+    {
+      std::cerr << "vtkKdTree::FindPointsWithinRadius mismatch for query " << q << std::endl;
+      ++numErrors;
+    }
+    kdLocator->FindPointsWithinRadius(R, x, ids);
+    if (!SameIds(ids, expected))
+    {
+      std::cerr << "vtkKdTreePointLocator::FindPointsWithinRadius mismatch for query " << q
+                << std::endl;
+      ++numErrors;
+    }
+    octree->FindPointsWithinRadius(R, x, ids);
+    if (!SameIds(ids, expected))
+    {
+      std::cerr << "vtkOctreePointLocator::FindPointsWithinRadius mismatch for query " << q
+                << std::endl;
+      ++numErrors;
+    }
+
+    // The closest point of a point of the set is itself, up to the float
+    // precision of the locators.
+    vtkIdType closest = kdTree->FindClosestPoint(p, dist2);
+    if (closest < 0 || dist2 > 1e-12)
+    {
+      std::cerr << "vtkKdTree::FindClosestPoint failed for point " << ptId << std::endl;
+      ++numErrors;
+    }
+    closest = octree->FindClosestPoint(p[0], p[1], p[2], dist2);
+    if (closest < 0 || dist2 > 1e-12)
+    {
+      std::cerr << "vtkOctreePointLocator::FindClosestPoint failed for point " << ptId
+                << std::endl;
+      ++numErrors;
+    }
+  }
+
+  // The regions grown by SetNewBounds() contain the points of the new space.
+  double newBounds[6] = { -1.0, 2.0, -1.0, 2.0, -1.0, 2.0 };
+  kdTree->SetNewBounds(newBounds);
+  const double outside[3][3] = { { -0.5, -0.5, -0.5 }, { 1.5, 1.5, 1.5 }, { -0.5, 0.5, 1.5 } };
+  for (const double* p : outside)
+  {
+    int region = kdTree->GetRegionContainingPoint(p[0], p[1], p[2]);
+    double bounds[6] = { 0.0 };
+    if (region >= 0)
+    {
+      kdTree->GetRegionBounds(region, bounds);
+    }
+    if (region < 0 || p[0] < bounds[0] || p[0] > bounds[1] || p[1] < bounds[2] ||
+      p[1] > bounds[3] || p[2] < bounds[4] || p[2] > bounds[5])
+    {
+      std::cerr << "GetRegionContainingPoint failed after SetNewBounds for (" << p[0] << ", "
+                << p[1] << ", " << p[2] << ")" << std::endl;
+      ++numErrors;
+    }
+  }
+
+  return numErrors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
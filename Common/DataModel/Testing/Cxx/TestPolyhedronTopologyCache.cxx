@@ -0,0 +1,405 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Load the polyhedra of a grid with the precomputed topology of the grid, and
+// check that they behave like polyhedra initialized from their faces only.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkMath.h"
+#include "vtkMergePoints.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyhedron.h"
+#include "vtkPolyhedronTopologyCache.h"
+#include "vtkPolyhedronUtilities.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+// A hexahedron, a cube and a warped cube as polyhedra, and a pentagonal prism.
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid()
+{
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  vtkNew<vtkPoints> points;
+  for (int cube = 0; cube < 3; ++cube)
+  {
+    for (int k = 0; k < 2; ++k)
+    {
+      for (int j = 0; j < 2; ++j)
+      {
+        for (int i = 0; i < 2; ++i)
+        {
+          const bool warped = cube == 2 && i == 1 && j == 1 && k == 1;
+          points->InsertNextPoint(2.0 * cube + i, j, warped ? 1.3 : k);
+        }
+      }
+    }
+  }
+  for (int k = 0; k < 2; ++k)
+  {
+    for (int i = 0; i < 5; ++i)
+    {
+      const double angle = 2.0 * vtkMath::Pi() * i / 5.0;
+      points->InsertNextPoint(7.0 + 0.5 * std::cos(angle), 0.5 + 0.5 * std::sin(angle), k);
+    }
+  }
+  grid->SetPoints(points);
+
+  const vtkIdType hex[8] = { 0, 1, 3, 2, 4, 5, 7, 6 };
+  grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+
+  // Point ids are listed in a different order than in the faces, so that
+  // canonical ids differ from global ids.
+  for (vtkIdType cube = 1; cube < 3; ++cube)
+  {
+    const vtkIdType o = 8 * cube;
+    const vtkIdType pts[8] = { o + 3, o + 1, o + 0, o + 2, o + 7, o + 5, o + 4, o + 6 };
+    const vtkIdType faces[30] = { 4, o + 0, o + 2, o + 3, o + 1, 4, o + 4, o + 5, o + 7, o + 6, 4,
+      o + 0, o + 1, o + 5, o + 4, 4, o + 2, o + 6, o + 7, o + 3, 4, o + 0, o + 4, o + 6, o + 2, 4,
+      o + 1, o + 3, o + 7, o + 5 };
+    grid->InsertNextCell(VTK_POLYHEDRON, 8, pts, 6, faces);
+  }
+
+  vtkIdType prism[10];
+  vtkNew<vtkIdList> prismFaces;
+  prismFaces->InsertNextId(5);
+  for (vtkIdType i = 0; i < 5; ++i)
+  {
+    prism[i] = 24 + i;
+    prism[i + 5] = 29 + i;
+    prismFaces->InsertNextId(24 + (5 - i) % 5);
+  }
+  prismFaces->InsertNextId(5);
+  for (vtkIdType i = 0; i < 5; ++i)
+  {
+    prismFaces->InsertNextId(29 + i);
+  }
+  for (vtkIdType i = 0; i < 5; ++i)
+  {
+    const vtkIdType next = (i + 1) % 5;
+    const vtkIdType quad[5] = { 4, 24 + i, 24 + next, 29 + next, 29 + i };
+    for (vtkIdType id : quad)
+    {
+      prismFaces->InsertNextId(id);
+    }
+  }
+  grid->InsertNextCell(VTK_POLYHEDRON, 10, prism, 7, prismFaces->GetPointer(0));
+
+  vtkNew<vtkDoubleArray> z;
+  z->SetName("z");
+  z->SetNumberOfTuples(points->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    z->SetValue(ptId, points->GetPoint(ptId)[2]);
+  }
+  grid->GetPointData()->SetScalars(z);
+  return grid;
+}
+
+// Contour or clip a cell at z = 0.4 and return the output cells.
+void ContourOrClip(vtkUnstructuredGrid* grid, vtkPolyhedron* cell, vtkIdType cellId, bool clip,
+  vtkCellArray* output)
+{
+  vtkNew<vtkDoubleArray> cellScalars;
+  cellScalars->SetNumberOfTuples(cell->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < cell->GetNumberOfPoints(); ++i)
+  {
+    cellScalars->SetValue(i, cell->GetPoints()->GetPoint(i)[2]);
+  }
+  vtkNew<vtkPoints> outPoints;
+  vtkNew<vtkMergePoints> locator;
+  locator->InitPointInsertion(outPoints, grid->GetBounds());
+  vtkNew<vtkPointData> outPd;
+  vtkNew<vtkCellData> outCd;
+  if (clip)
+  {
+    cell->Clip(0.4, cellScalars, locator, output, grid->GetPointData(), outPd,
+      grid->GetCellData(), cellId, outCd, 0);
+  }
+  else
+  {
+    cell->Contour(0.4, cellScalars, locator, nullptr, nullptr, output, grid->GetPointData(), outPd,
+      grid->GetCellData(), cellId, outCd);
+  }
+}
+
+bool SameCells(vtkCellArray* a, vtkCellArray* b)
+{
+  if (a->GetNumberOfCells() == 0 || a->GetNumberOfCells() != b->GetNumberOfCells() ||
+    a->GetNumberOfConnectivityIds() != b->GetNumberOfConnectivityIds())
+  {
+    std::cerr << "Different numbers of cells: " << a->GetNumberOfCells() << " and "
+              << b->GetNumberOfCells() << std::endl;
+    return false;
+  }
+  vtkNew<vtkIdTypeArray> aIds, bIds;
+  a->ExportLegacyFormat(aIds);
+  b->ExportLegacyFormat(bIds);
+  for (vtkIdType i = 0; i < aIds->GetNumberOfValues(); ++i)
+  {
+    if (aIds->GetValue(i) != bIds->GetValue(i))
+    {
+      std::cerr << "Different cells at connectivity entry " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Compare a polyhedron loaded with the topology cache to the same polyhedron
+// initialized from its faces.
+bool ComparePolyhedron(vtkUnstructuredGrid* grid, vtkIdType cellId, vtkPolyhedron* cached)
+{
+  vtkNew<vtkPolyhedron> reference;
+  reference->GetPointIds()->DeepCopy(cached->GetPointIds());
+  reference->GetPoints()->DeepCopy(cached->GetPoints());
+  reference->SetCellFaces(cached->GetCellFaces());
+  reference->Initialize();
+  if (reference->GetTopologyCache())
+  {
+    std::cerr << "The reference polyhedron uses the topology cache" << std::endl;
+    return false;
+  }
+
+  if (cached->GetNumberOfEdges() != reference->GetNumberOfEdges())
+  {
+    std::cerr << "Wrong number of edges: " << cached->GetNumberOfEdges() << std::endl;
+    return false;
+  }
+  for (int edgeId = 0; edgeId < reference->GetNumberOfEdges(); ++edgeId)
+  {
+    vtkCell* edge = reference->GetEdge(edgeId);
+    const vtkIdType p0 = edge->GetPointId(0), p1 = edge->GetPointId(1);
+    edge = cached->GetEdge(edgeId);
+    if (edge->GetPointId(0) != p0 || edge->GetPointId(1) != p1)
+    {
+      std::cerr << "Wrong edge " << edgeId << std::endl;
+      return false;
+    }
+  }
+
+  if (cached->GetNumberOfFaces() != reference->GetNumberOfFaces())
+  {
+    std::cerr << "Wrong number of faces: " << cached->GetNumberOfFaces() << std::endl;
+    return false;
+  }
+  for (int faceId = 0; faceId < reference->GetNumberOfFaces(); ++faceId)
+  {
+    vtkCell* refFace = reference->GetFace(faceId);
+    vtkNew<vtkIdList> refIds;
+    vtkNew<vtkPoints> refPoints;
+    refIds->DeepCopy(refFace->GetPointIds());
+    refPoints->DeepCopy(refFace->GetPoints());
+    vtkCell* face = cached->GetFace(faceId);
+    if (face->GetNumberOfPoints() != refIds->GetNumberOfIds() ||
+      cached->IsFacePlanar(faceId) != reference->IsFacePlanar(faceId))
+    {
+      std::cerr << "Wrong face " << faceId << std::endl;
+      return false;
+    }
+    for (vtkIdType i = 0; i < refIds->GetNumberOfIds(); ++i)
+    {
+      double x[3], y[3];
+      face->GetPoints()->GetPoint(i, x);
+      refPoints->GetPoint(i, y);
+      if (face->GetPointId(i) != refIds->GetId(i) || vtkMath::Distance2BetweenPoints(x, y) != 0.0)
+      {
+        std::cerr << "Wrong point " << i << " of face " << faceId << std::endl;
+        return false;
+      }
+    }
+  }
+
+  for (vtkIdType ptId = 0; ptId < reference->GetNumberOfPoints(); ++ptId)
+  {
+    const vtkIdType *refFaces, *faces;
+    const vtkIdType numFaces = reference->GetPointToIncidentFaces(ptId, refFaces);
+    if (cached->GetPointToIncidentFaces(ptId, faces) != numFaces)
+    {
+      std::cerr << "Wrong number of faces incident to point " << ptId << std::endl;
+      return false;
+    }
+    for (vtkIdType i = 0; i < numFaces; ++i)
+    {
+      if (faces[i] != refFaces[i])
+      {
+        std::cerr << "Wrong faces incident to point " << ptId << std::endl;
+        return false;
+      }
+    }
+  }
+
+  double x[3] = { 0.0, 0.0, 0.0 };
+  for (vtkIdType i = 0; i < reference->GetNumberOfPoints(); ++i)
+  {
+    double p[3];
+    reference->GetPoints()->GetPoint(i, p);
+    vtkMath::Add(x, p, x);
+  }
+  vtkMath::MultiplyScalar(x, 1.0 / reference->GetNumberOfPoints());
+  if (cached->IsInside(x, 1e-6) != 1 || reference->IsInside(x, 1e-6) != 1)
+  {
+    std::cerr << "The center is not inside" << std::endl;
+    return false;
+  }
+
+  for (bool clip : { false, true })
+  {
+    vtkNew<vtkCellArray> refOutput, output;
+    ContourOrClip(grid, reference, cellId, clip, refOutput);
+    ContourOrClip(grid, cached, cellId, clip, output);
+    if (!SameCells(refOutput, output))
+    {
+      std::cerr << (clip ? "Clip" : "Contour") << " differs" << std::endl;
+      return false;
+    }
+  }
+
+  auto refTetras = vtkPolyhedronUtilities::Decompose(
+    reference, grid->GetPointData(), cellId, grid->GetCellData());
+  auto tetras =
+    vtkPolyhedronUtilities::Decompose(cached, grid->GetPointData(), cellId, grid->GetCellData());
+  if (!refTetras || !tetras || refTetras->GetNumberOfPoints() != tetras->GetNumberOfPoints() ||
+    !SameCells(refTetras->GetCells(), tetras->GetCells()))
+  {
+    std::cerr << "Decompose differs" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestCache()
+{
+  auto grid = MakeGrid();
+  vtkSmartPointer<vtkPolyhedronTopologyCache> cache = grid->GetPolyhedronTopologyCache();
+  if (!cache || !cache->IsUpToDate(grid) || cache->GetNumberOfCells() != 4 ||
+    cache->GetNumberOfFaces(0) != 0 || cache->GetNumberOfFaces(1) != 6 ||
+    cache->GetNumberOfFaces(3) != 7)
+  {
+    std::cerr << "Wrong topology cache for the grid" << std::endl;
+    return false;
+  }
+
+  // Faces in canonical ids: global point 8 is the third point of cell 1.
+  const vtkIdType* pts;
+  if (cache->GetFace(1, 0, pts) != 4 || pts[0] != 2 || pts[1] != 3 || pts[2] != 0 || pts[3] != 1)
+  {
+    std::cerr << "Wrong canonical ids of the first face of cell 1" << std::endl;
+    return false;
+  }
+
+  const vtkIdType *edges, *edgeFaces;
+  if (cache->GetEdges(1, edges, edgeFaces) != 12)
+  {
+    std::cerr << "Wrong number of edges of cell 1" << std::endl;
+    return false;
+  }
+  for (vtkIdType edge = 0; edge < 12; ++edge)
+  {
+    if (edgeFaces[2 * edge] < 0 || edgeFaces[2 * edge + 1] <= edgeFaces[2 * edge])
+    {
+      std::cerr << "Wrong faces of edge " << edge << " of cell 1" << std::endl;
+      return false;
+    }
+  }
+  const vtkIdType* tris;
+  if (cache->GetEdges(3, edges, edgeFaces) != 15 || cache->GetFaceTriangles(3, 0, tris) != 3 ||
+    cache->GetFaceTriangles(1, 5, tris) != 2)
+  {
+    std::cerr << "Wrong edges or face triangles" << std::endl;
+    return false;
+  }
+
+  // The faces of the warped cube using its lifted point are not planar.
+  const bool planar[6] = { true, false, true, false, true, false };
+  for (vtkIdType faceId = 0; faceId < 6; ++faceId)
+  {
+    if (!cache->IsFacePlanar(1, faceId) || cache->IsFacePlanar(2, faceId) != planar[faceId])
+    {
+      std::cerr << "Wrong planarity of face " << faceId << std::endl;
+      return false;
+    }
+  }
+
+  vtkNew<vtkGenericCell> cell;
+  for (vtkIdType cellId = 1; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    grid->GetCell(cellId, cell);
+    vtkPolyhedron* polyhedron = vtkPolyhedron::SafeDownCast(cell->GetRepresentativeCell());
+    if (!polyhedron || polyhedron->GetTopologyCache() != cache)
+    {
+      std::cerr << "Polyhedron " << cellId << " does not use the topology cache" << std::endl;
+      return false;
+    }
+    if (!ComparePolyhedron(grid, cellId, polyhedron))
+    {
+      std::cerr << "Polyhedron " << cellId << " differs from its reference" << std::endl;
+      return false;
+    }
+  }
+
+  // The cache follows the modifications of the grid, and a copy of the
+  // structure shares it.
+  grid->GetPoints()->SetPoint(0, -0.5, 0.0, 0.0);
+  grid->GetPoints()->Modified();
+  if (cache->IsUpToDate(grid))
+  {
+    std::cerr << "The cache is up to date after modifying the points" << std::endl;
+    return false;
+  }
+  vtkPolyhedronTopologyCache* rebuilt = grid->GetPolyhedronTopologyCache();
+  vtkNew<vtkUnstructuredGrid> copy;
+  copy->CopyStructure(grid);
+  if (!rebuilt || rebuilt == cache || !rebuilt->IsUpToDate(grid) ||
+    copy->GetPolyhedronTopologyCache() != rebuilt)
+  {
+    std::cerr << "The cache was not rebuilt, or is not shared by a copy" << std::endl;
+    return false;
+  }
+
+  // A polyhedron initialized again, e.g. after setting its faces by hand,
+  // no longer uses the cache, nor does a polyhedron whose faces do not match.
+  grid->GetCell(1, cell);
+  vtkPolyhedron* loaded = vtkPolyhedron::SafeDownCast(cell->GetRepresentativeCell());
+  if (!loaded || loaded->GetTopologyCache() != rebuilt)
+  {
+    std::cerr << "The polyhedron does not use the rebuilt cache" << std::endl;
+    return false;
+  }
+  loaded->Initialize();
+  vtkNew<vtkPolyhedron> empty;
+  empty->SetTopologyCache(rebuilt, 1);
+  empty->Initialize();
+  if (loaded->GetTopologyCache() || empty->GetTopologyCache())
+  {
+    std::cerr << "An initialized polyhedron still uses the cache" << std::endl;
+    return false;
+  }
+
+  // Grids without polyhedra have no cache.
+  vtkNew<vtkUnstructuredGrid> hexGrid;
+  hexGrid->SetPoints(grid->GetPoints());
+  const vtkIdType hex[8] = { 0, 1, 3, 2, 4, 5, 7, 6 };
+  hexGrid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+  if (hexGrid->GetPolyhedronTopologyCache())
+  {
+    std::cerr << "A grid without polyhedra has a topology cache" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestPolyhedronTopologyCache(int, char*[])
+{
+  return TestCache() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
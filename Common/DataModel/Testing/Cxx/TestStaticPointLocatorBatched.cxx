@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compare the batched queries of vtkStaticPointLocator with their single
+// point counterparts.
+
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkStaticPointLocator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+bool SameIds(vtkIdList* expected, const vtkIdType* ids, vtkIdType numIds, bool sorted)
+{
+  if (expected->GetNumberOfIds() != numIds)
+  {
+    return false;
+  }
+  std::vector<vtkIdType> a(expected->begin(), expected->end());
+  std::vector<vtkIdType> b(ids, ids + numIds);
+  if (!sorted)
+  {
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+  }
+  return a == b;
+}
+
+bool SameDistance(double a, double b)
+{
+  return std::abs(a - b) <= 1e-12 * std::max(1.0, std::abs(b));
+}
+}
+
+int TestStaticPointLocatorBatched(int, char*[])
+{
+  const vtkIdType numPts = 20000;
+  const vtkIdType numQueries = 2000;
+  const int N = 8;
+  const double R = 0.05;
+
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1177);
+
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    double x[3];
+    for (int c = 0; c < 3; ++c)
+    {
+      x[c] = random->GetNextRangeValue(0.0, 1.0);
+    }
+    points->SetPoint(i, x);
+  }
+  vtkNew<vtkPolyData> polydata;
+  polydata->SetPoints(points);
+
+  // Queries partly lie outside the bounds of the points; use floats to
+  // exercise the conversion of the query points.
+  vtkNew<vtkFloatArray> queries;
+  queries->SetNumberOfComponents(3);
+  queries->SetNumberOfTuples(numQueries);
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    for (int c = 0; c < 3; ++c)
+    {
+      queries->SetTypedComponent(i, c, static_cast<float>(random->GetNextRangeValue(-0.2, 1.2)));
+    }
+  }
+
+  vtkNew<vtkStaticPointLocator> locator;
+  locator->SetDataSet(polydata);
+  locator->BuildLocator();
+
+  vtkNew<vtkIdTypeArray> offsets;
+  vtkNew<vtkIdTypeArray> ids;
+  vtkNew<vtkDoubleArray> dist2;
+  vtkNew<vtkIdList> expected;
+  int numErrors = 0;
+
+  locator->FindClosestPoints(queries, ids, dist2);
+  for (vtkIdType i = 0; i < numQueries && numErrors < 10; ++i)
+  {
+    double q[3], p[3];
+    queries->GetTuple(i, q);
+    vtkIdType closest = locator->FindClosestPoint(q);
+    points->GetPoint(closest, p);
+    if (!SameDistance(dist2->GetValue(i), vtkMath::Distance2BetweenPoints(q, p)))
+    {
+      std::cerr << "FindClosestPoints mismatch for query " << i << std::endl;
+      ++numErrors;
+    }
+  }
+
+  locator->FindClosestNPoints(N, queries, offsets, ids, dist2);
+  if (offsets->GetNumberOfValues() != numQueries + 1 ||
+    ids->GetNumberOfValues() != N * numQueries || dist2->GetNumberOfValues() != N * numQueries)
+  {
+    std::cerr << "FindClosestNPoints returned wrongly sized arrays" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType i = 0; i < numQueries && numErrors < 10; ++i)
+  {
+    double q[3];
+    queries->GetTuple(i, q);
+    locator->FindClosestNPoints(N, q, expected);
+    vtkIdType offset = offsets->GetValue(i);
+    if (offset != i * N || !SameIds(expected, ids->GetPointer(offset), N, false))
+    {
+      std::cerr << "FindClosestNPoints mismatch for query " << i << std::endl;
+      ++numErrors;
+    }
+    for (vtkIdType k = offset + 1; k < offset + N; ++k)
+    {
+      if (dist2->GetValue(k) < dist2->GetValue(k - 1))
+      {
+        std::cerr << "FindClosestNPoints results are not sorted for query " << i << std::endl;
+        ++numErrors;
+        break;
+      }
+    }
+  }
+
+  locator->FindPointsWithinRadius(R, queries, offsets, ids, dist2);
+  if (offsets->GetNumberOfValues() != numQueries + 1 ||
+    ids->GetNumberOfValues() != offsets->GetValue(numQueries) ||
+    dist2->GetNumberOfValues() != ids->GetNumberOfValues())
+  {
+    std::cerr << "FindPointsWithinRadius returned wrongly sized arrays" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType i = 0; i < numQueries && numErrors < 10; ++i)
+  {
+    double q[3], p[3];
+    queries->GetTuple(i, q);
+    locator->FindPointsWithinRadius(R, q, expected);
+    vtkIdType offset = offsets->GetValue(i);
+    vtkIdType numIds = offsets->GetValue(i + 1) - offset;
+    if (!SameIds(expected, ids->GetPointer(offset), numIds, false))
+    {
+      std::cerr << "FindPointsWithinRadius mismatch for query " << i << std::endl;
+      ++numErrors;
+    }
+    for (vtkIdType k = offset; k < offset + numIds; ++k)
+    {
+      points->GetPoint(ids->GetValue(k), p);
+      if (!SameDistance(dist2->GetValue(k), vtkMath::Distance2BetweenPoints(q, p)))
+      {
+        std::cerr << "FindPointsWithinRadius distance mismatch for query " << i << std::endl;
+        ++numErrors;
+        break;
+      }
+    }
+  }
+
+  return numErrors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
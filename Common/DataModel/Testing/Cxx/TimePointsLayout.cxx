@@ -0,0 +1,279 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compare the geometric kernels on points stored in the array-of-structs and
+// struct-of-arrays layouts: the results must be identical, and the timings of
+// both layouts are reported.
+
+#include "vtkBoundingBox.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPlane.h"
+#include "vtkPoints.h"
+#include "vtkSOADataArrayTemplate.h"
+#include "vtkSphere.h"
+#include "vtkTimerLog.h"
+#include "vtkTransform.h"
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+const vtkIdType NumberOfPoints = 1000000;
+const int NumberOfRuns = 10;
+
+bool SameTuples(vtkDataArray* a, vtkDataArray* b)
+{
+  if (a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents())
+  {
+    std::cerr << "The arrays have different sizes" << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int comp = 0; comp < a->GetNumberOfComponents(); ++comp)
+    {
+      if (a->GetComponent(i, comp) != b->GetComponent(i, comp))
+      {
+        std::cerr << "The arrays differ at tuple " << i << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameBounds(const double a[6], const double b[6])
+{
+  for (int i = 0; i < 6; ++i)
+  {
+    if (a[i] != b[i])
+    {
+      std::cerr << "The bounds differ at index " << i << ": " << a[i] << " != " << b[i]
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Run the kernels on both layouts of points of the given type.
+bool TestLayouts(int dataType)
+{
+  vtkNew<vtkPoints> aos;
+  aos->SetDataType(dataType);
+  aos->SetNumberOfPoints(NumberOfPoints);
+  vtkMath::RandomSeed(8775070);
+  for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+  {
+    aos->SetPoint(i, vtkMath::Random(-1, 1), vtkMath::Random(-2, 2), vtkMath::Random(-3, 3));
+  }
+  vtkNew<vtkPoints> soa;
+  soa->DeepCopy(aos);
+  soa->SetDataLayoutToSOA();
+  if (aos->GetDataLayout() != vtkPoints::AOS_LAYOUT ||
+    soa->GetDataLayout() != vtkPoints::SOA_LAYOUT || soa->GetDataType() != dataType ||
+    soa->GetData()->GetArrayType() != vtkAbstractArray::SoADataArrayTemplate ||
+    std::string(soa->GetData()->GetName()) != "Points")
+  {
+    std::cerr << "Wrong points after SetDataLayoutToSOA" << std::endl;
+    return false;
+  }
+  if (!SameTuples(aos->GetData(), soa->GetData()))
+  {
+    return false;
+  }
+
+  std::cout << "\n=== " << (dataType == VTK_FLOAT ? "float" : "double") << " points, "
+            << NumberOfPoints << " points, " << NumberOfRuns << " runs (AOS / SOA) ===\n";
+  vtkPoints* layouts[2] = { aos, soa };
+  double times[2];
+  vtkNew<vtkTimerLog> timer;
+
+  // Bounds
+  double bounds[2][6];
+  for (int layout = 0; layout < 2; ++layout)
+  {
+    timer->StartTimer();
+    for (int run = 0; run < NumberOfRuns; ++run)
+    {
+      layouts[layout]->Modified();
+      layouts[layout]->GetBounds(bounds[layout]);
+    }
+    timer->StopTimer();
+    times[layout] = timer->GetElapsedTime();
+  }
+  std::cout << "vtkPoints::GetBounds: " << times[0] << " / " << times[1] << "\n";
+  if (!SameBounds(bounds[0], bounds[1]))
+  {
+    return false;
+  }
+  if (bounds[0][0] < -1 || bounds[0][1] > 1 || bounds[0][4] < -3 || bounds[0][5] > 3)
+  {
+    std::cerr << "The bounds are larger than the points" << std::endl;
+    return false;
+  }
+
+  for (int layout = 0; layout < 2; ++layout)
+  {
+    timer->StartTimer();
+    for (int run = 0; run < NumberOfRuns; ++run)
+    {
+      vtkBoundingBox::ComputeBounds(layouts[layout], bounds[layout]);
+    }
+    timer->StopTimer();
+    times[layout] = timer->GetElapsedTime();
+  }
+  std::cout << "vtkBoundingBox::ComputeBounds: " << times[0] << " / " << times[1] << "\n";
+  if (!SameBounds(bounds[0], bounds[1]))
+  {
+    return false;
+  }
+
+  // Implicit functions
+  vtkNew<vtkPlane> plane;
+  plane->SetOrigin(0.1, 0.2, 0.3);
+  plane->SetNormal(1.0, 2.0, 3.0);
+  vtkNew<vtkSphere> sphere;
+  sphere->SetRadius(0.5);
+  vtkImplicitFunction* functions[2] = { plane, sphere };
+  for (vtkImplicitFunction* function : functions)
+  {
+    vtkNew<vtkDoubleArray> values[2];
+    for (int layout = 0; layout < 2; ++layout)
+    {
+      values[layout]->SetNumberOfTuples(NumberOfPoints);
+      timer->StartTimer();
+      for (int run = 0; run < NumberOfRuns; ++run)
+      {
+        function->EvaluateFunction(layouts[layout]->GetData(), values[layout]);
+      }
+      timer->StopTimer();
+      times[layout] = timer->GetElapsedTime();
+    }
+    std::cout << function->GetClassName() << "::EvaluateFunction: " << times[0] << " / "
+              << times[1] << "\n";
+    if (!SameTuples(values[0], values[1]))
+    {
+      return false;
+    }
+  }
+
+  // Linear transform, the output points having the layout of the input
+  vtkNew<vtkTransform> transform;
+  transform->Translate(1.0, 2.0, 3.0);
+  transform->RotateWXYZ(30.0, 1.0, 1.0, 0.0);
+  transform->Scale(2.0, 0.5, 1.0);
+  vtkNew<vtkPoints> transformed[2];
+  for (int layout = 0; layout < 2; ++layout)
+  {
+    transformed[layout]->SetDataType(dataType);
+    transformed[layout]->SetDataLayout(layouts[layout]->GetDataLayout());
+    timer->StartTimer();
+    for (int run = 0; run < NumberOfRuns; ++run)
+    {
+      transformed[layout]->Reset();
+      transform->TransformPoints(layouts[layout], transformed[layout]);
+    }
+    timer->StopTimer();
+    times[layout] = timer->GetElapsedTime();
+  }
+  std::cout << "vtkTransform::TransformPoints: " << times[0] << " / " << times[1] << "\n";
+  if (transformed[1]->GetDataLayout() != vtkPoints::SOA_LAYOUT)
+  {
+    std::cerr << "The transformed points do not keep the SOA layout" << std::endl;
+    return false;
+  }
+  if (!SameTuples(transformed[0]->GetData(), transformed[1]->GetData()))
+  {
+    return false;
+  }
+
+  // Mixed layouts, and points appended after existing ones
+  vtkNew<vtkPoints> mixed;
+  mixed->SetDataType(dataType);
+  mixed->SetDataLayoutToSOA();
+  mixed->InsertNextPoint(0.0, 0.0, 0.0);
+  transform->TransformPoints(aos, mixed);
+  double x[3], y[3];
+  transformed[0]->GetPoint(NumberOfPoints - 1, x);
+  mixed->GetPoint(NumberOfPoints, y);
+  if (mixed->GetNumberOfPoints() != NumberOfPoints + 1 || mixed->GetPoint(0)[0] != 0.0 ||
+    x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+  {
+    std::cerr << "Wrong points transformed from the AOS layout to the SOA layout" << std::endl;
+    return false;
+  }
+
+  // Back to the default layout
+  soa->SetDataLayoutToAOS();
+  if (soa->GetDataLayout() != vtkPoints::AOS_LAYOUT)
+  {
+    std::cerr << "Wrong layout after SetDataLayoutToAOS" << std::endl;
+    return false;
+  }
+  return SameTuples(aos->GetData(), soa->GetData());
+}
+
+bool TestLayoutChanges()
+{
+  // The layout is kept when the type changes.
+  vtkNew<vtkPoints> points;
+  points->SetDataLayoutToSOA();
+  points->SetDataTypeToDouble();
+  if (points->GetDataLayout() != vtkPoints::SOA_LAYOUT ||
+    !vtkSOADataArrayTemplate<double>::FastDownCast(points->GetData()))
+  {
+    std::cerr << "The layout is not kept when the type changes" << std::endl;
+    return false;
+  }
+  points->InsertNextPoint(1.0, 2.0, 3.0);
+  points->InsertNextPoint(-1.0, 0.0, 5.0);
+  const double expected[6] = { -1.0, 1.0, 0.0, 2.0, 3.0, 5.0 };
+  if (!SameBounds(points->GetBounds(), expected))
+  {
+    return false;
+  }
+
+  // Points of the SOA layout stored as array-of-structs by GetVoidPointer().
+  vtkObject::GlobalWarningDisplayOff();
+  points->GetVoidPointer(0);
+  vtkObject::GlobalWarningDisplayOn();
+  if (vtkSOADataArrayTemplate<double>::FastDownCast(points->GetData())->HasComponentArrays())
+  {
+    std::cerr << "GetVoidPointer() did not switch to array-of-structs storage" << std::endl;
+    return false;
+  }
+  points->InsertNextPoint(0.0, 4.0, 4.0);
+  double bounds[6];
+  const double expected2[6] = { -1.0, 1.0, 0.0, 4.0, 3.0, 5.0 };
+  vtkBoundingBox::ComputeBounds(points, bounds);
+  if (!SameBounds(bounds, expected2) || !SameBounds(points->GetBounds(), expected2))
+  {
+    return false;
+  }
+
+  // Only float and double points have a SOA layout.
+  vtkNew<vtkPoints> intPoints;
+  intPoints->SetDataTypeToInt();
+  vtkObject::GlobalWarningDisplayOff();
+  intPoints->SetDataLayoutToSOA();
+  vtkObject::GlobalWarningDisplayOn();
+  if (intPoints->GetDataLayout() != vtkPoints::AOS_LAYOUT)
+  {
+    std::cerr << "Integer points have a SOA layout" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TimePointsLayout(int, char*[])
+{
+  return TestLayouts(VTK_FLOAT) && TestLayouts(VTK_DOUBLE) && TestLayoutChanges() ? EXIT_SUCCESS
+                                                                                   : EXIT_FAILURE;
+}
@@ -5,11 +5,20 @@
 // .SECTION Description
 // this program tests vtkUnstructuredGrid
 
+#include "vtkCellArray.h"
+#include "vtkCellIterator.h"
+#include "vtkCellType.h"
+#include "vtkIdTypeArray.h"
 #include "vtkLogger.h"
 #include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <atomic>
+
 int otherUnstructuredGrid(int, char*[])
 {
   int retVal = EXIT_SUCCESS;
@@ -33,5 +42,103 @@ int otherUnstructuredGrid(int, char*[])
     retVal = EXIT_FAILURE;
   }
 
+  // A grid of tetrahedra stores neither offsets nor cell types.
+  vtkNew<vtkPoints> points;
+  points->InsertNextPoint(0.0, 0.0, 0.0);
+  points->InsertNextPoint(1.0, 0.0, 0.0);
+  points->InsertNextPoint(0.0, 1.0, 0.0);
+  points->InsertNextPoint(0.0, 0.0, 1.0);
+  points->InsertNextPoint(1.0, 1.0, 1.0);
+  vtkNew<vtkIdTypeArray> conn;
+  for (vtkIdType id : { 0, 1, 2, 3, 1, 2, 3, 4 })
+  {
+    conn->InsertNextValue(id);
+  }
+  vtkNew<vtkCellArray> tets;
+  tets->SetFixedSizeData(4, conn);
+  vtkNew<vtkUnstructuredGrid> tetGrid;
+  tetGrid->SetPoints(points);
+  tetGrid->SetCells(VTK_TETRA, tets);
+  vtkNew<vtkIdTypeArray> ids;
+  tetGrid->GetIdsOfCellsOfType(VTK_TETRA, ids);
+  if (tetGrid->GetConstantCellType() != VTK_TETRA || !tets->IsStorageFixedSize() ||
+    tetGrid->GetCellType(1) != VTK_TETRA || !tetGrid->IsHomogeneous() ||
+    tetGrid->GetCell(1)->GetPointId(3) != 4 || ids->GetNumberOfValues() != 2 ||
+    tetGrid->GetDistinctCellTypesArray()->GetNumberOfValues() != 1)
+  {
+    vtkLog(ERROR, "Unexpected results on a grid with a constant cell type");
+    retVal = EXIT_FAILURE;
+  }
+
+  vtkIdType numCells = 0;
+  auto iter = vtkSmartPointer<vtkCellIterator>::Take(tetGrid->NewCellIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextCell(), ++numCells)
+  {
+    if (iter->GetCellType() != VTK_TETRA || iter->GetNumberOfPoints() != 4)
+    {
+      vtkLog(ERROR, "Unexpected cell from the cell iterator");
+      retVal = EXIT_FAILURE;
+    }
+  }
+  if (numCells != 2 || tetGrid->GetConstantCellType() != VTK_TETRA)
+  {
+    vtkLog(ERROR, "The cell iterator should not create the cell types array");
+    retVal = EXIT_FAILURE;
+  }
+
+  // Concurrent calls share the cell types array created on demand.
+  std::atomic<int> wrongTypes(0);
+  vtkUnstructuredGrid* tetGridPtr = tetGrid;
+  vtkSMPTools::For(0, 64,
+    [tetGridPtr, &wrongTypes](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        vtkUnsignedCharArray* cellTypes = tetGridPtr->GetCellTypesArray();
+        if (cellTypes->GetNumberOfValues() != 2 || cellTypes->GetValue(1) != VTK_TETRA)
+        {
+          ++wrongTypes;
+        }
+      }
+    });
+  if (wrongTypes != 0 || tetGrid->GetCellTypesArray() != tetGrid->GetCellTypesArray() ||
+    tetGrid->GetConstantCellType() != VTK_TETRA)
+  {
+    vtkLog(ERROR, "Unexpected cell types array on a grid with a constant cell type");
+    retVal = EXIT_FAILURE;
+  }
+
+  // Inserting a cell of another type creates the cell types array.
+  const vtkIdType triangle[3] = { 0, 1, 2 };
+  tetGrid->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+  vtkUnsignedCharArray* types = tetGrid->GetCellTypesArray();
+  if (tetGrid->GetConstantCellType() != -1 || types->GetNumberOfValues() != 3 ||
+    types->GetValue(0) != VTK_TETRA || tetGrid->GetCellType(2) != VTK_TRIANGLE ||
+    tetGrid->IsHomogeneous() || tetGrid->GetCellSize(2) != 3)
+  {
+    vtkLog(ERROR, "Unexpected results after inserting a cell of another type");
+    retVal = EXIT_FAILURE;
+  }
+
+  // Reset() goes back to an empty cell types array.
+  vtkNew<vtkIdTypeArray> resetConn;
+  for (vtkIdType id : { 0, 1, 2, 3 })
+  {
+    resetConn->InsertNextValue(id);
+  }
+  vtkNew<vtkCellArray> resetTets;
+  resetTets->SetFixedSizeData(4, resetConn);
+  tetGrid->SetCells(VTK_TETRA, resetTets);
+  tetGrid->GetCellTypesArray();
+  tetGrid->Reset();
+  tetGrid->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+  types = tetGrid->GetCellTypesArray();
+  if (tetGrid->GetConstantCellType() != -1 || tetGrid->GetNumberOfCells() != 1 ||
+    types->GetNumberOfValues() != 1 || types->GetValue(0) != VTK_TRIANGLE)
+  {
+    vtkLog(ERROR, "Unexpected results after resetting a grid with a constant cell type");
+    retVal = EXIT_FAILURE;
+  }
+
   return retVal;
 }
@@ -13,7 +13,6 @@
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
-#include "vtkSMPTools.h"
 #include "vtkUnstructuredGrid.h"
 
 //------------------------------------------------------------------------------
@@ -43,21 +42,9 @@ bool vtkAbstractCellLocator::StoreCellBounds()
   {
     return false;
   }
-  // Allocate space for cell bounds storage, then fill
-  vtkIdType numCells = this->DataSet->GetNumberOfCells();
-  this->CellBoundsSharedPtr = std::make_shared<std::vector<double>>(numCells * 6);
+  // Share the cell bounds cached by the dataset, computed if needed.
+  this->CellBoundsSharedPtr = this->DataSet->GetCellBoundsCache();
   this->CellBounds = this->CellBoundsSharedPtr->data();
-
-  // This is done to cause non-thread safe initialization to occur due to
-  // side effects from GetCellBounds().
-  this->DataSet->GetCellBounds(0, &this->CellBounds[0]);
-
-  vtkSMPTools::For(1, numCells, [&](vtkIdType begin, vtkIdType end) {
-    for (vtkIdType cellId = begin; cellId < end; cellId++)
-    {
-      this->DataSet->GetCellBounds(cellId, &this->CellBounds[cellId * 6]);
-    }
-  });
   return true;
 }
 
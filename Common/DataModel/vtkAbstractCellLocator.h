@@ -307,11 +307,11 @@ protected:
 
   ///@{
   /**
-   * This command is used internally by the locator to copy
-   * all cell Bounds into the internal CellBounds array. Subsequent
-   * calls to InsideCellBounds(...) can make use of the data
-   * A valid dataset must be present for this to work. Returns true
-   * if bounds wre copied, false otherwise.
+   * This command is used internally by the locator to share the cell
+   * bounds cached by the dataset (see vtkDataSet::GetCellBoundsCache()) in
+   * the internal CellBounds array. Subsequent calls to InsideCellBounds(...)
+   * can make use of the data. A valid dataset must be present for this to
+   * work. Returns true if bounds were stored, false otherwise.
    */
   virtual bool StoreCellBounds();
   virtual void FreeCellBounds();
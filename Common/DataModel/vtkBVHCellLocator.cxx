@@ -0,0 +1,1279 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkBVHCellLocator.h"
+
+#include "vtkBox.h"
+#include "vtkCellArray.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMath.h"
+#include "vtkMortonCode.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkBVHCellLocator);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// The number of rays traversed together by IntersectWithLines().
+constexpr int VTK_BVH_PACKET_SIZE = 8;
+
+// Ranges of cells larger than this are processed with vtkSMPTools while
+// building the top levels of the hierarchy.
+constexpr vtkIdType VTK_BVH_PARALLEL_RANGE = 65536;
+
+//------------------------------------------------------------------------------
+// A node of the hierarchy. The two children of an interior node are stored
+// next to each other; the cells of a leaf are a contiguous range of the
+// sorted cell ids.
+struct BVHNode
+{
+  double Bounds[6];
+  vtkIdType Index; // first child (interior node) or first cell (leaf)
+  vtkIdType Count; // number of cells of a leaf, 0 for an interior node
+  int Axis;        // split axis of an interior node
+
+  bool IsLeaf() const { return this->Count > 0; }
+};
+
+//------------------------------------------------------------------------------
+void InitializeBounds(double* b)
+{
+  b[0] = b[2] = b[4] = VTK_DOUBLE_MAX;
+  b[1] = b[3] = b[5] = -VTK_DOUBLE_MAX;
+}
+
+void AddBounds(double* b, const double* other)
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    b[2 * i] = std::min(b[2 * i], other[2 * i]);
+    b[2 * i + 1] = std::max(b[2 * i + 1], other[2 * i + 1]);
+  }
+}
+
+// The cost metric of a box used by the surface area heuristic: half its
+// area, or half its perimeter for the nodes whose cells are all flat along
+// two axes (e.g., collinear lines).
+double BoxMetric(const double* b, bool perimeter)
+{
+  double dx = std::max(b[1] - b[0], 0.0);
+  double dy = std::max(b[3] - b[2], 0.0);
+  double dz = std::max(b[5] - b[4], 0.0);
+  return perimeter ? dx + dy + dz : dx * dy + dy * dz + dz * dx;
+}
+
+double Distance2ToBounds(const double x[3], const double bounds[6])
+{
+  double deltas[3];
+  deltas[0] = x[0] < bounds[0] ? bounds[0] - x[0] : (x[0] > bounds[1] ? x[0] - bounds[1] : 0.0);
+  deltas[1] = x[1] < bounds[2] ? bounds[2] - x[1] : (x[1] > bounds[3] ? x[1] - bounds[3] : 0.0);
+  deltas[2] = x[2] < bounds[4] ? bounds[4] - x[2] : (x[2] > bounds[5] ? x[2] - bounds[5] : 0.0);
+  return vtkMath::SquaredNorm(deltas);
+}
+
+//------------------------------------------------------------------------------
+// Accumulate the bounds of the cells ids[beg,end), and the bounds of their
+// centers, into b[0,6) and b[6,12).
+void AccumulateBounds(
+  const double* cellBounds, const vtkIdType* ids, vtkIdType beg, vtkIdType end, double* b)
+{
+  for (; beg < end; ++beg)
+  {
+    const double* cb = cellBounds + 6 * ids[beg];
+    AddBounds(b, cb);
+    for (int i = 0; i < 3; ++i)
+    {
+      double c = 0.5 * (cb[2 * i] + cb[2 * i + 1]);
+      b[6 + 2 * i] = std::min(b[6 + 2 * i], c);
+      b[7 + 2 * i] = std::max(b[7 + 2 * i], c);
+    }
+  }
+}
+
+struct BoundsFunctor
+{
+  const double* CellBounds;
+  const vtkIdType* Ids;
+  vtkSMPThreadLocal<std::array<double, 12>> Local;
+  double Result[12];
+
+  BoundsFunctor(const double* cellBounds, const vtkIdType* ids)
+    : CellBounds(cellBounds)
+    , Ids(ids)
+  {
+    InitializeBounds(this->Result);
+    InitializeBounds(this->Result + 6);
+  }
+
+  void Initialize()
+  {
+    std::array<double, 12>& b = this->Local.Local();
+    InitializeBounds(b.data());
+    InitializeBounds(b.data() + 6);
+  }
+
+  void operator()(vtkIdType beg, vtkIdType end)
+  {
+    AccumulateBounds(this->CellBounds, this->Ids, beg, end, this->Local.Local().data());
+  }
+
+  void Reduce()
+  {
+    for (const auto& b : this->Local)
+    {
+      AddBounds(this->Result, b.data());
+      AddBounds(this->Result + 6, b.data() + 6);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+// The SAH bins of the three axes: the number of cells whose center falls in
+// each bin, and the bounds of these cells.
+struct BVHBins
+{
+  int NumBins = 0;
+  std::vector<vtkIdType> Counts;
+  std::vector<double> Bounds;
+
+  void Initialize(int numBins)
+  {
+    this->NumBins = numBins;
+    this->Counts.assign(3 * numBins, 0);
+    this->Bounds.resize(18 * numBins);
+    for (int i = 0; i < 3 * numBins; ++i)
+    {
+      InitializeBounds(this->Bounds.data() + 6 * i);
+    }
+  }
+
+  void Add(const BVHBins& other)
+  {
+    for (int i = 0; i < 3 * this->NumBins; ++i)
+    {
+      this->Counts[i] += other.Counts[i];
+      AddBounds(this->Bounds.data() + 6 * i, other.Bounds.data() + 6 * i);
+    }
+  }
+};
+
+int GetBin(double c, double cMin, double scale, int numBins)
+{
+  int bin = static_cast<int>((c - cMin) * scale);
+  return bin < 0 ? 0 : (bin >= numBins ? numBins - 1 : bin);
+}
+
+void AccumulateBins(const double* cellBounds, const vtkIdType* ids, vtkIdType beg, vtkIdType end,
+  const double cMin[3], const double scale[3], BVHBins& bins)
+{
+  const int numBins = bins.NumBins;
+  for (; beg < end; ++beg)
+  {
+    const double* cb = cellBounds + 6 * ids[beg];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      double c = 0.5 * (cb[2 * axis] + cb[2 * axis + 1]);
+      int idx = axis * numBins + GetBin(c, cMin[axis], scale[axis], numBins);
+      ++bins.Counts[idx];
+      AddBounds(bins.Bounds.data() + 6 * idx, cb);
+    }
+  }
+}
+
+struct BinsFunctor
+{
+  const double* CellBounds;
+  const vtkIdType* Ids;
+  const double* CMin;
+  const double* Scale;
+  int NumBins;
+  vtkSMPThreadLocal<BVHBins> Local;
+  BVHBins Result;
+
+  BinsFunctor(const double* cellBounds, const vtkIdType* ids, const double* cMin,
+    const double* scale, int numBins)
+    : CellBounds(cellBounds)
+    , Ids(ids)
+    , CMin(cMin)
+    , Scale(scale)
+    , NumBins(numBins)
+  {
+    this->Result.Initialize(numBins);
+  }
+
+  void Initialize() { this->Local.Local().Initialize(this->NumBins); }
+
+  void operator()(vtkIdType beg, vtkIdType end)
+  {
+    AccumulateBins(this->CellBounds, this->Ids, beg, end, this->CMin, this->Scale,
+      this->Local.Local());
+  }
+
+  void Reduce()
+  {
+    for (const auto& bins : this->Local)
+    {
+      this->Result.Add(bins);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+// Builds a hierarchy (or a subtree of it) over a range of the cell ids,
+// which are reordered in place so that each leaf is a contiguous range.
+struct BVHBuilder
+{
+  const double* CellBounds;
+  vtkIdType* Ids;
+  int NumBins;
+  vtkIdType MaxLeafSize;
+
+  struct Task
+  {
+    vtkIdType Node;
+    vtkIdType Begin;
+    vtkIdType End;
+  };
+
+  // Build the subtree of nodes[root] over ids[beg,end). Ranges larger than
+  // VTK_BVH_PARALLEL_RANGE are processed in parallel if threaded is true.
+  // If deferred is not null, ranges of at most deferSize cells are not
+  // processed but appended to deferred.
+  void Build(std::vector<BVHNode>& nodes, vtkIdType root, vtkIdType beg, vtkIdType end,
+    bool threaded, std::vector<Task>* deferred, vtkIdType deferSize) const
+  {
+    std::vector<Task> stack;
+    stack.push_back(Task{ root, beg, end });
+    while (!stack.empty())
+    {
+      Task task = stack.back();
+      stack.pop_back();
+      vtkIdType numCells = task.End - task.Begin;
+      if (deferred && numCells <= deferSize)
+      {
+        deferred->push_back(task);
+        continue;
+      }
+      bool parallel = threaded && numCells > VTK_BVH_PARALLEL_RANGE;
+
+      double b[12];
+      if (parallel)
+      {
+        BoundsFunctor functor(this->CellBounds, this->Ids);
+        vtkSMPTools::For(task.Begin, task.End, functor);
+        std::copy_n(functor.Result, 12, b);
+      }
+      else
+      {
+        InitializeBounds(b);
+        InitializeBounds(b + 6);
+        AccumulateBounds(this->CellBounds, this->Ids, task.Begin, task.End, b);
+      }
+      std::copy_n(b, 6, nodes[task.Node].Bounds);
+
+      int axis;
+      vtkIdType mid;
+      if (!this->Split(task.Begin, task.End, b, parallel, axis, mid))
+      {
+        nodes[task.Node].Index = task.Begin;
+        nodes[task.Node].Count = numCells;
+        nodes[task.Node].Axis = 0;
+        continue;
+      }
+
+      vtkIdType children = static_cast<vtkIdType>(nodes.size());
+      nodes.resize(nodes.size() + 2);
+      nodes[task.Node].Index = children;
+      nodes[task.Node].Count = 0;
+      nodes[task.Node].Axis = axis;
+      stack.push_back(Task{ children + 1, mid, task.End });
+      stack.push_back(Task{ children, task.Begin, mid });
+    }
+  }
+
+  // Choose the split of ids[beg,end) minimizing the surface area heuristic
+  // and partition the ids accordingly. Return false if the range should be
+  // a leaf.
+  bool Split(vtkIdType beg, vtkIdType end, const double b[12], bool parallel, int& bestAxis,
+    vtkIdType& mid) const
+  {
+    const vtkIdType numCells = end - beg;
+    const double* cBounds = b + 6;
+    double cMin[3], scale[3], extent[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      cMin[i] = cBounds[2 * i];
+      extent[i] = cBounds[2 * i + 1] - cBounds[2 * i];
+      scale[i] = extent[i] > 0.0 ? this->NumBins / extent[i] : 0.0;
+    }
+    if (numCells < 2 || (extent[0] <= 0.0 && extent[1] <= 0.0 && extent[2] <= 0.0))
+    {
+      return false; // all the centers are identical
+    }
+
+    BVHBins bins;
+    if (parallel)
+    {
+      BinsFunctor functor(this->CellBounds, this->Ids, cMin, scale, this->NumBins);
+      vtkSMPTools::For(beg, end, functor);
+      bins = std::move(functor.Result);
+    }
+    else
+    {
+      bins.Initialize(this->NumBins);
+      AccumulateBins(this->CellBounds, this->Ids, beg, end, cMin, scale, bins);
+    }
+
+    // Sweep the bins of each axis to evaluate the cost of every split.
+    const int numBins = this->NumBins;
+    const bool perimeter = BoxMetric(b, false) <= 0.0;
+    std::vector<double> rightMetric(numBins);
+    std::vector<vtkIdType> rightCount(numBins);
+    double bestCost = VTK_DOUBLE_MAX;
+    int bestBin = -1;
+    bestAxis = -1;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      if (extent[axis] <= 0.0)
+      {
+        continue;
+      }
+      const vtkIdType* counts = bins.Counts.data() + axis * numBins;
+      const double* bounds = bins.Bounds.data() + 6 * axis * numBins;
+      double box[6];
+      InitializeBounds(box);
+      vtkIdType count = 0;
+      for (int i = numBins - 1; i > 0; --i)
+      {
+        AddBounds(box, bounds + 6 * i);
+        count += counts[i];
+        rightMetric[i] = count > 0 ? BoxMetric(box, perimeter) : 0.0;
+        rightCount[i] = count;
+      }
+      InitializeBounds(box);
+      count = 0;
+      for (int i = 0; i < numBins - 1; ++i)
+      {
+        AddBounds(box, bounds + 6 * i);
+        count += counts[i];
+        if (count == 0 || rightCount[i + 1] == 0)
+        {
+          continue;
+        }
+        double cost = BoxMetric(box, perimeter) * count + rightMetric[i + 1] * rightCount[i + 1];
+        if (cost < bestCost)
+        {
+          bestCost = cost;
+          bestAxis = axis;
+          bestBin = i;
+        }
+      }
+    }
+
+    // Compare with the cost of a leaf, taking the cost of traversing a node
+    // as the cost of intersecting one cell.
+    double nodeMetric = BoxMetric(b, perimeter);
+    if (numCells <= this->MaxLeafSize &&
+      (bestAxis < 0 || nodeMetric <= 0.0 ||
+        1.0 + bestCost / nodeMetric >= static_cast<double>(numCells)))
+    {
+      return false;
+    }
+
+    vtkIdType* first = this->Ids + beg;
+    vtkIdType* last = this->Ids + end;
+    vtkIdType* pivot = last;
+    if (bestAxis >= 0)
+    {
+      const double* cellBounds = this->CellBounds;
+      const double axisMin = cMin[bestAxis];
+      const double axisScale = scale[bestAxis];
+      const int axis = bestAxis;
+      auto inLeft = [cellBounds, axis, axisMin, axisScale, numBins, bestBin](vtkIdType cellId)
+      {
+        const double* cb = cellBounds + 6 * cellId;
+        double c = 0.5 * (cb[2 * axis] + cb[2 * axis + 1]);
+        return GetBin(c, axisMin, axisScale, numBins) <= bestBin;
+      };
+      pivot = parallel ? this->Ids + this->ParallelPartition(beg, end, inLeft)
+                       : std::partition(first, last, inLeft);
+    }
+    if (pivot == first || pivot == last)
+    {
+      // Degenerate binning: split at the median along the largest extent.
+      bestAxis = static_cast<int>(std::max_element(extent, extent + 3) - extent);
+      const double* cellBounds = this->CellBounds;
+      const int axis = bestAxis;
+      pivot = first + numCells / 2;
+      std::nth_element(first, pivot, last,
+        [cellBounds, axis](vtkIdType a, vtkIdType c)
+        {
+          const double* ba = cellBounds + 6 * a;
+          const double* bc = cellBounds + 6 * c;
+          return ba[2 * axis] + ba[2 * axis + 1] < bc[2 * axis] + bc[2 * axis + 1];
+        });
+    }
+    mid = beg + (pivot - first);
+    return true;
+  }
+
+  // Partition ids[beg,end) so that the ids satisfying pred come first, and
+  // return the index of the first id that does not. The range is cut into
+  // chunks: the ids of each chunk satisfying pred are counted in parallel,
+  // then each chunk copies its ids to a buffer at the offsets given by the
+  // counts of the previous chunks. The partition is stable.
+  template <typename Predicate>
+  vtkIdType ParallelPartition(vtkIdType beg, vtkIdType end, const Predicate& pred) const
+  {
+    const vtkIdType chunkSize = VTK_BVH_PARALLEL_RANGE / 4;
+    const vtkIdType numChunks = (end - beg + chunkSize - 1) / chunkSize;
+    vtkIdType* ids = this->Ids;
+
+    std::vector<vtkIdType> offsets(numChunks + 1, 0);
+    vtkSMPTools::For(0, numChunks,
+      [&](vtkIdType chunk, vtkIdType endChunk)
+      {
+        for (; chunk < endChunk; ++chunk)
+        {
+          const vtkIdType first = beg + chunk * chunkSize;
+          const vtkIdType last = std::min(first + chunkSize, end);
+          offsets[chunk + 1] = std::count_if(ids + first, ids + last, pred);
+        }
+      });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    const vtkIdType numLeft = offsets[numChunks];
+
+    std::vector<vtkIdType> buffer(end - beg);
+    vtkSMPTools::For(0, numChunks,
+      [&](vtkIdType chunk, vtkIdType endChunk)
+      {
+        for (; chunk < endChunk; ++chunk)
+        {
+          const vtkIdType first = beg + chunk * chunkSize;
+          const vtkIdType last = std::min(first + chunkSize, end);
+          vtkIdType left = offsets[chunk];
+          vtkIdType right = numLeft + (first - beg) - offsets[chunk];
+          for (vtkIdType i = first; i < last; ++i)
+          {
+            buffer[pred(ids[i]) ? left++ : right++] = ids[i];
+          }
+        }
+      });
+    vtkSMPTools::For(beg, end,
+      [&](vtkIdType first, vtkIdType last)
+      { std::copy(buffer.begin() + (first - beg), buffer.begin() + (last - beg), ids + first); });
+    return beg + numLeft;
+  }
+};
+
+//------------------------------------------------------------------------------
+// A packet of rays traversing the hierarchy together. The unused slots of a
+// packet never hit anything (their TMax is negative).
+struct RayPacket
+{
+  int Size;
+  const double* P1[VTK_BVH_PACKET_SIZE];
+  const double* P2[VTK_BVH_PACKET_SIZE];
+  double Origin[3][VTK_BVH_PACKET_SIZE];
+  double InvDir[3][VTK_BVH_PACKET_SIZE];
+  double TMax[VTK_BVH_PACKET_SIZE];
+
+  // The closest hit of each ray
+  vtkIdType CellId[VTK_BVH_PACKET_SIZE];
+  double X[VTK_BVH_PACKET_SIZE][3];
+  double PCoords[VTK_BVH_PACKET_SIZE][3];
+  int SubId[VTK_BVH_PACKET_SIZE];
+
+  RayPacket()
+  {
+    this->Size = 0;
+    for (int r = 0; r < VTK_BVH_PACKET_SIZE; ++r)
+    {
+      this->P1[r] = this->P2[r] = nullptr;
+      this->Origin[0][r] = this->Origin[1][r] = this->Origin[2][r] = 0.0;
+      this->InvDir[0][r] = this->InvDir[1][r] = this->InvDir[2][r] = 0.0;
+      this->TMax[r] = -1.0;
+      this->CellId[r] = -1;
+    }
+  }
+
+  void AddRay(const double* p1, const double* p2)
+  {
+    int r = this->Size++;
+    this->P1[r] = p1;
+    this->P2[r] = p2;
+    for (int i = 0; i < 3; ++i)
+    {
+      // Avoid infinite inverses so that the slab tests never produce NaNs.
+      double d = p2[i] - p1[i];
+      d = std::abs(d) < 1.0e-300 ? (d < 0.0 ? -1.0e-300 : 1.0e-300) : d;
+      this->Origin[i][r] = p1[i];
+      this->InvDir[i][r] = 1.0 / d;
+    }
+    this->TMax[r] = 1.0;
+    this->CellId[r] = -1;
+  }
+};
+
+// Slab test of all the rays of a packet against a box inflated by tol. The
+// loop is free of branches so that it vectorizes across the rays. Return
+// the number of rays intersecting the box within [0, TMax].
+int IntersectPacketWithBox(const RayPacket& rays, const double b[6], double tol, bool hit[])
+{
+  const double lo[3] = { b[0] - tol, b[2] - tol, b[4] - tol };
+  const double hi[3] = { b[1] + tol, b[3] + tol, b[5] + tol };
+  int numHits = 0;
+  for (int r = 0; r < VTK_BVH_PACKET_SIZE; ++r)
+  {
+    double t0 = 0.0;
+    double t1 = rays.TMax[r];
+    for (int i = 0; i < 3; ++i)
+    {
+      double tNear = (lo[i] - rays.Origin[i][r]) * rays.InvDir[i][r];
+      double tFar = (hi[i] - rays.Origin[i][r]) * rays.InvDir[i][r];
+      double tMin = tNear < tFar ? tNear : tFar;
+      double tMax = tNear < tFar ? tFar : tNear;
+      t0 = tMin > t0 ? tMin : t0;
+      t1 = tMax < t1 ? tMax : t1;
+    }
+    hit[r] = t0 <= t1;
+    numHits += hit[r] ? 1 : 0;
+  }
+  return numHits;
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+class vtkBVHCellLocator::vtkInternals
+{
+public:
+  std::vector<BVHNode> Nodes;
+  std::vector<vtkIdType> CellIds;
+
+  void Build(const double* cellBounds, vtkIdType numCells, int numBins, vtkIdType maxLeafSize);
+
+  vtkIdType FindCell(vtkAbstractCellLocator* locator, vtkDataSet* ds, const double x[3],
+    vtkGenericCell* cell, int& subId, double pcoords[3], double* weights) const;
+  void IntersectPacket(vtkDataSet* ds, const double* cellBounds, double tol, RayPacket& rays,
+    vtkGenericCell* cell, std::vector<vtkIdType>& stack) const;
+  int IntersectWithLine(vtkDataSet* ds, const double* cellBounds, const double p1[3],
+    const double p2[3], double tol, vtkPoints* points, vtkIdList* cellIds,
+    vtkGenericCell* cell) const;
+  vtkIdType FindClosestPointWithinRadius(vtkDataSet* ds, const double* cellBounds,
+    const double x[3], double radius, double closestPoint[3], vtkGenericCell* cell,
+    vtkIdType& closestCellId, int& closestSubId, double& minDist2, int& inside) const;
+  void FindCellsWithinBounds(
+    const double* cellBounds, const double bbox[6], vtkIdList* cells) const;
+};
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::vtkInternals::Build(
+  const double* cellBounds, vtkIdType numCells, int numBins, vtkIdType maxLeafSize)
+{
+  this->CellIds.resize(numCells);
+  vtkIdType* ids = this->CellIds.data();
+  vtkSMPTools::For(0, numCells,
+    [ids](vtkIdType cellId, vtkIdType end)
+    {
+      for (; cellId < end; ++cellId)
+      {
+        ids[cellId] = cellId;
+      }
+    });
+
+  BVHBuilder builder{ cellBounds, ids, numBins, maxLeafSize };
+  using Task = BVHBuilder::Task;
+
+  // Split the top levels with threaded binning until there are enough
+  // subtrees to keep all threads busy, then build the subtrees concurrently.
+  vtkIdType numThreads = std::max(vtkSMPTools::GetEstimatedNumberOfThreads(), 1);
+  vtkIdType deferSize = std::max(numCells / (8 * numThreads), static_cast<vtkIdType>(1024));
+  this->Nodes.resize(1);
+  std::vector<Task> subtrees;
+  builder.Build(this->Nodes, 0, 0, numCells, true, &subtrees, deferSize);
+
+  std::vector<std::vector<BVHNode>> subtreeNodes(subtrees.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(subtrees.size()), 1,
+    [&builder, &subtrees, &subtreeNodes](vtkIdType i, vtkIdType end)
+    {
+      for (; i < end; ++i)
+      {
+        std::vector<BVHNode>& nodes = subtreeNodes[i];
+        nodes.resize(1);
+        builder.Build(nodes, 0, subtrees[i].Begin, subtrees[i].End, false, nullptr, 0);
+      }
+    });
+
+  // Stitch the subtrees: the root of each subtree replaces its placeholder
+  // node, the other nodes are appended.
+  for (size_t i = 0; i < subtrees.size(); ++i)
+  {
+    const std::vector<BVHNode>& nodes = subtreeNodes[i];
+    vtkIdType base = static_cast<vtkIdType>(this->Nodes.size()) - 1;
+    this->Nodes.insert(this->Nodes.end(), nodes.begin() + 1, nodes.end());
+    this->Nodes[subtrees[i].Node] = nodes[0];
+    std::vector<BVHNode*> relocated;
+    relocated.push_back(&this->Nodes[subtrees[i].Node]);
+    for (size_t j = 1; j < nodes.size(); ++j)
+    {
+      relocated.push_back(&this->Nodes[base + j]);
+    }
+    for (BVHNode* node : relocated)
+    {
+      if (!node->IsLeaf())
+      {
+        node->Index += base;
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::vtkInternals::FindCell(vtkAbstractCellLocator* locator,
+  vtkDataSet* ds, const double x[3], vtkGenericCell* cell, int& subId, double pcoords[3],
+  double* weights) const
+{
+  double pos[3] = { x[0], x[1], x[2] };
+  double dist2;
+  std::vector<vtkIdType> stack;
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const BVHNode& node = this->Nodes[stack.back()];
+    stack.pop_back();
+    if (!vtkBVHCellLocator::IsInBounds(node.Bounds, pos))
+    {
+      continue;
+    }
+    if (!node.IsLeaf())
+    {
+      stack.push_back(node.Index + 1);
+      stack.push_back(node.Index);
+      continue;
+    }
+    for (vtkIdType i = node.Index; i < node.Index + node.Count; ++i)
+    {
+      vtkIdType cellId = this->CellIds[i];
+      if (locator->InsideCellBounds(pos, cellId))
+      {
+        ds->GetCell(cellId, cell);
+        if (cell->EvaluatePosition(pos, nullptr, subId, pcoords, dist2, weights) == 1)
+        {
+          return cellId;
+        }
+      }
+    }
+  }
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+// Find the closest intersection of each ray of the packet. All the rays
+// share a single front-to-back traversal, ordered by the direction of the
+// first ray; a node is skipped when none of the rays hits it before its
+// current closest hit.
+void vtkBVHCellLocator::vtkInternals::IntersectPacket(vtkDataSet* ds, const double* cellBounds,
+  double tol, RayPacket& rays, vtkGenericCell* cell, std::vector<vtkIdType>& stack) const
+{
+  bool hit[VTK_BVH_PACKET_SIZE];
+  double t, x[3], pcoords[3];
+  int subId;
+
+  stack.clear();
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const BVHNode& node = this->Nodes[stack.back()];
+    stack.pop_back();
+    if (!IntersectPacketWithBox(rays, node.Bounds, tol, hit))
+    {
+      continue;
+    }
+    if (!node.IsLeaf())
+    {
+      if (rays.InvDir[node.Axis][0] >= 0.0)
+      {
+        stack.push_back(node.Index + 1);
+        stack.push_back(node.Index);
+      }
+      else
+      {
+        stack.push_back(node.Index);
+        stack.push_back(node.Index + 1);
+      }
+      continue;
+    }
+    for (vtkIdType i = node.Index; i < node.Index + node.Count; ++i)
+    {
+      vtkIdType cellId = this->CellIds[i];
+      if (!IntersectPacketWithBox(rays, cellBounds + 6 * cellId, tol, hit))
+      {
+        continue;
+      }
+      ds->GetCell(cellId, cell);
+      for (int r = 0; r < rays.Size; ++r)
+      {
+        // the first hit may lie at the end of the line, later hits must be closer
+        if (hit[r] && cell->IntersectWithLine(rays.P1[r], rays.P2[r], tol, t, x, pcoords, subId) &&
+          (t < rays.TMax[r] || (rays.CellId[r] < 0 && t <= rays.TMax[r])))
+        {
+          rays.TMax[r] = t;
+          rays.CellId[r] = cellId;
+          std::copy_n(x, 3, rays.X[r]);
+          std::copy_n(pcoords, 3, rays.PCoords[r]);
+          rays.SubId[r] = subId;
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkBVHCellLocator::vtkInternals::IntersectWithLine(vtkDataSet* ds, const double* cellBounds,
+  const double p1[3], const double p2[3], double tol, vtkPoints* points, vtkIdList* cellIds,
+  vtkGenericCell* cell) const
+{
+  struct Intersection
+  {
+    vtkIdType CellId;
+    double T;
+    double X[3];
+  };
+  std::vector<Intersection> intersections;
+  RayPacket rays;
+  rays.AddRay(p1, p2);
+  double rayDir[3], t, x[3], pcoords[3];
+  int subId;
+  bool hit[VTK_BVH_PACKET_SIZE];
+  vtkMath::Subtract(p2, p1, rayDir);
+
+  std::vector<vtkIdType> stack;
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const BVHNode& node = this->Nodes[stack.back()];
+    stack.pop_back();
+    if (!IntersectPacketWithBox(rays, node.Bounds, tol, hit))
+    {
+      continue;
+    }
+    if (!node.IsLeaf())
+    {
+      stack.push_back(node.Index + 1);
+      stack.push_back(node.Index);
+      continue;
+    }
+    for (vtkIdType i = node.Index; i < node.Index + node.Count; ++i)
+    {
+      vtkIdType cellId = this->CellIds[i];
+      if (!vtkBox::IntersectBox(cellBounds + 6 * cellId, p1, rayDir, x, t, tol))
+      {
+        continue;
+      }
+      if (cell)
+      {
+        ds->GetCell(cellId, cell);
+        if (!cell->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId))
+        {
+          continue;
+        }
+      }
+      intersections.push_back(Intersection{ cellId, t, { x[0], x[1], x[2] } });
+    }
+  }
+
+  if (intersections.empty())
+  {
+    return 0;
+  }
+  std::sort(intersections.begin(), intersections.end(),
+    [](const Intersection& a, const Intersection& b) { return a.T < b.T; });
+  vtkIdType numIntersections = static_cast<vtkIdType>(intersections.size());
+  if (points)
+  {
+    points->SetNumberOfPoints(numIntersections);
+    for (vtkIdType i = 0; i < numIntersections; ++i)
+    {
+      points->SetPoint(i, intersections[i].X);
+    }
+  }
+  if (cellIds)
+  {
+    cellIds->SetNumberOfIds(numIntersections);
+    for (vtkIdType i = 0; i < numIntersections; ++i)
+    {
+      cellIds->SetId(i, intersections[i].CellId);
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+// Best-first traversal: the nodes are processed by increasing distance to
+// their bounds, until they are further away than the closest point found.
+vtkIdType vtkBVHCellLocator::vtkInternals::FindClosestPointWithinRadius(vtkDataSet* ds,
+  const double* cellBounds, const double x[3], double radius, double closestPoint[3],
+  vtkGenericCell* cell, vtkIdType& closestCellId, int& closestSubId, double& minDist2,
+  int& inside) const
+{
+  std::vector<double> weights(ds->GetMaxCellSize());
+  double point[3], pcoords[3], dist2;
+  int subId, stat;
+  vtkIdType retVal = 0;
+
+  using QueueItem = std::pair<double, vtkIdType>;
+  std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> queue;
+  queue.emplace(Distance2ToBounds(x, this->Nodes[0].Bounds), 0);
+  minDist2 = radius * radius;
+
+  while (!queue.empty() && queue.top().first <= minDist2)
+  {
+    const BVHNode& node = this->Nodes[queue.top().second];
+    queue.pop();
+    if (!node.IsLeaf())
+    {
+      for (vtkIdType child = node.Index; child < node.Index + 2; ++child)
+      {
+        double d2 = Distance2ToBounds(x, this->Nodes[child].Bounds);
+        if (d2 <= minDist2)
+        {
+          queue.emplace(d2, child);
+        }
+      }
+      continue;
+    }
+    for (vtkIdType i = node.Index; i < node.Index + node.Count; ++i)
+    {
+      vtkIdType cellId = this->CellIds[i];
+      if (Distance2ToBounds(x, cellBounds + 6 * cellId) >= minDist2)
+      {
+        continue;
+      }
+      ds->GetCell(cellId, cell);
+      // stat==(-1) is numerical error; stat==0 means outside; stat=1 means inside.
+      stat = cell->EvaluatePosition(x, point, subId, pcoords, dist2, weights.data());
+      if (stat != -1 && dist2 < minDist2)
+      {
+        retVal = 1;
+        inside = stat;
+        minDist2 = dist2;
+        closestCellId = cellId;
+        closestSubId = subId;
+        std::copy_n(point, 3, closestPoint);
+      }
+    }
+  }
+  return retVal;
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::vtkInternals::FindCellsWithinBounds(
+  const double* cellBounds, const double bbox[6], vtkIdList* cells) const
+{
+  auto overlaps = [bbox](const double* b)
+  {
+    return b[0] <= bbox[1] && bbox[0] <= b[1] && b[2] <= bbox[3] && bbox[2] <= b[3] &&
+      b[4] <= bbox[5] && bbox[4] <= b[5];
+  };
+  std::vector<vtkIdType> stack;
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const BVHNode& node = this->Nodes[stack.back()];
+    stack.pop_back();
+    if (!overlaps(node.Bounds))
+    {
+      continue;
+    }
+    if (!node.IsLeaf())
+    {
+      stack.push_back(node.Index + 1);
+      stack.push_back(node.Index);
+      continue;
+    }
+    for (vtkIdType i = node.Index; i < node.Index + node.Count; ++i)
+    {
+      if (overlaps(cellBounds + 6 * this->CellIds[i]))
+      {
+        cells->InsertNextId(this->CellIds[i]);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Here is the VTK class proper.
+
+//------------------------------------------------------------------------------
+vtkBVHCellLocator::vtkBVHCellLocator()
+{
+  this->CacheCellBounds = 1; // always cached
+  this->NumberOfCellsPerNode = 8;
+  this->NumberOfBins = 16;
+}
+
+//------------------------------------------------------------------------------
+vtkBVHCellLocator::~vtkBVHCellLocator()
+{
+  this->FreeSearchStructure();
+  this->FreeCellBounds();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::FreeSearchStructure()
+{
+  this->Internals.reset();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::BuildLocator()
+{
+  // don't rebuild if build time is newer than modified and dataset modified time
+  if (this->Internals && this->BuildTime > this->MTime &&
+    this->BuildTime > this->DataSet->GetMTime())
+  {
+    return;
+  }
+  // don't rebuild if UseExistingSearchStructure is ON and a search structure already exists
+  if (this->Internals && this->UseExistingSearchStructure)
+  {
+    this->BuildTime.Modified();
+    vtkDebugMacro(<< "BuildLocator exited - UseExistingSearchStructure");
+    return;
+  }
+  this->BuildLocatorInternal();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::ForceBuildLocator()
+{
+  this->BuildLocatorInternal();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::BuildLocatorInternal()
+{
+  vtkDebugMacro(<< "Building BVH cell locator");
+  vtkIdType numCells;
+  if (!this->DataSet || (numCells = this->DataSet->GetNumberOfCells()) < 1)
+  {
+    vtkErrorMacro(<< "No cells to build");
+    return;
+  }
+
+  this->FreeSearchStructure();
+  this->CacheCellBounds = 1;
+  this->ComputeCellBounds();
+
+  auto internals = std::make_shared<vtkInternals>();
+  internals->Build(this->CellBounds, numCells, this->NumberOfBins, this->NumberOfCellsPerNode);
+  this->Internals = internals;
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::FindCell(
+  double x[3], double, vtkGenericCell* cell, int& subId, double pcoords[3], double* weights)
+{
+  this->BuildLocator();
+  if (!this->Internals)
+  {
+    return -1;
+  }
+  return this->Internals->FindCell(this, this->DataSet, x, cell, subId, pcoords, weights);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::FindClosestPointWithinRadius(double x[3], double radius,
+  double closestPoint[3], vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2,
+  int& inside)
+{
+  this->BuildLocator();
+  if (!this->Internals)
+  {
+    return 0;
+  }
+  return this->Internals->FindClosestPointWithinRadius(this->DataSet, this->CellBounds, x, radius,
+    closestPoint, cell, cellId, subId, dist2, inside);
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::FindCellsWithinBounds(double* bbox, vtkIdList* cells)
+{
+  this->BuildLocator();
+  if (!this->Internals || !cells)
+  {
+    return;
+  }
+  cells->Reset();
+  this->Internals->FindCellsWithinBounds(this->CellBounds, bbox, cells);
+}
+
+//------------------------------------------------------------------------------
+int vtkBVHCellLocator::IntersectWithLine(const double p1[3], const double p2[3], double tol,
+  double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell)
+{
+  cellId = -1;
+  this->BuildLocator();
+  if (!this->Internals)
+  {
+    return 0;
+  }
+
+  RayPacket rays;
+  rays.AddRay(p1, p2);
+  std::vector<vtkIdType> stack;
+  this->Internals->IntersectPacket(this->DataSet, this->CellBounds, tol, rays, cell, stack);
+  if (rays.CellId[0] < 0)
+  {
+    return 0;
+  }
+  this->DataSet->GetCell(rays.CellId[0], cell);
+  t = rays.TMax[0];
+  std::copy_n(rays.X[0], 3, x);
+  std::copy_n(rays.PCoords[0], 3, pcoords);
+  subId = rays.SubId[0];
+  cellId = rays.CellId[0];
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkBVHCellLocator::IntersectWithLine(const double p1[3], const double p2[3], double tol,
+  vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell)
+{
+  // Initialize the list of points/cells
+  if (points)
+  {
+    points->Reset();
+  }
+  if (cellIds)
+  {
+    cellIds->Reset();
+  }
+  this->BuildLocator();
+  if (!this->Internals)
+  {
+    return 0;
+  }
+  return this->Internals->IntersectWithLine(
+    this->DataSet, this->CellBounds, p1, p2, tol, points, cellIds, cell);
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::IntersectWithLines(vtkDataArray* p1, vtkDataArray* p2, double tol,
+  vtkIdTypeArray* cellIds, vtkDoubleArray* t, vtkDoubleArray* points)
+{
+  if (!p1 || !p2 || !cellIds || p1->GetNumberOfComponents() != 3 ||
+    p2->GetNumberOfComponents() != 3 || p1->GetNumberOfTuples() != p2->GetNumberOfTuples())
+  {
+    vtkErrorMacro("IntersectWithLines requires two 3-component arrays of the same size.");
+    return;
+  }
+  const vtkIdType numLines = p1->GetNumberOfTuples();
+  cellIds->SetNumberOfComponents(1);
+  cellIds->SetNumberOfTuples(numLines);
+  cellIds->FillValue(-1);
+  if (t)
+  {
+    t->SetNumberOfComponents(1);
+    t->SetNumberOfTuples(numLines);
+    t->FillValue(VTK_DOUBLE_MAX);
+  }
+  if (points)
+  {
+    points->SetNumberOfComponents(3);
+    points->SetNumberOfTuples(numLines);
+    points->FillValue(0.0);
+  }
+  this->BuildLocator();
+  if (!this->Internals || numLines < 1)
+  {
+    return;
+  }
+
+  // Copy the end points of the lines, and sort the lines by direction
+  // octant, then along a Morton curve of their start points, so that the
+  // rays of a packet are coherent.
+  std::vector<double> ends(6 * numLines);
+  std::vector<std::pair<vtkTypeUInt64, vtkIdType>> keys(numLines);
+  const double* bounds = this->Internals->Nodes[0].Bounds;
+  vtkSMPTools::For(0, numLines,
+    [p1, p2, bounds, &ends, &keys](vtkIdType lineId, vtkIdType end)
+    {
+      for (; lineId < end; ++lineId)
+      {
+        double* a = ends.data() + 6 * lineId;
+        p1->GetTuple(lineId, a);
+        p2->GetTuple(lineId, a + 3);
+        vtkTypeUInt64 key = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+          double extent = bounds[2 * i + 1] - bounds[2 * i];
+          double s = extent > 0.0 ? (a[i] - bounds[2 * i]) / extent : 0.0;
+          s = std::min(std::max(s, 0.0), 1.0);
+          key |= vtkMortonCode::SpreadBits(static_cast<vtkTypeUInt64>(s * 0xfffff)) << i;
+          key |= static_cast<vtkTypeUInt64>(a[3 + i] < a[i] ? 1 : 0) << (60 + i);
+        }
+        keys[lineId] = std::make_pair(key, lineId);
+      }
+    });
+  vtkSMPTools::Sort(keys.begin(), keys.end());
+
+  // Make sure the cells can be retrieved from multiple threads.
+  vtkNew<vtkGenericCell> cell;
+  this->DataSet->GetCell(0, cell);
+
+  vtkDataSet* ds = this->DataSet;
+  const double* cellBounds = this->CellBounds;
+  const vtkInternals* internals = this->Internals.get();
+  vtkIdType* outIds = cellIds->GetPointer(0);
+  double* outT = t ? t->GetPointer(0) : nullptr;
+  double* outX = points ? points->GetPointer(0) : nullptr;
+  vtkSMPThreadLocalObject<vtkGenericCell> localCell;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> localStack;
+  vtkIdType numPackets = (numLines + VTK_BVH_PACKET_SIZE - 1) / VTK_BVH_PACKET_SIZE;
+  vtkSMPTools::For(0, numPackets,
+    [&](vtkIdType packetId, vtkIdType endPacket)
+    {
+      vtkGenericCell* genericCell = localCell.Local();
+      std::vector<vtkIdType>& stack = localStack.Local();
+      for (; packetId < endPacket; ++packetId)
+      {
+        vtkIdType first = packetId * VTK_BVH_PACKET_SIZE;
+        vtkIdType last = std::min(first + VTK_BVH_PACKET_SIZE, numLines);
+        RayPacket rays;
+        for (vtkIdType i = first; i < last; ++i)
+        {
+          const double* a = ends.data() + 6 * keys[i].second;
+          rays.AddRay(a, a + 3);
+        }
+        internals->IntersectPacket(ds, cellBounds, tol, rays, genericCell, stack);
+        for (int r = 0; r < rays.Size; ++r)
+        {
+          if (rays.CellId[r] < 0)
+          {
+            continue;
+          }
+          vtkIdType lineId = keys[first + r].second;
+          outIds[lineId] = rays.CellId[r];
+          if (outT)
+          {
+            outT[lineId] = rays.TMax[r];
+          }
+          if (outX)
+          {
+            std::copy_n(rays.X[r], 3, outX + 3 * lineId);
+          }
+        }
+      }
+    });
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::GetNumberOfNodes()
+{
+  return this->Internals ? static_cast<vtkIdType>(this->Internals->Nodes.size()) : 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::GenerateRepresentation(int level, vtkPolyData* pd)
+{
+  this->BuildLocator();
+  if (!this->Internals)
+  {
+    return;
+  }
+
+  vtkNew<vtkPoints> pts;
+  vtkNew<vtkCellArray> lines;
+  pd->SetPoints(pts);
+  pd->SetLines(lines);
+
+  // Add the edges of the boxes of the nodes at the requested level, or of
+  // the leaves if level < 0.
+  static const int edges[12][2] = { { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 }, { 0, 2 }, { 1, 3 },
+    { 4, 6 }, { 5, 7 }, { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 } };
+  std::vector<std::pair<vtkIdType, int>> stack;
+  stack.emplace_back(0, 0);
+  while (!stack.empty())
+  {
+    const BVHNode& node = this->Internals->Nodes[stack.back().first];
+    int nodeLevel = stack.back().second;
+    stack.pop_back();
+    if ((level < 0 && node.IsLeaf()) || nodeLevel == level)
+    {
+      vtkIdType ids[8];
+      for (int i = 0; i < 8; ++i)
+      {
+        ids[i] = pts->InsertNextPoint(
+          node.Bounds[i & 1], node.Bounds[2 + ((i >> 1) & 1)], node.Bounds[4 + ((i >> 2) & 1)]);
+      }
+      for (int e = 0; e < 12; ++e)
+      {
+        vtkIdType edge[2] = { ids[edges[e][0]], ids[edges[e][1]] };
+        lines->InsertNextCell(2, edge);
+      }
+    }
+    else if (!node.IsLeaf())
+    {
+      stack.emplace_back(node.Index + 1, nodeLevel + 1);
+      stack.emplace_back(node.Index, nodeLevel + 1);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::ShallowCopy(vtkAbstractCellLocator* locator)
+{
+  vtkBVHCellLocator* cellLocator = vtkBVHCellLocator::SafeDownCast(locator);
+  if (!cellLocator)
+  {
+    vtkErrorMacro("Cannot cast " << locator->GetClassName() << " to vtkBVHCellLocator.");
+    return;
+  }
+  // we only copy what's actually used by vtkBVHCellLocator
+
+  // vtkLocator parameters
+  this->SetUseExistingSearchStructure(cellLocator->GetUseExistingSearchStructure());
+
+  // vtkAbstractCellLocator parameters
+  this->SetNumberOfCellsPerNode(cellLocator->GetNumberOfCellsPerNode());
+  this->CacheCellBounds = cellLocator->CacheCellBounds;
+  this->CellBoundsSharedPtr = cellLocator->CellBoundsSharedPtr; // This is important
+  this->CellBounds = this->CellBoundsSharedPtr.get() ? this->CellBoundsSharedPtr->data() : nullptr;
+
+  // vtkBVHCellLocator parameters, the hierarchy is immutable once built
+  this->NumberOfBins = cellLocator->NumberOfBins;
+  this->Internals = cellLocator->Internals;
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfBins: " << this->NumberOfBins << "\n";
+  os << indent << "NumberOfNodes: " << this->GetNumberOfNodes() << "\n";
+}
+VTK_ABI_NAMESPACE_END
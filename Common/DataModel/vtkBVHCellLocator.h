@@ -0,0 +1,193 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkBVHCellLocator
+ * @brief   cell locator based on a bounding volume hierarchy
+ *
+ * vtkBVHCellLocator is a type of vtkAbstractCellLocator organizing the
+ * bounding boxes of the cells in a bounding volume hierarchy (BVH). Each
+ * cell is referenced by exactly one leaf of the hierarchy, and the split of
+ * each node is chosen with the binned surface area heuristic (SAH), which
+ * minimizes the expected cost of ray traversals. This makes the locator
+ * particularly well suited to line intersection queries (picking,
+ * visibility, inside/outside tests), while also supporting point location
+ * and closest point queries.
+ *
+ * The hierarchy is built in parallel (via vtkSMPTools): the cells of each
+ * top level node are binned and partitioned by threads, one node at a time,
+ * then the remaining subtrees are built concurrently. A node whose binning
+ * cannot separate the cells (e.g. many cells with the same center) is split
+ * at the median instead, which is done serially.
+ *
+ * The batched IntersectWithLines() method intersects many lines at once: the
+ * lines are sorted to group coherent rays, then traversed in parallel, in
+ * packets sharing a single traversal of the hierarchy whose box tests are
+ * vectorized across the rays of the packet.
+ *
+ * @warning
+ * vtkBVHCellLocator utilizes the following parent class parameters:
+ * - NumberOfCellsPerNode        (default 8)
+ * - UseExistingSearchStructure  (default false)
+ *
+ * vtkBVHCellLocator does NOT utilize the following parameters:
+ * - CacheCellBounds             (always cached)
+ * - Automatic
+ * - Level
+ * - MaxLevel
+ * - Tolerance
+ * - RetainCellLists
+ *
+ * @sa
+ * vtkAbstractCellLocator vtkCellLocator vtkStaticCellLocator vtkCellTreeLocator
+ * vtkModifiedBSPTree vtkOBBTree
+ */
+
+#ifndef vtkBVHCellLocator_h
+#define vtkBVHCellLocator_h
+
+#include "vtkAbstractCellLocator.h"
+#include "vtkCommonDataModelModule.h" // For export macro
+
+#include <memory> // For shared_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+class vtkDoubleArray;
+class vtkIdTypeArray;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkBVHCellLocator : public vtkAbstractCellLocator
+{
+public:
+  ///@{
+  /**
+   * Standard methods to instantiate, print and obtain type-related information.
+   */
+  static vtkBVHCellLocator* New();
+  vtkTypeMacro(vtkBVHCellLocator, vtkAbstractCellLocator);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of bins used along each axis to evaluate the surface
+   * area heuristic when splitting a node. More bins give better splits at
+   * the expense of a slower build.
+   *
+   * Default is 16.
+   */
+  vtkSetClampMacro(NumberOfBins, int, 2, 256);
+  vtkGetMacro(NumberOfBins, int);
+  ///@}
+
+  // Re-use any superclass signatures that we don't override.
+  using vtkAbstractCellLocator::FindCell;
+  using vtkAbstractCellLocator::FindClosestPoint;
+  using vtkAbstractCellLocator::FindClosestPointWithinRadius;
+  using vtkAbstractCellLocator::IntersectWithLine;
+
+  /**
+   * Return intersection point (if any) AND the cell which was intersected by
+   * the finite line. The cell is returned as a cell id and as a generic cell.
+   *
+   * For other IntersectWithLine signatures, see vtkAbstractCellLocator.
+   */
+  int IntersectWithLine(const double a0[3], const double a1[3], double tol, double& t, double x[3],
+    double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) override;
+
+  /**
+   * Take the passed line segment and intersect it with the data set.
+   * The return value of the function is 0 if no intersections were found.
+   * For each intersection with the bounds of a cell or with a cell (if a cell is provided),
+   * the points and cellIds have the relevant information added sorted by t.
+   * If points or cellIds are nullptr pointers, then no information is generated for that list.
+   *
+   * For other IntersectWithLine signatures, see vtkAbstractCellLocator.
+   */
+  int IntersectWithLine(const double p1[3], const double p2[3], double tol, vtkPoints* points,
+    vtkIdList* cellIds, vtkGenericCell* cell) override;
+
+  /**
+   * Intersect a batch of finite lines with the data set. The lines go from
+   * the points of p1 to the points of p2 (both 3-component arrays with the
+   * same number of tuples). For each line, cellIds receives the id of the
+   * first cell intersected (i.e., with the smallest parametric coordinate
+   * along the line) or -1 if none, and the optional t and points arrays
+   * receive the parametric coordinate and the position of the intersection.
+   * This gives the same results as calling IntersectWithLine() for each
+   * line, but the lines are processed in parallel and in coherent packets,
+   * which is much faster for many lines. This method is thread safe after
+   * the locator is built.
+   */
+  void IntersectWithLines(vtkDataArray* p1, vtkDataArray* p2, double tol, vtkIdTypeArray* cellIds,
+    vtkDoubleArray* t = nullptr, vtkDoubleArray* points = nullptr);
+
+  /**
+   * Return the closest point within a specified radius and the cell which is
+   * closest to the point x. The closest point is somewhere on a cell, it
+   * need not be one of the vertices of the cell. This method returns 1 if a
+   * point is found within the specified radius. If there are no cells within
+   * the specified radius, the method returns 0 and the values of
+   * closestPoint, cellId, subId, and dist2 are undefined. If a closest point
+   * is found, inside returns the return value of the EvaluatePosition call to
+   * the closest cell; inside(=1) or outside(=0).
+   */
+  vtkIdType FindClosestPointWithinRadius(double x[3], double radius, double closestPoint[3],
+    vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2, int& inside) override;
+
+  /**
+   * Return a list of unique cell ids inside of a given bounding box. The
+   * user must provide the vtkIdList to populate.
+   */
+  void FindCellsWithinBounds(double* bbox, vtkIdList* cells) override;
+
+  /**
+   * Find the cell containing a given point. returns -1 if no cell found
+   * the cell parameters are copied into the supplied variables, a cell must
+   * be provided to store the information.
+   *
+   * For other FindCell signatures, see vtkAbstractCellLocator.
+   */
+  vtkIdType FindCell(double x[3], double vtkNotUsed(tol2), vtkGenericCell* GenCell, int& subId,
+    double pcoords[3], double* weights) override;
+
+  ///@{
+  /**
+   * Satisfy vtkLocator abstract interface.
+   */
+  void FreeSearchStructure() override;
+  void BuildLocator() override;
+  void ForceBuildLocator() override;
+  void GenerateRepresentation(int level, vtkPolyData* pd) override;
+  ///@}
+
+  /**
+   * Return the number of nodes of the hierarchy, or 0 if it is not built.
+   */
+  vtkIdType GetNumberOfNodes();
+
+  /**
+   * Shallow copy of a vtkBVHCellLocator: the hierarchy and the cell bounds
+   * are shared.
+   *
+   * Before you shallow copy, make sure to call SetDataSet()
+   */
+  void ShallowCopy(vtkAbstractCellLocator* locator) override;
+
+protected:
+  vtkBVHCellLocator();
+  ~vtkBVHCellLocator() override;
+
+  void BuildLocatorInternal() override;
+
+  int NumberOfBins;
+
+  class vtkInternals;
+  std::shared_ptr<vtkInternals> Internals;
+
+private:
+  vtkBVHCellLocator(const vtkBVHCellLocator&) = delete;
+  void operator=(const vtkBVHCellLocator&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -1190,12 +1190,22 @@ struct BoundsPointIdsWorker
 //------------------------------------------------------------------------------
 void vtkBoundingBox::ComputeBounds(vtkPoints* pts, double bounds[6])
 {
-  // Compute bounds: dispatch to real types, fallback for other types.
+  // Points in the struct-of-arrays layout have their own vectorized bounds.
+  if (pts->GetDataLayout() == vtkPoints::SOA_LAYOUT && pts->GetNumberOfPoints() > 0)
+  {
+    pts->GetBounds(bounds);
+    return;
+  }
+
+  // Compute bounds: dispatch to real types, including the struct-of-arrays
+  // point layout, fallback for other types.
+  using PointsDispatcher = vtkArrayDispatch::DispatchByArray<vtkArrayDispatch::PointArrays>;
   using Dispatcher = vtkArrayDispatch::DispatchByValueTypeUsingArrays<vtkArrayDispatch::AllArrays,
     vtkArrayDispatch::Reals>;
   BoundsWorker worker;
 
-  if (!Dispatcher::Execute(pts->GetData(), worker, bounds))
+  if (!PointsDispatcher::Execute(pts->GetData(), worker, bounds) &&
+    !Dispatcher::Execute(pts->GetData(), worker, bounds))
   { // Fallback to slowpath for other point types
     worker(pts->GetData(), bounds);
   }
@@ -1204,12 +1214,15 @@ void vtkBoundingBox::ComputeBounds(vtkPoints* pts, double bounds[6])
 //------------------------------------------------------------------------------
 void vtkBoundingBox::ComputeBounds(vtkPoints* pts, const unsigned char* ptUses, double bounds[6])
 {
-  // Compute bounds: dispatch to real types, fallback for other types.
+  // Compute bounds: dispatch to real types, including the struct-of-arrays
+  // point layout, fallback for other types.
+  using PointsDispatcher = vtkArrayDispatch::DispatchByArray<vtkArrayDispatch::PointArrays>;
   using Dispatcher = vtkArrayDispatch::DispatchByValueTypeUsingArrays<vtkArrayDispatch::AllArrays,
     vtkArrayDispatch::Reals>;
   BoundsPointUsesWorker worker;
 
-  if (!Dispatcher::Execute(pts->GetData(), worker, ptUses, bounds))
+  if (!PointsDispatcher::Execute(pts->GetData(), worker, ptUses, bounds) &&
+    !Dispatcher::Execute(pts->GetData(), worker, ptUses, bounds))
   { // Fallback to slowpath for other point types
     worker(pts->GetData(), ptUses, bounds);
   }
@@ -1219,12 +1232,15 @@ void vtkBoundingBox::ComputeBounds(vtkPoints* pts, const unsigned char* ptUses,
 void vtkBoundingBox::ComputeBounds(
   vtkPoints* pts, const std::atomic<unsigned char>* ptUses, double bounds[6])
 {
-  // Compute bounds: dispatch to real types, fallback for other types.
+  // Compute bounds: dispatch to real types, including the struct-of-arrays
+  // point layout, fallback for other types.
+  using PointsDispatcher = vtkArrayDispatch::DispatchByArray<vtkArrayDispatch::PointArrays>;
   using Dispatcher = vtkArrayDispatch::DispatchByValueTypeUsingArrays<vtkArrayDispatch::AllArrays,
     vtkArrayDispatch::Reals>;
   BoundsPointUsesWorker worker;
 
-  if (!Dispatcher::Execute(pts->GetData(), worker, ptUses, bounds))
+  if (!PointsDispatcher::Execute(pts->GetData(), worker, ptUses, bounds) &&
+    !Dispatcher::Execute(pts->GetData(), worker, ptUses, bounds))
   { // Fallback to slowpath for other point types
     worker(pts->GetData(), ptUses, bounds);
   }
@@ -1234,12 +1250,15 @@ void vtkBoundingBox::ComputeBounds(
 void vtkBoundingBox::ComputeBounds(
   vtkPoints* pts, const long long* ptIds, long long numberOfPointsIds, double bounds[6])
 {
-  // Compute bounds: dispatch to real types, fallback for other types.
+  // Compute bounds: dispatch to real types, including the struct-of-arrays
+  // point layout, fallback for other types.
+  using PointsDispatcher = vtkArrayDispatch::DispatchByArray<vtkArrayDispatch::PointArrays>;
   using Dispatcher = vtkArrayDispatch::DispatchByValueTypeUsingArrays<vtkArrayDispatch::AllArrays,
     vtkArrayDispatch::Reals>;
   BoundsPointIdsWorker worker;
 
-  if (!Dispatcher::Execute(pts->GetData(), worker, ptIds, numberOfPointsIds, bounds))
+  if (!PointsDispatcher::Execute(pts->GetData(), worker, ptIds, numberOfPointsIds, bounds) &&
+    !Dispatcher::Execute(pts->GetData(), worker, ptIds, numberOfPointsIds, bounds))
   { // Fallback to slowpath for other point types
     worker(pts->GetData(), ptIds, numberOfPointsIds, bounds);
   }
@@ -1249,12 +1268,15 @@ void vtkBoundingBox::ComputeBounds(
 void vtkBoundingBox::ComputeBounds(
   vtkPoints* pts, const long* ptIds, long numberOfPointsIds, double bounds[6])
 {
-  // Compute bounds: dispatch to real types, fallback for other types.
+  // Compute bounds: dispatch to real types, including the struct-of-arrays
+  // point layout, fallback for other types.
+  using PointsDispatcher = vtkArrayDispatch::DispatchByArray<vtkArrayDispatch::PointArrays>;
   using Dispatcher = vtkArrayDispatch::DispatchByValueTypeUsingArrays<vtkArrayDispatch::AllArrays,
     vtkArrayDispatch::Reals>;
   BoundsPointIdsWorker worker;
 
-  if (!Dispatcher::Execute(pts->GetData(), worker, ptIds, numberOfPointsIds, bounds))
+  if (!PointsDispatcher::Execute(pts->GetData(), worker, ptIds, numberOfPointsIds, bounds) &&
+    !Dispatcher::Execute(pts->GetData(), worker, ptIds, numberOfPointsIds, bounds))
   { // Fallback to slowpath for other point types
     worker(pts->GetData(), ptIds, numberOfPointsIds, bounds);
   }
@@ -1264,12 +1286,15 @@ void vtkBoundingBox::ComputeBounds(
 void vtkBoundingBox::ComputeBounds(
   vtkPoints* pts, const int* ptIds, int numberOfPointsIds, double bounds[6])
 {
-  // Compute bounds: dispatch to real types, fallback for other types.
+  // Compute bounds: dispatch to real types, including the struct-of-arrays
+  // point layout, fallback for other types.
+  using PointsDispatcher = vtkArrayDispatch::DispatchByArray<vtkArrayDispatch::PointArrays>;
   using Dispatcher = vtkArrayDispatch::DispatchByValueTypeUsingArrays<vtkArrayDispatch::AllArrays,
     vtkArrayDispatch::Reals>;
   BoundsPointIdsWorker worker;
 
-  if (!Dispatcher::Execute(pts->GetData(), worker, ptIds, numberOfPointsIds, bounds))
+  if (!PointsDispatcher::Execute(pts->GetData(), worker, ptIds, numberOfPointsIds, bounds) &&
+    !Dispatcher::Execute(pts->GetData(), worker, ptIds, numberOfPointsIds, bounds))
   { // Fallback to slowpath for other point types
     worker(pts->GetData(), ptIds, numberOfPointsIds, bounds);
   }
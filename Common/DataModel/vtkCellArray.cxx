@@ -3,6 +3,7 @@
 
 #include "vtkCellArray.h"
 
+#include "vtkAffineArray.h"
 #include "vtkArrayDispatch.h"
 #include "vtkCellArrayIterator.h"
 #include "vtkDataArrayRange.h"
@@ -17,6 +18,7 @@
 #include <algorithm>
 #include <array>
 #include <iterator>
+#include <vector>
 
 namespace
 {
@@ -116,8 +118,7 @@ struct GetInsertLocationImpl
   {
     // The insert location used to just be the tail of the connectivity array.
     // Compute the equivalent value:
-    return (
-      (cells.GetOffsets()->GetNumberOfValues() - 1) + cells.GetConnectivity()->GetNumberOfValues());
+    return cells.GetNumberOfCells() + cells.GetConnectivity()->GetNumberOfValues();
   }
 };
 
@@ -163,7 +164,7 @@ struct SqueezeImpl
   void operator()(CellStateT& cells) const
   {
     cells.GetConnectivity()->Squeeze();
-    cells.GetOffsets()->Squeeze();
+    cells.GetStoredOffsets()->Squeeze();
   }
 };
 
@@ -217,10 +218,10 @@ struct CanConvert
     using ArrayType = typename CellStateT::ArrayType;
     using ValueType = typename CellStateT::ValueType;
 
-    // offsets are sorted, so just check the last value, but we have to compute
-    // the full range of the connectivity array.
-    auto* off = state.GetOffsets();
-    if (off->GetNumberOfValues() > 0 && !this->CheckValue(off->GetValue(off->GetMaxId())))
+    // offsets are sorted, so just check the last value, which is the size of
+    // the connectivity array (also when the offsets are implicit), but we have
+    // to compute the full range of the connectivity array.
+    if (!this->CheckValue(state.GetConnectivity()->GetNumberOfValues()))
     {
       return false;
     }
@@ -251,21 +252,27 @@ struct ExtractAndInitialize
   template <typename CellStateT, typename TargetArrayT>
   bool operator()(CellStateT& state, TargetArrayT* offsets, TargetArrayT* conn) const
   {
-    return (
-      this->Process(state.GetOffsets(), offsets) && this->Process(state.GetConnectivity(), conn));
+    return (this->Process(state.GetStoredOffsets(), offsets) &&
+      this->Process(state.GetConnectivity(), conn));
   }
 
   template <typename SourceArrayT, typename TargetArrayT>
   bool Process(SourceArrayT* src, TargetArrayT* dst) const
   {
+    using SrcValueType = vtk::GetAPIType<SourceArrayT>;
+    using DstValueType = vtk::GetAPIType<TargetArrayT>;
+
     // Check that allocation succeeds:
-    if (!dst->Resize(src->GetNumberOfTuples()))
+    if (!dst->SetNumberOfValues(src->GetNumberOfValues()))
     {
       return false;
     }
 
-    // Copy data:
-    dst->DeepCopy(src);
+    // Convert data:
+    const auto srcRange = vtk::DataArrayValueRange<1>(src);
+    auto dstRange = vtk::DataArrayValueRange<1>(dst);
+    vtkSMPTools::Transform(srcRange.cbegin(), srcRange.cend(), dstRange.begin(),
+      [](SrcValueType x) -> DstValueType { return static_cast<DstValueType>(x); });
 
     // Free old memory:
     src->Resize(0);
@@ -378,8 +385,8 @@ struct GetActualMemorySizeImpl
   template <typename CellStateT>
   unsigned long operator()(CellStateT& cells) const
   {
-    return (
-      cells.GetOffsets()->GetActualMemorySize() + cells.GetConnectivity()->GetActualMemorySize());
+    return (cells.GetStoredOffsets()->GetActualMemorySize() +
+      cells.GetConnectivity()->GetActualMemorySize());
   }
 };
 
@@ -389,7 +396,7 @@ struct PrintSelfImpl
   void operator()(CellStateT& cells, ostream& os, vtkIndent indent) const
   {
     os << indent << "Offsets:\n";
-    cells.GetOffsets()->PrintSelf(os, indent.GetNextIndent());
+    cells.GetStoredOffsets()->PrintSelf(os, indent.GetNextIndent());
     os << indent << "Connectivity:\n";
     cells.GetConnectivity()->PrintSelf(os, indent.GetNextIndent());
   }
@@ -400,8 +407,7 @@ struct GetLegacyDataSizeImpl
   template <typename CellStateT>
   vtkIdType operator()(CellStateT& cells) const
   {
-    return (
-      (cells.GetOffsets()->GetNumberOfValues() - 1) + cells.GetConnectivity()->GetNumberOfValues());
+    return cells.GetNumberOfCells() + cells.GetConnectivity()->GetNumberOfValues();
   }
 };
 
@@ -519,6 +525,188 @@ struct AppendImpl
   }
 };
 
+struct FillFixedSizeOffsetsImpl
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* offsets, vtkIdType numCells, vtkIdType cellSize) const
+  {
+    using ValueType = vtk::GetAPIType<ArrayT>;
+    offsets->SetNumberOfValues(numCells + 1);
+    ValueType* offs = offsets->GetPointer(0);
+    vtkSMPTools::For(0, numCells + 1,
+      [offs, cellSize](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType cellId = begin; cellId < end; ++cellId)
+        {
+          offs[cellId] = static_cast<ValueType>(cellId * cellSize);
+        }
+      });
+  }
+};
+
+// Return the slope of an affine offsets array starting at 0, or 0 if offsets
+// is not such an array.
+template <typename ValueType>
+vtkIdType GetAffineOffsetsCellSize(vtkDataArray* offsets)
+{
+  auto* affine = vtkArrayDownCast<vtkAffineArray<ValueType>>(offsets);
+  if (!affine || !affine->GetBackend() || affine->GetBackend()->Intercept != 0 ||
+    affine->GetBackend()->Slope <= 0)
+  {
+    return 0;
+  }
+  return static_cast<vtkIdType>(affine->GetBackend()->Slope);
+}
+
+vtkIdType GetAffineOffsetsCellSize(vtkDataArray* offsets)
+{
+  switch (offsets->GetDataType())
+  {
+    vtkTemplateMacro(return GetAffineOffsetsCellSize<VTK_TT>(offsets));
+  }
+  return 0;
+}
+
+struct AppendPieceImpl
+{
+  // Copy the cells of src to dst, starting at the cell cellBegin and at the
+  // connectivity index connBegin. dst is already sized.
+  template <typename SrcCellStateT, typename DstCellStateT>
+  void operator()(SrcCellStateT& src, DstCellStateT& dst, vtkIdType cellBegin, vtkIdType connBegin,
+    vtkIdType pointOffset) const
+  {
+    using SrcValueType = typename SrcCellStateT::ValueType;
+    using DstValueType = typename DstCellStateT::ValueType;
+
+    const SrcValueType* srcOffsets = src.GetOffsets()->GetPointer(0);
+    const SrcValueType* srcConn = src.GetConnectivity()->GetPointer(0);
+    DstValueType* dstOffsets = dst.GetOffsets()->GetPointer(cellBegin);
+    DstValueType* dstConn = dst.GetConnectivity()->GetPointer(connBegin);
+    const DstValueType offset = static_cast<DstValueType>(connBegin - srcOffsets[0]);
+    const DstValueType ptOffset = static_cast<DstValueType>(pointOffset);
+
+    // The first offset of the piece is the last one of the previous piece.
+    vtkSMPTools::For(1, src.GetOffsets()->GetNumberOfValues(),
+      [=](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          dstOffsets[i] = static_cast<DstValueType>(srcOffsets[i]) + offset;
+        }
+      });
+    vtkSMPTools::For(0, src.GetConnectivity()->GetNumberOfValues(),
+      [=](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          dstConn[i] = static_cast<DstValueType>(srcConn[i]) + ptOffset;
+        }
+      });
+  }
+};
+
+struct AppendCellArraysImpl
+{
+  template <typename DstCellStateT>
+  void operator()(DstCellStateT& dst, vtkCellArray* const* pieces, int numPieces,
+    const vtkIdType* pointOffsets) const
+  {
+    // Prefix sums of the piece sizes give the location of each piece.
+    std::vector<vtkIdType> cellBegin(numPieces + 1);
+    std::vector<vtkIdType> connBegin(numPieces + 1);
+    cellBegin[0] = dst.GetNumberOfCells();
+    connBegin[0] = dst.GetConnectivity()->GetNumberOfValues();
+    for (int i = 0; i < numPieces; ++i)
+    {
+      cellBegin[i + 1] = cellBegin[i] + (pieces[i] ? pieces[i]->GetNumberOfCells() : 0);
+      connBegin[i + 1] =
+        connBegin[i] + (pieces[i] ? pieces[i]->GetNumberOfConnectivityIds() : 0);
+    }
+
+    dst.GetOffsets()->SetNumberOfValues(cellBegin[numPieces] + 1);
+    dst.GetConnectivity()->SetNumberOfValues(connBegin[numPieces]);
+    for (int i = 0; i < numPieces; ++i)
+    {
+      if (pieces[i] && pieces[i]->GetNumberOfCells() > 0)
+      {
+        pieces[i]->Visit(AppendPieceImpl{}, dst, cellBegin[i], connBegin[i],
+          pointOffsets ? pointOffsets[i] : 0);
+      }
+    }
+  }
+};
+
+struct ScanCellSizesImpl
+{
+  vtkIdType ConnectivitySize = 0;
+
+  // Exclusive prefix sum of the cell sizes, by blocks: the sums of the
+  // blocks are computed in parallel, scanned serially, then each block is
+  // scanned in parallel from the sum of the previous ones.
+  template <typename OffsetsArrayT, typename SizesArrayT>
+  void operator()(OffsetsArrayT* offsets, SizesArrayT* cellSizes)
+  {
+    using OffsetType = vtk::GetAPIType<OffsetsArrayT>;
+
+    const auto sizes = vtk::DataArrayValueRange<1>(cellSizes);
+    auto offs = vtk::DataArrayValueRange<1>(offsets);
+    const vtkIdType numCells = sizes.size();
+    const vtkIdType blockSize = 16384;
+    const vtkIdType numBlocks = (numCells + blockSize - 1) / blockSize;
+
+    std::vector<OffsetType> blockOffsets(numBlocks + 1, 0);
+    vtkSMPTools::For(0, numBlocks,
+      [&](vtkIdType block, vtkIdType endBlock)
+      {
+        for (; block < endBlock; ++block)
+        {
+          OffsetType sum = 0;
+          const vtkIdType end = std::min(numCells, (block + 1) * blockSize);
+          for (vtkIdType i = block * blockSize; i < end; ++i)
+          {
+            sum += static_cast<OffsetType>(sizes[i]);
+          }
+          blockOffsets[block + 1] = sum;
+        }
+      });
+    for (vtkIdType block = 0; block < numBlocks; ++block)
+    {
+      blockOffsets[block + 1] += blockOffsets[block];
+    }
+
+    offs[0] = 0;
+    vtkSMPTools::For(0, numBlocks,
+      [&](vtkIdType block, vtkIdType endBlock)
+      {
+        for (; block < endBlock; ++block)
+        {
+          OffsetType offset = blockOffsets[block];
+          const vtkIdType end = std::min(numCells, (block + 1) * blockSize);
+          for (vtkIdType i = block * blockSize; i < end; ++i)
+          {
+            offset += static_cast<OffsetType>(sizes[i]);
+            offs[i + 1] = offset;
+          }
+        }
+      });
+    this->ConnectivitySize = static_cast<vtkIdType>(blockOffsets[numBlocks]);
+  }
+};
+
+// Dispatch the offsets array alone when the cell sizes array is not an
+// integral array of InputArrayList.
+struct ScanCellSizesFallback
+{
+  ScanCellSizesImpl& Worker;
+  vtkDataArray* CellSizes;
+
+  template <typename OffsetsArrayT>
+  void operator()(OffsetsArrayT* offsets)
+  {
+    this->Worker(offsets, this->CellSizes);
+  }
+};
+
 } // end anon namespace
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -546,7 +734,7 @@ vtkIdType vtkCellArray::GetSize()
 vtkIdType vtkCellArray::GetNumberOfConnectivityEntries()
 {
   // We can still compute roughly the same result, so go ahead and do that.
-  return this->Visit(GetLegacyDataSizeImpl{});
+  return this->VisitInternal(GetLegacyDataSizeImpl{});
 }
 
 //------------------------------------------------------------------------------
@@ -585,7 +773,7 @@ vtkIdType vtkCellArray::GetInsertLocation(int npts)
 {
   // It looks like the original implementation of this actually returned the
   // location of the last cell (of size npts), not the current insert location.
-  return this->Visit(deprec::GetInsertLocationImpl{}) - npts - 1;
+  return this->VisitInternal(deprec::GetInsertLocationImpl{}) - npts - 1;
 }
 
 //------------------------------------------------------------------------------
@@ -690,6 +878,7 @@ void vtkCellArray::DeepCopy(vtkAbstractCellArray* ca)
     auto& dstStorage = this->Storage.GetArrays64();
     dstStorage.Offsets->DeepCopy(srcStorage.Offsets);
     dstStorage.Connectivity->DeepCopy(srcStorage.Connectivity);
+    dstStorage.FixedCellSize = srcStorage.GetFixedCellSize();
     this->Modified();
   }
   else
@@ -699,6 +888,7 @@ void vtkCellArray::DeepCopy(vtkAbstractCellArray* ca)
     auto& dstStorage = this->Storage.GetArrays32();
     dstStorage.Offsets->DeepCopy(srcStorage.Offsets);
     dstStorage.Connectivity->DeepCopy(srcStorage.Connectivity);
+    dstStorage.FixedCellSize = srcStorage.GetFixedCellSize();
     this->Modified();
   }
 }
@@ -719,13 +909,14 @@ void vtkCellArray::ShallowCopy(vtkAbstractCellArray* ca)
   if (other->Storage.Is64Bit())
   {
     auto& srcStorage = other->Storage.GetArrays64();
-    this->SetData(srcStorage.GetOffsets(), srcStorage.GetConnectivity());
+    this->SetData(srcStorage.GetStoredOffsets(), srcStorage.GetConnectivity());
   }
   else
   {
     auto& srcStorage = other->Storage.GetArrays32();
-    this->SetData(srcStorage.GetOffsets(), srcStorage.GetConnectivity());
+    this->SetData(srcStorage.GetStoredOffsets(), srcStorage.GetConnectivity());
   }
+  this->SetFixedCellSizeInternal(other->GetFixedCellSize());
 }
 
 //------------------------------------------------------------------------------
@@ -737,10 +928,29 @@ void vtkCellArray::Append(vtkCellArray* src, vtkIdType pointOffset)
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkCellArray::AppendCellArrays(
+  vtkCellArray* const* pieces, int numPieces, const vtkIdType* pointOffsets)
+{
+  if (!pieces || numPieces <= 0)
+  {
+    return;
+  }
+  if (numPieces == 1 && pieces[0] && this->GetNumberOfCells() == 0 &&
+    (!pointOffsets || pointOffsets[0] == 0))
+  {
+    this->ShallowCopy(pieces[0]);
+    return;
+  }
+  this->Visit(AppendCellArraysImpl{}, pieces, numPieces, pointOffsets);
+  this->Modified();
+}
+
 //------------------------------------------------------------------------------
 void vtkCellArray::Initialize()
 {
-  this->Visit(InitializeImpl{});
+  this->SetFixedCellSizeInternal(0);
+  this->VisitInternal(InitializeImpl{});
 
   this->LegacyData->Initialize();
 }
@@ -770,6 +980,7 @@ void vtkCellArray::SetData(vtkTypeInt32Array* offsets, vtkTypeInt32Array* connec
   // vtkArrayDownCast to ensure this works when ArrayType32 is vtkIdTypeArray.
   storage.Offsets = vtkArrayDownCast<ArrayType32>(offsets);
   storage.Connectivity = vtkArrayDownCast<ArrayType32>(connectivity);
+  storage.FixedCellSize = 0;
   this->Modified();
 }
 
@@ -789,6 +1000,7 @@ void vtkCellArray::SetData(vtkTypeInt64Array* offsets, vtkTypeInt64Array* connec
   // vtkArrayDownCast to ensure this works when ArrayType64 is vtkIdTypeArray.
   storage.Offsets = vtkArrayDownCast<ArrayType64>(offsets);
   storage.Connectivity = vtkArrayDownCast<ArrayType64>(connectivity);
+  storage.FixedCellSize = 0;
   this->Modified();
 }
 
@@ -907,10 +1119,17 @@ struct GenerateOffsetsImpl
   template <typename ArrayT>
   void operator()(ArrayT* offsets)
   {
-    for (vtkIdType cc = 0, max = (offsets->GetNumberOfTuples() - 1); cc < max; ++cc)
-    {
-      offsets->SetTypedComponent(cc, 0, cc * this->CellSize);
-    }
+    using ValueType = vtk::GetAPIType<ArrayT>;
+    auto offs = vtk::DataArrayValueRange<1>(offsets);
+    const vtkIdType cellSize = this->CellSize;
+    vtkSMPTools::For(0, offsets->GetNumberOfTuples() - 1,
+      [&offs, cellSize](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType cc = begin; cc < end; ++cc)
+        {
+          offs[cc] = static_cast<ValueType>(cc * cellSize);
+        }
+      });
     offsets->SetTypedComponent(offsets->GetNumberOfTuples() - 1, 0, this->ConnectivityArraySize);
   }
 };
@@ -921,6 +1140,17 @@ VTK_ABI_NAMESPACE_BEGIN
 //------------------------------------------------------------------------------
 bool vtkCellArray::SetData(vtkDataArray* offsets, vtkDataArray* connectivity)
 {
+  // Implicit offsets of cells of the same size
+  if (const vtkIdType cellSize = ::GetAffineOffsetsCellSize(offsets))
+  {
+    if (offsets->GetNumberOfValues() * cellSize != connectivity->GetNumberOfValues() + cellSize)
+    {
+      vtkErrorMacro("The affine offsets array does not match the connectivity size.");
+      return false;
+    }
+    return this->SetFixedSizeData(cellSize, connectivity);
+  }
+
   SetDataGenericImpl worker{ this, connectivity, false };
   using SupportedArrays = vtkCellArray::InputArrayList;
   using Dispatch = vtkArrayDispatch::DispatchByArray<SupportedArrays>;
@@ -973,6 +1203,76 @@ bool vtkCellArray::SetData(vtkIdType cellSize, vtkDataArray* connectivity)
   return this->SetData(offsets, connectivity);
 }
 
+//------------------------------------------------------------------------------
+bool vtkCellArray::SetFixedSizeData(vtkIdType cellSize, vtkDataArray* connectivity)
+{
+  if (connectivity == nullptr || cellSize <= 0)
+  {
+    vtkErrorMacro("Invalid cellSize or connectivity array.");
+    return false;
+  }
+
+  if ((connectivity->GetNumberOfTuples() % cellSize) != 0)
+  {
+    vtkErrorMacro("Connectivity array size is not suitable for chosen cellSize");
+    return false;
+  }
+
+  // The offsets are implicit: use an empty offsets array.
+  vtkSmartPointer<vtkDataArray> offsets;
+  offsets.TakeReference(connectivity->NewInstance());
+  if (!this->SetData(offsets, connectivity))
+  {
+    return false;
+  }
+  this->SetFixedCellSizeInternal(cellSize);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkCellArray::SetDataFromCellSizes(vtkDataArray* cellSizes, vtkDataArray* connectivity)
+{
+  if (cellSizes == nullptr || connectivity == nullptr)
+  {
+    vtkErrorMacro("Invalid cellSizes or connectivity array.");
+    return false;
+  }
+  if (cellSizes->GetNumberOfComponents() != 1 || connectivity->GetNumberOfComponents() != 1)
+  {
+    vtkErrorMacro("Only single component arrays may be used for vtkCellArray "
+                  "storage.");
+    return false;
+  }
+
+  vtkSmartPointer<vtkDataArray> offsets;
+  offsets.TakeReference(connectivity->NewInstance());
+  offsets->SetNumberOfTuples(1 + cellSizes->GetNumberOfTuples());
+
+  ScanCellSizesImpl worker;
+  using SupportedArrays = vtkCellArray::InputArrayList;
+  using Dispatch = vtkArrayDispatch::Dispatch2ByArray<SupportedArrays, SupportedArrays>;
+  if (!Dispatch::Execute(offsets, cellSizes, worker))
+  {
+    ScanCellSizesFallback fallback{ worker, cellSizes };
+    if (!vtkArrayDispatch::DispatchByArray<SupportedArrays>::Execute(offsets, fallback))
+    {
+      vtkErrorMacro("Invalid array types passed to SetDataFromCellSizes: "
+        << "connectivity=" << connectivity->GetClassName());
+      return false;
+    }
+  }
+
+  if (worker.ConnectivitySize != connectivity->GetNumberOfValues())
+  {
+    vtkErrorMacro("The sum of the cell sizes (" << worker.ConnectivitySize
+                                                << ") does not match the connectivity size ("
+                                                << connectivity->GetNumberOfValues() << ").");
+    return false;
+  }
+
+  return this->SetData(offsets, connectivity);
+}
+
 //------------------------------------------------------------------------------
 void vtkCellArray::Use32BitStorage()
 {
@@ -1012,7 +1312,7 @@ bool vtkCellArray::CanConvertTo32BitStorage() const
   {
     return true;
   }
-  return this->Visit(CanConvert<ArrayType32::ValueType>{});
+  return this->VisitInternal(CanConvert<ArrayType32::ValueType>{});
 }
 
 //------------------------------------------------------------------------------
@@ -1038,14 +1338,16 @@ bool vtkCellArray::ConvertTo32BitStorage()
   {
     return true;
   }
+  const vtkIdType fixedCellSize = this->GetFixedCellSize();
   vtkNew<ArrayType32> offsets;
   vtkNew<ArrayType32> conn;
-  if (!this->Visit(ExtractAndInitialize{}, offsets.Get(), conn.Get()))
+  if (!this->VisitInternal(ExtractAndInitialize{}, offsets.Get(), conn.Get()))
   {
     return false;
   }
 
   this->SetData(offsets, conn);
+  this->SetFixedCellSizeInternal(fixedCellSize);
   return true;
 }
 
@@ -1056,14 +1358,16 @@ bool vtkCellArray::ConvertTo64BitStorage()
   {
     return true;
   }
+  const vtkIdType fixedCellSize = this->GetFixedCellSize();
   vtkNew<ArrayType64> offsets;
   vtkNew<ArrayType64> conn;
-  if (!this->Visit(ExtractAndInitialize{}, offsets.Get(), conn.Get()))
+  if (!this->VisitInternal(ExtractAndInitialize{}, offsets.Get(), conn.Get()))
   {
     return false;
   }
 
   this->SetData(offsets, conn);
+  this->SetFixedCellSizeInternal(fixedCellSize);
   return true;
 }
 
@@ -1088,6 +1392,47 @@ bool vtkCellArray::ConvertToSmallestStorage()
   return true;
 }
 
+//------------------------------------------------------------------------------
+bool vtkCellArray::ConvertToFixedSizeStorage()
+{
+  if (this->IsStorageFixedSize())
+  {
+    return true;
+  }
+  const vtkIdType cellSize = this->IsHomogeneous();
+  if (cellSize <= 0)
+  {
+    return false;
+  }
+
+  // The offsets array may be shared with another cell array: replace it.
+  if (this->Storage.Is64Bit())
+  {
+    this->Storage.GetArrays64().Offsets = vtkSmartPointer<ArrayType64>::New();
+  }
+  else
+  {
+    this->Storage.GetArrays32().Offsets = vtkSmartPointer<ArrayType32>::New();
+  }
+  this->SetFixedCellSizeInternal(cellSize);
+  this->Modified();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkCellArray::FillFixedSizeOffsets(
+  ArrayType32* offsets, vtkIdType numCells, vtkIdType cellSize)
+{
+  FillFixedSizeOffsetsImpl{}(offsets, numCells, cellSize);
+}
+
+//------------------------------------------------------------------------------
+void vtkCellArray::FillFixedSizeOffsets(
+  ArrayType64* offsets, vtkIdType numCells, vtkIdType cellSize)
+{
+  FillFixedSizeOffsetsImpl{}(offsets, numCells, cellSize);
+}
+
 //------------------------------------------------------------------------------
 bool vtkCellArray::AllocateExact(vtkIdType numCells, vtkIdType connectivitySize)
 {
@@ -1105,6 +1450,10 @@ bool vtkCellArray::ResizeExact(vtkIdType numCells, vtkIdType connectivitySize)
 // defining the cell.
 int vtkCellArray::GetMaxCellSize()
 {
+  if (this->IsStorageFixedSize())
+  {
+    return static_cast<int>(this->GetFixedCellSize());
+  }
   const vtkIdType numCells = this->GetNumberOfCells();
   // We use THRESHOLD to test if the data size is small enough
   // to execute the functor serially. This is faster.
@@ -1118,7 +1467,7 @@ int vtkCellArray::GetMaxCellSize()
 //------------------------------------------------------------------------------
 unsigned long vtkCellArray::GetActualMemorySize() const
 {
-  return this->Visit(GetActualMemorySizeImpl{});
+  return this->VisitInternal(GetActualMemorySizeImpl{});
 }
 
 //------------------------------------------------------------------------------
@@ -1127,16 +1476,17 @@ void vtkCellArray::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "StorageIs64Bit: " << this->Storage.Is64Bit() << "\n";
+  os << indent << "FixedCellSize: " << this->GetFixedCellSize() << "\n";
 
   PrintSelfImpl functor;
-  this->Visit(functor, os, indent);
+  this->VisitInternal(functor, os, indent);
 }
 
 //------------------------------------------------------------------------------
 void vtkCellArray::PrintDebug(std::ostream& os)
 {
   this->Print(os);
-  this->Visit(PrintDebugImpl{}, os);
+  this->VisitInternal(PrintDebugImpl{}, os);
 }
 
 //------------------------------------------------------------------------------
@@ -1154,33 +1504,34 @@ void vtkCellArray::SetTraversalCellId(vtkIdType cellId)
 //------------------------------------------------------------------------------
 void vtkCellArray::ReverseCellAtId(vtkIdType cellId)
 {
-  this->Visit(ReverseCellAtIdImpl{}, cellId);
+  this->VisitInternal(ReverseCellAtIdImpl{}, cellId);
 }
 
 //------------------------------------------------------------------------------
 void vtkCellArray::ReplaceCellAtId(vtkIdType cellId, vtkIdList* list)
 {
-  this->Visit(ReplaceCellAtIdImpl{}, cellId, list->GetNumberOfIds(), list->GetPointer(0));
+  this->VisitInternal(
+    ReplaceCellAtIdImpl{}, cellId, list->GetNumberOfIds(), list->GetPointer(0));
 }
 
 //------------------------------------------------------------------------------
 void vtkCellArray::ReplaceCellAtId(
   vtkIdType cellId, vtkIdType cellSize, const vtkIdType cellPoints[])
 {
-  this->Visit(ReplaceCellAtIdImpl{}, cellId, cellSize, cellPoints);
+  this->VisitInternal(ReplaceCellAtIdImpl{}, cellId, cellSize, cellPoints);
 }
 
 //------------------------------------------------------------------------------
 void vtkCellArray::ReplaceCellPointAtId(
   vtkIdType cellId, vtkIdType cellPointIndex, vtkIdType newPointId)
 {
-  this->Visit(ReplaceCellPointAtIdImpl{}, cellId, cellPointIndex, newPointId);
+  this->VisitInternal(ReplaceCellPointAtIdImpl{}, cellId, cellPointIndex, newPointId);
 }
 
 //------------------------------------------------------------------------------
 void vtkCellArray::ExportLegacyFormat(vtkIdTypeArray* data)
 {
-  data->Allocate(this->Visit(GetLegacyDataSizeImpl{}));
+  data->Allocate(this->VisitInternal(GetLegacyDataSizeImpl{}));
 
   auto it = vtk::TakeSmartPointer(this->NewIterator());
 
@@ -1225,7 +1576,7 @@ void vtkCellArray::AppendLegacyFormat(const vtkIdType* data, vtkIdType len, vtkI
 //------------------------------------------------------------------------------
 void vtkCellArray::Squeeze()
 {
-  this->Visit(SqueezeImpl{});
+  this->VisitInternal(SqueezeImpl{});
 
   // Just delete the legacy buffer.
   this->LegacyData->Initialize();
@@ -1234,12 +1585,23 @@ void vtkCellArray::Squeeze()
 //------------------------------------------------------------------------------
 bool vtkCellArray::IsValid()
 {
+  if (this->IsStorageFixedSize())
+  {
+    // Implicit offsets are valid if the cells fill the connectivity array.
+    vtkDataArray* conn = this->GetConnectivityArray();
+    return conn->GetNumberOfComponents() == 1 &&
+      conn->GetNumberOfValues() % this->GetFixedCellSize() == 0;
+  }
   return this->Visit(IsValidImpl{});
 }
 
 //------------------------------------------------------------------------------
 vtkIdType vtkCellArray::IsHomogeneous()
 {
+  if (this->IsStorageFixedSize())
+  {
+    return this->GetNumberOfCells() > 0 ? this->GetFixedCellSize() : 0;
+  }
   return this->Visit(IsHomogeneousImpl{});
 }
 VTK_ABI_NAMESPACE_END
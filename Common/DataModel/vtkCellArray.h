@@ -84,6 +84,24 @@
  * - `bool ConvertToDefaultStorage() // Depends on vtkIdType`
  * - `bool ConvertToSmallestStorage() // Depends on current values in arrays`
  *
+ * When all the cells have the same size (e.g. a triangle or tetrahedral
+ * mesh), the offsets may be left implicit: in fixed cell size storage, the
+ * offsets array is not stored and the offset of a cell is computed from its
+ * id. The cell accessors (GetCellAtId(), GetCellSize(), iterators...) and the
+ * insertion of cells of the same size work transparently in this mode, as do
+ * the Visit() functors using the cell accessors of their state. Methods
+ * exposing the offsets array (GetOffsetsArray(), GetOffsets() of a Visit()
+ * state...) and insertion of cells of a different size convert the storage
+ * back to explicit offsets first. This conversion is done once, and is safe
+ * to trigger from concurrent const accesses. Methods for managing this mode
+ * are:
+ *
+ * - `bool IsStorageFixedSize()`
+ * - `vtkIdType GetFixedCellSize()`
+ * - `bool ConvertToFixedSizeStorage() // Requires cells of the same size`
+ * - `void ConvertToVariableSizeStorage()`
+ * - `bool SetFixedSizeData(vtkIdType cellSize, vtkDataArray* connectivity)`
+ *
  * Note that some legacy methods are still available that reflect the
  * previous storage format of this data, which embedded the cell sizes into
  * the Connectivity array:
@@ -136,8 +154,10 @@
 #include "vtkTypeInt64Array.h"       // Needed for inline methods
 #include "vtkTypeList.h"             // Needed for ArrayList definition
 
+#include <atomic>           // for std::atomic
 #include <cassert>          // for assert
 #include <initializer_list> // for API
+#include <thread>           // for std::this_thread
 #include <type_traits>      // for std::is_same
 #include <utility>          // for std::forward
 
@@ -305,11 +325,11 @@ public:
   {
     if (this->Storage.Is64Bit())
     {
-      return this->Storage.GetArrays64().Offsets->GetNumberOfValues() - 1;
+      return this->Storage.GetArrays64().GetNumberOfCells();
     }
     else
     {
-      return this->Storage.GetArrays32().Offsets->GetNumberOfValues() - 1;
+      return this->Storage.GetArrays32().GetNumberOfCells();
     }
   }
 
@@ -317,17 +337,7 @@ public:
    * Get the number of elements in the offsets array. This will be the number of
    * cells + 1.
    */
-  vtkIdType GetNumberOfOffsets() const override
-  {
-    if (this->Storage.Is64Bit())
-    {
-      return this->Storage.GetArrays64().Offsets->GetNumberOfValues();
-    }
-    else
-    {
-      return this->Storage.GetArrays32().Offsets->GetNumberOfValues();
-    }
-  }
+  vtkIdType GetNumberOfOffsets() const override { return this->GetNumberOfCells() + 1; }
 
   /**
    * Get the offset (into the connectivity) for a specified cell id.
@@ -336,11 +346,11 @@ public:
   {
     if (this->Storage.Is64Bit())
     {
-      return this->Storage.GetArrays64().Offsets->GetValue(cellId);
+      return this->Storage.GetArrays64().GetBeginOffset(cellId);
     }
     else
     {
-      return this->Storage.GetArrays32().Offsets->GetValue(cellId);
+      return this->Storage.GetArrays32().GetBeginOffset(cellId);
     }
   }
 
@@ -397,6 +407,10 @@ public:
    * - Both arrays must be of the same type.
    * - The array type must be one of the types in InputArrayList.
    *
+   * As an exception, @a offsets may be a vtkAffineArray with a null
+   * intercept, in which case the fixed cell size storage is used with its
+   * slope as cell size (see SetFixedSizeData()).
+   *
    * If invalid arrays are passed in, an error is logged and the function
    * will return false.
    */
@@ -414,9 +428,19 @@ public:
    *
    * If invalid arrays are passed in, an error is logged and the function
    * will return false.
+   *
+   * The offsets are stored explicitly, use SetFixedSizeData() to leave them
+   * implicit.
    */
   bool SetData(vtkIdType cellSize, vtkDataArray* connectivity);
 
+  /**
+   * Same as SetData(vtkIdType, vtkDataArray*), but the cell array uses the
+   * fixed cell size storage: no offsets array is stored, the offsets being
+   * computed from the cell ids.
+   */
+  bool SetFixedSizeData(vtkIdType cellSize, vtkDataArray* connectivity);
+
   /**
    * @return True if the internal storage is using 64 bit arrays. If false,
    * the storage is using 32 bit arrays.
@@ -476,7 +500,9 @@ public:
    * If selecting smallest storage, the data is checked to see what the smallest
    * safe storage for the existing data is, and then converts to it.
    *
-   * Existing data is preserved.
+   * Existing data is preserved. The values are checked and converted in
+   * parallel, and the source arrays are released as soon as they are
+   * converted.
    *
    * @return True on success, false on failure. If this algorithm fails, the
    * cell array will be in an unspecified state.
@@ -489,9 +515,46 @@ public:
   bool ConvertToSmallestStorage();
   /**@}*/
 
+  /**
+   * Return true if the offsets are implicit, all the cells having
+   * GetFixedCellSize() points.
+   */
+  bool IsStorageFixedSize() const { return this->GetFixedCellSize() > 0; }
+
+  /**
+   * Return the size of all the cells when the storage is of fixed cell size,
+   * 0 otherwise.
+   */
+  vtkIdType GetFixedCellSize() const
+  {
+    if (this->Storage.Is64Bit())
+    {
+      return this->Storage.GetArrays64().GetFixedCellSize();
+    }
+    else
+    {
+      return this->Storage.GetArrays32().GetFixedCellSize();
+    }
+  }
+
+  /**
+   * Release the offsets array if all the cells have the same size, which is
+   * then used to compute the offsets. Return false, leaving the storage
+   * unchanged, if the cells have different sizes or the array is empty.
+   */
+  bool ConvertToFixedSizeStorage();
+
+  /**
+   * Store the offsets explicitly if the storage is of fixed cell size. This
+   * does not modify the cells, and is done implicitly by the methods needing
+   * explicit offsets.
+   */
+  void ConvertToVariableSizeStorage() const;
+
   /**
    * Return the array used to store cell offsets. The 32/64 variants are only
-   * valid when IsStorage64Bit() returns the appropriate value.
+   * valid when IsStorage64Bit() returns the appropriate value. With the fixed
+   * cell size storage, the offsets are stored explicitly first.
    * @{
    */
   vtkDataArray* GetOffsetsArray()
@@ -505,8 +568,16 @@ public:
       return this->GetOffsetsArray32();
     }
   }
-  ArrayType32* GetOffsetsArray32() { return this->Storage.GetArrays32().Offsets; }
-  ArrayType64* GetOffsetsArray64() { return this->Storage.GetArrays64().Offsets; }
+  ArrayType32* GetOffsetsArray32()
+  {
+    this->ConvertToVariableSizeStorage();
+    return this->Storage.GetArrays32().Offsets;
+  }
+  ArrayType64* GetOffsetsArray64()
+  {
+    this->ConvertToVariableSizeStorage();
+    return this->Storage.GetArrays64().Offsets;
+  }
   /**@}*/
 
   /**
@@ -736,6 +807,40 @@ public:
    */
   void Append(vtkCellArray* src, vtkIdType pointOffset = 0);
 
+  /**
+   * Append the cells of @a numPieces cell arrays into this, in order. This is
+   * meant to gather the per-thread cells of a vtkSMPTools::For() loop. If
+   * @a pointOffsets is not null, the point ids of the i-th piece are offset
+   * by `pointOffsets[i]`. Null pieces are skipped.
+   *
+   * The location of each piece in the offsets and connectivity arrays is
+   * computed with a prefix sum of the piece sizes, the arrays are resized
+   * once and the pieces are copied in parallel. When this cell array is
+   * empty and a single piece without point offset is given, its arrays are
+   * shared instead of being copied (see ShallowCopy()).
+   *
+   * @sa ConvertToSmallestStorage
+   */
+  void AppendCellArrays(
+    vtkCellArray* const* pieces, int numPieces, const vtkIdType* pointOffsets = nullptr);
+
+  /**
+   * Set the cells from the number of points of each cell and the
+   * connectivity array. The offsets are computed from @a cellSizes with a
+   * parallel prefix sum, in a new array of the type of @a connectivity, and
+   * @a connectivity is used without copy when possible (see SetData()).
+   *
+   * This method may fail if the following conditions are not met:
+   *
+   * - The `connectivity` array must be one of the types in InputArrayList.
+   * - Both arrays must have a single component.
+   * - The sum of the cell sizes must be the size of `connectivity`.
+   *
+   * If invalid arrays are passed in, an error is logged and the function
+   * will return false.
+   */
+  bool SetDataFromCellSizes(vtkDataArray* cellSizes, vtkDataArray* connectivity);
+
   /**
    * Fill @a data with the old-style vtkCellArray data layout, e.g.
    *
@@ -810,8 +915,18 @@ public:
     static constexpr bool ValueTypeIsSameAsIdType = std::is_integral<ValueType>::value &&
       std::is_signed<ValueType>::value && (sizeof(ValueType) == sizeof(vtkIdType));
 
-    ArrayType* GetOffsets() { return this->Offsets; }
-    const ArrayType* GetOffsets() const { return this->Offsets; }
+    // With the fixed cell size storage, the offsets are stored explicitly
+    // first, see vtkCellArray::ConvertToVariableSizeStorage().
+    ArrayType* GetOffsets()
+    {
+      this->StoreFixedSizeOffsets();
+      return this->Offsets;
+    }
+    const ArrayType* GetOffsets() const
+    {
+      const_cast<VisitState*>(this)->StoreFixedSizeOffsets();
+      return this->Offsets;
+    }
 
     ArrayType* GetConnectivity() { return this->Connectivity; }
     const ArrayType* GetConnectivity() const { return this->Connectivity; }
@@ -826,6 +941,16 @@ public:
 
     CellRangeType GetCellRange(vtkIdType cellId);
 
+    // Size of all the cells if the offsets are implicit, 0 otherwise.
+    vtkIdType GetFixedCellSize() const
+    {
+      return this->FixedCellSize.load(std::memory_order_acquire);
+    }
+
+    // The offsets array as stored, empty with the fixed cell size storage.
+    ArrayType* GetStoredOffsets() { return this->Offsets; }
+    const ArrayType* GetStoredOffsets() const { return this->Offsets; }
+
     friend class vtkCellArray;
 
   protected:
@@ -867,8 +992,17 @@ public:
 #endif
     }
 
+    // Fill a new offsets array from the fixed cell size. The first caller
+    // fills it while the concurrent ones wait for it.
+    void StoreFixedSizeOffsets();
+
     vtkSmartPointer<ArrayType> Connectivity;
     vtkSmartPointer<ArrayType> Offsets;
+    // Reset only once the explicit offsets are stored, so that concurrent
+    // readers seeing 0 also see the new offsets.
+    std::atomic<vtkIdType> FixedCellSize{ 0 };
+    // Set by the thread storing the explicit offsets.
+    std::atomic<bool> StoringOffsets{ false };
 
   private:
     VisitState(const VisitState&) = delete;
@@ -954,6 +1088,11 @@ public:
    * vtkIdType largest = cellArray->Visit(FindLargestCellInRange{},
    *                                      128, 1024);
    * ```
+   *
+   * With the fixed cell size storage, the functor may use the cell
+   * accessors of the state (GetNumberOfCells(), GetCellRange()...) that
+   * compute the offsets from the cell ids, while its GetOffsets() stores the
+   * offsets explicitly first.
    * @{
    */
   template <typename Functor, typename... Args,
@@ -1037,6 +1176,55 @@ public:
 
   /** @} */
 
+private:
+  // Same as Visit(), for the functors used internally, which access the
+  // offsets array of the fixed cell size storage with GetStoredOffsets().
+  template <typename Functor, typename... Args>
+  GetReturnType<Functor, Args...> VisitInternal(Functor&& functor, Args&&... args)
+  {
+    if (this->Storage.Is64Bit())
+    {
+      return functor(this->Storage.GetArrays64(), std::forward<Args>(args)...);
+    }
+    else
+    {
+      return functor(this->Storage.GetArrays32(), std::forward<Args>(args)...);
+    }
+  }
+  template <typename Functor, typename... Args>
+  GetReturnType<Functor, Args...> VisitInternal(Functor&& functor, Args&&... args) const
+  {
+    if (this->Storage.Is64Bit())
+    {
+      return functor(this->Storage.GetArrays64(), std::forward<Args>(args)...);
+    }
+    else
+    {
+      return functor(this->Storage.GetArrays32(), std::forward<Args>(args)...);
+    }
+  }
+
+  // Set the cell size of the fixed cell size storage, 0 for explicit offsets.
+  // The offsets array is not modified.
+  void SetFixedCellSizeInternal(vtkIdType cellSize)
+  {
+    if (this->Storage.Is64Bit())
+    {
+      this->Storage.GetArrays64().FixedCellSize = cellSize;
+    }
+    else
+    {
+      this->Storage.GetArrays32().FixedCellSize = cellSize;
+    }
+  }
+
+  // Fill the offsets array from the fixed cell size, for
+  // VisitState::StoreFixedSizeOffsets().
+  static void FillFixedSizeOffsets(ArrayType32* offsets, vtkIdType numCells, vtkIdType cellSize);
+  static void FillFixedSizeOffsets(ArrayType64* offsets, vtkIdType numCells, vtkIdType cellSize);
+
+public:
+
   /**
    * Control the default internal storage size. Useful for saving memory when
    * most cases can be handled with 32bit indices, but large models may require
@@ -1238,12 +1426,10 @@ protected:
     {
       if (this->StorageIs64Bit)
       {
-        this->Arrays->Int64->~VisitState();
         delete this->Arrays->Int64;
       }
       else
       {
-        this->Arrays->Int32->~VisitState();
         delete this->Arrays->Int32;
       }
 #ifdef VTK_USE_MEMKIND
@@ -1269,7 +1455,6 @@ protected:
         return false;
       }
 
-      this->Arrays->Int64->~VisitState();
       delete this->Arrays->Int64;
       this->Arrays->Int32 = new VisitState<ArrayType32>;
       this->StorageIs64Bit = false;
@@ -1286,7 +1471,6 @@ protected:
         return false;
       }
 
-      this->Arrays->Int32->~VisitState();
       delete this->Arrays->Int32;
       this->Arrays->Int64 = new VisitState<ArrayType64>;
       this->StorageIs64Bit = true;
@@ -1346,25 +1530,73 @@ private:
 template <typename ArrayT>
 vtkIdType vtkCellArray::VisitState<ArrayT>::GetNumberOfCells() const
 {
+  if (const vtkIdType cellSize = this->GetFixedCellSize())
+  {
+    return this->Connectivity->GetNumberOfValues() / cellSize;
+  }
   return this->Offsets->GetNumberOfValues() - 1;
 }
 
+template <typename ArrayT>
+void vtkCellArray::VisitState<ArrayT>::StoreFixedSizeOffsets()
+{
+  if (this->GetFixedCellSize() == 0)
+  {
+    return;
+  }
+  bool storing = false;
+  if (!this->StoringOffsets.compare_exchange_strong(storing, true, std::memory_order_acquire))
+  {
+    // Stored by another thread
+    while (this->GetFixedCellSize() != 0)
+    {
+      std::this_thread::yield();
+    }
+    return;
+  }
+
+  // Another thread may have stored them since the first check.
+  if (const vtkIdType cellSize = this->GetFixedCellSize())
+  {
+    // A new array, as the empty one may be shared with another cell array.
+    vtkSmartPointer<ArrayType> offsets = vtkSmartPointer<ArrayType>::New();
+    vtkCellArray::FillFixedSizeOffsets(
+      offsets, this->Connectivity->GetNumberOfValues() / cellSize, cellSize);
+    this->Offsets = offsets;
+    this->FixedCellSize.store(0, std::memory_order_release);
+  }
+  this->StoringOffsets.store(false, std::memory_order_release);
+}
+
 template <typename ArrayT>
 vtkIdType vtkCellArray::VisitState<ArrayT>::GetBeginOffset(vtkIdType cellId) const
 {
+  if (const vtkIdType cellSize = this->GetFixedCellSize())
+  {
+    return cellId * cellSize;
+  }
   return static_cast<vtkIdType>(this->Offsets->GetValue(cellId));
 }
 
 template <typename ArrayT>
 vtkIdType vtkCellArray::VisitState<ArrayT>::GetEndOffset(vtkIdType cellId) const
 {
+  if (const vtkIdType cellSize = this->GetFixedCellSize())
+  {
+    return (cellId + 1) * cellSize;
+  }
   return static_cast<vtkIdType>(this->Offsets->GetValue(cellId + 1));
 }
 
 template <typename ArrayT>
 vtkIdType vtkCellArray::VisitState<ArrayT>::GetCellSize(vtkIdType cellId) const
 {
-  return this->GetEndOffset(cellId) - this->GetBeginOffset(cellId);
+  if (const vtkIdType cellSize = this->GetFixedCellSize())
+  {
+    return cellSize;
+  }
+  return static_cast<vtkIdType>(this->Offsets->GetValue(cellId + 1)) -
+    static_cast<vtkIdType>(this->Offsets->GetValue(cellId));
 }
 
 template <typename ArrayT>
@@ -1388,11 +1620,15 @@ struct InsertNextCellImpl
   {
     using ValueType = typename CellStateT::ValueType;
     auto* conn = state.GetConnectivity();
-    auto* offsets = state.GetOffsets();
+    auto* offsets = state.GetStoredOffsets();
 
-    const vtkIdType cellId = offsets->GetNumberOfValues() - 1;
+    const vtkIdType cellId = state.GetNumberOfCells();
 
-    offsets->InsertNextValue(static_cast<ValueType>(conn->GetNumberOfValues() + npts));
+    // The offsets are implicit for the fixed cell size storage.
+    if (!state.GetFixedCellSize())
+    {
+      offsets->InsertNextValue(static_cast<ValueType>(conn->GetNumberOfValues() + npts));
+    }
 
     for (vtkIdType i = 0; i < npts; ++i)
     {
@@ -1537,9 +1773,9 @@ struct ResetImpl
   template <typename CellStateT>
   void operator()(CellStateT& state)
   {
-    state.GetOffsets()->Reset();
+    state.GetStoredOffsets()->Reset();
     state.GetConnectivity()->Reset();
-    state.GetOffsets()->InsertNextValue(0);
+    state.GetStoredOffsets()->InsertNextValue(0);
   }
 };
 
@@ -1584,33 +1820,38 @@ inline int vtkCellArray::GetNextCell(vtkIdList* pts)
 //----------------------------------------------------------------------------
 inline vtkIdType vtkCellArray::GetCellSize(const vtkIdType cellId) const
 {
-  return this->Visit(vtkCellArray_detail::GetCellSizeImpl{}, cellId);
+  return this->VisitInternal(vtkCellArray_detail::GetCellSizeImpl{}, cellId);
 }
 
 //----------------------------------------------------------------------------
 inline void vtkCellArray::GetCellAtId(vtkIdType cellId, vtkIdType& cellSize,
   vtkIdType const*& cellPoints, vtkIdList* ptIds) VTK_SIZEHINT(cellPoints, cellSize)
 {
-  this->Visit(vtkCellArray_detail::GetCellAtIdImpl{}, cellId, cellSize, cellPoints, ptIds);
+  this->VisitInternal(vtkCellArray_detail::GetCellAtIdImpl{}, cellId, cellSize, cellPoints, ptIds);
 }
 
 //----------------------------------------------------------------------------
 inline void vtkCellArray::GetCellAtId(vtkIdType cellId, vtkIdList* pts)
 {
-  this->Visit(vtkCellArray_detail::GetCellAtIdImpl{}, cellId, pts);
+  this->VisitInternal(vtkCellArray_detail::GetCellAtIdImpl{}, cellId, pts);
 }
 
 //----------------------------------------------------------------------------
 inline void vtkCellArray::GetCellAtId(vtkIdType cellId, vtkIdType& cellSize, vtkIdType* cellPoints)
 {
-  this->Visit(vtkCellArray_detail::GetCellAtIdImpl{}, cellId, cellSize, cellPoints);
+  this->VisitInternal(vtkCellArray_detail::GetCellAtIdImpl{}, cellId, cellSize, cellPoints);
 }
 
 //----------------------------------------------------------------------------
 inline vtkIdType vtkCellArray::InsertNextCell(vtkIdType npts, const vtkIdType* pts)
   VTK_SIZEHINT(pts, npts)
 {
-  return this->Visit(vtkCellArray_detail::InsertNextCellImpl{}, npts, pts);
+  const vtkIdType fixedCellSize = this->GetFixedCellSize();
+  if (fixedCellSize && fixedCellSize != npts)
+  {
+    this->ConvertToVariableSizeStorage();
+  }
+  return this->VisitInternal(vtkCellArray_detail::InsertNextCellImpl{}, npts, pts);
 }
 
 //----------------------------------------------------------------------------
@@ -1643,22 +1884,34 @@ inline void vtkCellArray::UpdateCellCount(int npts)
 //----------------------------------------------------------------------------
 inline vtkIdType vtkCellArray::InsertNextCell(vtkIdList* pts)
 {
-  return this->Visit(
-    vtkCellArray_detail::InsertNextCellImpl{}, pts->GetNumberOfIds(), pts->GetPointer(0));
+  return this->InsertNextCell(pts->GetNumberOfIds(), pts->GetPointer(0));
 }
 
 //----------------------------------------------------------------------------
 inline vtkIdType vtkCellArray::InsertNextCell(vtkCell* cell)
 {
   vtkIdList* pts = cell->GetPointIds();
-  return this->Visit(
-    vtkCellArray_detail::InsertNextCellImpl{}, pts->GetNumberOfIds(), pts->GetPointer(0));
+  return this->InsertNextCell(pts->GetNumberOfIds(), pts->GetPointer(0));
 }
 
 //----------------------------------------------------------------------------
 inline void vtkCellArray::Reset()
 {
-  this->Visit(vtkCellArray_detail::ResetImpl{});
+  this->SetFixedCellSizeInternal(0);
+  this->VisitInternal(vtkCellArray_detail::ResetImpl{});
+}
+
+//----------------------------------------------------------------------------
+inline void vtkCellArray::ConvertToVariableSizeStorage() const
+{
+  if (this->Storage.Is64Bit())
+  {
+    const_cast<vtkCellArray*>(this)->Storage.GetArrays64().StoreFixedSizeOffsets();
+  }
+  else
+  {
+    const_cast<vtkCellArray*>(this)->Storage.GetArrays32().StoreFixedSizeOffsets();
+  }
 }
 
 VTK_ABI_NAMESPACE_END
@@ -0,0 +1,316 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkConcurrentMergePoints.h"
+
+#include "vtkAtomicMutex.h"
+#include "vtkBoundingBox.h"
+#include "vtkCellArray.h"
+#include "vtkDataArray.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkConcurrentMergePoints);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// A unique point: its coordinates (in the precision of the output points),
+// its smallest key, the sequence number of its first insertion with that
+// key, and its provisional id.
+struct MergeEntry
+{
+  double X[3];
+  vtkIdType Key;
+  vtkIdType Sequence;
+  vtkIdType Id;
+};
+
+struct MergeBucket
+{
+  vtkAtomicMutex Lock;
+  std::vector<MergeEntry> Entries;
+};
+
+//------------------------------------------------------------------------------
+struct RenumberCellsImpl
+{
+  template <typename CellStateT>
+  void operator()(CellStateT& state, const vtkIdType* map) const
+  {
+    using ValueType = typename CellStateT::ValueType;
+    ValueType* ids = state.GetConnectivity()->GetPointer(0);
+    vtkSMPTools::For(0, state.GetConnectivity()->GetNumberOfValues(),
+      [ids, map](vtkIdType i, vtkIdType end)
+      {
+        for (; i < end; ++i)
+        {
+          ids[i] = static_cast<ValueType>(map[ids[i]]);
+        }
+      });
+  }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+class vtkConcurrentMergePoints::vtkInternals
+{
+public:
+  vtkSmartPointer<vtkPoints> Points;
+  bool FloatPrecision = false;
+  double Bounds[6] = { 0.0, 1.0, 0.0, 1.0, 0.0, 1.0 };
+  double H[3] = { 1.0, 1.0, 1.0 };
+  int Divisions[3] = { 1, 1, 1 };
+  std::vector<MergeBucket> Buckets;
+  std::atomic<vtkIdType> NextId{ 0 };
+  // Incremented by each insertion: consecutive insertions of a thread get
+  // increasing numbers, whatever the other threads do.
+  std::atomic<vtkIdType> NextSequence{ 0 };
+
+  // After Finalize(): provisional id -> final id, and final id -> provisional id.
+  std::vector<vtkIdType> Map;
+  std::vector<vtkIdType> Order;
+
+  void Round(const double x[3], double p[3]) const
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      p[i] = this->FloatPrecision ? static_cast<double>(static_cast<float>(x[i])) : x[i];
+    }
+  }
+
+  vtkIdType GetBucketIndex(const double x[3]) const
+  {
+    // Points outside of the bounds are clamped to the border buckets.
+    vtkIdType ijk[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      double t = (x[i] - this->Bounds[2 * i]) / this->H[i];
+      ijk[i] = t <= 0.0 ? 0 : static_cast<vtkIdType>(std::min(t, this->Divisions[i] - 1.0));
+    }
+    return ijk[0] + this->Divisions[0] * (ijk[1] + this->Divisions[1] * ijk[2]);
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkConcurrentMergePoints::vtkConcurrentMergePoints()
+  : Internals(new vtkInternals)
+{
+  this->NumberOfPointsPerBucket = 3;
+}
+
+//------------------------------------------------------------------------------
+vtkConcurrentMergePoints::~vtkConcurrentMergePoints() = default;
+
+//------------------------------------------------------------------------------
+int vtkConcurrentMergePoints::InitPointInsertion(
+  vtkPoints* newPts, const double bounds[6], vtkIdType estNumPts)
+{
+  if (newPts == nullptr)
+  {
+    vtkErrorMacro(<< "Must define points for point insertion");
+    return 0;
+  }
+
+  this->Internals.reset(new vtkInternals);
+  vtkInternals& internals = *this->Internals;
+  internals.Points = newPts;
+  internals.FloatPrecision = newPts->GetDataType() == VTK_FLOAT;
+
+  vtkBoundingBox bbox(bounds);
+  vtkIdType numBuckets = std::max(estNumPts / this->NumberOfPointsPerBucket, vtkIdType(1));
+  bbox.ComputeDivisions(numBuckets, internals.Bounds, internals.Divisions);
+  for (int i = 0; i < 3; ++i)
+  {
+    internals.Divisions[i] = std::max(internals.Divisions[i], 1);
+    internals.H[i] =
+      (internals.Bounds[2 * i + 1] - internals.Bounds[2 * i]) / internals.Divisions[i];
+    if (internals.H[i] <= 0.0)
+    {
+      internals.H[i] = 1.0;
+    }
+  }
+  internals.Buckets.resize(static_cast<size_t>(internals.Divisions[0]) * internals.Divisions[1] *
+    internals.Divisions[2]);
+  this->Modified();
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkConcurrentMergePoints::InsertUniquePoint(const double x[3], vtkIdType& id, vtkIdType key)
+{
+  vtkInternals& internals = *this->Internals;
+  double p[3];
+  internals.Round(x, p);
+  MergeBucket& bucket = internals.Buckets[internals.GetBucketIndex(p)];
+  const vtkIdType sequence = internals.NextSequence.fetch_add(1, std::memory_order_relaxed);
+
+  std::lock_guard<vtkAtomicMutex> lock(bucket.Lock);
+  for (MergeEntry& entry : bucket.Entries)
+  {
+    if (entry.X[0] == p[0] && entry.X[1] == p[1] && entry.X[2] == p[2])
+    {
+      // point is already in the list, keep its first insertion with the
+      // smallest key
+      if (key < entry.Key || (key == entry.Key && sequence < entry.Sequence))
+      {
+        entry.Key = key;
+        entry.Sequence = sequence;
+      }
+      id = entry.Id;
+      return 0;
+    }
+  }
+  id = internals.NextId++;
+  bucket.Entries.push_back(MergeEntry{ { p[0], p[1], p[2] }, key, sequence, id });
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkConcurrentMergePoints::IsInsertedPoint(const double x[3])
+{
+  vtkInternals& internals = *this->Internals;
+  if (internals.Buckets.empty())
+  {
+    return -1;
+  }
+  double p[3];
+  internals.Round(x, p);
+  MergeBucket& bucket = internals.Buckets[internals.GetBucketIndex(p)];
+
+  std::lock_guard<vtkAtomicMutex> lock(bucket.Lock);
+  for (const MergeEntry& entry : bucket.Entries)
+  {
+    if (entry.X[0] == p[0] && entry.X[1] == p[1] && entry.X[2] == p[2])
+    {
+      return entry.Id;
+    }
+  }
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkConcurrentMergePoints::GetNumberOfInsertedPoints() const
+{
+  return this->Internals->NextId;
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentMergePoints::Finalize()
+{
+  vtkInternals& internals = *this->Internals;
+  if (!internals.Points)
+  {
+    vtkErrorMacro(<< "InitPointInsertion must be called before Finalize");
+    return;
+  }
+  const vtkIdType numPts = internals.NextId;
+
+  // Gather the unique points by provisional id.
+  std::vector<const MergeEntry*> entries(numPts);
+  const MergeBucket* buckets = internals.Buckets.data();
+  vtkSMPTools::For(0, static_cast<vtkIdType>(internals.Buckets.size()),
+    [buckets, &entries](vtkIdType bucketId, vtkIdType end)
+    {
+      for (; bucketId < end; ++bucketId)
+      {
+        for (const MergeEntry& entry : buckets[bucketId].Entries)
+        {
+          entries[entry.Id] = &entry;
+        }
+      }
+    });
+
+  // Sort them by key, then in the order of their insertion with that key.
+  // Sequence numbers are unique, so that no two entries are equivalent.
+  internals.Order.resize(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    internals.Order[i] = i;
+  }
+  vtkSMPTools::Sort(internals.Order.begin(), internals.Order.end(),
+    [&entries](vtkIdType a, vtkIdType b)
+    {
+      const MergeEntry& ea = *entries[a];
+      const MergeEntry& eb = *entries[b];
+      if (ea.Key != eb.Key)
+      {
+        return ea.Key < eb.Key;
+      }
+      return ea.Sequence < eb.Sequence;
+    });
+
+  // Build the map and copy the points in their final order.
+  internals.Map.resize(numPts);
+  vtkIdType* map = internals.Map.data();
+  const vtkIdType* order = internals.Order.data();
+  vtkDataArray* data = internals.Points->GetData();
+  internals.Points->SetNumberOfPoints(numPts);
+  vtkSMPTools::For(0, numPts,
+    [map, order, data, &entries](vtkIdType ptId, vtkIdType end)
+    {
+      for (; ptId < end; ++ptId)
+      {
+        map[order[ptId]] = ptId;
+        data->SetTuple(ptId, entries[order[ptId]]->X);
+      }
+    });
+  internals.Points->Modified();
+
+  // The buckets are not needed anymore.
+  std::vector<MergeBucket>().swap(internals.Buckets);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkConcurrentMergePoints::GetFinalId(vtkIdType provisionalId) const
+{
+  return this->Internals->Map[provisionalId];
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentMergePoints::RenumberCells(vtkCellArray* cells) const
+{
+  if (!cells || this->Internals->Map.empty())
+  {
+    return;
+  }
+  cells->Visit(RenumberCellsImpl{}, this->Internals->Map.data());
+  cells->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentMergePoints::ReorderPointData(vtkPointData* inPD, vtkPointData* outPD) const
+{
+  if (!inPD || !outPD)
+  {
+    return;
+  }
+  const std::vector<vtkIdType>& order = this->Internals->Order;
+  const vtkIdType numPts = static_cast<vtkIdType>(order.size());
+  vtkNew<vtkIdList> fromIds;
+  fromIds->SetNumberOfIds(numPts);
+  std::copy(order.begin(), order.end(), fromIds->begin());
+  outPD->CopyAllocate(inPD, numPts);
+  outPD->CopyData(inPD, fromIds);
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentMergePoints::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfPointsPerBucket: " << this->NumberOfPointsPerBucket << "\n";
+  os << indent << "Divisions: (" << this->Internals->Divisions[0] << ", "
+     << this->Internals->Divisions[1] << ", " << this->Internals->Divisions[2] << ")\n";
+  os << indent << "NumberOfInsertedPoints: " << this->GetNumberOfInsertedPoints() << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkConcurrentMergePoints
+ * @brief   merge exactly coincident points inserted concurrently
+ *
+ * vtkConcurrentMergePoints provides the point merging functionality of
+ * vtkMergePoints (i.e., exactly coincident points are merged) to algorithms
+ * inserting points from multiple threads, for example from a
+ * vtkSMPTools::For() loop. All threads share a single locator: space is
+ * divided in a regular array of buckets, each one protected by its own
+ * spin lock, so that threads only contend when inserting points in the
+ * same bucket.
+ *
+ * Because the order in which threads insert points is not reproducible,
+ * InsertUniquePoint() returns provisional point ids, which are dense (in
+ * the range [0, GetNumberOfInsertedPoints())) but depend on the thread
+ * scheduling. Once all the points are inserted, Finalize() renumbers the
+ * points and fills the output points. The final order sorts the points
+ * by increasing key, an optional value given with each insertion (the
+ * smallest one is kept when a point is inserted several times), then in
+ * the order of their insertions with that key. When the keys are the
+ * indices of a serial loop (e.g., the id of the edge or cell generating
+ * the points), and all the points of an iteration are inserted by the
+ * thread running it, the final ids are the ones vtkMergePoints would
+ * assign when running that loop serially. The output is then independent
+ * of the number of threads. The order of points inserted with the same
+ * key by several threads depends on the thread scheduling, e.g., when
+ * the default key is used concurrently.
+ *
+ * The typical usage is:
+ *  - InitPointInsertion() from a single thread,
+ *  - InsertUniquePoint() from any number of threads, storing the
+ *    provisional ids in the connectivity and the point data of the new
+ *    points at their provisional id,
+ *  - Finalize() from a single thread,
+ *  - RenumberCells() (or GetFinalId()) to translate the connectivity, and
+ *    ReorderPointData() to reorder the point data.
+ *
+ * @warning
+ * As with vtkMergePoints, points are merged when their coordinates are
+ * exactly equal, in the precision of the output points.
+ *
+ * @sa
+ * vtkMergePoints vtkPointLocator vtkStaticPointLocator
+ */
+
+#ifndef vtkConcurrentMergePoints_h
+#define vtkConcurrentMergePoints_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <memory> // For unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkCellArray;
+class vtkPointData;
+class vtkPoints;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkConcurrentMergePoints : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods to instantiate, print and obtain type-related information.
+   */
+  static vtkConcurrentMergePoints* New();
+  vtkTypeMacro(vtkConcurrentMergePoints, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Specify the average number of points in each bucket, used with the
+   * estimated number of points given to InitPointInsertion() to choose the
+   * number of buckets. Default is 3.
+   */
+  vtkSetClampMacro(NumberOfPointsPerBucket, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfPointsPerBucket, int);
+  ///@}
+
+  /**
+   * Initialize the point insertion. newPts receives the merged points when
+   * Finalize() is called; its data type defines the precision in which the
+   * points are compared. The points are expected to lie in bounds (points
+   * outside of it are still merged correctly, but less efficiently).
+   * estNumPts is an estimate of the number of inserted points. Return 0 on
+   * failure. Not thread safe.
+   */
+  int InitPointInsertion(vtkPoints* newPts, const double bounds[6], vtkIdType estNumPts);
+
+  /**
+   * Insert a point unless an exactly coincident point has already been
+   * inserted. id receives the provisional id of the point. Return 1 if the
+   * point was inserted, 0 if it was merged. key orders the points during
+   * Finalize(), the points inserted with the same key keeping the order of
+   * their insertions. This method is thread safe.
+   */
+  int InsertUniquePoint(const double x[3], vtkIdType& id, vtkIdType key = 0);
+
+  /**
+   * Return the provisional id of the point x if it has been inserted, -1
+   * otherwise. This method is thread safe.
+   */
+  vtkIdType IsInsertedPoint(const double x[3]);
+
+  /**
+   * Return the number of unique points inserted so far.
+   */
+  vtkIdType GetNumberOfInsertedPoints() const;
+
+  /**
+   * Renumber the inserted points by key and copy them, in their final
+   * order, to the points given to InitPointInsertion(). Not thread safe; no
+   * point may be inserted afterwards until InitPointInsertion() is called
+   * again.
+   */
+  void Finalize();
+
+  /**
+   * Return the final id of a point given its provisional id. Only valid
+   * after Finalize(). This method is thread safe.
+   */
+  vtkIdType GetFinalId(vtkIdType provisionalId) const;
+
+  /**
+   * Replace the provisional point ids of the connectivity of cells by the
+   * final ids, in parallel. Only valid after Finalize().
+   */
+  void RenumberCells(vtkCellArray* cells) const;
+
+  /**
+   * Copy the tuples of inPD, indexed by provisional ids, to outPD in the
+   * final order of the points. Only valid after Finalize().
+   */
+  void ReorderPointData(vtkPointData* inPD, vtkPointData* outPD) const;
+
+protected:
+  vtkConcurrentMergePoints();
+  ~vtkConcurrentMergePoints() override;
+
+  int NumberOfPointsPerBucket;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+
+private:
+  vtkConcurrentMergePoints(const vtkConcurrentMergePoints&) = delete;
+  void operator=(const vtkConcurrentMergePoints&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
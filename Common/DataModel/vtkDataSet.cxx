@@ -23,17 +23,32 @@
 #include "vtkMath.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredData.h"
 
 #include <cmath>
+#include <mutex>
 #include <set>
 
+VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+class vtkDataSet::vtkCellGeometryCache
+{
+public:
+  std::mutex Lock;
+  std::shared_ptr<std::vector<double>> Bounds;
+  std::shared_ptr<std::vector<double>> Centers;
+  vtkTimeStamp BoundsTime;
+  vtkTimeStamp CentersTime;
+};
+
 //------------------------------------------------------------------------------
 // Constructor with default bounds (0,1, 0,1, 0,1).
-VTK_ABI_NAMESPACE_BEGIN
 vtkDataSet::vtkDataSet()
+  : CellGeometryCache(new vtkCellGeometryCache)
 {
   vtkMath::UninitializeBounds(this->Bounds);
   // Observer for updating the cell/point ghost arrays pointers
@@ -78,6 +93,7 @@ void vtkDataSet::Initialize()
   }
   this->CellData->Initialize();
   this->PointData->Initialize();
+  this->ReleaseCellGeometryCache();
 }
 
 //------------------------------------------------------------------------------
@@ -199,6 +215,139 @@ void vtkDataSet::ComputeBounds()
   }
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+// Evaluate the parametric center of the cells, like vtkCellCenters.
+struct CellCentersFunctor
+{
+  vtkDataSet* DataSet;
+  double* Centers;
+  int MaxCellSize;
+  vtkSMPThreadLocalObject<vtkGenericCell> TLCell;
+  vtkSMPThreadLocal<std::vector<double>> TLWeights;
+
+  CellCentersFunctor(vtkDataSet* dataSet, double* centers)
+    : DataSet(dataSet)
+    , Centers(centers)
+    , MaxCellSize(dataSet->GetMaxCellSize())
+  {
+  }
+
+  void Initialize() { this->TLWeights.Local().resize(this->MaxCellSize); }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    vtkGenericCell* cell = this->TLCell.Local();
+    double* weights = this->TLWeights.Local().data();
+    for (; cellId < endCellId; ++cellId)
+    {
+      double* x = this->Centers + 3 * cellId;
+      this->DataSet->GetCell(cellId, cell);
+      if (cell->GetCellType() != VTK_EMPTY_CELL)
+      {
+        double pcoords[3];
+        int subId = cell->GetParametricCenter(pcoords);
+        cell->EvaluateLocation(subId, pcoords, x, weights);
+      }
+      else
+      {
+        x[0] = x[1] = x[2] = 0.0;
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+std::shared_ptr<std::vector<double>> vtkDataSet::GetCellBoundsCache()
+{
+  vtkCellGeometryCache& cache = *this->CellGeometryCache;
+  std::lock_guard<std::mutex> lock(cache.Lock);
+  const vtkIdType numCells = this->GetNumberOfCells();
+  if (cache.Bounds && cache.BoundsTime > this->GetMTime() &&
+    cache.Bounds->size() == static_cast<size_t>(6 * numCells))
+  {
+    return cache.Bounds;
+  }
+
+  cache.Bounds.reset();
+  auto bounds = std::make_shared<std::vector<double>>(6 * numCells);
+  if (numCells > 0)
+  {
+    // The first call initializes the internal structures of the dataset.
+    double* cellBounds = bounds->data();
+    this->GetCellBounds(0, cellBounds);
+    vtkSMPTools::For(1, numCells,
+      [this, cellBounds](vtkIdType cellId, vtkIdType endCellId)
+      {
+        for (; cellId < endCellId; ++cellId)
+        {
+          this->GetCellBounds(cellId, cellBounds + 6 * cellId);
+        }
+      });
+  }
+  cache.Bounds = bounds;
+  cache.BoundsTime.Modified();
+  return bounds;
+}
+
+//------------------------------------------------------------------------------
+std::shared_ptr<std::vector<double>> vtkDataSet::GetCellCentersCache()
+{
+  vtkCellGeometryCache& cache = *this->CellGeometryCache;
+  std::lock_guard<std::mutex> lock(cache.Lock);
+  const vtkIdType numCells = this->GetNumberOfCells();
+  if (cache.Centers && cache.CentersTime > this->GetMTime() &&
+    cache.Centers->size() == static_cast<size_t>(3 * numCells))
+  {
+    return cache.Centers;
+  }
+
+  cache.Centers.reset();
+  auto centers = std::make_shared<std::vector<double>>(3 * numCells);
+  if (numCells > 0)
+  {
+    // The first call initializes the internal structures of the dataset.
+    vtkNew<vtkGenericCell> cell;
+    this->GetCell(0, cell);
+    CellCentersFunctor functor(this, centers->data());
+    vtkSMPTools::For(0, numCells, functor);
+  }
+  cache.Centers = centers;
+  cache.CentersTime.Modified();
+  return centers;
+}
+
+//------------------------------------------------------------------------------
+bool vtkDataSet::IsCellBoundsCacheValid()
+{
+  vtkCellGeometryCache& cache = *this->CellGeometryCache;
+  std::lock_guard<std::mutex> lock(cache.Lock);
+  return cache.Bounds && cache.BoundsTime > this->GetMTime() &&
+    cache.Bounds->size() == static_cast<size_t>(6 * this->GetNumberOfCells());
+}
+
+//------------------------------------------------------------------------------
+bool vtkDataSet::IsCellCentersCacheValid()
+{
+  vtkCellGeometryCache& cache = *this->CellGeometryCache;
+  std::lock_guard<std::mutex> lock(cache.Lock);
+  return cache.Centers && cache.CentersTime > this->GetMTime() &&
+    cache.Centers->size() == static_cast<size_t>(3 * this->GetNumberOfCells());
+}
+
+//------------------------------------------------------------------------------
+void vtkDataSet::ReleaseCellGeometryCache()
+{
+  vtkCellGeometryCache& cache = *this->CellGeometryCache;
+  std::lock_guard<std::mutex> lock(cache.Lock);
+  cache.Bounds.reset();
+  cache.Centers.reset();
+}
+
 //------------------------------------------------------------------------------
 // Description:
 // Compute the range of the scalars and cache it into ScalarRange
@@ -676,6 +825,13 @@ unsigned long vtkDataSet::GetActualMemorySize()
   {
     size += this->TempPoints->GetActualMemorySize();
   }
+  {
+    vtkCellGeometryCache& cache = *this->CellGeometryCache;
+    std::lock_guard<std::mutex> lock(cache.Lock);
+    const size_t numValues = (cache.Bounds ? cache.Bounds->size() : 0) +
+      (cache.Centers ? cache.Centers->size() : 0);
+    size += static_cast<unsigned long>(numValues * sizeof(double) / 1024);
+  }
   return size;
 }
 
@@ -716,6 +872,8 @@ void vtkDataSet::InternalDataSetCopy(vtkDataSet* src)
 {
   int idx;
 
+  this->ReleaseCellGeometryCache();
+
   this->ScalarRangeComputeTime = src->ScalarRangeComputeTime;
   this->ScalarRange[0] = src->ScalarRange[0];
   this->ScalarRange[1] = src->ScalarRange[1];
@@ -35,6 +35,9 @@
 #include "vtkSmartPointer.h"  // For vtkSmartPointer
 #include "vtkWrappingHints.h" // For VTK_MARSHALAUTO
 
+#include <memory> // For std::shared_ptr
+#include <vector> // For std::vector
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCell;
 class vtkCellData;
@@ -151,6 +154,40 @@ public:
    */
   virtual void GetCellBounds(vtkIdType cellId, double bounds[6]);
 
+  ///@{
+  /**
+   * Return the bounds of all the cells, 6 values per cell as returned by
+   * GetCellBounds(), or their centers, 3 values per cell (the parametric
+   * center of the cell in world coordinates as computed by vtkCellCenters,
+   * (0,0,0) for empty cells). They are computed in parallel on the first
+   * call, then cached until the dataset is modified, so that the locators
+   * and filters processing the same dataset share them. A cached vector is
+   * never modified by the dataset (it is replaced when recomputed), and
+   * must not be modified by the caller.
+   * THIS METHOD IS THREAD SAFE IF THE DATASET IS NOT MODIFIED
+   */
+  VTK_WRAPEXCLUDE std::shared_ptr<std::vector<double>> GetCellBoundsCache();
+  VTK_WRAPEXCLUDE std::shared_ptr<std::vector<double>> GetCellCentersCache();
+  ///@}
+
+  ///@{
+  /**
+   * Return true if the cached cell bounds (or centers) are up to date, i.e.,
+   * if the next call to GetCellBoundsCache() (or GetCellCentersCache()) will
+   * not compute them.
+   * THIS METHOD IS THREAD SAFE
+   */
+  bool IsCellBoundsCacheValid();
+  bool IsCellCentersCacheValid();
+  ///@}
+
+  /**
+   * Free the cached cell bounds and centers. The vectors returned before
+   * remain valid.
+   * THIS METHOD IS NOT THREAD SAFE.
+   */
+  void ReleaseCellGeometryCache();
+
   /**
    * Get type of cell with cellId such that: 0 <= cellId < NumberOfCells.
    * THIS METHOD IS THREAD SAFE IF FIRST CALLED FROM A SINGLE THREAD AND
@@ -608,6 +645,10 @@ private:
   // This should only be used if a vtkDataSet subclass don't define GetPoints()
   vtkSmartPointer<vtkPoints> TempPoints;
 
+  // Cached cell bounds and centers
+  class vtkCellGeometryCache;
+  std::unique_ptr<vtkCellGeometryCache> CellGeometryCache;
+
   vtkDataSet(const vtkDataSet&) = delete;
   void operator=(const vtkDataSet&) = delete;
 };
@@ -0,0 +1,723 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkHalfEdgeMesh.h"
+
+#include "vtkCellArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkHalfEdgeMesh);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Fill the faces: the half-edges of a cell are its connectivity entries.
+struct BuildFacesImpl
+{
+  template <typename CellStateT>
+  void operator()(CellStateT& state, vtkIdType numVerts, vtkIdType* origin, vtkIdType* next,
+    vtkIdType* face, vtkIdType* faceEdge, std::atomic<bool>& valid) const
+  {
+    const auto* conn = state.GetConnectivity()->GetPointer(0);
+    vtkSMPTools::For(0, state.GetNumberOfCells(),
+      [&](vtkIdType cellId, vtkIdType endCellId)
+      {
+        for (; cellId < endCellId; ++cellId)
+        {
+          const vtkIdType begin = state.GetBeginOffset(cellId);
+          const vtkIdType end = state.GetEndOffset(cellId);
+          faceEdge[cellId] = begin < end ? begin : -1;
+          for (vtkIdType edge = begin; edge < end; ++edge)
+          {
+            origin[edge] = static_cast<vtkIdType>(conn[edge]);
+            next[edge] = edge + 1 < end ? edge + 1 : begin;
+            face[edge] = cellId;
+            if (origin[edge] < 0 || origin[edge] >= numVerts)
+            {
+              valid = false;
+            }
+          }
+        }
+      });
+  }
+};
+
+// An edge, as its sorted end points, and one of its half-edges.
+struct EdgeKey
+{
+  vtkIdType V0;
+  vtkIdType V1;
+  vtkIdType HalfEdge;
+
+  bool operator<(const EdgeKey& other) const
+  {
+    return this->V0 < other.V0 ||
+      (this->V0 == other.V0 &&
+        (this->V1 < other.V1 || (this->V1 == other.V1 && this->HalfEdge < other.HalfEdge)));
+  }
+  bool SameEdge(const EdgeKey& other) const
+  {
+    return this->V0 == other.V0 && this->V1 == other.V1;
+  }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkHalfEdgeMesh::vtkHalfEdgeMesh() = default;
+
+//------------------------------------------------------------------------------
+vtkHalfEdgeMesh::~vtkHalfEdgeMesh() = default;
+
+//------------------------------------------------------------------------------
+void vtkHalfEdgeMesh::Initialize()
+{
+  std::vector<vtkIdType>().swap(this->Origin);
+  std::vector<vtkIdType>().swap(this->Next);
+  std::vector<vtkIdType>().swap(this->Twin);
+  std::vector<vtkIdType>().swap(this->Face);
+  std::vector<vtkIdType>().swap(this->FaceEdge);
+  std::vector<vtkIdType>().swap(this->VertexEdge);
+  this->NumberOfNonManifoldEdges = 0;
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+bool vtkHalfEdgeMesh::BuildFromPolyData(vtkPolyData* input)
+{
+  if (!input)
+  {
+    this->Initialize();
+    return false;
+  }
+  return this->BuildFromPolys(input->GetPolys(), input->GetNumberOfPoints());
+}
+
+//------------------------------------------------------------------------------
+bool vtkHalfEdgeMesh::BuildFromPolys(vtkCellArray* polys, vtkIdType numberOfVertices)
+{
+  this->Initialize();
+  const vtkIdType numFaces = polys ? polys->GetNumberOfCells() : 0;
+  const vtkIdType numEdges = polys ? polys->GetNumberOfConnectivityIds() : 0;
+  this->Origin.resize(numEdges);
+  this->Next.resize(numEdges);
+  this->Twin.resize(numEdges);
+  this->Face.resize(numEdges);
+  this->FaceEdge.resize(numFaces);
+  this->VertexEdge.resize(numberOfVertices);
+  if (numFaces == 0)
+  {
+    std::fill(this->VertexEdge.begin(), this->VertexEdge.end(), -1);
+    return true;
+  }
+
+  // Faces and their loops of half-edges
+  std::atomic<bool> valid(true);
+  polys->Visit(BuildFacesImpl{}, numberOfVertices, this->Origin.data(), this->Next.data(),
+    this->Face.data(), this->FaceEdge.data(), valid);
+  if (!valid)
+  {
+    vtkErrorMacro("Point ids of the polygons must be in [0, " << numberOfVertices << ").");
+    this->Initialize();
+    return false;
+  }
+
+  // Twins: sort the half-edges by edge, then link the pairs of half-edges of
+  // opposite orientation.
+  std::vector<EdgeKey> keys(numEdges);
+  const vtkIdType* origin = this->Origin.data();
+  const vtkIdType* next = this->Next.data();
+  vtkSMPTools::For(0, numEdges,
+    [&keys, origin, next](vtkIdType edge, vtkIdType end)
+    {
+      for (; edge < end; ++edge)
+      {
+        const vtkIdType v0 = origin[edge];
+        const vtkIdType v1 = origin[next[edge]];
+        keys[edge] = EdgeKey{ std::min(v0, v1), std::max(v0, v1), edge };
+      }
+    });
+  vtkSMPTools::Sort(keys.begin(), keys.end());
+
+  vtkIdType* twin = this->Twin.data();
+  std::atomic<vtkIdType> numNonManifold(0);
+  vtkSMPTools::For(0, numEdges,
+    [&keys, &numNonManifold, numEdges, origin, twin](vtkIdType i, vtkIdType end)
+    {
+      vtkIdType localNonManifold = 0;
+      for (; i < end; ++i)
+      {
+        // Each run of keys of the same edge is processed from its first key.
+        if (i > 0 && keys[i].SameEdge(keys[i - 1]))
+        {
+          continue;
+        }
+        vtkIdType runEnd = i + 1;
+        while (runEnd < numEdges && keys[runEnd].SameEdge(keys[i]))
+        {
+          ++runEnd;
+        }
+        const vtkIdType e0 = keys[i].HalfEdge;
+        if (keys[i].V0 != keys[i].V1 && runEnd == i + 1)
+        {
+          twin[e0] = vtkHalfEdgeMesh::BOUNDARY;
+        }
+        else if (keys[i].V0 != keys[i].V1 && runEnd == i + 2 &&
+          origin[e0] != origin[keys[i + 1].HalfEdge])
+        {
+          const vtkIdType e1 = keys[i + 1].HalfEdge;
+          twin[e0] = e1;
+          twin[e1] = e0;
+        }
+        else
+        {
+          for (vtkIdType j = i; j < runEnd; ++j)
+          {
+            twin[keys[j].HalfEdge] = vtkHalfEdgeMesh::NON_MANIFOLD;
+          }
+          ++localNonManifold;
+        }
+      }
+      numNonManifold += localNonManifold;
+    });
+  this->NumberOfNonManifoldEdges = numNonManifold;
+  std::vector<EdgeKey>().swap(keys);
+
+  // Vertex half-edges: the boundary half-edge of smallest id leaving the
+  // vertex, or its outgoing half-edge of smallest id.
+  const vtkIdType none = std::numeric_limits<vtkIdType>::max();
+  std::unique_ptr<std::atomic<vtkIdType>[]> best(new std::atomic<vtkIdType>[numberOfVertices]);
+  vtkSMPTools::For(0, numberOfVertices,
+    [&best, none](vtkIdType vertex, vtkIdType end)
+    {
+      for (; vertex < end; ++vertex)
+      {
+        best[vertex] = none;
+      }
+    });
+  vtkSMPTools::For(0, numEdges,
+    [&best, numEdges, origin, twin](vtkIdType edge, vtkIdType end)
+    {
+      for (; edge < end; ++edge)
+      {
+        const vtkIdType priority = twin[edge] == vtkHalfEdgeMesh::BOUNDARY ? edge : edge + numEdges;
+        std::atomic<vtkIdType>& current = best[origin[edge]];
+        vtkIdType value = current;
+        while (priority < value && !current.compare_exchange_weak(value, priority))
+        {
+        }
+      }
+    });
+  vtkIdType* vertexEdge = this->VertexEdge.data();
+  vtkSMPTools::For(0, numberOfVertices,
+    [&best, none, numEdges, vertexEdge](vtkIdType vertex, vtkIdType end)
+    {
+      for (; vertex < end; ++vertex)
+      {
+        const vtkIdType priority = best[vertex];
+        vertexEdge[vertex] =
+          priority == none ? -1 : (priority < numEdges ? priority : priority - numEdges);
+      }
+    });
+
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkHalfEdgeMesh::ExportPolys(vtkCellArray* polys, vtkIdList* faceIds) const
+{
+  if (!polys)
+  {
+    return;
+  }
+
+  std::vector<vtkIdType> faces;
+  faces.reserve(this->FaceEdge.size());
+  for (vtkIdType face = 0; face < this->GetNumberOfFaces(); ++face)
+  {
+    if (!this->IsFaceDeleted(face))
+    {
+      faces.push_back(face);
+    }
+  }
+  const vtkIdType numCells = static_cast<vtkIdType>(faces.size());
+
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(numCells + 1);
+  vtkIdType* offs = offsets->GetPointer(0);
+  vtkSMPTools::For(0, numCells,
+    [this, &faces, offs](vtkIdType cellId, vtkIdType end)
+    {
+      for (; cellId < end; ++cellId)
+      {
+        offs[cellId + 1] = this->GetFaceSize(faces[cellId]);
+      }
+    });
+  offs[0] = 0;
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    offs[cellId + 1] += offs[cellId];
+  }
+
+  vtkNew<vtkIdTypeArray> conn;
+  conn->SetNumberOfValues(offs[numCells]);
+  vtkIdType* ids = conn->GetPointer(0);
+  vtkSMPTools::For(0, numCells,
+    [this, &faces, offs, ids](vtkIdType cellId, vtkIdType end)
+    {
+      for (; cellId < end; ++cellId)
+      {
+        const vtkIdType first = this->FaceEdge[faces[cellId]];
+        vtkIdType edge = first;
+        vtkIdType* cellIds = ids + offs[cellId];
+        do
+        {
+          *cellIds++ = this->Origin[edge];
+          edge = this->Next[edge];
+        } while (edge != first);
+      }
+    });
+  polys->SetData(offsets, conn);
+
+  if (faceIds)
+  {
+    faceIds->SetNumberOfIds(numCells);
+    std::copy(faces.begin(), faces.end(), faceIds->begin());
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkHalfEdgeMesh::GetFaceSize(vtkIdType face) const
+{
+  const vtkIdType first = this->FaceEdge[face];
+  if (first < 0)
+  {
+    return 0;
+  }
+  vtkIdType size = 1;
+  for (vtkIdType edge = this->Next[first]; edge != first; edge = this->Next[edge])
+  {
+    ++size;
+  }
+  return size;
+}
+
+//------------------------------------------------------------------------------
+void vtkHalfEdgeMesh::GetFacePoints(vtkIdType face, vtkIdList* ptIds) const
+{
+  ptIds->Reset();
+  const vtkIdType first = this->FaceEdge[face];
+  if (first < 0)
+  {
+    return;
+  }
+  vtkIdType edge = first;
+  do
+  {
+    ptIds->InsertNextId(this->Origin[edge]);
+    edge = this->Next[edge];
+  } while (edge != first);
+}
+
+//------------------------------------------------------------------------------
+void vtkHalfEdgeMesh::GetVertexNeighbors(vtkIdType vertex, vtkIdList* neighbors) const
+{
+  neighbors->Reset();
+  const vtkIdType first = this->VertexEdge[vertex];
+  if (first < 0)
+  {
+    return;
+  }
+  vtkIdType edge = first;
+  do
+  {
+    neighbors->InsertNextId(this->GetDestination(edge));
+    const vtkIdType prev = this->GetPrevious(edge);
+    if (this->Twin[prev] < 0)
+    {
+      // Reached the boundary (the walk started from the other side)
+      neighbors->InsertNextId(this->Origin[prev]);
+      break;
+    }
+    edge = this->Twin[prev];
+  } while (edge != first);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkHalfEdgeMesh::FindHalfEdge(vtkIdType v0, vtkIdType v1) const
+{
+  const vtkIdType first = this->VertexEdge[v0];
+  if (first < 0)
+  {
+    return -1;
+  }
+  vtkIdType edge = first;
+  do
+  {
+    if (this->GetDestination(edge) == v1)
+    {
+      return edge;
+    }
+    edge = this->RotateOutgoing(edge);
+  } while (edge >= 0 && edge != first);
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+void vtkHalfEdgeMesh::UpdateVertexEdge(vtkIdType vertex, vtkIdType edge)
+{
+  if (edge >= 0)
+  {
+    const vtkIdType first = edge;
+    while (this->Twin[edge] >= 0)
+    {
+      edge = this->Next[this->Twin[edge]];
+      if (edge == first)
+      {
+        break;
+      }
+    }
+  }
+  this->VertexEdge[vertex] = edge;
+}
+
+//------------------------------------------------------------------------------
+void vtkHalfEdgeMesh::SetTwins(vtkIdType edge0, vtkIdType edge1)
+{
+  if (edge0 >= 0)
+  {
+    this->Twin[edge0] = edge1 >= 0 ? edge1 : static_cast<vtkIdType>(BOUNDARY);
+  }
+  if (edge1 >= 0)
+  {
+    this->Twin[edge1] = edge0 >= 0 ? edge0 : static_cast<vtkIdType>(BOUNDARY);
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkHalfEdgeMesh::NewHalfEdge(vtkIdType origin, vtkIdType face)
+{
+  this->Origin.push_back(origin);
+  this->Next.push_back(-1);
+  this->Twin.push_back(BOUNDARY);
+  this->Face.push_back(face);
+  return this->GetNumberOfHalfEdges() - 1;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHalfEdgeMesh::FlipEdge(vtkIdType h)
+{
+  if (h < 0 || h >= this->GetNumberOfHalfEdges() || this->IsHalfEdgeDeleted(h))
+  {
+    return false;
+  }
+  const vtkIdType t = this->Twin[h];
+  if (t < 0 || this->GetFaceSize(this->Face[h]) != 3 || this->GetFaceSize(this->Face[t]) != 3)
+  {
+    return false;
+  }
+
+  // h: a->b in (a, b, c), t: b->a in (b, a, d)
+  const vtkIdType h1 = this->Next[h];
+  const vtkIdType h2 = this->Next[h1];
+  const vtkIdType t1 = this->Next[t];
+  const vtkIdType t2 = this->Next[t1];
+  const vtkIdType a = this->Origin[h];
+  const vtkIdType b = this->Origin[t];
+  const vtkIdType c = this->Origin[h2];
+  const vtkIdType d = this->Origin[t2];
+  if (c == d || this->FindHalfEdge(c, d) >= 0 || this->FindHalfEdge(d, c) >= 0)
+  {
+    return false;
+  }
+  const vtkIdType f0 = this->Face[h];
+  const vtkIdType f1 = this->Face[t];
+
+  // f0 becomes (d, c, a) and f1 (c, d, b)
+  this->Origin[h] = d;
+  this->Origin[t] = c;
+  this->Next[h] = h2;
+  this->Next[h2] = t1;
+  this->Next[t1] = h;
+  this->Next[t] = t2;
+  this->Next[t2] = h1;
+  this->Next[h1] = t;
+  this->Face[t1] = f0;
+  this->Face[h1] = f1;
+  this->FaceEdge[f0] = h;
+  this->FaceEdge[f1] = t;
+  if (this->VertexEdge[a] == h)
+  {
+    this->VertexEdge[a] = t1;
+  }
+  if (this->VertexEdge[b] == t)
+  {
+    this->VertexEdge[b] = h1;
+  }
+  this->Modified();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkHalfEdgeMesh::SplitEdge(vtkIdType h)
+{
+  if (h < 0 || h >= this->GetNumberOfHalfEdges() || this->IsHalfEdgeDeleted(h))
+  {
+    return -1;
+  }
+  const vtkIdType t = this->Twin[h];
+  if (t == NON_MANIFOLD || this->GetFaceSize(this->Face[h]) != 3 ||
+    (t >= 0 && this->GetFaceSize(this->Face[t]) != 3))
+  {
+    return -1;
+  }
+
+  // h: a->b in f0 = (a, b, c) becomes a->m in f0 = (a, m, c), and the new
+  // face f2 = (m, b, c) is added.
+  const vtkIdType h1 = this->Next[h];
+  const vtkIdType h2 = this->Next[h1];
+  const vtkIdType c = this->Origin[h2];
+  const vtkIdType f0 = this->Face[h];
+  const vtkIdType m = this->GetNumberOfVertices();
+  this->VertexEdge.push_back(-1);
+  const vtkIdType f2 = this->GetNumberOfFaces();
+  this->FaceEdge.push_back(-1);
+  const vtkIdType e0 = this->NewHalfEdge(m, f2);
+  const vtkIdType e1 = this->NewHalfEdge(c, f2);
+  const vtkIdType e2 = this->NewHalfEdge(m, f0);
+  this->Next[h] = e2;
+  this->Next[e2] = h2;
+  this->Next[e0] = h1;
+  this->Next[h1] = e1;
+  this->Next[e1] = e0;
+  this->Face[h1] = f2;
+  this->FaceEdge[f0] = h;
+  this->FaceEdge[f2] = e0;
+  this->SetTwins(e1, e2);
+
+  if (t >= 0)
+  {
+    // t: b->a in f1 = (b, a, d) becomes b->m in f1 = (b, m, d), and the new
+    // face f3 = (m, a, d) is added.
+    const vtkIdType t1 = this->Next[t];
+    const vtkIdType t2 = this->Next[t1];
+    const vtkIdType d = this->Origin[t2];
+    const vtkIdType f1 = this->Face[t];
+    const vtkIdType f3 = this->GetNumberOfFaces();
+    this->FaceEdge.push_back(-1);
+    const vtkIdType g0 = this->NewHalfEdge(m, f3);
+    const vtkIdType g1 = this->NewHalfEdge(d, f3);
+    const vtkIdType g2 = this->NewHalfEdge(m, f1);
+    this->Next[t] = g2;
+    this->Next[g2] = t2;
+    this->Next[g0] = t1;
+    this->Next[t1] = g1;
+    this->Next[g1] = g0;
+    this->Face[t1] = f3;
+    this->FaceEdge[f1] = t;
+    this->FaceEdge[f3] = g0;
+    this->SetTwins(g1, g2);
+    this->SetTwins(h, g0);
+    this->SetTwins(t, e0);
+  }
+
+  // On a boundary edge, e0 is the boundary half-edge leaving m.
+  this->VertexEdge[m] = e0;
+  this->Modified();
+  return m;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHalfEdgeMesh::IsCollapsible(vtkIdType h) const
+{
+  if (h < 0 || h >= this->GetNumberOfHalfEdges() || this->IsHalfEdgeDeleted(h))
+  {
+    return false;
+  }
+  const vtkIdType t = this->Twin[h];
+  if (t == NON_MANIFOLD || this->GetFaceSize(this->Face[h]) != 3 ||
+    (t >= 0 && this->GetFaceSize(this->Face[t]) != 3))
+  {
+    return false;
+  }
+  const vtkIdType a = this->Origin[h];
+  const vtkIdType b = this->GetDestination(h);
+  if (t >= 0 && this->IsBoundaryVertex(a) && this->IsBoundaryVertex(b))
+  {
+    return false;
+  }
+
+  // Link condition: the common neighbors of a and b are the opposite
+  // vertices of the triangles using the edge.
+  vtkNew<vtkIdList> ringA;
+  vtkNew<vtkIdList> ringB;
+  this->GetVertexNeighbors(a, ringA);
+  this->GetVertexNeighbors(b, ringB);
+  vtkIdType numCommon = 0;
+  for (vtkIdType i = 0; i < ringA->GetNumberOfIds(); ++i)
+  {
+    if (ringB->IsId(ringA->GetId(i)) >= 0)
+    {
+      ++numCommon;
+    }
+  }
+  return numCommon == (t >= 0 ? 2 : 1);
+}
+
+//------------------------------------------------------------------------------
+bool vtkHalfEdgeMesh::CollapseEdge(vtkIdType h)
+{
+  if (!this->IsCollapsible(h))
+  {
+    return false;
+  }
+
+  // h: a->b in f0 = (a, b, c), t: b->a in f1 = (b, a, d)
+  const vtkIdType t = this->Twin[h];
+  const vtkIdType h1 = this->Next[h];
+  const vtkIdType h2 = this->Next[h1];
+  const vtkIdType a = this->Origin[h];
+  const vtkIdType b = this->Origin[h1];
+  const vtkIdType c = this->Origin[h2];
+
+  // The half-edges leaving b now leave a.
+  const vtkIdType firstB = this->VertexEdge[b];
+  vtkIdType edge = firstB;
+  do
+  {
+    this->Origin[edge] = a;
+    edge = this->RotateOutgoing(edge);
+  } while (edge >= 0 && edge != firstB);
+
+  // Remove f0, gluing the twins of its two other edges.
+  const vtkIdType o1 = this->Twin[h1];
+  const vtkIdType o2 = this->Twin[h2];
+  this->SetTwins(o1, o2);
+  this->FaceEdge[this->Face[h]] = -1;
+  this->Face[h] = this->Face[h1] = this->Face[h2] = -1;
+
+  vtkIdType p1 = -1;
+  vtkIdType p2 = -1;
+  vtkIdType d = -1;
+  if (t >= 0)
+  {
+    // Remove f1 likewise.
+    const vtkIdType t1 = this->Next[t];
+    const vtkIdType t2 = this->Next[t1];
+    d = this->Origin[t2];
+    p1 = this->Twin[t1];
+    p2 = this->Twin[t2];
+    this->SetTwins(p1, p2);
+    this->FaceEdge[this->Face[t]] = -1;
+    this->Face[t] = this->Face[t1] = this->Face[t2] = -1;
+  }
+
+  // Update the half-edges of the vertices of the removed faces.
+  this->VertexEdge[b] = -1;
+  vtkIdType aEdge = o2 >= 0 ? o2 : p2;
+  if (aEdge < 0)
+  {
+    aEdge = o1 >= 0 ? this->Next[o1] : (p1 >= 0 ? this->Next[p1] : -1);
+  }
+  this->UpdateVertexEdge(a, aEdge);
+  this->UpdateVertexEdge(c, o1 >= 0 ? o1 : (o2 >= 0 ? this->Next[o2] : -1));
+  if (d >= 0)
+  {
+    this->UpdateVertexEdge(d, p1 >= 0 ? p1 : (p2 >= 0 ? this->Next[p2] : -1));
+  }
+  this->Modified();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHalfEdgeMesh::IsValid() const
+{
+  const vtkIdType numEdges = this->GetNumberOfHalfEdges();
+  const vtkIdType numFaces = this->GetNumberOfFaces();
+  vtkIdType numLiveEdges = 0;
+  for (vtkIdType edge = 0; edge < numEdges; ++edge)
+  {
+    if (this->IsHalfEdgeDeleted(edge))
+    {
+      continue;
+    }
+    ++numLiveEdges;
+    const vtkIdType face = this->Face[edge];
+    const vtkIdType next = this->Next[edge];
+    const vtkIdType twin = this->Twin[edge];
+    if (face >= numFaces || this->IsFaceDeleted(face) || next < 0 || next >= numEdges ||
+      this->Face[next] != face)
+    {
+      return false;
+    }
+    if (twin >= 0 &&
+      (twin >= numEdges || this->IsHalfEdgeDeleted(twin) || this->Twin[twin] != edge ||
+        this->Origin[twin] != this->GetDestination(edge) ||
+        this->GetDestination(twin) != this->Origin[edge]))
+    {
+      return false;
+    }
+    if (twin < 0 && twin != BOUNDARY && twin != NON_MANIFOLD)
+    {
+      return false;
+    }
+  }
+
+  vtkIdType numLoopEdges = 0;
+  for (vtkIdType face = 0; face < numFaces; ++face)
+  {
+    const vtkIdType first = this->FaceEdge[face];
+    if (first < 0)
+    {
+      continue;
+    }
+    if (first >= numEdges || this->Face[first] != face)
+    {
+      return false;
+    }
+    vtkIdType edge = first;
+    do
+    {
+      if (++numLoopEdges > numLiveEdges)
+      {
+        return false;
+      }
+      edge = this->Next[edge];
+    } while (edge != first);
+  }
+  if (numLoopEdges != numLiveEdges)
+  {
+    return false;
+  }
+
+  for (vtkIdType vertex = 0; vertex < this->GetNumberOfVertices(); ++vertex)
+  {
+    const vtkIdType edge = this->VertexEdge[vertex];
+    if (edge >= 0 &&
+      (edge >= numEdges || this->IsHalfEdgeDeleted(edge) || this->Origin[edge] != vertex))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkHalfEdgeMesh::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfVertices: " << this->GetNumberOfVertices() << "\n";
+  os << indent << "NumberOfFaces: " << this->GetNumberOfFaces() << "\n";
+  os << indent << "NumberOfHalfEdges: " << this->GetNumberOfHalfEdges() << "\n";
+  os << indent << "NumberOfNonManifoldEdges: " << this->NumberOfNonManifoldEdges << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkHalfEdgeMesh
+ * @brief   compact, editable half-edge representation of polygonal meshes
+ *
+ * vtkHalfEdgeMesh represents the topology of a polygonal surface (the polys
+ * of a vtkPolyData) with half-edges stored in flat arrays. Each polygon is
+ * a loop of half-edges, and each half-edge knows its origin vertex, the next
+ * half-edge of its face, its face, and its twin, the half-edge going the
+ * other way in the neighboring face. Vertices and faces reference one of
+ * their half-edges. Adjacency queries (edge neighbors, vertex one-ring,
+ * boundary loops) are therefore answered without cell links, and local
+ * modifications of a triangle mesh (edge collapse, split and flip) only
+ * update a constant number of entries, plus the half-edges around the
+ * removed vertex of a collapse.
+ *
+ * The half-edges of face f are numbered like the connectivity entries of
+ * the cell array the mesh is built from: the i-th half-edge of cell c goes
+ * from its i-th point to its (i+1)-th point and has id GetOffset(c) + i.
+ * BuildFromPolys() and ExportPolys() run in parallel with vtkSMPTools.
+ *
+ * Only manifold edges, shared by two faces of opposite orientation, are
+ * linked to a twin. Other half-edges have no twin: GetTwin() returns
+ * BOUNDARY for the half-edges used by a single face, and NON_MANIFOLD for
+ * the half-edges of edges used by more than two faces, by two faces with
+ * the same orientation, or with identical end points. Editing operations
+ * are only performed on triangles; the vertices are the point ids of the
+ * input, and the caller manages the coordinates and point data (for
+ * example, of the vertices created by SplitEdge()).
+ *
+ * Elements removed by the editing operations are marked as deleted
+ * (IsFaceDeleted(), IsHalfEdgeDeleted()) and their ids are not reused, so
+ * that the ids of the remaining elements are stable. ExportPolys() writes
+ * the remaining faces in the order of their ids.
+ *
+ * @sa
+ * vtkPolyData vtkCellLinks vtkEdgeTable
+ */
+
+#ifndef vtkHalfEdgeMesh_h
+#define vtkHalfEdgeMesh_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <vector> // For storage
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkCellArray;
+class vtkIdList;
+class vtkPolyData;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkHalfEdgeMesh : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods to instantiate, print and obtain type-related information.
+   */
+  static vtkHalfEdgeMesh* New();
+  vtkTypeMacro(vtkHalfEdgeMesh, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  /**
+   * Values returned by GetTwin() for half-edges without twin.
+   */
+  enum
+  {
+    BOUNDARY = -1,
+    NON_MANIFOLD = -2
+  };
+
+  /**
+   * Free the memory and reset the mesh to an empty state.
+   */
+  void Initialize();
+
+  ///@{
+  /**
+   * Build the half-edges of the polygons of polys, whose point ids are in
+   * [0, numberOfVertices). The polys of a vtkPolyData are used by the second
+   * signature (its verts, lines and strips are ignored). Return false if
+   * the point ids are out of range.
+   */
+  bool BuildFromPolys(vtkCellArray* polys, vtkIdType numberOfVertices);
+  bool BuildFromPolyData(vtkPolyData* input);
+  ///@}
+
+  /**
+   * Write the faces which are not deleted to polys, in the order of their
+   * ids. If faceIds is given, it receives the id of the face of each output
+   * cell, e.g. to copy cell data (the faces created by editing operations
+   * have ids beyond the number of input cells).
+   */
+  void ExportPolys(vtkCellArray* polys, vtkIdList* faceIds = nullptr) const;
+
+  ///@{
+  /**
+   * Number of elements, including the deleted ones. Valid ids are in
+   * [0, GetNumberOf...()).
+   */
+  vtkIdType GetNumberOfVertices() const { return static_cast<vtkIdType>(this->VertexEdge.size()); }
+  vtkIdType GetNumberOfFaces() const { return static_cast<vtkIdType>(this->FaceEdge.size()); }
+  vtkIdType GetNumberOfHalfEdges() const { return static_cast<vtkIdType>(this->Origin.size()); }
+  ///@}
+
+  /**
+   * Number of edges which are neither boundary nor manifold edges, found by
+   * the last build.
+   */
+  vtkIdType GetNumberOfNonManifoldEdges() const { return this->NumberOfNonManifoldEdges; }
+
+  ///@{
+  /**
+   * Half-edge accessors. GetDestination() is the origin of the next
+   * half-edge; GetPrevious() walks around the face.
+   */
+  vtkIdType GetOrigin(vtkIdType edge) const { return this->Origin[edge]; }
+  vtkIdType GetDestination(vtkIdType edge) const { return this->Origin[this->Next[edge]]; }
+  vtkIdType GetNext(vtkIdType edge) const { return this->Next[edge]; }
+  vtkIdType GetTwin(vtkIdType edge) const { return this->Twin[edge]; }
+  vtkIdType GetFace(vtkIdType edge) const { return this->Face[edge]; }
+  vtkIdType GetPrevious(vtkIdType edge) const
+  {
+    vtkIdType prev = edge;
+    for (vtkIdType next = this->Next[edge]; next != edge; next = this->Next[next])
+    {
+      prev = next;
+    }
+    return prev;
+  }
+  bool IsBoundaryEdge(vtkIdType edge) const { return this->Twin[edge] == BOUNDARY; }
+  bool IsHalfEdgeDeleted(vtkIdType edge) const { return this->Face[edge] < 0; }
+  ///@}
+
+  ///@{
+  /**
+   * Face accessors. A deleted face has no half-edge.
+   */
+  vtkIdType GetFaceEdge(vtkIdType face) const { return this->FaceEdge[face]; }
+  bool IsFaceDeleted(vtkIdType face) const { return this->FaceEdge[face] < 0; }
+  vtkIdType GetFaceSize(vtkIdType face) const;
+  void GetFacePoints(vtkIdType face, vtkIdList* ptIds) const;
+  ///@}
+
+  ///@{
+  /**
+   * Vertex accessors. GetVertexEdge() returns a half-edge leaving the
+   * vertex, -1 for vertices not used by any face (unused or removed by a
+   * collapse). For a vertex on the boundary, it is the boundary half-edge
+   * leaving the vertex, from which GetVertexNeighbors() enumerates the
+   * one-ring in order. A vertex with non-manifold edges, or on several
+   * boundary loops, may have an incomplete one-ring.
+   */
+  vtkIdType GetVertexEdge(vtkIdType vertex) const { return this->VertexEdge[vertex]; }
+  bool IsBoundaryVertex(vtkIdType vertex) const
+  {
+    const vtkIdType edge = this->VertexEdge[vertex];
+    return edge >= 0 && this->Twin[edge] == BOUNDARY;
+  }
+  void GetVertexNeighbors(vtkIdType vertex, vtkIdList* neighbors) const;
+  ///@}
+
+  /**
+   * Return the half-edge going from v0 to v1, -1 if there is none.
+   */
+  vtkIdType FindHalfEdge(vtkIdType v0, vtkIdType v1) const;
+
+  ///@{
+  /**
+   * Editing operations on triangles. Each one returns false (or -1) and
+   * leaves the mesh unchanged when the operation is not possible.
+   *
+   * FlipEdge() replaces a manifold edge shared by two triangles with the
+   * other diagonal of their quadrilateral. It fails if the diagonal already
+   * exists.
+   *
+   * SplitEdge() inserts a new vertex, whose id is returned, on the edge and
+   * splits the one or two triangles using it.
+   *
+   * CollapseEdge() merges the destination of the half-edge into its origin,
+   * and removes the one or two triangles using the edge. It fails if
+   * IsCollapsible() returns false.
+   */
+  bool FlipEdge(vtkIdType edge);
+  vtkIdType SplitEdge(vtkIdType edge);
+  bool CollapseEdge(vtkIdType edge);
+  ///@}
+
+  /**
+   * Return true if collapsing the edge keeps the mesh manifold, i.e., the
+   * triangles using it satisfy the link condition: the common neighbors
+   * of both end points are exactly the opposite vertices of these
+   * triangles, and an interior edge does not join two boundary vertices.
+   */
+  bool IsCollapsible(vtkIdType edge) const;
+
+  /**
+   * Check the consistency of the mesh (face loops, twins and vertex
+   * half-edges), for debugging and testing.
+   */
+  bool IsValid() const;
+
+protected:
+  vtkHalfEdgeMesh();
+  ~vtkHalfEdgeMesh() override;
+
+  // Walk to the next half-edge leaving the origin of edge, rotating towards
+  // its twin side: -1 when a boundary is reached.
+  vtkIdType RotateOutgoing(vtkIdType edge) const
+  {
+    const vtkIdType prevTwin = this->Twin[this->GetPrevious(edge)];
+    return prevTwin >= 0 ? prevTwin : -1;
+  }
+
+  // Set the half-edge of vertex from one of its outgoing half-edges,
+  // moving it to the boundary half-edge if there is one.
+  void UpdateVertexEdge(vtkIdType vertex, vtkIdType edge);
+
+  void SetTwins(vtkIdType edge0, vtkIdType edge1);
+  vtkIdType NewHalfEdge(vtkIdType origin, vtkIdType face);
+
+  // Half-edges
+  std::vector<vtkIdType> Origin;
+  std::vector<vtkIdType> Next;
+  std::vector<vtkIdType> Twin;
+  std::vector<vtkIdType> Face;
+
+  // One half-edge per face and per vertex
+  std::vector<vtkIdType> FaceEdge;
+  std::vector<vtkIdType> VertexEdge;
+
+  vtkIdType NumberOfNonManifoldEdges = 0;
+
+private:
+  vtkHalfEdgeMesh(const vtkHalfEdgeMesh&) = delete;
+  void operator=(const vtkHalfEdgeMesh&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
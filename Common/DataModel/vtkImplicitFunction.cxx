@@ -106,10 +106,14 @@ void vtkImplicitFunction::FunctionValue(vtkDataArray* input, vtkDataArray* outpu
     FunctionWorker<TransformFunction> worker(TransformFunction(this, this->Transform));
     typedef vtkTypeList::Create<float, double> InputTypes;
     typedef vtkTypeList::Create<float, double> OutputTypes;
+    typedef vtkArrayDispatch::Dispatch2ByArray<vtkArrayDispatch::PointArrays,
+      vtkArrayDispatch::PointArrays>
+      PointsDispatch;
     typedef vtkArrayDispatch::Dispatch2ByValueTypeUsingArrays<vtkArrayDispatch::AllArrays,
       InputTypes, OutputTypes>
       MyDispatch;
-    if (!MyDispatch::Execute(input, output, worker))
+    if (!PointsDispatch::Execute(input, output, worker) &&
+      !MyDispatch::Execute(input, output, worker))
     {
       worker(input, output); // Use vtkDataArray API if dispatch fails.
     }
@@ -125,10 +129,14 @@ void vtkImplicitFunction::EvaluateFunction(vtkDataArray* input, vtkDataArray* ou
   FunctionWorker<SimpleFunction> worker(SimpleFunction(this));
   typedef vtkTypeList::Create<float, double> InputTypes;
   typedef vtkTypeList::Create<float, double> OutputTypes;
+  typedef vtkArrayDispatch::Dispatch2ByArray<vtkArrayDispatch::PointArrays,
+    vtkArrayDispatch::PointArrays>
+    PointsDispatch;
   typedef vtkArrayDispatch::Dispatch2ByValueTypeUsingArrays<vtkArrayDispatch::AllArrays, InputTypes,
     OutputTypes>
     MyDispatch;
-  if (!MyDispatch::Execute(input, output, worker))
+  if (!PointsDispatch::Execute(input, output, worker) &&
+    !MyDispatch::Execute(input, output, worker))
   {
     worker(input, output); // Use vtkDataArray API if dispatch fails.
   }
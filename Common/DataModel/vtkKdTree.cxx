@@ -12,17 +12,22 @@
 #include "vtkDataSetCollection.h"
 #include "vtkFloatArray.h"
 #include "vtkGarbageCollector.h"
+#include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkIntArray.h"
 #include "vtkKdNode.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointSet.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTimerLog.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
@@ -32,6 +37,7 @@
 #include <map>
 #include <queue>
 #include <set>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 namespace
@@ -210,6 +216,9 @@ vtkKdTree::vtkKdTree()
   this->LocatorIds = nullptr;
   this->LocatorRegionLocation = nullptr;
 
+  this->NumberOfFlatNodes = 0;
+  this->FlatNodes = nullptr;
+
   this->LastDataCacheSize = 0;
   this->LastNumDataSets = 0;
   this->ClearLastBuildCache();
@@ -637,52 +646,60 @@ float* vtkKdTree::ComputeCellCenters(vtkDataSet* set)
     }
   }
 
-  double* weights = new double[maxCellSize];
-
-  float* cptr = center;
-  double dcenter[3];
+  // Cell centers are independent, compute them in parallel. Progress is
+  // only reported from the main thread.
+  vtkSMPThreadLocalObject<vtkGenericCell> localCell;
+  vtkSMPThreadLocal<std::vector<double>> localWeights;
+  auto computeCenters = [this, &localCell, &localWeights, maxCellSize, totalCells](
+                          vtkDataSet* iset, float* cptr, vtkIdType offset)
+  {
+    // Make sure the cells can be retrieved from multiple threads.
+    vtkNew<vtkGenericCell> cell;
+    iset->GetCell(0, cell);
+    vtkSMPTools::For(0, iset->GetNumberOfCells(),
+      [this, iset, cptr, offset, &localCell, &localWeights, maxCellSize, totalCells](
+        vtkIdType j, vtkIdType end)
+      {
+        vtkGenericCell* genericCell = localCell.Local();
+        std::vector<double>& weights = localWeights.Local();
+        weights.resize(maxCellSize);
+        bool isFirst = vtkSMPTools::GetSingleThread();
+        double dcenter[3];
+        for (; j < end; ++j)
+        {
+          iset->GetCell(j, genericCell);
+          this->ComputeCellCenter(genericCell, dcenter, weights.data());
+          cptr[3 * j] = static_cast<float>(dcenter[0]);
+          cptr[3 * j + 1] = static_cast<float>(dcenter[1]);
+          cptr[3 * j + 2] = static_cast<float>(dcenter[2]);
+          if (isFirst && j % 1000 == 0)
+          {
+            this->UpdateSubOperationProgress(static_cast<double>(offset + j) / totalCells);
+          }
+        }
+      });
+  };
 
   if (set)
   {
-    for (int j = 0; j < totalCells; j++)
-    {
-      this->ComputeCellCenter(set->GetCell(j), dcenter, weights);
-      cptr[0] = static_cast<float>(dcenter[0]);
-      cptr[1] = static_cast<float>(dcenter[1]);
-      cptr[2] = static_cast<float>(dcenter[2]);
-      cptr += 3;
-      if (j % 1000 == 0)
-      {
-        this->UpdateSubOperationProgress(static_cast<double>(j) / totalCells);
-      }
-    }
+    computeCenters(set, center, 0);
   }
   else
   {
+    vtkIdType offset = 0;
     vtkCollectionSimpleIterator cookie;
     this->DataSets->InitTraversal(cookie);
     for (vtkDataSet* iset = this->DataSets->GetNextDataSet(cookie); iset != nullptr;
          iset = this->DataSets->GetNextDataSet(cookie))
     {
-      int nCells = iset->GetNumberOfCells();
-
-      for (int j = 0; j < nCells; j++)
+      if (iset->GetNumberOfCells() > 0)
       {
-        this->ComputeCellCenter(iset->GetCell(j), dcenter, weights);
-        cptr[0] = static_cast<float>(dcenter[0]);
-        cptr[1] = static_cast<float>(dcenter[1]);
-        cptr[2] = static_cast<float>(dcenter[2]);
-        cptr += 3;
-        if (j % 1000 == 0)
-        {
-          this->UpdateSubOperationProgress(static_cast<double>(j) / totalCells);
-        }
+        computeCenters(iset, center + 3 * offset, offset);
+        offset += iset->GetNumberOfCells();
       }
     }
   }
 
-  delete[] weights;
-
   this->UpdateSubOperationProgress(1.0);
   return center;
 }
@@ -1053,6 +1070,13 @@ void vtkKdTree::SetNewBounds(double* bounds)
       fixDimRight[cutDim] = 0;
       vtkKdTree::SetNewBounds_(kd->GetRight(), bounds, fixDimRight);
     }
+
+    // The flat copy of the tree used by GetRegionContainingPoint() holds
+    // the region bounds too.
+    if (this->FlatNodes)
+    {
+      this->BuildFlatTree();
+    }
   }
 }
 
@@ -1255,7 +1279,71 @@ int vtkKdTree::DivideTest(int size, int level)
 }
 
 //------------------------------------------------------------------------------
+// The subtrees are independent: each of them only rearranges its own range
+// of the point and id arrays. The top of the tree is split serially until
+// the subtrees are small enough to keep the threads busy, then these
+// subtrees are divided concurrently. Since the regions of a subtree only
+// depend on its points, the tree is identical to the one built serially.
 int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
+{
+  struct DivideTask
+  {
+    vtkKdNode* Node;
+    float* C1;
+    int* Ids;
+    int Level;
+  };
+
+  int numThreads = std::max(vtkSMPTools::GetEstimatedNumberOfThreads(), 1);
+  int taskSize = std::max(kd->GetNumberOfPoints() / (8 * numThreads), 16384);
+
+  std::vector<DivideTask> tasks;
+  std::vector<DivideTask> stack(1, DivideTask{ kd, c1, ids, level });
+  while (!stack.empty())
+  {
+    DivideTask task = stack.back();
+    stack.pop_back();
+    if (task.Node->GetNumberOfPoints() <= taskSize)
+    {
+      tasks.push_back(task);
+    }
+    else if (this->SplitRegion(task.Node, task.C1, task.Ids, task.Level))
+    {
+      int nleft = task.Node->GetLeft()->GetNumberOfPoints();
+      stack.push_back(DivideTask{ task.Node->GetRight(), task.C1 + nleft * 3,
+        task.Ids ? task.Ids + nleft : nullptr, task.Level + 1 });
+      stack.push_back(DivideTask{ task.Node->GetLeft(), task.C1, task.Ids, task.Level + 1 });
+    }
+  }
+
+  vtkSMPTools::For(0, static_cast<vtkIdType>(tasks.size()), 1,
+    [this, &tasks](vtkIdType taskId, vtkIdType endTaskId)
+    {
+      std::vector<DivideTask> subtasks;
+      for (; taskId < endTaskId; ++taskId)
+      {
+        subtasks.push_back(tasks[taskId]);
+        while (!subtasks.empty())
+        {
+          DivideTask task = subtasks.back();
+          subtasks.pop_back();
+          if (this->SplitRegion(task.Node, task.C1, task.Ids, task.Level))
+          {
+            int nleft = task.Node->GetLeft()->GetNumberOfPoints();
+            subtasks.push_back(DivideTask{ task.Node->GetRight(), task.C1 + nleft * 3,
+              task.Ids ? task.Ids + nleft : nullptr, task.Level + 1 });
+            subtasks.push_back(
+              DivideTask{ task.Node->GetLeft(), task.C1, task.Ids, task.Level + 1 });
+          }
+        }
+      }
+    });
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+int vtkKdTree::SplitRegion(vtkKdNode* kd, float* c1, int* ids, int level)
 {
   int ok = this->DivideTest(kd->GetNumberOfPoints(), level);
 
@@ -1315,16 +1403,7 @@ int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
     return 0; // unable to divide region further
   }
 
-  int nleft = kd->GetLeft()->GetNumberOfPoints();
-
-  int* leftIds = ids;
-  int* rightIds = ids ? ids + nleft : nullptr;
-
-  this->DivideRegion(kd->GetLeft(), c1, leftIds, level + 1);
-
-  this->DivideRegion(kd->GetRight(), c1 + nleft * 3, rightIds, level + 1);
-
-  return 0;
+  return 1;
 }
 
 //------------------------------------------------------------------------------
@@ -1848,26 +1927,36 @@ void vtkKdTree::BuildLocatorFromPoints(vtkPoints** ptArrays, int numPtArrays)
     else
     {
       // Hopefully point arrays are usually floats.  This conversion will
-      // really slow things down.
+      // really slow things down, so do it in parallel.
 
-      for (vtkIdType ii = 0; ii < npoints; ii++)
-      {
-        double* pt = ptArrays[i]->GetPoint(ii);
-
-        points[ptId++] = static_cast<float>(pt[0]);
-        points[ptId++] = static_cast<float>(pt[1]);
-        points[ptId++] = static_cast<float>(pt[2]);
-      }
+      vtkPoints* ptArray = ptArrays[i];
+      float* dest = points + ptId;
+      vtkSMPTools::For(0, npoints,
+        [ptArray, dest](vtkIdType ii, vtkIdType end)
+        {
+          double pt[3];
+          for (; ii < end; ii++)
+          {
+            ptArray->GetPoint(ii, pt);
+            dest[3 * ii] = static_cast<float>(pt[0]);
+            dest[3 * ii + 1] = static_cast<float>(pt[1]);
+            dest[3 * ii + 2] = static_cast<float>(pt[2]);
+          }
+        });
+      ptId += nvals;
     }
   }
 
-  for (ptId = 0; ptId < totalNumPoints; ptId++)
-  {
-    // Select_ dominates DivideRegion algorithm, operating on
-    // ints is much fast than operating on long longs
-
-    ptIds[ptId] = ptId;
-  }
+  // Select_ dominates DivideRegion algorithm, operating on
+  // ints is much fast than operating on long longs
+  vtkSMPTools::For(0, totalNumPoints,
+    [ptIds](vtkIdType id, vtkIdType end)
+    {
+      for (; id < end; id++)
+      {
+        ptIds[id] = static_cast<int>(id);
+      }
+    });
 
   TIMERDONE("Set up to build k-d tree");
 
@@ -1895,9 +1984,94 @@ void vtkKdTree::BuildLocatorFromPoints(vtkPoints** ptArrays, int numPtArrays)
 
   this->SetCalculator(this->Top);
 
+  this->BuildFlatTree();
+
   TIMERDONE("Build tree");
 }
 
+//------------------------------------------------------------------------------
+void vtkKdTree::BuildFlatTree()
+{
+  delete[] this->FlatNodes;
+  this->FlatNodes = nullptr;
+  this->NumberOfFlatNodes = 0;
+
+  if (!this->Top)
+  {
+    return;
+  }
+
+  // A binary tree with n leaves has 2n - 1 nodes.
+  this->FlatNodes = new flatNode_[2 * this->NumberOfRegions - 1];
+
+  // Nodes are stored in depth-first order. The index of the right child is
+  // only known once the left subtree is stored, so it is patched then.
+  std::vector<std::pair<vtkKdNode*, int>> stack(1, std::make_pair(this->Top, -1));
+  while (!stack.empty())
+  {
+    vtkKdNode* kd = stack.back().first;
+    int parent = stack.back().second;
+    stack.pop_back();
+
+    int index = this->NumberOfFlatNodes++;
+    if (parent >= 0)
+    {
+      this->FlatNodes[parent].Right = index;
+    }
+    flatNode_& node = this->FlatNodes[index];
+    std::copy_n(kd->GetMinBounds(), 3, node.Min);
+    std::copy_n(kd->GetMaxBounds(), 3, node.Max);
+    node.Right = -1;
+    node.MinID = kd->GetMinID();
+    node.MaxID = kd->GetMaxID();
+    if (kd->GetLeft())
+    {
+      stack.emplace_back(kd->GetRight(), index);
+      stack.emplace_back(kd->GetLeft(), -1);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkKdTree::FindRegionInFlatTree(double x, double y, double z)
+{
+  // Same traversal as findRegion(): the first region, in depth-first order,
+  // whose bounds contain the point.
+  const flatNode_* nodes = this->FlatNodes;
+  int index = 0;
+  int localStack[64];
+  std::vector<int> heapStack;
+  int* stack = localStack;
+  if (this->Level >= 64)
+  {
+    heapStack.resize(this->Level + 1);
+    stack = heapStack.data();
+  }
+  int stackSize = 0;
+  while (true)
+  {
+    const flatNode_& node = nodes[index];
+    if (node.Min[0] <= x && x <= node.Max[0] && node.Min[1] <= y && y <= node.Max[1] &&
+      node.Min[2] <= z && z <= node.Max[2])
+    {
+      if (node.Right < 0)
+      {
+        return node.MinID;
+      }
+      stack[stackSize++] = node.Right;
+      index++;
+    }
+    else if (stackSize > 0)
+    {
+      index = stack[--stackSize];
+    }
+    else
+    {
+      return -1;
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 // Query functions subsequent to BuildLocatorFromPoints,
 // relating to duplicate and nearby points
@@ -2427,7 +2601,94 @@ void vtkKdTree::FindPointsWithinRadius(double R, const double x[3], vtkIdList* r
 {
   result->Reset();
   // don't forget to square the radius
-  this->FindPointsWithinRadius(this->Top, R * R, x, result);
+  if (this->FlatNodes && this->LocatorPoints)
+  {
+    this->FindPointsWithinRadiusInFlatTree(R * R, x, result);
+  }
+  else
+  {
+    this->FindPointsWithinRadius(this->Top, R * R, x, result);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Same traversal as the recursive FindPointsWithinRadius(), on the flat tree.
+void vtkKdTree::FindPointsWithinRadiusInFlatTree(double R2, const double x[3], vtkIdList* result)
+{
+  std::vector<int> stack(1, 0);
+  while (!stack.empty())
+  {
+    const flatNode_& node = this->FlatNodes[stack.back()];
+    int index = stack.back();
+    stack.pop_back();
+
+    double mindist2 = 0; // distance to closest vertex of BB
+    double maxdist2 = 0; // distance to furthest vertex of BB
+    for (int i = 0; i < 3; i++)
+    {
+      double lo = node.Min[i];
+      double hi = node.Max[i];
+      if (x[i] < lo)
+      {
+        mindist2 += (lo - x[i]) * (lo - x[i]);
+        maxdist2 += (hi - x[i]) * (hi - x[i]);
+      }
+      else if (x[i] > hi)
+      {
+        mindist2 += (hi - x[i]) * (hi - x[i]);
+        maxdist2 += (lo - x[i]) * (lo - x[i]);
+      }
+      else if ((hi - x[i]) > (x[i] - lo))
+      {
+        maxdist2 += (hi - x[i]) * (hi - x[i]);
+      }
+      else
+      {
+        maxdist2 += (lo - x[i]) * (lo - x[i]);
+      }
+    }
+
+    if (mindist2 > R2)
+    {
+      // non-intersecting
+      continue;
+    }
+
+    // The points of the regions of a subtree are contiguous.
+    int begin = this->LocatorRegionLocation[node.MinID];
+    int end = node.MaxID + 1 < this->NumberOfRegions
+      ? this->LocatorRegionLocation[node.MaxID + 1]
+      : this->NumberOfLocatorPoints;
+
+    if (maxdist2 <= R2)
+    {
+      // sphere contains BB
+      for (int i = begin; i < end; i++)
+      {
+        result->InsertNextId(static_cast<vtkIdType>(this->LocatorIds[i]));
+      }
+    }
+    else if (node.Right < 0)
+    {
+      // partial intersection of sphere & BB
+      const float* pt = this->LocatorPoints + (begin * 3);
+      for (int i = begin; i < end; i++)
+      {
+        double dist2 = (pt[0] - x[0]) * (pt[0] - x[0]) + (pt[1] - x[1]) * (pt[1] - x[1]) +
+          (pt[2] - x[2]) * (pt[2] - x[2]);
+        if (dist2 <= R2)
+        {
+          result->InsertNextId(static_cast<vtkIdType>(this->LocatorIds[i]));
+        }
+        pt += 3;
+      }
+    }
+    else
+    {
+      stack.push_back(node.Right);
+      stack.push_back(index + 1);
+    }
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -3135,6 +3396,10 @@ void vtkKdTree::FreeSearchStructure()
 
   delete[] this->LocatorRegionLocation;
   this->LocatorRegionLocation = nullptr;
+
+  delete[] this->FlatNodes;
+  this->FlatNodes = nullptr;
+  this->NumberOfFlatNodes = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -4214,6 +4479,10 @@ int* vtkKdTree::AllGetRegionContainingCell()
 //------------------------------------------------------------------------------
 int vtkKdTree::GetRegionContainingPoint(double x, double y, double z)
 {
+  if (this->FlatNodes)
+  {
+    return this->FindRegionInFlatTree(x, y, z);
+  }
   return vtkKdTree::findRegion(this->Top, x, y, z);
 }
 //------------------------------------------------------------------------------
@@ -766,12 +766,33 @@ protected:
   // Recursive helper for public FindPointsInArea
   void AddAllPointsInRegion(vtkKdNode* node, vtkIdTypeArray* ids);
 
+  // Divide a region recursively. The top of the tree is split serially,
+  // then the remaining subtrees are divided concurrently (vtkSMPTools).
   int DivideRegion(vtkKdNode* kd, float* c1, int* ids, int nlevels);
 
+  // Split a region in two halves, return 0 if it is not divided.
+  int SplitRegion(vtkKdNode* kd, float* c1, int* ids, int level);
+
   void DoMedianFind(vtkKdNode* kd, float* c1, int* ids, int d1, int d2, int d3);
 
   void SelfRegister(vtkKdNode* kd);
 
+  // Depth-first copy of the tree built by BuildLocatorFromPoints(), used by
+  // the point location queries. The left child of a node immediately
+  // follows it.
+  struct flatNode_
+  {
+    double Min[3];
+    double Max[3];
+    int Right; // index of the right child, -1 for a leaf
+    int MinID; // first region of the subtree
+    int MaxID; // last region of the subtree
+  };
+
+  void BuildFlatTree();
+  int FindRegionInFlatTree(double x, double y, double z);
+  void FindPointsWithinRadiusInFlatTree(double R2, const double x[3], vtkIdList* ids);
+
   struct cellList_
   {
     vtkDataSet* dataSet; // cell lists for which data set
@@ -876,6 +897,9 @@ protected:
   int* LocatorIds;
   int* LocatorRegionLocation;
 
+  int NumberOfFlatNodes;
+  flatNode_* FlatNodes;
+
   float MaxWidth;
 
   // These Last* values are here to save state so we can
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkMortonCode
+ * @brief   inline functions to compute 3D Morton codes
+ *
+ * vtkMortonCode interleaves the bits of three integer coordinates so that
+ * sorting by the resulting key orders points along a Z-order (Morton) curve.
+ * It is shared by the locators that sort queries for coherence.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. It
+ * is not meant to define a public API.
+ */
+
+#ifndef vtkMortonCode_h
+#define vtkMortonCode_h
+
+#include "vtkABINamespace.h"
+#include "vtkType.h"
+
+namespace vtkMortonCode
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+/**
+ * Spread the lower 21 bits of v so that they occupy every third bit.
+ */
+inline vtkTypeUInt64 SpreadBits(vtkTypeUInt64 v)
+{
+  v &= 0x1fffff;
+  v = (v | v << 32) & 0x1f00000000ffffULL;
+  v = (v | v << 16) & 0x1f0000ff0000ffULL;
+  v = (v | v << 8) & 0x100f00f00f00f00fULL;
+  v = (v | v << 4) & 0x10c30c30c30c30c3ULL;
+  v = (v | v << 2) & 0x1249249249249249ULL;
+  return v;
+}
+
+/**
+ * Interleave the lower 21 bits of i, j and k into a 63-bit Morton code.
+ */
+inline vtkTypeUInt64 Encode(vtkTypeUInt64 i, vtkTypeUInt64 j, vtkTypeUInt64 k)
+{
+  return SpreadBits(i) | (SpreadBits(j) << 1) | (SpreadBits(k) << 2);
+}
+
+VTK_ABI_NAMESPACE_END
+}
+
+#endif
+// VTK-HeaderTest-Exclude: vtkMortonCode.h
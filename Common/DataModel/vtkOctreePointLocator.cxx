@@ -14,7 +14,11 @@
 #include "vtkOctreePointLocatorNode.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 
+#include <algorithm>
+#include <array>
 #include <list>
 #include <map>
 #include <queue>
@@ -225,54 +229,213 @@ int vtkOctreePointLocator::DivideTest(int size, int level)
 }
 
 //------------------------------------------------------------------------------
+// The octants are independent: each of them only rearranges its own range of
+// the ordering. The top of the octree is divided serially, partitioning the
+// points of large octants in parallel, until the subtrees are small enough
+// to keep the threads busy, then these subtrees are divided concurrently.
+// Since the partitions are stable, the octree and the ordering of the points
+// are the same as with a serial build.
 void vtkOctreePointLocator::DivideRegion(vtkOctreePointLocatorNode* node, int* ordering, int level)
 {
-  if (!this->DivideTest(node->GetNumberOfPoints(), level))
+  struct DivideTask
   {
-    return;
+    vtkOctreePointLocatorNode* Node;
+    int* Ordering;
+    int Level;
+  };
+
+  // Gather the coordinates once, instead of querying the data set at every
+  // level of the octree.
+  vtkDataSet* ds = this->GetDataSet();
+  std::vector<double> coordinates(3 * ds->GetNumberOfPoints());
+  double* coords = coordinates.data();
+  vtkSMPTools::For(0, ds->GetNumberOfPoints(),
+    [ds, coords](vtkIdType ptId, vtkIdType end)
+    {
+      for (; ptId < end; ++ptId)
+      {
+        ds->GetPoint(ptId, coords + 3 * ptId);
+      }
+    });
+
+  int numThreads = std::max(vtkSMPTools::GetEstimatedNumberOfThreads(), 1);
+  int taskSize = std::max(node->GetNumberOfPoints() / (8 * numThreads), 16384);
+
+  std::vector<DivideTask> tasks;
+  std::vector<DivideTask> stack(1, DivideTask{ node, ordering, level });
+  int maxLevel = this->Level;
+  while (!stack.empty())
+  {
+    DivideTask task = stack.back();
+    stack.pop_back();
+    if (task.Node->GetNumberOfPoints() <= taskSize)
+    {
+      tasks.push_back(task);
+    }
+    else if (this->SplitRegion(task.Node, task.Ordering, task.Level, coords, true))
+    {
+      maxLevel = std::max(maxLevel, task.Level + 1);
+      int counter = 0;
+      for (int i = 0; i < 8; i++)
+      {
+        vtkOctreePointLocatorNode* child = task.Node->GetChild(i);
+        stack.push_back(DivideTask{ child, task.Ordering + counter, task.Level + 1 });
+        counter += child->GetNumberOfPoints();
+      }
+    }
+  }
+
+  vtkSMPThreadLocal<int> localMaxLevel(maxLevel);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(tasks.size()), 1,
+    [this, &tasks, &localMaxLevel, coords](vtkIdType taskId, vtkIdType endTaskId)
+    {
+      int& threadMaxLevel = localMaxLevel.Local();
+      std::vector<DivideTask> subtasks;
+      for (; taskId < endTaskId; ++taskId)
+      {
+        subtasks.push_back(tasks[taskId]);
+        while (!subtasks.empty())
+        {
+          DivideTask task = subtasks.back();
+          subtasks.pop_back();
+          if (this->SplitRegion(task.Node, task.Ordering, task.Level, coords, false))
+          {
+            threadMaxLevel = std::max(threadMaxLevel, task.Level + 1);
+            int counter = 0;
+            for (int i = 0; i < 8; i++)
+            {
+              vtkOctreePointLocatorNode* child = task.Node->GetChild(i);
+              subtasks.push_back(DivideTask{ child, task.Ordering + counter, task.Level + 1 });
+              counter += child->GetNumberOfPoints();
+            }
+          }
+        }
+      }
+    });
+
+  for (int threadMaxLevel : localMaxLevel)
+  {
+    maxLevel = std::max(maxLevel, threadMaxLevel);
   }
-  if (level >= this->Level)
+  this->Level = maxLevel;
+}
+
+//------------------------------------------------------------------------------
+int vtkOctreePointLocator::SplitRegion(vtkOctreePointLocatorNode* node, int* ordering,
+  int level, const double* coordinates, bool threaded)
+{
+  if (!this->DivideTest(node->GetNumberOfPoints(), level))
   {
-    this->Level = level + 1;
+    return 0;
   }
 
   node->CreateChildNodes();
   int numberOfPoints = node->GetNumberOfPoints();
-  vtkDataSet* ds = this->GetDataSet();
-
-  std::vector<int> points[7];
-  int i;
   int subOctantNumberOfPoints[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
-  for (i = 0; i < numberOfPoints; i++)
+  int i;
+
+  if (!threaded || numberOfPoints < 65536)
   {
-    int index = node->GetSubOctantIndex(ds->GetPoint(ordering[i]), 0);
-    if (index)
+    std::vector<int> points[7];
+    for (i = 0; i < numberOfPoints; i++)
     {
-      points[index - 1].push_back(ordering[i]);
+      double pt[3];
+      std::copy_n(coordinates + 3 * static_cast<vtkIdType>(ordering[i]), 3, pt);
+      int index = node->GetSubOctantIndex(pt, 0);
+      if (index)
+      {
+        points[index - 1].push_back(ordering[i]);
+      }
+      else
+      {
+        ordering[subOctantNumberOfPoints[0]] = ordering[i];
+      }
+      subOctantNumberOfPoints[index]++;
     }
-    else
+    int counter = 0;
+    int sizeOfInt = sizeof(int);
+    for (i = 0; i < 7; i++)
     {
-      ordering[subOctantNumberOfPoints[0]] = ordering[i];
+      counter += subOctantNumberOfPoints[i];
+      if (!points[i].empty())
+      {
+        memcpy(ordering + counter, points[i].data(), subOctantNumberOfPoints[i + 1] * sizeOfInt);
+      }
     }
-    subOctantNumberOfPoints[index]++;
   }
-  int counter = 0;
-  int sizeOfInt = sizeof(int);
-  for (i = 0; i < 7; i++)
+  else
   {
-    counter += subOctantNumberOfPoints[i];
-    if (!points[i].empty())
+    // Stable counting sort in parallel: count the points of each octant per
+    // chunk, then scatter each chunk at the offsets given by the counts.
+    const int chunkSize = 16384;
+    const vtkIdType numChunks = (numberOfPoints + chunkSize - 1) / chunkSize;
+    std::vector<unsigned char> octants(numberOfPoints);
+    std::vector<std::array<int, 8>> offsets(numChunks);
+    vtkSMPTools::For(0, numChunks, 1,
+      [node, ordering, coordinates, numberOfPoints, &octants, &offsets](
+        vtkIdType chunk, vtkIdType endChunk)
+      {
+        for (; chunk < endChunk; ++chunk)
+        {
+          std::array<int, 8>& counts = offsets[chunk];
+          counts.fill(0);
+          int end = std::min(static_cast<int>((chunk + 1) * chunkSize), numberOfPoints);
+          for (int j = static_cast<int>(chunk * chunkSize); j < end; j++)
+          {
+            double pt[3];
+            std::copy_n(coordinates + 3 * static_cast<vtkIdType>(ordering[j]), 3, pt);
+            int index = node->GetSubOctantIndex(pt, 0);
+            octants[j] = static_cast<unsigned char>(index);
+            counts[index]++;
+          }
+        }
+      });
+
+    for (const auto& counts : offsets)
+    {
+      for (i = 0; i < 8; i++)
+      {
+        subOctantNumberOfPoints[i] += counts[i];
+      }
+    }
+    int octantStart[8];
+    octantStart[0] = 0;
+    for (i = 1; i < 8; i++)
     {
-      memcpy(ordering + counter, points[i].data(), subOctantNumberOfPoints[i + 1] * sizeOfInt);
+      octantStart[i] = octantStart[i - 1] + subOctantNumberOfPoints[i - 1];
     }
+    for (auto& counts : offsets)
+    {
+      for (i = 0; i < 8; i++)
+      {
+        int count = counts[i];
+        counts[i] = octantStart[i];
+        octantStart[i] += count;
+      }
+    }
+
+    std::vector<int> sorted(numberOfPoints);
+    vtkSMPTools::For(0, numChunks, 1,
+      [ordering, numberOfPoints, &octants, &offsets, &sorted](vtkIdType chunk, vtkIdType endChunk)
+      {
+        for (; chunk < endChunk; ++chunk)
+        {
+          std::array<int, 8>& next = offsets[chunk];
+          int end = std::min(static_cast<int>((chunk + 1) * chunkSize), numberOfPoints);
+          for (int j = static_cast<int>(chunk * chunkSize); j < end; j++)
+          {
+            sorted[next[octants[j]]++] = ordering[j];
+          }
+        }
+      });
+    std::copy(sorted.begin(), sorted.end(), ordering);
   }
-  counter = 0;
+
   for (i = 0; i < 8; i++)
   {
     node->GetChild(i)->SetNumberOfPoints(subOctantNumberOfPoints[i]);
-    this->DivideRegion(node->GetChild(i), ordering + counter, level + 1);
-    counter += subOctantNumberOfPoints[i];
   }
+  return 1;
 }
 
 //------------------------------------------------------------------------------
@@ -404,14 +567,20 @@ void vtkOctreePointLocator::BuildLocatorInternal()
   // is of type float and directly copy that instead of dealing with
   // all of the casts
   vtkDataSet* ds = this->GetDataSet();
-  for (i = 0; i < numPoints; i++)
-  {
-    double* pt = ds->GetPoint(this->LocatorIds[i]);
-
-    this->LocatorPoints[i * 3] = static_cast<float>(pt[0]);
-    this->LocatorPoints[i * 3 + 1] = static_cast<float>(pt[1]);
-    this->LocatorPoints[i * 3 + 2] = static_cast<float>(pt[2]);
-  }
+  int* locatorIds = this->LocatorIds;
+  float* locatorPoints = this->LocatorPoints;
+  vtkSMPTools::For(0, numPoints,
+    [ds, locatorIds, locatorPoints](vtkIdType ptId, vtkIdType end)
+    {
+      double pt[3];
+      for (; ptId < end; ++ptId)
+      {
+        ds->GetPoint(locatorIds[ptId], pt);
+        locatorPoints[ptId * 3] = static_cast<float>(pt[0]);
+        locatorPoints[ptId * 3 + 1] = static_cast<float>(pt[1]);
+        locatorPoints[ptId * 3 + 2] = static_cast<float>(pt[2]);
+      }
+    });
 
   int nextLeafNodeId = 0;
   int nextMinId = 0;
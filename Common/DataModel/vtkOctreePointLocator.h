@@ -219,8 +219,20 @@ protected:
   // Recursive helper for public FindPointsInArea
   void AddAllPointsInRegion(vtkOctreePointLocatorNode* node, vtkIdTypeArray* ids);
 
+  /**
+   * Divide a node recursively. The top of the octree is divided serially,
+   * with a parallel partition of the points of large octants, then the
+   * remaining subtrees are divided concurrently (vtkSMPTools).
+   */
   void DivideRegion(vtkOctreePointLocatorNode* node, int* ordering, int level);
 
+  /**
+   * Split a node in eight octants, stably partitioning its points given
+   * their coordinates. Return 0 if the node is not divided.
+   */
+  int SplitRegion(vtkOctreePointLocatorNode* node, int* ordering, int level,
+    const double* coordinates, bool threaded);
+
   int DivideTest(int size, int level);
 
   void AddPolys(vtkOctreePointLocatorNode* node, vtkPoints* pts, vtkCellArray* polys);
@@ -10,6 +10,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkSMPThreadLocal.h"
 #include "vtkSMPTools.h"
+#include "vtkSOADataArrayTemplate.h"
 
 #include <algorithm>
 #include <array>
@@ -257,6 +258,34 @@ struct CutWorker
   }
 };
 
+// Same evaluation for points in the struct-of-arrays layout, reading each
+// coordinate from its own contiguous array so that the loop vectorizes.
+template <typename ValueType, typename OutputArrayType>
+struct SOACutWorker
+{
+  using OutputValueType = vtk::GetAPIType<OutputArrayType>;
+
+  const ValueType* Coordinates[3];
+  OutputArrayType* Output;
+  OutputValueType Normal[3];
+  OutputValueType Origin[3];
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    auto dstValues = vtk::DataArrayValueRange<1>(this->Output);
+    const ValueType* x = this->Coordinates[0];
+    const ValueType* y = this->Coordinates[1];
+    const ValueType* z = this->Coordinates[2];
+    for (vtkIdType pointId = begin; pointId < end; ++pointId)
+    {
+      dstValues[pointId] =
+        this->Normal[0] * (static_cast<double>(x[pointId]) - this->Origin[0]) +
+        this->Normal[1] * (static_cast<double>(y[pointId]) - this->Origin[1]) +
+        this->Normal[2] * (static_cast<double>(z[pointId]) - this->Origin[2]);
+    }
+  }
+};
+
 struct CutFunctionWorker
 {
   double Normal[3];
@@ -267,7 +296,7 @@ struct CutFunctionWorker
     std::copy_n(o, 3, this->Origin);
   }
   template <typename InputArrayType, typename OutputArrayType>
-  void operator()(InputArrayType* input, OutputArrayType* output)
+  void Evaluate(InputArrayType* input, OutputArrayType* output)
   {
     VTK_ASSUME(input->GetNumberOfComponents() == 3);
     VTK_ASSUME(output->GetNumberOfComponents() == 1);
@@ -277,6 +306,31 @@ struct CutFunctionWorker
     std::copy_n(this->Origin, 3, cut.Origin);
     vtkSMPTools::For(0, numTuples, cut);
   }
+  template <typename InputArrayType, typename OutputArrayType>
+  void operator()(InputArrayType* input, OutputArrayType* output)
+  {
+    this->Evaluate(input, output);
+  }
+  template <typename ValueType, typename OutputArrayType>
+  void operator()(vtkSOADataArrayTemplate<ValueType>* input, OutputArrayType* output)
+  {
+    if (!input->HasComponentArrays())
+    {
+      this->Evaluate(input, output);
+      return;
+    }
+    VTK_ASSUME(input->GetNumberOfComponents() == 3);
+    VTK_ASSUME(output->GetNumberOfComponents() == 1);
+    SOACutWorker<ValueType, OutputArrayType> cut;
+    cut.Output = output;
+    for (int comp = 0; comp < 3; ++comp)
+    {
+      cut.Coordinates[comp] = input->GetComponentArrayPointer(comp);
+      cut.Normal[comp] = this->Normal[comp];
+      cut.Origin[comp] = this->Origin[comp];
+    }
+    vtkSMPTools::For(0, input->GetNumberOfTuples(), cut);
+  }
 };
 } // end anon namespace
 
@@ -286,10 +340,14 @@ void vtkPlane::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
   CutFunctionWorker worker(this->Normal, this->Origin);
   typedef vtkTypeList::Create<float, double> InputTypes;
   typedef vtkTypeList::Create<float, double> OutputTypes;
+  typedef vtkArrayDispatch::Dispatch2ByArray<vtkArrayDispatch::PointArrays,
+    vtkArrayDispatch::PointArrays>
+    PointsDispatch;
   typedef vtkArrayDispatch::Dispatch2ByValueTypeUsingArrays<vtkArrayDispatch::AllArrays, InputTypes,
     OutputTypes>
     MyDispatch;
-  if (!MyDispatch::Execute(input, output, worker))
+  if (!PointsDispatch::Execute(input, output, worker) &&
+    !MyDispatch::Execute(input, output, worker))
   {
     worker(input, output); // Use vtkDataArray API if dispatch fails.
   }
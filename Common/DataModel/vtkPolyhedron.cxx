@@ -17,6 +17,7 @@
 #include "vtkPointLocator.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkPolyhedronTopologyCache.h"
 #include "vtkQuad.h"
 #include "vtkTetra.h"
 #include "vtkTriangle.h"
@@ -275,20 +276,27 @@ void vtkPolyhedron::ComputePositionFromParametricCoordinate(const double pc[3],
 // points, point ids, and faces have been loaded.
 void vtkPolyhedron::Initialize()
 {
+  // A topology cache only applies to the cell loaded just before this call.
+  vtkPolyhedronTopologyCache* cache = this->TopologyCache;
+  if (!this->TopologyCacheSet ||
+    (cache &&
+      (this->TopologyCellId < 0 || this->TopologyCellId >= cache->GetNumberOfCells() ||
+        cache->GetNumberOfFaces(this->TopologyCellId) != this->GlobalFaces->GetNumberOfCells())))
+  {
+    this->TopologyCache = nullptr;
+  }
+  this->TopologyCacheSet = false;
+
   // Clear out any remaining memory.
   this->PointIdMap.clear();
+  this->PointIdMapBuilt = false;
 
   // Clear out any remaining memory.
   this->PointToIncidentFaces.clear();
 
-  // We need to create a reverse map from the point ids to their canonical cell
-  // ids. This is a fancy way of saying that we have to be able to rapidly go
-  // from a PointId[i] to the location i in the cell.
-  vtkIdType i, id, numPointIds = this->PointIds->GetNumberOfIds();
-  for (i = 0; i < numPointIds; ++i)
+  if (!this->TopologyCache)
   {
-    id = this->PointIds->GetId(i);
-    this->PointIdMap[id] = i;
+    this->BuildPointIdMap();
   }
 
   // Edges have to be reset
@@ -312,6 +320,40 @@ void vtkPolyhedron::Initialize()
   this->LocatorConstructed = 0;
 }
 
+//------------------------------------------------------------------------------
+void vtkPolyhedron::BuildPointIdMap()
+{
+  if (this->PointIdMapBuilt)
+  {
+    return;
+  }
+
+  // We need to create a reverse map from the point ids to their canonical cell
+  // ids. This is a fancy way of saying that we have to be able to rapidly go
+  // from a PointId[i] to the location i in the cell.
+  vtkIdType i, id, numPointIds = this->PointIds->GetNumberOfIds();
+  for (i = 0; i < numPointIds; ++i)
+  {
+    id = this->PointIds->GetId(i);
+    this->PointIdMap[id] = i;
+  }
+  this->PointIdMapBuilt = true;
+}
+
+//------------------------------------------------------------------------------
+void vtkPolyhedron::SetTopologyCache(vtkPolyhedronTopologyCache* cache, vtkIdType cellId)
+{
+  this->TopologyCache = cache;
+  this->TopologyCellId = cellId;
+  this->TopologyCacheSet = true;
+}
+
+//------------------------------------------------------------------------------
+vtkPolyhedronTopologyCache* vtkPolyhedron::GetTopologyCache()
+{
+  return this->TopologyCache;
+}
+
 //------------------------------------------------------------------------------
 int vtkPolyhedron::GetNumberOfEdges()
 {
@@ -370,6 +412,20 @@ int vtkPolyhedron::GenerateEdges()
     return 0;
   }
 
+  // Copy the precomputed edges
+  if (this->TopologyCache)
+  {
+    const vtkIdType *edges, *edgeFaces;
+    const vtkIdType numEdges =
+      this->TopologyCache->GetEdges(this->TopologyCellId, edges, edgeFaces);
+    this->Edges->SetNumberOfTuples(numEdges);
+    this->EdgeFaces->SetNumberOfTuples(numEdges);
+    std::copy(edges, edges + 2 * numEdges, this->Edges->GetPointer(0));
+    std::copy(edgeFaces, edgeFaces + 2 * numEdges, this->EdgeFaces->GetPointer(0));
+    this->EdgesGenerated = 1;
+    return numEdges;
+  }
+
   vtkNew<vtkIdList> tmpface;
   vtkIdType nfaces = 0;
   const vtkIdType* face;
@@ -435,6 +491,23 @@ void vtkPolyhedron::GenerateFaces()
     return;
   }
 
+  // Copy the precomputed faces
+  if (this->TopologyCache)
+  {
+    const vtkIdType nfaces = this->TopologyCache->GetNumberOfFaces(this->TopologyCellId);
+    this->Faces->Reset();
+    this->Faces->AllocateExact(
+      nfaces, this->TopologyCache->GetNumberOfFacePoints(this->TopologyCellId));
+    for (vtkIdType faceId = 0; faceId < nfaces; ++faceId)
+    {
+      const vtkIdType* pts;
+      const vtkIdType npts = this->TopologyCache->GetFace(this->TopologyCellId, faceId, pts);
+      this->Faces->InsertNextCell(npts, pts);
+    }
+    this->FacesGenerated = 1;
+    return;
+  }
+
   // Basically we just run through the faces and change the global ids to the
   // canonical ids using the PointIdMap.
   this->Faces->DeepCopy(this->GlobalFaces);
@@ -477,6 +550,18 @@ vtkCell* vtkPolyhedron::GetFace(int faceId)
   this->GlobalFaces->GetCellAtId(faceId, this->Polygon->PointIds);
   this->Polygon->Points->SetNumberOfPoints(numPts);
 
+  // the precomputed face gives the canonical ids
+  if (this->TopologyCache)
+  {
+    const vtkIdType* pts;
+    this->TopologyCache->GetFace(this->TopologyCellId, faceId, pts);
+    for (i = 0; i < numPts; ++i)
+    {
+      this->Polygon->Points->SetPoint(i, this->Points->GetPoint(pts[i]));
+    }
+    return this->Polygon;
+  }
+
   // grab faces in global id space
   for (i = 0; i < numPts; ++i)
   {
@@ -1303,6 +1388,26 @@ int vtkPolyhedron::TriangulateFaces(vtkCellArray* newFaces)
   return 1;
 }
 
+//------------------------------------------------------------------------------
+bool vtkPolyhedron::IsFacePlanar(int faceId, double tolerance)
+{
+  if (faceId < 0 || faceId >= this->GetNumberOfFaces())
+  {
+    return false;
+  }
+
+  if (this->TopologyCache && this->TopologyCache->GetPlanarityTolerance() == tolerance)
+  {
+    return this->TopologyCache->IsFacePlanar(this->TopologyCellId, faceId);
+  }
+
+  this->GenerateFaces();
+  vtkIdType npts;
+  const vtkIdType* pts;
+  this->Faces->GetCellAtId(faceId, npts, pts, this->CellIds);
+  return vtkPolyhedronTopologyCache::IsPlanar(this->Points, npts, pts, tolerance);
+}
+
 //------------------------------------------------------------------------------
 void vtkPolyhedron::GeneratePointToIncidentFaces()
 {
@@ -1313,6 +1418,16 @@ void vtkPolyhedron::GeneratePointToIncidentFaces()
   std::vector<std::set<vtkIdType>> setFacesOfPoint(this->GetNumberOfPoints());
   for (int faceIndex = 0; faceIndex < this->GetNumberOfFaces(); faceIndex++)
   {
+    if (this->TopologyCache)
+    {
+      const vtkIdType* pts;
+      const vtkIdType npts = this->TopologyCache->GetFace(this->TopologyCellId, faceIndex, pts);
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        setFacesOfPoint[pts[i]].insert(faceIndex);
+      }
+      continue;
+    }
     auto face = this->GetFace(faceIndex);
     // For each point of the face
     for (int pointIndexFace = 0; pointIndexFace < face->GetNumberOfPoints(); pointIndexFace++)
@@ -1713,6 +1828,7 @@ bool CheckNonManifoldTriangulation(EdgeFaceSetMap& edgeFaceMap)
 
 bool GetContourPoints(double value, vtkPolyhedron* cell,
   const vtkPolyhedron::vtkPointIdMap& pointIdMap, // from global id to local cell id
+  vtkPolyhedronTopologyCache* topology, vtkIdType topologyCellId,
   FaceEdgesVector& faceEdgesVector, EdgeFaceSetMap& edgeFaceMap, EdgeSet& originalEdges,
   std::vector<std::vector<vtkIdType>>& oririginalFaceTriFaceMap,
   PointIndexEdgeMultiMap& contourPointEdgeMultiMap, EdgePointIndexMap& edgeContourPointMap,
@@ -1743,7 +1859,25 @@ bool GetContourPoints(double value, vtkPolyhedron* cell,
     }
 
     size_t nTris = faces.size();
-    TriangulateFace(face, faces, triIds, cell->GetPoints(), pointIdMap);
+    if (topology)
+    {
+      // the precomputed triangulation is the one of TriangulateFace(), in canonical ids
+      const vtkIdType* tris;
+      const vtkIdType numTris = topology->GetFaceTriangles(topologyCellId, i, tris);
+      for (vtkIdType j = 0; j < 3 * numTris; j += 3)
+      {
+        Face tri(3);
+        for (int k = 0; k < 3; ++k)
+        {
+          tri[k] = cell->GetPointIds()->GetId(tris[j + k]);
+        }
+        faces.push_back(tri);
+      }
+    }
+    else
+    {
+      TriangulateFace(face, faces, triIds, cell->GetPoints(), pointIdMap);
+    }
     std::vector<vtkIdType> trisOfFace;
     for (size_t j = nTris; j < faces.size(); ++j)
     {
@@ -1971,6 +2105,8 @@ void vtkPolyhedron::Contour(double value, vtkDataArray* pointScalars,
   vtkCellArray* polys, vtkPointData* inPd, vtkPointData* outPd, vtkCellData* inCd, vtkIdType cellId,
   vtkCellData* outCd)
 {
+  this->BuildPointIdMap();
+
   EdgeFaceSetMap edgeFaceMap;
   FaceEdgesVector faceEdgesVector;
   PointIndexEdgeMultiMap contourPointEdgeMultiMap;
@@ -1979,9 +2115,10 @@ void vtkPolyhedron::Contour(double value, vtkDataArray* pointScalars,
   EdgeSet originalEdges;
   std::vector<std::vector<vtkIdType>> oririginalFaceTriFaceMap;
 
-  if (!GetContourPoints(value, this, this->PointIdMap, faceEdgesVector, edgeFaceMap, originalEdges,
-        oririginalFaceTriFaceMap, contourPointEdgeMultiMap, edgeContourPointMap, pointLocationMap,
-        locator, pointScalars, inPd, outPd))
+  if (!GetContourPoints(value, this, this->PointIdMap, this->TopologyCache, this->TopologyCellId,
+        faceEdgesVector, edgeFaceMap, originalEdges, oririginalFaceTriFaceMap,
+        contourPointEdgeMultiMap, edgeContourPointMap, pointLocationMap, locator, pointScalars,
+        inPd, outPd))
   {
     return;
   }
@@ -2302,6 +2439,8 @@ void vtkPolyhedron::Clip(double value, vtkDataArray* pointScalars,
   vtkIncrementalPointLocator* locator, vtkCellArray* connectivity, vtkPointData* inPd,
   vtkPointData* outPd, vtkCellData* inCd, vtkIdType cellId, vtkCellData* outCd, int insideOut)
 {
+  this->BuildPointIdMap();
+
   // set the compare function
   std::function<bool(double, double)> c = [insideOut](double a, double b) {
     if (insideOut)
@@ -2352,9 +2491,10 @@ void vtkPolyhedron::Clip(double value, vtkDataArray* pointScalars,
   EdgeSet originalEdges;
   std::vector<std::vector<vtkIdType>> oririginalFaceTriFaceMap;
 
-  if (!GetContourPoints(value, this, this->PointIdMap, faceEdgesVector, edgeFaceMap, originalEdges,
-        oririginalFaceTriFaceMap, contourPointEdgeMultiMap, edgeContourPointMap, pointLocationMap,
-        locator, pointScalars, inPd, outPd))
+  if (!GetContourPoints(value, this, this->PointIdMap, this->TopologyCache, this->TopologyCellId,
+        faceEdgesVector, edgeFaceMap, originalEdges, oririginalFaceTriFaceMap,
+        contourPointEdgeMultiMap, edgeContourPointMap, pointLocationMap, locator, pointScalars,
+        inPd, outPd))
   {
     return;
   }
@@ -2542,6 +2682,10 @@ void vtkPolyhedron::ShallowCopy(vtkCell* c)
   if (cell)
   {
     this->GlobalFaces->ShallowCopy(cell->GlobalFaces);
+    if (cell->TopologyCache)
+    {
+      this->SetTopologyCache(cell->TopologyCache, cell->TopologyCellId);
+    }
     this->Initialize();
   }
 }
@@ -2555,6 +2699,10 @@ void vtkPolyhedron::DeepCopy(vtkCell* c)
   if (cell)
   {
     this->GlobalFaces->DeepCopy(cell->GlobalFaces);
+    if (cell->TopologyCache)
+    {
+      this->SetTopologyCache(cell->TopologyCache, cell->TopologyCellId);
+    }
     this->Initialize();
   }
 }
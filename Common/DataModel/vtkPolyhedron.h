@@ -123,6 +123,7 @@
 #include "vtkCell3D.h"
 #include "vtkCommonDataModelModule.h" // For export macro
 #include "vtkDeprecation.h"           // For VTK_DEPRECATED
+#include "vtkSmartPointer.h"          // For vtkSmartPointer
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkIdTypeArray;
@@ -137,6 +138,7 @@ class vtkPolyData;
 class vtkCellLocator;
 class vtkGenericCell;
 class vtkPointLocator;
+class vtkPolyhedronTopologyCache;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkPolyhedron : public vtkCell3D
 {
@@ -428,6 +430,25 @@ public:
    */
   bool IsConvex();
 
+  ///@{
+  /**
+   * Use the precomputed topology of cell cellId of an unstructured grid
+   * (faces in canonical ids, edges and face triangulations) instead of
+   * building it from the faces. The cache applies to the cell loaded by the
+   * next call to Initialize() only, and must describe its point ids and
+   * faces: vtkUnstructuredGrid::GetCell() sets it for the polyhedra it loads.
+   */
+  void SetTopologyCache(vtkPolyhedronTopologyCache* cache, vtkIdType cellId);
+  vtkPolyhedronTopologyCache* GetTopologyCache();
+  ///@}
+
+  /**
+   * Return true if the points of a face lie in a plane, within tolerance
+   * (see vtkPolyhedronTopologyCache::IsPlanar()). The flag of the topology
+   * cache is used when it was computed with the same tolerance.
+   */
+  bool IsFacePlanar(int faceId, double tolerance = 1e-6);
+
   /**
    * Construct polydata if no one exist, then return this->PolyData
    */
@@ -508,6 +529,17 @@ private:
   // The PointIdMap is constructed during the call of the Initialize() method and maps global
   // point ids to the canonical point ids.
   vtkPointIdMap PointIdMap;
+  bool PointIdMapBuilt = false;
+
+  // With a topology cache, only contouring and clipping need the PointIdMap,
+  // which is then built on demand.
+  void BuildPointIdMap();
+
+  // Precomputed topology, see SetTopologyCache(). TopologyCacheSet is true
+  // between SetTopologyCache() and the next Initialize().
+  vtkSmartPointer<vtkPolyhedronTopologyCache> TopologyCache;
+  vtkIdType TopologyCellId = -1;
+  bool TopologyCacheSet = false;
 
   void GeneratePointToIncidentFaces();
 
@@ -0,0 +1,491 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkPolyhedronTopologyCache.h"
+
+#include "vtkCellArray.h"
+#include "vtkIdList.h"
+#include "vtkMath.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolygon.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkVector.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkPolyhedronTopologyCache);
+
+namespace
+{
+//------------------------------------------------------------------------------
+vtkMTimeType GetGridMTime(vtkUnstructuredGrid* grid)
+{
+  vtkMTimeType time = grid->GetPoints() ? grid->GetPoints()->GetMTime() : 0;
+  vtkCellArray* arrays[3] = { grid->GetCells(), grid->GetPolyhedronFaces(),
+    grid->GetPolyhedronFaceLocations() };
+  for (vtkCellArray* array : arrays)
+  {
+    time = std::max(time, array ? array->GetMTime() : 0);
+  }
+  return time;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType GetGridNumberOfFacePoints(vtkUnstructuredGrid* grid)
+{
+  vtkCellArray* faces = grid->GetPolyhedronFaces();
+  return faces ? faces->GetNumberOfConnectivityIds() : 0;
+}
+
+//------------------------------------------------------------------------------
+// Map from the global point ids of a cell to their canonical ids. Like
+// vtkPolyhedron::PointIdMap, a point repeated in the cell maps to its last
+// position, and a point which is not in the cell maps to 0.
+struct CanonicalIds
+{
+  std::vector<std::pair<vtkIdType, vtkIdType>> Map;
+
+  void Build(vtkIdType npts, const vtkIdType* pts)
+  {
+    this->Map.resize(npts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      this->Map[i] = std::make_pair(pts[i], i);
+    }
+    std::sort(this->Map.begin(), this->Map.end());
+  }
+
+  vtkIdType operator()(vtkIdType ptId) const
+  {
+    auto it =
+      std::upper_bound(this->Map.begin(), this->Map.end(), std::make_pair(ptId, VTK_ID_MAX));
+    return (it == this->Map.begin() || (it - 1)->first != ptId) ? 0 : (it - 1)->second;
+  }
+};
+
+// Occurrence of an edge in a face, for the search of the unique edges.
+struct EdgeUse
+{
+  vtkIdType Low;
+  vtkIdType High;
+  vtkIdType Use; // index of the use in the faces of the cell
+
+  bool operator<(const EdgeUse& other) const
+  {
+    return this->Low != other.Low ? this->Low < other.Low
+                                  : (this->High != other.High ? this->High < other.High
+                                                              : this->Use < other.Use);
+  }
+};
+
+struct LocalData
+{
+  CanonicalIds Ids;
+  std::vector<vtkIdType> UsePoints; // 2 canonical ids per use
+  std::vector<vtkIdType> UseFaces;
+  std::vector<EdgeUse> Uses;
+  std::vector<std::pair<vtkIdType, vtkIdType>> Edges; // first use, last use
+};
+
+//------------------------------------------------------------------------------
+// Same computation as in the contouring code of vtkPolyhedron.
+void CalculateAngles(vtkPoints* points, const vtkIdType* tri, double& minAngle, double& maxAngle)
+{
+  double p[9];
+  points->GetPoint(tri[0], p + 0);
+  points->GetPoint(tri[1], p + 3);
+  points->GetPoint(tri[2], p + 6);
+
+  minAngle = DBL_MAX;
+  maxAngle = 0;
+
+  vtkVector3d left, right;
+  for (int i = 0; i < 3; ++i)
+  {
+    double* p0 = p + 3 * i;
+    double* p1 = p + 3 * ((i + 1) % 3);
+    double* p2 = p + 3 * ((i + 2) % 3);
+
+    left.Set(p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]);
+    right.Set(p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]);
+    left.Normalize();
+    right.Normalize();
+
+    double dot = std::max(-1.0, std::min(1.0, left.Dot(right)));
+    double angle = acos(dot) * 180.0 / vtkMath::Pi();
+
+    minAngle = std::min(angle, minAngle);
+    maxAngle = std::max(angle, maxAngle);
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+struct vtkPolyhedronTopologyCache::BuildFunctor
+{
+  enum Pass
+  {
+    COUNT_FACES,
+    COUNT_FACE_POINTS,
+    FILL
+  };
+
+  vtkPolyhedronTopologyCache* Self;
+  vtkCellArray* Cells;
+  vtkCellArray* Faces;
+  vtkCellArray* FaceLocations;
+  vtkPoints* Points;
+  Pass CurrentPass = COUNT_FACES;
+
+  vtkSMPThreadLocalObject<vtkIdList> CellIds;
+  vtkSMPThreadLocalObject<vtkIdList> FaceIds;
+  vtkSMPThreadLocalObject<vtkIdList> FacePointIds;
+  vtkSMPThreadLocal<LocalData> Local;
+
+  void Initialize() {}
+
+  // Collect the edge uses of a cell in canonical ids, and find its unique
+  // edges in the order of their first use. The last use gives the second
+  // face of the edge, as in vtkPolyhedron::GenerateEdges().
+  void FindEdges(vtkIdType nfaces, const vtkIdType* faceIds, vtkIdList* tmp, LocalData& local)
+  {
+    local.UsePoints.clear();
+    local.UseFaces.clear();
+    for (vtkIdType face = 0; face < nfaces; ++face)
+    {
+      vtkIdType npts;
+      const vtkIdType* pts;
+      this->Faces->GetCellAtId(faceIds[face], npts, pts, tmp);
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        local.UsePoints.push_back(local.Ids(pts[i]));
+        local.UsePoints.push_back(local.Ids(pts[i + 1 != npts ? i + 1 : 0]));
+        local.UseFaces.push_back(face);
+      }
+    }
+
+    const vtkIdType numUses = static_cast<vtkIdType>(local.UseFaces.size());
+    local.Uses.resize(numUses);
+    for (vtkIdType use = 0; use < numUses; ++use)
+    {
+      const vtkIdType v0 = local.UsePoints[2 * use];
+      const vtkIdType v1 = local.UsePoints[2 * use + 1];
+      local.Uses[use] = EdgeUse{ std::min(v0, v1), std::max(v0, v1), use };
+    }
+    std::sort(local.Uses.begin(), local.Uses.end());
+
+    local.Edges.clear();
+    for (vtkIdType use = 0; use < numUses; ++use)
+    {
+      const EdgeUse& edgeUse = local.Uses[use];
+      if (use == 0 || edgeUse.Low != local.Uses[use - 1].Low ||
+        edgeUse.High != local.Uses[use - 1].High)
+      {
+        local.Edges.emplace_back(edgeUse.Use, edgeUse.Use);
+      }
+      else
+      {
+        local.Edges.back().second = edgeUse.Use;
+      }
+    }
+    std::sort(local.Edges.begin(), local.Edges.end());
+  }
+
+  // Triangulate a face given by canonical ids with the fan chosen by the
+  // contouring code of vtkPolyhedron: the fan whose internal angles are the
+  // closest to 60 degrees.
+  void TriangulateFace(
+    vtkIdType npts, const vtkIdType* face, const vtkIdType* cellPts, vtkIdType* tris)
+  {
+    if (npts < 3)
+    {
+      return;
+    }
+
+    double minRange = DBL_MAX;
+    vtkIdType choose = 0;
+    for (vtkIdType offset = 0; offset < npts; ++offset)
+    {
+      double minAngle = DBL_MAX;
+      double maxAngle = 0;
+      for (vtkIdType i = 0; i < npts - 2; ++i)
+      {
+        const vtkIdType tri[3] = { cellPts[face[offset]], cellPts[face[(i + offset + 1) % npts]],
+          cellPts[face[(i + offset + 2) % npts]] };
+        double triMin, triMax;
+        CalculateAngles(this->Points, tri, triMin, triMax);
+        minAngle = std::min(minAngle, triMin);
+        maxAngle = std::max(maxAngle, triMax);
+      }
+      const double range = std::abs(60.0 - minAngle) + std::abs(maxAngle - 60.0);
+      if (range < minRange)
+      {
+        choose = offset;
+        minRange = range;
+      }
+    }
+
+    for (vtkIdType i = 0; i < npts - 2; ++i)
+    {
+      tris[3 * i] = face[choose];
+      tris[3 * i + 1] = face[(i + choose + 1) % npts];
+      tris[3 * i + 2] = face[(i + choose + 2) % npts];
+    }
+  }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    vtkPolyhedronTopologyCache* self = this->Self;
+    vtkIdList* cellIds = this->CellIds.Local();
+    vtkIdList* faceIdList = this->FaceIds.Local();
+    vtkIdList* facePtIds = this->FacePointIds.Local();
+    LocalData& local = this->Local.Local();
+    const vtkIdType numLocations = this->FaceLocations->GetNumberOfCells();
+
+    for (; cellId < endCellId && cellId < numLocations; ++cellId)
+    {
+      vtkIdType nfaces;
+      const vtkIdType* faceIds;
+      this->FaceLocations->GetCellAtId(cellId, nfaces, faceIds, faceIdList);
+      if (nfaces == 0)
+      {
+        continue;
+      }
+
+      if (this->CurrentPass == COUNT_FACE_POINTS)
+      {
+        vtkIdType face = self->CellFaceOffsets[cellId];
+        for (vtkIdType i = 0; i < nfaces; ++i, ++face)
+        {
+          const vtkIdType npts = this->Faces->GetCellSize(faceIds[i]);
+          self->FacePointOffsets[face + 1] = npts;
+          self->FaceTriangleOffsets[face + 1] = std::max<vtkIdType>(npts - 2, 0);
+        }
+        continue;
+      }
+
+      vtkIdType numCellPts;
+      const vtkIdType* cellPts;
+      this->Cells->GetCellAtId(cellId, numCellPts, cellPts, cellIds);
+      local.Ids.Build(numCellPts, cellPts);
+      this->FindEdges(nfaces, faceIds, facePtIds, local);
+      const vtkIdType numEdges = static_cast<vtkIdType>(local.Edges.size());
+
+      if (this->CurrentPass == COUNT_FACES)
+      {
+        self->CellFaceOffsets[cellId + 1] = nfaces;
+        self->CellEdgeOffsets[cellId + 1] = numEdges;
+        continue;
+      }
+
+      // Edges
+      vtkIdType* edgePts = self->EdgePoints.data() + 2 * self->CellEdgeOffsets[cellId];
+      vtkIdType* edgeFaces = self->EdgeFaces.data() + 2 * self->CellEdgeOffsets[cellId];
+      for (vtkIdType edge = 0; edge < numEdges; ++edge)
+      {
+        const vtkIdType first = local.Edges[edge].first;
+        const vtkIdType last = local.Edges[edge].second;
+        edgePts[2 * edge] = local.UsePoints[2 * first];
+        edgePts[2 * edge + 1] = local.UsePoints[2 * first + 1];
+        edgeFaces[2 * edge] = local.UseFaces[first];
+        edgeFaces[2 * edge + 1] = last != first ? local.UseFaces[last] : -1;
+      }
+
+      // Faces in canonical ids, their triangulation and planarity. The
+      // canonical ids of the face points are the first points of the uses.
+      vtkIdType face = self->CellFaceOffsets[cellId];
+      const vtkIdType* usePts = local.UsePoints.data();
+      for (vtkIdType i = 0; i < nfaces; ++i, ++face)
+      {
+        vtkIdType npts;
+        const vtkIdType* pts;
+        this->Faces->GetCellAtId(faceIds[i], npts, pts, facePtIds);
+        vtkIdType* facePts = self->FacePoints.data() + self->FacePointOffsets[face];
+        for (vtkIdType j = 0; j < npts; ++j, usePts += 2)
+        {
+          facePts[j] = usePts[0];
+        }
+        this->TriangulateFace(npts, facePts, cellPts,
+          self->Triangles.data() + 3 * self->FaceTriangleOffsets[face]);
+        self->FacePlanar[face] = vtkPolyhedronTopologyCache::IsPlanar(
+                                   this->Points, npts, pts, self->PlanarityTolerance)
+          ? 1
+          : 0;
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+
+//------------------------------------------------------------------------------
+vtkPolyhedronTopologyCache::vtkPolyhedronTopologyCache() = default;
+
+//------------------------------------------------------------------------------
+vtkPolyhedronTopologyCache::~vtkPolyhedronTopologyCache() = default;
+
+//------------------------------------------------------------------------------
+void vtkPolyhedronTopologyCache::Initialize()
+{
+  this->CellFaceOffsets.clear();
+  this->CellEdgeOffsets.clear();
+  this->FacePointOffsets.clear();
+  this->FacePoints.clear();
+  this->FaceTriangleOffsets.clear();
+  this->Triangles.clear();
+  this->FacePlanar.clear();
+  this->EdgePoints.clear();
+  this->EdgeFaces.clear();
+  this->GridMTime = 0;
+  this->GridNumberOfCells = 0;
+  this->GridNumberOfPoints = 0;
+  this->GridNumberOfFacePoints = 0;
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkPolyhedronTopologyCache::Build(vtkUnstructuredGrid* grid)
+{
+  this->Initialize();
+  if (!grid)
+  {
+    return;
+  }
+
+  this->GridMTime = GetGridMTime(grid);
+  this->GridNumberOfCells = grid->GetNumberOfCells();
+  this->GridNumberOfPoints = grid->GetNumberOfPoints();
+  this->GridNumberOfFacePoints = GetGridNumberOfFacePoints(grid);
+
+  const vtkIdType numCells = this->GridNumberOfCells;
+  this->CellFaceOffsets.assign(numCells + 1, 0);
+  this->CellEdgeOffsets.assign(numCells + 1, 0);
+  this->FacePointOffsets.assign(1, 0);
+  this->FaceTriangleOffsets.assign(1, 0);
+
+  BuildFunctor functor;
+  functor.Self = this;
+  functor.Cells = grid->GetCells();
+  functor.Faces = grid->GetPolyhedronFaces();
+  functor.FaceLocations = grid->GetPolyhedronFaceLocations();
+  functor.Points = grid->GetPoints();
+  if (numCells == 0 || !functor.Cells || !functor.Faces || !functor.FaceLocations ||
+    !functor.Points)
+  {
+    return;
+  }
+
+  // Count the faces and edges of each cell, then the points and triangles
+  // of each face, and fill the arrays at the offsets of each cell.
+  functor.CurrentPass = BuildFunctor::COUNT_FACES;
+  vtkSMPTools::For(0, numCells, functor);
+  std::partial_sum(
+    this->CellFaceOffsets.begin(), this->CellFaceOffsets.end(), this->CellFaceOffsets.begin());
+  std::partial_sum(
+    this->CellEdgeOffsets.begin(), this->CellEdgeOffsets.end(), this->CellEdgeOffsets.begin());
+
+  const vtkIdType numFaces = this->CellFaceOffsets[numCells];
+  this->FacePointOffsets.assign(numFaces + 1, 0);
+  this->FaceTriangleOffsets.assign(numFaces + 1, 0);
+  functor.CurrentPass = BuildFunctor::COUNT_FACE_POINTS;
+  vtkSMPTools::For(0, numCells, functor);
+  std::partial_sum(
+    this->FacePointOffsets.begin(), this->FacePointOffsets.end(), this->FacePointOffsets.begin());
+  std::partial_sum(this->FaceTriangleOffsets.begin(), this->FaceTriangleOffsets.end(),
+    this->FaceTriangleOffsets.begin());
+
+  const vtkIdType numEdges = this->CellEdgeOffsets[numCells];
+  this->FacePoints.resize(this->FacePointOffsets[numFaces]);
+  this->Triangles.resize(3 * this->FaceTriangleOffsets[numFaces]);
+  this->FacePlanar.resize(numFaces);
+  this->EdgePoints.resize(2 * numEdges);
+  this->EdgeFaces.resize(2 * numEdges);
+  functor.CurrentPass = BuildFunctor::FILL;
+  vtkSMPTools::For(0, numCells, functor);
+}
+
+//------------------------------------------------------------------------------
+bool vtkPolyhedronTopologyCache::IsUpToDate(vtkUnstructuredGrid* grid) const
+{
+  return grid && !this->CellFaceOffsets.empty() && this->GridMTime == GetGridMTime(grid) &&
+    this->GridNumberOfCells == grid->GetNumberOfCells() &&
+    this->GridNumberOfPoints == grid->GetNumberOfPoints() &&
+    this->GridNumberOfFacePoints == GetGridNumberOfFacePoints(grid);
+}
+
+//------------------------------------------------------------------------------
+bool vtkPolyhedronTopologyCache::IsPlanar(
+  vtkPoints* points, vtkIdType npts, const vtkIdType* pts, double tolerance)
+{
+  if (npts < 4)
+  {
+    return true;
+  }
+
+  double normal[3];
+  vtkPolygon::ComputeNormal(points, static_cast<int>(npts), pts, normal);
+
+  double center[3] = { 0.0, 0.0, 0.0 };
+  double bounds[6] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN,
+    VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+  for (vtkIdType i = 0; i < npts; ++i)
+  {
+    double x[3];
+    points->GetPoint(pts[i], x);
+    for (int j = 0; j < 3; ++j)
+    {
+      center[j] += x[j] / npts;
+      bounds[2 * j] = std::min(bounds[2 * j], x[j]);
+      bounds[2 * j + 1] = std::max(bounds[2 * j + 1], x[j]);
+    }
+  }
+
+  const double low[3] = { bounds[0], bounds[2], bounds[4] };
+  const double high[3] = { bounds[1], bounds[3], bounds[5] };
+  const double diagonal = std::sqrt(vtkMath::Distance2BetweenPoints(low, high));
+  for (vtkIdType i = 0; i < npts; ++i)
+  {
+    double x[3];
+    points->GetPoint(pts[i], x);
+    const double distance = std::abs((x[0] - center[0]) * normal[0] +
+      (x[1] - center[1]) * normal[1] + (x[2] - center[2]) * normal[2]);
+    if (distance > tolerance * diagonal)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkPolyhedronTopologyCache::GetActualMemorySize() const
+{
+  size_t size = sizeof(vtkIdType) *
+    (this->CellFaceOffsets.capacity() + this->CellEdgeOffsets.capacity() +
+      this->FacePointOffsets.capacity() + this->FacePoints.capacity() +
+      this->FaceTriangleOffsets.capacity() + this->Triangles.capacity() +
+      this->EdgePoints.capacity() + this->EdgeFaces.capacity()) +
+    this->FacePlanar.capacity();
+  return static_cast<unsigned long>(std::ceil(size / 1024.0));
+}
+
+//------------------------------------------------------------------------------
+void vtkPolyhedronTopologyCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  const vtkIdType numCells = this->GetNumberOfCells();
+  os << indent << "PlanarityTolerance: " << this->PlanarityTolerance << "\n";
+  os << indent << "NumberOfCells: " << numCells << "\n";
+  os << indent << "NumberOfFaces: " << (numCells ? this->CellFaceOffsets[numCells] : 0) << "\n";
+  os << indent << "NumberOfEdges: " << (numCells ? this->CellEdgeOffsets[numCells] : 0) << "\n";
+}
+VTK_ABI_NAMESPACE_END
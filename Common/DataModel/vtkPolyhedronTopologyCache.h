@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPolyhedronTopologyCache
+ * @brief   precomputed topology of the polyhedral cells of an unstructured grid
+ *
+ * vtkPolyhedronTopologyCache stores, for every polyhedron of a
+ * vtkUnstructuredGrid, the data that vtkPolyhedron otherwise rebuilds each
+ * time a cell is loaded:
+ *
+ * - the faces in canonical (cell local) point ids, in compressed row storage;
+ * - the unique edges in canonical ids and the faces using them, in the order
+ *   of vtkPolyhedron::GetEdge();
+ * - a triangulation of each face, the one used by vtkPolyhedron::Contour()
+ *   and vtkPolyhedron::Clip() (the fan of smallest internal angle range);
+ * - a planarity flag per face.
+ *
+ * The cache is built in parallel with vtkSMPTools by Build(), and is
+ * read-only afterward, so it can be shared by cells loaded from several
+ * threads. vtkUnstructuredGrid builds one on demand (see
+ * vtkUnstructuredGrid::GetPolyhedronTopologyCache()) and hands it to the
+ * vtkPolyhedron returned by GetCell(). Faces are indexed in the order of the
+ * faces of their cell, and all the arrays are indexed by cell id; cells
+ * which are not polyhedra have no face.
+ *
+ * @sa
+ * vtkPolyhedron vtkUnstructuredGrid vtkPolyhedronUtilities
+ */
+
+#ifndef vtkPolyhedronTopologyCache_h
+#define vtkPolyhedronTopologyCache_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <vector> // For storage
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkPoints;
+class vtkUnstructuredGrid;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkPolyhedronTopologyCache : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods to instantiate, print and obtain type-related information.
+   */
+  static vtkPolyhedronTopologyCache* New();
+  vtkTypeMacro(vtkPolyhedronTopologyCache, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Tolerance of the planarity test of the faces, relative to the length of
+   * the diagonal of the bounding box of each face. It must be set before
+   * Build(). Default is 1e-6.
+   */
+  vtkSetClampMacro(PlanarityTolerance, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(PlanarityTolerance, double);
+  ///@}
+
+  /**
+   * Compute the topology of the polyhedra of grid. The cache does not keep
+   * a reference to the grid; IsUpToDate() tells whether it still matches it.
+   */
+  void Build(vtkUnstructuredGrid* grid);
+
+  /**
+   * Return true if the cache was built from grid and the connectivity,
+   * faces and points of the grid were not modified since.
+   */
+  bool IsUpToDate(vtkUnstructuredGrid* grid) const;
+
+  /**
+   * Free the memory.
+   */
+  void Initialize();
+
+  /**
+   * Number of cells of the grid the cache was built from.
+   */
+  vtkIdType GetNumberOfCells() const
+  {
+    return this->CellFaceOffsets.empty()
+      ? 0
+      : static_cast<vtkIdType>(this->CellFaceOffsets.size() - 1);
+  }
+
+  /**
+   * Number of faces of a cell, 0 if the cell is not a polyhedron.
+   */
+  vtkIdType GetNumberOfFaces(vtkIdType cellId) const
+  {
+    return this->CellFaceOffsets[cellId + 1] - this->CellFaceOffsets[cellId];
+  }
+
+  /**
+   * Get the canonical point ids of a face of a cell, and return their number.
+   */
+  vtkIdType GetFace(vtkIdType cellId, vtkIdType faceId, const vtkIdType*& pts) const
+  {
+    const vtkIdType face = this->CellFaceOffsets[cellId] + faceId;
+    pts = this->FacePoints.data() + this->FacePointOffsets[face];
+    return this->FacePointOffsets[face + 1] - this->FacePointOffsets[face];
+  }
+
+  /**
+   * Number of points of all the faces of a cell.
+   */
+  vtkIdType GetNumberOfFacePoints(vtkIdType cellId) const
+  {
+    return this->FacePointOffsets[this->CellFaceOffsets[cellId + 1]] -
+      this->FacePointOffsets[this->CellFaceOffsets[cellId]];
+  }
+
+  /**
+   * Get the unique edges of a cell as pairs of canonical point ids, and the
+   * pairs of faces using them (-1 when an edge is used by a single face),
+   * and return the number of edges.
+   */
+  vtkIdType GetEdges(vtkIdType cellId, const vtkIdType*& edges, const vtkIdType*& edgeFaces) const
+  {
+    const vtkIdType begin = this->CellEdgeOffsets[cellId];
+    edges = this->EdgePoints.data() + 2 * begin;
+    edgeFaces = this->EdgeFaces.data() + 2 * begin;
+    return this->CellEdgeOffsets[cellId + 1] - begin;
+  }
+
+  /**
+   * Get the triangles of a face of a cell, as triplets of canonical point
+   * ids, and return their number.
+   */
+  vtkIdType GetFaceTriangles(vtkIdType cellId, vtkIdType faceId, const vtkIdType*& tris) const
+  {
+    const vtkIdType face = this->CellFaceOffsets[cellId] + faceId;
+    tris = this->Triangles.data() + 3 * this->FaceTriangleOffsets[face];
+    return this->FaceTriangleOffsets[face + 1] - this->FaceTriangleOffsets[face];
+  }
+
+  /**
+   * Return true if the points of a face of a cell lie in a plane, within
+   * the PlanarityTolerance.
+   */
+  bool IsFacePlanar(vtkIdType cellId, vtkIdType faceId) const
+  {
+    return this->FacePlanar[this->CellFaceOffsets[cellId] + faceId] != 0;
+  }
+
+  /**
+   * Planarity test used by the cache: return true if the points pts of a
+   * polygon are closer to their mean plane than tolerance times the diagonal
+   * of their bounding box. Polygons with less than four points are planar.
+   */
+  static bool IsPlanar(vtkPoints* points, vtkIdType npts, const vtkIdType* pts, double tolerance);
+
+  /**
+   * Return the memory used by the cache, in kibibytes (1024 bytes).
+   */
+  unsigned long GetActualMemorySize() const;
+
+protected:
+  vtkPolyhedronTopologyCache();
+  ~vtkPolyhedronTopologyCache() override;
+
+  double PlanarityTolerance = 1e-6;
+
+  // Per cell
+  std::vector<vtkIdType> CellFaceOffsets;
+  std::vector<vtkIdType> CellEdgeOffsets;
+
+  // Per face
+  std::vector<vtkIdType> FacePointOffsets;
+  std::vector<vtkIdType> FacePoints;
+  std::vector<vtkIdType> FaceTriangleOffsets;
+  std::vector<vtkIdType> Triangles;
+  std::vector<unsigned char> FacePlanar;
+
+  // Per edge
+  std::vector<vtkIdType> EdgePoints;
+  std::vector<vtkIdType> EdgeFaces;
+
+  // State of the grid at build time, for IsUpToDate()
+  vtkMTimeType GridMTime = 0;
+  vtkIdType GridNumberOfCells = 0;
+  vtkIdType GridNumberOfPoints = 0;
+  vtkIdType GridNumberOfFacePoints = 0;
+
+private:
+  vtkPolyhedronTopologyCache(const vtkPolyhedronTopologyCache&) = delete;
+  void operator=(const vtkPolyhedronTopologyCache&) = delete;
+
+  struct BuildFunctor;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
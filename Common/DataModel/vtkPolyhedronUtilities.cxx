@@ -17,23 +17,17 @@ namespace
 struct CopyWorker
 {
   // Copy tuples from inArray (indexed on global ids) to outArray (indexed on local ids).
-  // pointIdMap is used to map global ids to local ids.
-  // WARNING: this worker only make sense in the vtkPolyhedron scope (where `globalIds` corresponds
-  // to vtkPolyhedron::PointIds and `pointIdMap` corresponds to `vtkPolyhedron::PointIdMap`).
-  // It should not be used in other cases, nothing guarantying that localPtId is in the
-  // range of outArray.
+  // In the vtkPolyhedron scope, `globalIds` corresponds to vtkPolyhedron::PointIds, which
+  // gives the global id of each local id.
   template <typename ArrayType1, typename ArrayType2>
-  void operator()(ArrayType1* inArray, ArrayType2* outArray, vtkIdList* globalIds,
-    const vtkPolyhedron::vtkPointIdMap& pointIdMap)
+  void operator()(ArrayType1* inArray, ArrayType2* outArray, vtkIdList* globalIds)
   {
     // Number of components is already set by calling CopyStructure beforehand
     outArray->SetNumberOfTuples(globalIds->GetNumberOfIds());
 
-    for (int i = 0; i < globalIds->GetNumberOfIds(); i++)
+    for (vtkIdType localPtId = 0; localPtId < globalIds->GetNumberOfIds(); localPtId++)
     {
-      auto globalPtId = globalIds->GetId(i);
-      auto localPtId = pointIdMap.at(globalPtId);
-      outArray->SetTuple(localPtId, globalPtId, inArray);
+      outArray->SetTuple(localPtId, globalIds->GetId(localPtId), inArray);
     }
   }
 };
@@ -148,14 +142,16 @@ vtkSmartPointer<vtkUnstructuredGrid> vtkPolyhedronUtilities::Decompose(
   typedef vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::AllTypes> Dispatcher;
   typedef vtkArrayDispatch::Dispatch2BySameValueType<vtkArrayDispatch::AllTypes> Dispatcher2;
 
-  const vtkPolyhedron::vtkPointIdMap& pointIdMap = polyhedron->PointIdMap;
   vtkIdList* pointIds = polyhedron->GetPointIds();
 
+  // Faces with canonical point indexes, precomputed when the polyhedron has a topology cache.
+  polyhedron->GenerateFaces();
+  vtkCellArray* localFaces = polyhedron->Faces;
+
   ////////// Copy point data to the output //////////
   // Output point data should follow the output unstructured grid indexation, that corresponds
   // initially to polyhedron's canonical ids (new point data will be added for barycenters).
-  // Therefore, we can use polyhedron's pointIdMap to do the mapping between input ids and output
-  // ids.
+  // Therefore, the polyhedron's point ids give the input id of each output id.
   vtkPointData* outPd = outputGrid->GetPointData();
   if (inPd)
   {
@@ -168,14 +164,14 @@ vtkSmartPointer<vtkUnstructuredGrid> vtkPolyhedronUtilities::Decompose(
       vtkDataArray* outArray = vtkDataArray::SafeDownCast(outAbstArray);
       if (inArray && outArray)
       {
-        if (!Dispatcher2::Execute(inArray, outArray, copyWorker, pointIds, pointIdMap))
+        if (!Dispatcher2::Execute(inArray, outArray, copyWorker, pointIds))
         {
-          copyWorker(inArray, outArray, pointIds, pointIdMap); // Fallback for vtkDataArray subtypes
+          copyWorker(inArray, outArray, pointIds); // Fallback for vtkDataArray subtypes
         }
       }
       else
       {
-        copyWorker(inAbstArray, outAbstArray, pointIds, pointIdMap); // Fallback for other arrays
+        copyWorker(inAbstArray, outAbstArray, pointIds); // Fallback for other arrays
       }
     }
   }
@@ -186,10 +182,8 @@ vtkSmartPointer<vtkUnstructuredGrid> vtkPolyhedronUtilities::Decompose(
   // XXX Consider rework this code in order to include the face and face points iterations
   // inside the workers in order to reduce the number of dispatches (that are costly)
 
-  // Global faces are faces with global point indexes
-  vtkCellArray* globalFaces = polyhedron->GetCellFaces();
-  const vtkIdType* globalFace = nullptr;
-  vtkIdType facesNb = globalFaces->GetNumberOfCells();
+  const vtkIdType* localFace = nullptr;
+  vtkIdType facesNb = localFaces->GetNumberOfCells();
   vtkIdType numberOfNewCells = 0; // Account for the number of cells of the output UG
   vtkNew<vtkIdList> faceIds;
 
@@ -198,7 +192,7 @@ vtkSmartPointer<vtkUnstructuredGrid> vtkPolyhedronUtilities::Decompose(
   for (vtkIdType faceCount = 0; faceCount < facesNb; ++faceCount)
   {
     vtkIdType nbFacePts;
-    globalFaces->GetCellAtId(faceCount, nbFacePts, globalFace, faceIds);
+    localFaces->GetCellAtId(faceCount, nbFacePts, localFace, faceIds);
 
     // Add a new value for each output array, init to 0.0
     for (vtkIdType arrayId = 0; arrayId < outPd->GetNumberOfArrays(); arrayId++)
@@ -229,8 +223,8 @@ vtkSmartPointer<vtkUnstructuredGrid> vtkPolyhedronUtilities::Decompose(
     for (vtkIdType i = 0; i < nbFacePts; i++)
     {
       // Accumulate face points coordinates
-      auto globalPtId = globalFace[i];
-      auto localPtId = pointIdMap.at(globalPtId);
+      auto localPtId = localFace[i];
+      auto globalPtId = pointIds->GetId(localPtId);
 
       std::array<double, 3> pt = { 0.0, 0.0, 0.0 };
       polyhedron->GetPoints()->GetPoint(localPtId, pt.data());
@@ -368,11 +362,11 @@ vtkSmartPointer<vtkUnstructuredGrid> vtkPolyhedronUtilities::Decompose(
 
   // Insert to UG a new tetra. Tetra points:
   // ptId1, ptId2 (forming one face edge), face barycenter, polyhedron barycenter
-  auto insertTetra = [&](vtkCell* face, vtkIdType ptId1, vtkIdType ptId2) {
+  auto insertTetra = [&](const vtkIdType* face, vtkIdType ptId1, vtkIdType ptId2) {
     vtkIdType ptIds[4] = { 0 };
-    ptIds[0] = pointIdMap.at(face->GetPointId(ptId1));
+    ptIds[0] = face[ptId1];
     ptIds[1] = barycenterId;
-    ptIds[2] = pointIdMap.at(face->GetPointId(ptId2));
+    ptIds[2] = face[ptId2];
     ptIds[3] = polyBarycenterId;
     vtkIdType newCellId = outputGrid->InsertNextCell(VTK_TETRA, 4, ptIds);
     outCd->CopyData(inCd, cellId, newCellId);
@@ -381,16 +375,17 @@ vtkSmartPointer<vtkUnstructuredGrid> vtkPolyhedronUtilities::Decompose(
   // Add cells to output UG. Each new cell will contain the same data that the current polyhedron.
   // This can be potentially improved by finding a way to insert index at the same time we
   // create the barycenters, in order to avoid re-iterating over all the faces again
-  for (vtkIdType faceId = 0; faceId < polyhedron->GetNumberOfFaces(); ++faceId)
+  for (vtkIdType faceId = 0; faceId < facesNb; ++faceId)
   {
-    vtkCell* face = polyhedron->GetFace(faceId);
+    vtkIdType nbFacePts;
+    localFaces->GetCellAtId(faceId, nbFacePts, localFace, faceIds);
 
-    for (vtkIdType ptId = 0; ptId < face->GetNumberOfPoints() - 1; ptId++)
+    for (vtkIdType ptId = 0; ptId < nbFacePts - 1; ptId++)
     {
-      insertTetra(face, ptId, ptId + 1);
+      insertTetra(localFace, ptId, ptId + 1);
     }
 
-    insertTetra(face, face->GetNumberOfPoints() - 1, 0);
+    insertTetra(localFace, nbFacePts - 1, 0);
     barycenterId++;
   }
 
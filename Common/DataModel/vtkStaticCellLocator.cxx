@@ -89,17 +89,14 @@ struct vtkCellBinner
     this->DataSet = loc->GetDataSet();
     loc->GetDivisions(this->Divisions);
 
-    // Allocate data. Note that these arrays are deleted elsewhere
-    this->CellBoundsSharedPtr = std::make_shared<std::vector<double>>(numCells * 6);
+    // Share the cell bounds cached by the dataset, computed if needed.
+    // Note that these arrays are deleted elsewhere
+    this->CellBoundsSharedPtr = this->DataSet->GetCellBoundsCache();
     this->CellBounds = this->CellBoundsSharedPtr->data();
     this->CountsSharedPtr =
       std::make_shared<std::vector<vtkIdType>>(numCells + 1); // one extra holds total count
     this->Counts = this->CountsSharedPtr->data();
 
-    // This is done to cause non-thread safe initialization to occur due to
-    // side effects from GetCellBounds().
-    this->DataSet->GetCellBounds(0, this->CellBounds);
-
     // Setup internal data members for more efficient processing.
     this->hX = this->H[0] = loc->H[0];
     this->hY = this->H[1] = loc->H[1];
@@ -173,14 +170,13 @@ struct vtkCellBinner
 
   void operator()(vtkIdType cellId, vtkIdType endCellId)
   {
-    double* bds = this->CellBounds + cellId * 6;
+    const double* bds = this->CellBounds + cellId * 6;
     vtkIdType* counts = this->Counts + cellId;
     double xmin[3], xmax[3];
     int ijkMin[3], ijkMax[3];
 
     for (; cellId < endCellId; ++cellId, bds += 6)
     {
-      this->DataSet->GetCellBounds(cellId, bds);
       xmin[0] = bds[0];
       xmin[1] = bds[2];
       xmin[2] = bds[4];
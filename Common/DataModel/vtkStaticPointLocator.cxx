@@ -6,10 +6,13 @@
 #include "vtkBox.h"
 #include "vtkCellArray.h"
 #include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIntArray.h"
 #include "vtkLine.h"
 #include "vtkMath.h"
+#include "vtkMortonCode.h"
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
@@ -18,6 +21,9 @@
 #include "vtkSMPTools.h"
 #include "vtkStructuredData.h"
 
+#include <algorithm>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -486,6 +492,13 @@ struct BucketList : public vtkBucketList
   void MergePointsWithData(vtkDataArray* data, vtkIdType* pointMap);
   void GenerateRepresentation(int vtkNotUsed(level), vtkPolyData* pd);
 
+  // Bucket-ordered, structure-of-arrays copy of the point coordinates (all x,
+  // then all y, then all z) used by the batched queries. It is built on
+  // first use since it costs three doubles per point.
+  std::vector<double> SortedPoints;
+  std::once_flag SortedPointsFlag;
+  const double* GetSortedPoints();
+
   // Internal methods
   void GetOverlappingBuckets(
     NeighborBuckets* buckets, const double x[3], const int ijk[3], double dist, int level);
@@ -1452,6 +1465,448 @@ void BucketList<TIds>::FindPointsWithinRadius(double R, const double x[3], vtkId
   }         // k-footprint
 }
 
+//------------------------------------------------------------------------------
+// Support for the batched queries. The queries are visited along a Morton
+// (Z-order) curve of the bucket grid so that the queries processed in
+// sequence by a thread touch the same buckets. Point coordinates are read
+// from a bucket-ordered, structure-of-arrays copy of the points: since the
+// buckets along a row of the grid are contiguous in the sorted map, the
+// points of a row of buckets form a single contiguous run, and the squared
+// distances to a run are evaluated with a simple loop the compiler
+// vectorizes.
+namespace
+{
+// The number of points whose distance is evaluated at once.
+constexpr vtkIdType BatchBlockSize = 256;
+
+// Squared distances from q to n consecutive points of a structure-of-arrays
+// layout. Keep this loop free of branches so that it vectorizes.
+void Distance2Block(
+  const double* x, const double* y, const double* z, const double q[3], vtkIdType n, double* d2)
+{
+  const double qx = q[0];
+  const double qy = q[1];
+  const double qz = q[2];
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    const double dx = x[i] - qx;
+    const double dy = y[i] - qy;
+    const double dz = z[i] - qz;
+    d2[i] = dx * dx + dy * dy + dz * dz;
+  }
+}
+
+// Return the query points as a contiguous array of doubles, converting
+// them into buffer if needed.
+const double* GetQueryPoints(vtkDataArray* queries, std::vector<double>& buffer)
+{
+  vtkDoubleArray* doubles = vtkDoubleArray::FastDownCast(queries);
+  if (doubles)
+  {
+    return doubles->GetPointer(0);
+  }
+  vtkIdType numQueries = queries->GetNumberOfTuples();
+  buffer.resize(3 * numQueries);
+  double* q = buffer.data();
+  vtkSMPTools::For(0, numQueries,
+    [queries, q](vtkIdType qId, vtkIdType end)
+    {
+      for (; qId < end; ++qId)
+      {
+        queries->GetTuple(qId, q + 3 * qId);
+      }
+    });
+  return q;
+}
+
+// Per-thread results of the batched radius queries.
+struct BatchHits
+{
+  std::vector<vtkIdType> Ids;
+  std::vector<double> Dist2;
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+template <typename TIds>
+const double* BucketList<TIds>::GetSortedPoints()
+{
+  std::call_once(this->SortedPointsFlag,
+    [this]()
+    {
+      vtkIdType numPts = this->NumPts;
+      this->SortedPoints.resize(3 * numPts);
+      double* x = this->SortedPoints.data();
+      double* y = x + numPts;
+      double* z = y + numPts;
+      vtkSMPTools::For(0, numPts,
+        [this, x, y, z](vtkIdType i, vtkIdType end)
+        {
+          double p[3];
+          for (; i < end; ++i)
+          {
+            this->DataSet->GetPoint(this->Map[i].PtId, p);
+            x[i] = p[0];
+            y[i] = p[1];
+            z[i] = p[2];
+          }
+        });
+    });
+  return this->SortedPoints.data();
+}
+
+//------------------------------------------------------------------------------
+// Process a batch of query points. The queries are sorted in Morton order on
+// construction, then each query method processes them in parallel and
+// writes the results in the original query order.
+template <typename TIds>
+struct BatchedQueries
+{
+  BucketList<TIds>* BList;
+  const double* Queries;
+  vtkIdType NumQueries;
+  std::vector<vtkIdType> Order;
+  const double* X;
+  const double* Y;
+  const double* Z;
+  int MaxLevel;
+
+  BatchedQueries(BucketList<TIds>* blist, const double* queries, vtkIdType numQueries)
+    : BList(blist)
+    , Queries(queries)
+    , NumQueries(numQueries)
+  {
+    this->X = blist->GetSortedPoints();
+    this->Y = this->X + blist->NumPts;
+    this->Z = this->Y + blist->NumPts;
+    this->MaxLevel =
+      std::max(blist->Divisions[0], std::max(blist->Divisions[1], blist->Divisions[2]));
+
+    // Morton codes are built from (at most) 21 bits of each bucket index.
+    int shift = 0;
+    while (((this->MaxLevel - 1) >> shift) >= (1 << 21))
+    {
+      ++shift;
+    }
+    std::vector<std::pair<vtkTypeUInt64, vtkIdType>> keys(numQueries);
+    vtkSMPTools::For(0, numQueries,
+      [blist, queries, shift, &keys](vtkIdType qId, vtkIdType end)
+      {
+        int ijk[3];
+        for (; qId < end; ++qId)
+        {
+          blist->GetBucketIndices(queries + 3 * qId, ijk);
+          keys[qId].first = vtkMortonCode::Encode(static_cast<vtkTypeUInt64>(ijk[0] >> shift),
+            static_cast<vtkTypeUInt64>(ijk[1] >> shift),
+            static_cast<vtkTypeUInt64>(ijk[2] >> shift));
+          keys[qId].second = qId;
+        }
+      });
+    vtkSMPTools::Sort(keys.begin(), keys.end());
+    this->Order.resize(numQueries);
+    for (vtkIdType i = 0; i < numQueries; ++i)
+    {
+      this->Order[i] = keys[i].second;
+    }
+  }
+
+  // Evaluate the squared distances from x to the points of the buckets
+  // cBeg to cEnd (inclusive), which are contiguous in the sorted map. The
+  // visitor is invoked with the sorted index of the first point of each
+  // block, the block size and the squared distances.
+  template <typename TVisitor>
+  void VisitRun(const double x[3], vtkIdType cBeg, vtkIdType cEnd, TVisitor& visit) const
+  {
+    double d2[BatchBlockSize];
+    vtkIdType end = this->BList->Offsets[cEnd + 1];
+    for (vtkIdType beg = this->BList->Offsets[cBeg]; beg < end; beg += BatchBlockSize)
+    {
+      vtkIdType n = std::min(BatchBlockSize, end - beg);
+      Distance2Block(this->X + beg, this->Y + beg, this->Z + beg, x, n, d2);
+      visit(beg, n, d2);
+    }
+  }
+
+  // Invoke run(cBeg, cEnd) for each row of buckets in the box [lo,hi].
+  template <typename TRun>
+  void ForEachBoxRun(const int lo[3], const int hi[3], TRun& run) const
+  {
+    for (int k = lo[2]; k <= hi[2]; ++k)
+    {
+      for (int j = lo[1]; j <= hi[1]; ++j)
+      {
+        vtkIdType row = j * this->BList->xD + k * this->BList->xyD;
+        run(row + lo[0], row + hi[0]);
+      }
+    }
+  }
+
+  // Invoke run(cBeg, cEnd) for each run of buckets in the shell of buckets
+  // at the given level around ijk (i.e., the buckets visited by
+  // GetBucketNeighbors()).
+  template <typename TRun>
+  void ForEachShellRun(const int ijk[3], int level, TRun& run) const
+  {
+    const int* ndivs = this->BList->Divisions;
+    int lo[3], hi[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      lo[i] = std::max(ijk[i] - level, 0);
+      hi[i] = std::min(ijk[i] + level, ndivs[i] - 1);
+    }
+    for (int k = lo[2]; k <= hi[2]; ++k)
+    {
+      bool kFace = (k == ijk[2] - level || k == ijk[2] + level);
+      for (int j = lo[1]; j <= hi[1]; ++j)
+      {
+        vtkIdType row = j * this->BList->xD + k * this->BList->xyD;
+        if (kFace || j == ijk[1] - level || j == ijk[1] + level)
+        {
+          run(row + lo[0], row + hi[0]);
+        }
+        else
+        {
+          if (ijk[0] - level >= 0)
+          {
+            run(row + ijk[0] - level, row + ijk[0] - level);
+          }
+          if (ijk[0] + level < ndivs[0])
+          {
+            run(row + ijk[0] + level, row + ijk[0] + level);
+          }
+        }
+      }
+    }
+  }
+
+  // The bucket indices of the box [x-r,x+r].
+  void GetBox(const double x[3], double r, int lo[3], int hi[3]) const
+  {
+    double xMin[3] = { x[0] - r, x[1] - r, x[2] - r };
+    double xMax[3] = { x[0] + r, x[1] + r, x[2] + r };
+    this->BList->GetBucketIndices(xMin, lo);
+    this->BList->GetBucketIndices(xMax, hi);
+  }
+
+  void FindClosestPoints(vtkIdType* ids, double* dist2)
+  {
+    vtkSMPTools::For(0, this->NumQueries,
+      [this, ids, dist2](vtkIdType beg, vtkIdType end)
+      {
+        const LocatorTuple<TIds>* map = this->BList->Map;
+        for (; beg < end; ++beg)
+        {
+          vtkIdType qId = this->Order[beg];
+          const double* x = this->Queries + 3 * qId;
+          vtkIdType closest = -1;
+          double minDist2 = VTK_DOUBLE_MAX;
+          auto visit = [&closest, &minDist2](vtkIdType first, vtkIdType n, const double* d2)
+          {
+            for (vtkIdType i = 0; i < n; ++i)
+            {
+              if (d2[i] < minDist2)
+              {
+                closest = first + i;
+                minDist2 = d2[i];
+              }
+            }
+          };
+          auto run = [this, x, &visit](vtkIdType cBeg, vtkIdType cEnd)
+          { this->VisitRun(x, cBeg, cEnd, visit); };
+
+          // Expanding shells of buckets until a point is found, then all
+          // the buckets that may contain a closer point.
+          int ijk[3];
+          this->BList->GetBucketIndices(x, ijk);
+          for (int level = 0; closest < 0 && level < this->MaxLevel; ++level)
+          {
+            this->ForEachShellRun(ijk, level, run);
+          }
+          if (closest >= 0 && minDist2 > 0.0)
+          {
+            int lo[3], hi[3];
+            this->GetBox(x, std::sqrt(minDist2), lo, hi);
+            this->ForEachBoxRun(lo, hi, run);
+          }
+
+          ids[qId] = (closest < 0 ? -1 : static_cast<vtkIdType>(map[closest].PtId));
+          if (dist2)
+          {
+            dist2[qId] = minDist2;
+          }
+        }
+      });
+  }
+
+  // Write the numClosest closest points of each query (sorted by
+  // increasing distance) at ids + numClosest * queryId.
+  void FindClosestNPoints(vtkIdType numClosest, vtkIdType* ids, double* dist2)
+  {
+    vtkSMPThreadLocal<std::vector<double>> localDist2;
+    vtkSMPThreadLocal<std::vector<std::pair<double, vtkIdType>>> localCandidates;
+    vtkSMPTools::For(0, this->NumQueries,
+      [&, this](vtkIdType beg, vtkIdType end)
+      {
+        const LocatorTuple<TIds>* map = this->BList->Map;
+        const TIds* offsets = this->BList->Offsets;
+        std::vector<double>& allDist2 = localDist2.Local();
+        std::vector<std::pair<double, vtkIdType>>& candidates = localCandidates.Local();
+        for (; beg < end; ++beg)
+        {
+          vtkIdType qId = this->Order[beg];
+          const double* x = this->Queries + 3 * qId;
+
+          // Expanding shells of buckets until there are enough points.
+          int ijk[3], level;
+          vtkIdType count = 0;
+          auto counter = [&count, offsets](vtkIdType cBeg, vtkIdType cEnd)
+          { count += offsets[cEnd + 1] - offsets[cBeg]; };
+          this->BList->GetBucketIndices(x, ijk);
+          for (level = 0; count < numClosest && level < this->MaxLevel; ++level)
+          {
+            this->ForEachShellRun(ijk, level, counter);
+          }
+
+          // The distance to the numClosest-th point among these bounds the
+          // search radius.
+          int lo[3], hi[3];
+          for (int i = 0; i < 3; ++i)
+          {
+            lo[i] = std::max(ijk[i] - level + 1, 0);
+            hi[i] = std::min(ijk[i] + level - 1, this->BList->Divisions[i] - 1);
+          }
+          allDist2.clear();
+          auto gather = [&allDist2](vtkIdType, vtkIdType n, const double* d2)
+          { allDist2.insert(allDist2.end(), d2, d2 + n); };
+          auto gatherRun = [this, x, &gather](vtkIdType cBeg, vtkIdType cEnd)
+          { this->VisitRun(x, cBeg, cEnd, gather); };
+          this->ForEachBoxRun(lo, hi, gatherRun);
+          std::nth_element(allDist2.begin(), allDist2.begin() + (numClosest - 1), allDist2.end());
+          double r2 = allDist2[numClosest - 1];
+
+          // Collect the points within that radius and keep the closest ones.
+          int boxLo[3], boxHi[3];
+          this->GetBox(x, std::sqrt(r2), boxLo, boxHi);
+          for (int i = 0; i < 3; ++i)
+          {
+            boxLo[i] = std::min(boxLo[i], lo[i]);
+            boxHi[i] = std::max(boxHi[i], hi[i]);
+          }
+          candidates.clear();
+          auto select = [&candidates, map, r2](vtkIdType first, vtkIdType n, const double* d2)
+          {
+            for (vtkIdType i = 0; i < n; ++i)
+            {
+              if (d2[i] <= r2)
+              {
+                candidates.emplace_back(d2[i], static_cast<vtkIdType>(map[first + i].PtId));
+              }
+            }
+          };
+          auto selectRun = [this, x, &select](vtkIdType cBeg, vtkIdType cEnd)
+          { this->VisitRun(x, cBeg, cEnd, select); };
+          this->ForEachBoxRun(boxLo, boxHi, selectRun);
+          std::partial_sort(
+            candidates.begin(), candidates.begin() + numClosest, candidates.end());
+
+          vtkIdType* qIds = ids + numClosest * qId;
+          for (vtkIdType i = 0; i < numClosest; ++i)
+          {
+            qIds[i] = candidates[i].second;
+          }
+          if (dist2)
+          {
+            double* qDist2 = dist2 + numClosest * qId;
+            for (vtkIdType i = 0; i < numClosest; ++i)
+            {
+              qDist2[i] = candidates[i].first;
+            }
+          }
+        }
+      });
+  }
+
+  void FindPointsWithinRadius(
+    double R, vtkIdTypeArray* offsets, vtkIdTypeArray* ids, vtkDoubleArray* dist2)
+  {
+    // The hits of each query are first gathered in per-thread buffers, then
+    // scattered into the output once the offsets are known.
+    vtkSMPThreadLocal<BatchHits> localHits;
+    std::vector<BatchHits*> hitsOf(this->NumQueries);
+    std::vector<vtkIdType> startOf(this->NumQueries);
+    offsets->SetNumberOfComponents(1);
+    offsets->SetNumberOfTuples(this->NumQueries + 1);
+    vtkIdType* offs = offsets->GetPointer(0);
+    const bool withDist2 = (dist2 != nullptr);
+    const double R2 = R * R;
+
+    vtkSMPTools::For(0, this->NumQueries,
+      [&, this](vtkIdType beg, vtkIdType end)
+      {
+        const LocatorTuple<TIds>* map = this->BList->Map;
+        BatchHits& hits = localHits.Local();
+        auto visit = [&hits, map, R2, withDist2](vtkIdType first, vtkIdType n, const double* d2)
+        {
+          for (vtkIdType i = 0; i < n; ++i)
+          {
+            if (d2[i] <= R2)
+            {
+              hits.Ids.push_back(map[first + i].PtId);
+              if (withDist2)
+              {
+                hits.Dist2.push_back(d2[i]);
+              }
+            }
+          }
+        };
+        for (; beg < end; ++beg)
+        {
+          vtkIdType qId = this->Order[beg];
+          const double* x = this->Queries + 3 * qId;
+          auto run = [this, x, &visit](vtkIdType cBeg, vtkIdType cEnd)
+          { this->VisitRun(x, cBeg, cEnd, visit); };
+          int lo[3], hi[3];
+          this->GetBox(x, R, lo, hi);
+          vtkIdType start = static_cast<vtkIdType>(hits.Ids.size());
+          this->ForEachBoxRun(lo, hi, run);
+          hitsOf[qId] = &hits;
+          startOf[qId] = start;
+          offs[qId + 1] = static_cast<vtkIdType>(hits.Ids.size()) - start;
+        }
+      });
+
+    offs[0] = 0;
+    for (vtkIdType qId = 0; qId < this->NumQueries; ++qId)
+    {
+      offs[qId + 1] += offs[qId];
+    }
+    ids->SetNumberOfComponents(1);
+    ids->SetNumberOfTuples(offs[this->NumQueries]);
+    vtkIdType* outIds = ids->GetPointer(0);
+    double* outDist2 = nullptr;
+    if (withDist2)
+    {
+      dist2->SetNumberOfComponents(1);
+      dist2->SetNumberOfTuples(offs[this->NumQueries]);
+      outDist2 = dist2->GetPointer(0);
+    }
+    vtkSMPTools::For(0, this->NumQueries,
+      [&](vtkIdType qId, vtkIdType end)
+      {
+        for (; qId < end; ++qId)
+        {
+          vtkIdType n = offs[qId + 1] - offs[qId];
+          const BatchHits* hits = hitsOf[qId];
+          std::copy_n(hits->Ids.begin() + startOf[qId], n, outIds + offs[qId]);
+          if (withDist2)
+          {
+            std::copy_n(hits->Dist2.begin() + startOf[qId], n, outDist2 + offs[qId]);
+          }
+        }
+      });
+  }
+};
+
 //------------------------------------------------------------------------------
 // Find the point within tol of the finite line, and closest to the starting
 // point of the line (i.e., min parametric coordinate t).
@@ -2237,6 +2692,148 @@ void vtkStaticPointLocator::FindPointsWithinRadius(double R, const double x[3],
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkStaticPointLocator::FindClosestPoints(
+  vtkDataArray* queries, vtkIdTypeArray* ids, vtkDoubleArray* dist2)
+{
+  if (!queries || !ids || queries->GetNumberOfComponents() != 3)
+  {
+    vtkErrorMacro("FindClosestPoints requires 3-component query points and an ids array.");
+    return;
+  }
+  vtkIdType numQueries = queries->GetNumberOfTuples();
+  ids->SetNumberOfComponents(1);
+  ids->SetNumberOfTuples(numQueries);
+  ids->FillValue(-1);
+  if (dist2)
+  {
+    dist2->SetNumberOfComponents(1);
+    dist2->SetNumberOfTuples(numQueries);
+    dist2->FillValue(VTK_DOUBLE_MAX);
+  }
+
+  this->BuildLocator(); // will subdivide if modified; otherwise returns
+  if (!this->Buckets || numQueries < 1)
+  {
+    return;
+  }
+
+  std::vector<double> buffer;
+  const double* q = GetQueryPoints(queries, buffer);
+  double* d2 = (dist2 ? dist2->GetPointer(0) : nullptr);
+  if (this->LargeIds)
+  {
+    BatchedQueries<vtkIdType> batch(
+      static_cast<BucketList<vtkIdType>*>(this->Buckets), q, numQueries);
+    batch.FindClosestPoints(ids->GetPointer(0), d2);
+  }
+  else
+  {
+    BatchedQueries<int> batch(static_cast<BucketList<int>*>(this->Buckets), q, numQueries);
+    batch.FindClosestPoints(ids->GetPointer(0), d2);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticPointLocator::FindClosestNPoints(int N, vtkDataArray* queries,
+  vtkIdTypeArray* offsets, vtkIdTypeArray* ids, vtkDoubleArray* dist2)
+{
+  if (!queries || !offsets || !ids || queries->GetNumberOfComponents() != 3)
+  {
+    vtkErrorMacro(
+      "FindClosestNPoints requires 3-component query points, an offsets and an ids array.");
+    return;
+  }
+  vtkIdType numQueries = queries->GetNumberOfTuples();
+
+  this->BuildLocator(); // will subdivide if modified; otherwise returns
+  vtkIdType numPts = (this->Buckets ? this->Buckets->NumPts : 0);
+  vtkIdType numClosest = std::max(0, N);
+  numClosest = std::min(numClosest, numPts);
+
+  // Every query has the same number of results.
+  offsets->SetNumberOfComponents(1);
+  offsets->SetNumberOfTuples(numQueries + 1);
+  vtkIdType* offs = offsets->GetPointer(0);
+  vtkSMPTools::For(0, numQueries + 1,
+    [offs, numClosest](vtkIdType qId, vtkIdType end)
+    {
+      for (; qId < end; ++qId)
+      {
+        offs[qId] = qId * numClosest;
+      }
+    });
+  ids->SetNumberOfComponents(1);
+  ids->SetNumberOfTuples(numQueries * numClosest);
+  if (dist2)
+  {
+    dist2->SetNumberOfComponents(1);
+    dist2->SetNumberOfTuples(numQueries * numClosest);
+  }
+  if (numClosest < 1 || numQueries < 1)
+  {
+    return;
+  }
+
+  std::vector<double> buffer;
+  const double* q = GetQueryPoints(queries, buffer);
+  double* d2 = (dist2 ? dist2->GetPointer(0) : nullptr);
+  if (this->LargeIds)
+  {
+    BatchedQueries<vtkIdType> batch(
+      static_cast<BucketList<vtkIdType>*>(this->Buckets), q, numQueries);
+    batch.FindClosestNPoints(numClosest, ids->GetPointer(0), d2);
+  }
+  else
+  {
+    BatchedQueries<int> batch(static_cast<BucketList<int>*>(this->Buckets), q, numQueries);
+    batch.FindClosestNPoints(numClosest, ids->GetPointer(0), d2);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticPointLocator::FindPointsWithinRadius(double R, vtkDataArray* queries,
+  vtkIdTypeArray* offsets, vtkIdTypeArray* ids, vtkDoubleArray* dist2)
+{
+  if (!queries || !offsets || !ids || queries->GetNumberOfComponents() != 3)
+  {
+    vtkErrorMacro(
+      "FindPointsWithinRadius requires 3-component query points, an offsets and an ids array.");
+    return;
+  }
+  vtkIdType numQueries = queries->GetNumberOfTuples();
+
+  this->BuildLocator(); // will subdivide if modified; otherwise returns
+  if (!this->Buckets || numQueries < 1)
+  {
+    offsets->SetNumberOfComponents(1);
+    offsets->SetNumberOfTuples(numQueries + 1);
+    offsets->FillValue(0);
+    ids->SetNumberOfComponents(1);
+    ids->SetNumberOfTuples(0);
+    if (dist2)
+    {
+      dist2->SetNumberOfComponents(1);
+      dist2->SetNumberOfTuples(0);
+    }
+    return;
+  }
+
+  std::vector<double> buffer;
+  const double* q = GetQueryPoints(queries, buffer);
+  if (this->LargeIds)
+  {
+    BatchedQueries<vtkIdType> batch(
+      static_cast<BucketList<vtkIdType>*>(this->Buckets), q, numQueries);
+    batch.FindPointsWithinRadius(R, offsets, ids, dist2);
+  }
+  else
+  {
+    BatchedQueries<int> batch(static_cast<BucketList<int>*>(this->Buckets), q, numQueries);
+    batch.FindPointsWithinRadius(R, offsets, ids, dist2);
+  }
+}
+
 //------------------------------------------------------------------------------
 // This method traverses the locator along the defined ray, finding the
 // closest point to a0 when projected onto the line (a0,a1) (i.e., min
@@ -52,6 +52,8 @@ VTK_ABI_NAMESPACE_BEGIN
 class vtkIdList;
 struct vtkBucketList;
 class vtkDataArray;
+class vtkDoubleArray;
+class vtkIdTypeArray;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkStaticPointLocator : public vtkAbstractPointLocator
 {
@@ -139,6 +141,34 @@ public:
    */
   void FindPointsWithinRadius(double R, const double x[3], vtkIdList* result) override;
 
+  ///@{
+  /**
+   * Batched versions of FindClosestPoint(), FindClosestNPoints() and
+   * FindPointsWithinRadius(). The query points are given as a 3-component
+   * array, and the results are returned in compressed sparse row form: the
+   * ids found for query i are ids[offsets[i]] to ids[offsets[i+1]-1], with
+   * their squared distances in the optional dist2 array. FindClosestPoints()
+   * returns exactly one id per query (or -1 if the locator is empty), so it
+   * takes no offsets. FindClosestNPoints() returns min(N, number of points)
+   * ids per query, sorted from closest to farthest; FindPointsWithinRadius()
+   * returns them unsorted.
+   *
+   * These methods are much faster than calling their single point
+   * counterparts in a loop when there are many queries: the queries are
+   * processed in parallel (via vtkSMPTools) along a Morton curve of the
+   * locator buckets, and the distances to the points of a row of buckets
+   * are evaluated with a vectorized loop. To do so, the locator keeps a
+   * bucket-ordered copy of the point coordinates (three doubles per point),
+   * built on the first batched query.
+   */
+  void FindClosestPoints(
+    vtkDataArray* queries, vtkIdTypeArray* ids, vtkDoubleArray* dist2 = nullptr);
+  void FindClosestNPoints(int N, vtkDataArray* queries, vtkIdTypeArray* offsets,
+    vtkIdTypeArray* ids, vtkDoubleArray* dist2 = nullptr);
+  void FindPointsWithinRadius(double R, vtkDataArray* queries, vtkIdTypeArray* offsets,
+    vtkIdTypeArray* ids, vtkDoubleArray* dist2 = nullptr);
+  ///@}
+
   /**
    * Intersect the points contained in the locator with the line defined by
    * (a0,a1). Return the point within the tolerance tol that is closest to a0
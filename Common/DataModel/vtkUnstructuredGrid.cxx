@@ -19,11 +19,14 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyhedron.h"
+#include "vtkPolyhedronTopologyCache.h"
 #include "vtkStaticCellLinks.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGridCellIterator.h"
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <set>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -243,8 +246,45 @@ void vtkUnstructuredGrid::SetCells(vtkUnsignedCharArray* cellTypes, vtkIdTypeArr
   this->SetCells(cellTypes, cells, faceLocations, faces);
 }
 
+//------------------------------------------------------------------------------
+// The polyhedron topology cache is built under the lock, and read without it
+// once built. A new cache is built when the grid is modified, since cells
+// loaded before may still reference the previous one.
+class vtkUnstructuredGrid::vtkPolyhedronTopologyState
+{
+public:
+  std::mutex Lock;
+  std::atomic<vtkPolyhedronTopologyCache*> Current{ nullptr };
+  vtkSmartPointer<vtkPolyhedronTopologyCache> Cache;
+
+  void Set(vtkPolyhedronTopologyCache* cache)
+  {
+    std::lock_guard<std::mutex> lock(this->Lock);
+    this->Cache = cache;
+    this->Current.store(cache, std::memory_order_release);
+  }
+};
+
+//------------------------------------------------------------------------------
+class vtkUnstructuredGrid::vtkConstantCellTypesState
+{
+public:
+  std::mutex Lock;
+  std::atomic<vtkUnsignedCharArray*> Current{ nullptr };
+  vtkSmartPointer<vtkUnsignedCharArray> Types;
+
+  void Set(vtkUnsignedCharArray* types)
+  {
+    std::lock_guard<std::mutex> lock(this->Lock);
+    this->Types = types;
+    this->Current.store(types, std::memory_order_release);
+  }
+};
+
 //------------------------------------------------------------------------------
 vtkUnstructuredGrid::vtkUnstructuredGrid()
+  : PolyhedronTopology(new vtkPolyhedronTopologyState)
+  , ConstantCellTypes(new vtkConstantCellTypesState)
 {
   this->Information->Set(vtkDataObject::DATA_EXTENT_TYPE(), VTK_PIECES_EXTENT);
   this->Information->Set(vtkDataObject::DATA_PIECE_NUMBER(), -1);
@@ -294,8 +334,10 @@ void vtkUnstructuredGrid::CopyStructure(vtkDataSet* ds)
   this->Types = ug->Types;
   this->DistinctCellTypes = nullptr;
   this->DistinctCellTypesUpdateMTime = 0;
+  this->SetConstantCellType(ug->ConstantCellType);
   this->Faces = ug->Faces;
   this->FaceLocations = ug->FaceLocations;
+  this->PolyhedronTopology->Set(ug->PolyhedronTopology->Cache);
 }
 
 //------------------------------------------------------------------------------
@@ -306,8 +348,10 @@ void vtkUnstructuredGrid::Cleanup()
   this->Types = nullptr;
   this->DistinctCellTypes = nullptr;
   this->DistinctCellTypesUpdateMTime = 0;
+  this->SetConstantCellType(-1);
   this->Faces = nullptr;
   this->FaceLocations = nullptr;
+  this->PolyhedronTopology->Set(nullptr);
 }
 
 //------------------------------------------------------------------------------
@@ -328,6 +372,10 @@ void vtkUnstructuredGrid::Initialize()
 //------------------------------------------------------------------------------
 int vtkUnstructuredGrid::GetCellType(vtkIdType cellId)
 {
+  if (this->ConstantCellType >= 0)
+  {
+    return this->ConstantCellType;
+  }
   vtkDebugMacro(<< "Returning cell type " << static_cast<int>(this->Types->GetValue(cellId)));
   return static_cast<int>(this->Types->GetValue(cellId));
 }
@@ -348,7 +396,9 @@ vtkCell* vtkUnstructuredGrid::GetCell(vtkIdType cellId)
 //------------------------------------------------------------------------------
 void vtkUnstructuredGrid::GetCell(vtkIdType cellId, vtkGenericCell* cell)
 {
-  const int cellType = static_cast<int>(this->Types->GetValue(cellId));
+  const int cellType = this->ConstantCellType >= 0
+    ? this->ConstantCellType
+    : static_cast<int>(this->Types->GetValue(cellId));
   cell->SetCellType(cellType);
 
   this->Connectivity->GetCellAtId(cellId, cell->PointIds);
@@ -358,6 +408,10 @@ void vtkUnstructuredGrid::GetCell(vtkIdType cellId, vtkGenericCell* cell)
   if (cell->RequiresExplicitFaceRepresentation())
   {
     this->GetPolyhedronFaces(cellId, cell->GetCellFaces());
+    if (vtkPolyhedron* polyhedron = vtkPolyhedron::SafeDownCast(cell->GetRepresentativeCell()))
+    {
+      polyhedron->SetTopologyCache(this->GetPolyhedronTopologyCache(), cellId);
+    }
   }
 
   // Some cells require special initialization to build data structures and such.
@@ -440,6 +494,7 @@ vtkIdType vtkUnstructuredGrid::GetNumberOfCells()
 // polyhedron cells.
 vtkIdType vtkUnstructuredGrid::InternalInsertNextCell(int type, vtkIdList* ptIds)
 {
+  this->ExpandConstantCellType();
   if (type == VTK_POLYHEDRON)
   {
     // For polyhedron cell, input ptIds is of format:
@@ -468,6 +523,7 @@ vtkIdType vtkUnstructuredGrid::InternalInsertNextCell(int type, vtkIdList* ptIds
 vtkIdType vtkUnstructuredGrid::InternalInsertNextCell(
   int type, vtkIdType npts, const vtkIdType ptIds[])
 {
+  this->ExpandConstantCellType();
   if (type != VTK_POLYHEDRON)
   {
     // insert connectivity
@@ -516,6 +572,7 @@ vtkIdType vtkUnstructuredGrid::InternalInsertNextCell(
 vtkIdType vtkUnstructuredGrid::InternalInsertNextCell(
   int type, vtkIdType npts, const vtkIdType pts[], vtkIdType nfaces, const vtkIdType faces[])
 {
+  this->ExpandConstantCellType();
   if (type != VTK_POLYHEDRON)
   {
     return this->InsertNextCell(type, npts, pts);
@@ -563,6 +620,7 @@ vtkIdType vtkUnstructuredGrid::InternalInsertNextCell(
 vtkIdType vtkUnstructuredGrid::InternalInsertNextCell(
   int type, vtkIdType npts, const vtkIdType pts[], vtkCellArray* faces)
 {
+  this->ExpandConstantCellType();
   if (type != VTK_POLYHEDRON)
   {
     return this->InsertNextCell(type, npts, pts);
@@ -606,6 +664,7 @@ int vtkUnstructuredGrid::InitializeFacesRepresentation(vtkIdType numPrevCells)
                   "InitializeFacesRepresentation returned without execution.");
     return 0;
   }
+  this->ExpandConstantCellType();
 
   this->Faces = vtkSmartPointer<vtkCellArray>::New();
   this->Faces->Allocate(this->Types->GetSize());
@@ -951,9 +1010,44 @@ vtkCellArray* vtkUnstructuredGrid::GetPolyhedronFaceLocations()
   return this->FaceLocations;
 }
 
+//------------------------------------------------------------------------------
+vtkPolyhedronTopologyCache* vtkUnstructuredGrid::GetPolyhedronTopologyCache()
+{
+  if (!this->Faces || !this->FaceLocations || !this->Points)
+  {
+    return nullptr;
+  }
+
+  vtkPolyhedronTopologyState& state = *this->PolyhedronTopology;
+  vtkPolyhedronTopologyCache* cache = state.Current.load(std::memory_order_acquire);
+  if (cache && cache->IsUpToDate(this))
+  {
+    return cache;
+  }
+
+  std::lock_guard<std::mutex> lock(state.Lock);
+  cache = state.Cache;
+  if (!cache || !cache->IsUpToDate(this))
+  {
+    state.Cache = vtkSmartPointer<vtkPolyhedronTopologyCache>::New();
+    state.Cache->Build(this);
+    cache = state.Cache;
+    state.Current.store(cache, std::memory_order_release);
+  }
+  return cache;
+}
+
 //------------------------------------------------------------------------------
 void vtkUnstructuredGrid::SetCells(int type, vtkCellArray* cells)
 {
+  if (type != VTK_POLYHEDRON)
+  {
+    // The type of the cells is not stored per cell.
+    this->SetPolyhedralCells(nullptr, cells, nullptr, nullptr);
+    this->SetConstantCellType(type);
+    return;
+  }
+
   vtkNew<vtkUnsignedCharArray> types;
   types->SetNumberOfComponents(1);
   types->SetNumberOfValues(cells->GetNumberOfCells());
@@ -1039,6 +1133,7 @@ void vtkUnstructuredGrid::SetCells(vtkUnsignedCharArray* cellTypes, vtkCellArray
   this->Types = cellTypes;
   this->DistinctCellTypes = nullptr;
   this->DistinctCellTypesUpdateMTime = 0;
+  this->SetConstantCellType(-1);
   this->Faces = nullptr;
   this->FaceLocations = nullptr;
   if (faceLocations != nullptr && faces != nullptr)
@@ -1090,6 +1185,7 @@ void vtkUnstructuredGrid::SetPolyhedralCells(vtkUnsignedCharArray* cellTypes, vt
   this->Types = cellTypes;
   this->DistinctCellTypes = nullptr;
   this->DistinctCellTypesUpdateMTime = 0;
+  this->SetConstantCellType(-1);
   this->Faces = faces;
   this->FaceLocations = faceLocations;
   this->LegacyFaces = nullptr;
@@ -1167,6 +1263,12 @@ void vtkUnstructuredGrid::GetCellTypes(vtkCellTypes* types)
 //------------------------------------------------------------------------------
 vtkUnsignedCharArray* vtkUnstructuredGrid::GetDistinctCellTypesArray()
 {
+  if (this->ConstantCellType >= 0)
+  {
+    // Set along with the constant cell type, so that this is thread safe.
+    return this->DistinctCellTypes->GetCellTypesArray();
+  }
+
   if (this->Types == nullptr)
   {
     if (this->DistinctCellTypes == nullptr)
@@ -1200,7 +1302,60 @@ vtkUnsignedCharArray* vtkUnstructuredGrid::GetDistinctCellTypesArray()
 //------------------------------------------------------------------------------
 vtkUnsignedCharArray* vtkUnstructuredGrid::GetCellTypesArray()
 {
-  return this->Types;
+  if (this->ConstantCellType < 0)
+  {
+    return this->Types;
+  }
+
+  // The array is created once, and never replaced while the cell type is
+  // constant, so that concurrent callers (e.g. from vtkSMPTools) share it.
+  vtkConstantCellTypesState& state = *this->ConstantCellTypes;
+  vtkUnsignedCharArray* types = state.Current.load(std::memory_order_acquire);
+  if (types)
+  {
+    return types;
+  }
+
+  std::lock_guard<std::mutex> lock(state.Lock);
+  if (!state.Types)
+  {
+    const vtkIdType numCells = this->Connectivity ? this->Connectivity->GetNumberOfCells() : 0;
+    vtkNew<vtkUnsignedCharArray> newTypes;
+    newTypes->SetNumberOfValues(numCells);
+    newTypes->FillValue(static_cast<unsigned char>(this->ConstantCellType));
+    state.Types = newTypes;
+    state.Current.store(newTypes, std::memory_order_release);
+  }
+  return state.Types;
+}
+
+//------------------------------------------------------------------------------
+void vtkUnstructuredGrid::ExpandConstantCellType()
+{
+  if (this->ConstantCellType < 0)
+  {
+    return;
+  }
+  this->Types = this->GetCellTypesArray();
+  this->SetConstantCellType(-1);
+  this->DistinctCellTypes = nullptr;
+  this->DistinctCellTypesUpdateMTime = 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkUnstructuredGrid::SetConstantCellType(int type)
+{
+  this->ConstantCellType = type;
+  this->ConstantCellTypes->Set(nullptr);
+  if (type >= 0)
+  {
+    this->DistinctCellTypes = vtkSmartPointer<vtkCellTypes>::New();
+    if (this->Connectivity && this->Connectivity->GetNumberOfCells() > 0)
+    {
+      this->DistinctCellTypes->InsertNextType(static_cast<unsigned char>(type));
+    }
+    this->DistinctCellTypesUpdateMTime = 0;
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -1363,7 +1518,16 @@ void vtkUnstructuredGrid::Reset()
   {
     this->Links->Reset();
   }
-  if (this->Types)
+  if (this->ConstantCellType >= 0)
+  {
+    // Back to an empty cell types array, as the cells inserted next may be
+    // of any type.
+    this->SetConstantCellType(-1);
+    this->Types = vtkSmartPointer<vtkUnsignedCharArray>::New();
+    this->DistinctCellTypes = nullptr;
+    this->DistinctCellTypesUpdateMTime = 0;
+  }
+  else if (this->Types)
   {
     this->Types->Reset();
   }
@@ -1392,6 +1556,8 @@ void vtkUnstructuredGrid::Squeeze()
   {
     this->Links->Squeeze();
   }
+  // With a constant cell type, there is no cell types array to squeeze: the
+  // one created by GetCellTypesArray() has the exact size.
   if (this->Types)
   {
     this->Types->Squeeze();
@@ -1506,6 +1672,11 @@ unsigned long vtkUnstructuredGrid::GetActualMemorySize()
     size += this->FaceLocations->GetActualMemorySize();
   }
 
+  if (vtkPolyhedronTopologyCache* cache = this->PolyhedronTopology->Current.load())
+  {
+    size += cache->GetActualMemorySize();
+  }
+
   return size;
 }
 
@@ -1527,8 +1698,10 @@ void vtkUnstructuredGrid::ShallowCopy(vtkDataObject* dataObject)
     this->Types = grid->Types;
     this->DistinctCellTypes = nullptr;
     this->DistinctCellTypesUpdateMTime = 0;
+    this->SetConstantCellType(grid->ConstantCellType);
     this->Faces = grid->Faces;
     this->FaceLocations = grid->FaceLocations;
+    this->PolyhedronTopology->Set(grid->PolyhedronTopology->Cache);
 
     if (grid->Links)
     {
@@ -1544,6 +1717,7 @@ void vtkUnstructuredGrid::ShallowCopy(vtkDataObject* dataObject)
   else if (vtkUnstructuredGridBase* ugb = vtkUnstructuredGridBase::SafeDownCast(dataObject))
   {
     bool isNewAlloc = false;
+    this->ExpandConstantCellType();
     if (!this->Connectivity || !this->Types)
     {
       this->AllocateEstimate(ugb->GetNumberOfCells(), ugb->GetMaxCellSize());
@@ -1597,6 +1771,7 @@ void vtkUnstructuredGrid::DeepCopy(vtkDataObject* dataObject)
     {
       this->Types = nullptr;
     }
+    this->SetConstantCellType(grid->ConstantCellType);
     if (grid->DistinctCellTypes)
     {
       this->DistinctCellTypes = vtkSmartPointer<vtkCellTypes>::New();
@@ -1667,6 +1842,7 @@ bool vtkUnstructuredGrid::AllocateExact(vtkIdType numCells, vtkIdType connectivi
   this->DistinctCellTypesUpdateMTime = 0;
   this->DistinctCellTypes = vtkSmartPointer<vtkCellTypes>::New();
   this->Types = vtkSmartPointer<vtkUnsignedCharArray>::New();
+  this->SetConstantCellType(-1);
   this->Connectivity = vtkSmartPointer<vtkCellArray>::New();
 
   bool result = this->Connectivity->AllocateExact(numCells, connectivitySize);
@@ -1910,6 +2086,10 @@ void vtkUnstructuredGrid::GetCellNeighbors(
 //------------------------------------------------------------------------------
 int vtkUnstructuredGrid::IsHomogeneous()
 {
+  if (this->ConstantCellType >= 0)
+  {
+    return this->GetNumberOfCells() > 0 ? 1 : 0;
+  }
   unsigned char type;
   if (this->Types && this->Types->GetMaxId() >= 0)
   {
@@ -1931,6 +2111,17 @@ int vtkUnstructuredGrid::IsHomogeneous()
 // Fill container with indices of cells which match given type.
 void vtkUnstructuredGrid::GetIdsOfCellsOfType(int type, vtkIdTypeArray* array)
 {
+  if (this->ConstantCellType >= 0)
+  {
+    if (type == this->ConstantCellType)
+    {
+      for (vtkIdType cellId = 0; cellId < this->GetNumberOfCells(); cellId++)
+      {
+        array->InsertNextValue(cellId);
+      }
+    }
+    return;
+  }
   for (int cellId = 0; cellId < this->GetNumberOfCells(); cellId++)
   {
     if (static_cast<int>(Types->GetValue(cellId)) == type)
@@ -1947,6 +2138,7 @@ void vtkUnstructuredGrid::RemoveGhostCells()
   {
     return;
   }
+  this->ExpandConstantCellType();
   vtkNew<vtkUnstructuredGrid> newGrid;
 
   vtkNew<vtkCellArray> newFaces;
@@ -25,10 +25,13 @@
 
 #include "vtkSmartPointer.h" // for smart pointer
 
+#include <memory> // for std::unique_ptr
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCellArray;
 class vtkIdList;
 class vtkIdTypeArray;
+class vtkPolyhedronTopologyCache;
 class vtkUnsignedCharArray;
 class vtkIdTypeArray;
 
@@ -200,9 +203,22 @@ public:
    * tuple in the array at an index that corresponds to the type of the cell
    * with the same index. To get an array of only the distinct cell types in
    * the dataset, use GetCellTypes().
+   *
+   * If the grid has a constant cell type (see GetConstantCellType()), the
+   * array is created and filled by the first call to this method. This is
+   * done once, under a lock, so that concurrent calls return the same array.
    */
   vtkUnsignedCharArray* GetCellTypesArray();
 
+  /**
+   * Return the type of all the cells if the grid was defined with
+   * SetCells(int type, vtkCellArray*), or -1 if the type of each cell is
+   * stored in the cell types array. The cell types array of a grid with a
+   * constant cell type is only created when needed: by
+   * GetCellTypesArray(), or when a cell is inserted.
+   */
+  int GetConstantCellType() const { return this->ConstantCellType; }
+
   /**
    * Squeeze all arrays in the grid to conserve memory.
    */
@@ -279,6 +295,12 @@ public:
    * the faces use by the polyhedral cells.
    * SetPolyhedralCells also requires a faceLocations vtkCellArray to fully describe a polyhedron
    * cell The faceLocations is a collection of face ids pointing to the faces vtkCellArray.
+   *
+   * SetCells(int type, ...) does not store a cell types array (see
+   * GetConstantCellType()), unless type is VTK_POLYHEDRON. Combined with the
+   * fixed cell size storage of vtkCellArray (see
+   * vtkCellArray::ConvertToFixedSizeStorage()), a grid of cells of a single
+   * type is then stored without any per-cell offset nor type.
    */
   void SetCells(int type, vtkCellArray* cells);
   void SetCells(int* types, vtkCellArray* cells);
@@ -433,6 +455,16 @@ public:
   vtkCellArray* GetPolyhedronFaceLocations();
   ///@}
 
+  /**
+   * Get the precomputed topology of the polyhedra of the grid (faces in
+   * canonical point ids, unique edges, face triangulations and planarity),
+   * building it when it is missing or out of date. GetCell() hands it to the
+   * vtkPolyhedron cells it returns, which then do not rebuild this topology
+   * for each cell. Return nullptr if the grid has no polyhedron. As for
+   * GetCell(), concurrent calls are safe as long as the grid is not modified.
+   */
+  vtkPolyhedronTopologyCache* GetPolyhedronTopologyCache();
+
   /**
    * Special function used by vtkUnstructuredGridReader.
    * By default vtkUnstructuredGrid does not contain face information, which is
@@ -562,6 +594,9 @@ protected:
   vtkSmartPointer<vtkAbstractCellLinks> Links;
   vtkSmartPointer<vtkUnsignedCharArray> Types;
 
+  // Type of all the cells when Types is not stored, -1 otherwise.
+  int ConstantCellType = -1;
+
   // Set of all cell types present in the grid. All entries are unique.
   vtkSmartPointer<vtkCellTypes> DistinctCellTypes;
 
@@ -569,6 +604,10 @@ protected:
   // updated so we can compare it to the modified time of the Types array.
   vtkMTimeType DistinctCellTypesUpdateMTime;
 
+  // Create the Types array of a grid with a constant cell type, before cells
+  // of other types can be inserted.
+  void ExpandConstantCellType();
+
   /**
    *  Special support for polyhedra/cells with explicit face representations.
    * The Faces class represents polygonal faces using a vtkCellArray structure.
@@ -652,6 +691,18 @@ private:
   void operator=(const vtkUnstructuredGrid&) = delete;
 
   void Cleanup();
+
+  class vtkPolyhedronTopologyState;
+  std::unique_ptr<vtkPolyhedronTopologyState> PolyhedronTopology;
+
+  // Set the constant cell type, or -1, with the distinct cell types that it
+  // implies, and drop the cell types array that was created for it.
+  void SetConstantCellType(int type);
+
+  // The cell types array of a grid with a constant cell type, created once
+  // on demand by GetCellTypesArray().
+  class vtkConstantCellTypesState;
+  std::unique_ptr<vtkConstantCellTypesState> ConstantCellTypes;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -41,6 +41,7 @@ void vtkUnstructuredGridCellIterator::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << indent << "Types: (none)" << endl;
   }
+  os << indent << "ConstantCellType: " << this->ConstantCellType << endl;
 
   if (this->PolyFaceConn)
   {
@@ -76,8 +77,11 @@ void vtkUnstructuredGridCellIterator::PrintSelf(ostream& os, vtkIndent indent)
 //------------------------------------------------------------------------------
 void vtkUnstructuredGridCellIterator::SetUnstructuredGrid(vtkUnstructuredGrid* ug)
 {
-  // If the unstructured grid has not been initialized yet, these may not exist:
-  vtkUnsignedCharArray* cellTypeArray = ug ? ug->GetCellTypesArray() : nullptr;
+  // If the unstructured grid has not been initialized yet, these may not exist.
+  // The cell types array of a grid with a constant cell type is not needed.
+  const int constantCellType = ug ? ug->GetConstantCellType() : -1;
+  vtkUnsignedCharArray* cellTypeArray =
+    ug && constantCellType < 0 ? ug->GetCellTypesArray() : nullptr;
   vtkCellArray* cellArray = ug ? ug->GetCells() : nullptr;
   vtkPoints* points = ug ? ug->GetPoints() : nullptr;
 
@@ -86,12 +90,13 @@ void vtkUnstructuredGridCellIterator::SetUnstructuredGrid(vtkUnstructuredGrid* u
     this->Points->SetDataType(points->GetDataType());
   }
 
-  if (ug && cellTypeArray && cellArray && points)
+  if (ug && (cellTypeArray || constantCellType >= 0) && cellArray && points)
   {
     this->Cells = vtk::TakeSmartPointer(cellArray->NewIterator());
     this->Cells->GoToFirstCell();
 
     this->Types = cellTypeArray;
+    this->ConstantCellType = constantCellType;
     this->PolyFaceConn = ug->GetPolyhedronFaces();
     this->PolyFaceLocs = ug->GetPolyhedronFaceLocations();
     this->Coords = points;
@@ -134,6 +139,11 @@ void vtkUnstructuredGridCellIterator::ResetToFirstCell()
 //------------------------------------------------------------------------------
 void vtkUnstructuredGridCellIterator::FetchCellType()
 {
+  if (this->ConstantCellType >= 0)
+  {
+    this->CellType = this->ConstantCellType;
+    return;
+  }
   const vtkIdType cellId = this->Cells->GetCurrentCellId();
   this->CellType = this->Types->GetValue(cellId);
 }
@@ -65,6 +65,7 @@ protected:
 
   vtkSmartPointer<vtkCellArrayIterator> Cells;
   vtkSmartPointer<vtkUnsignedCharArray> Types;
+  int ConstantCellType = -1; // Used instead of Types when >= 0
   vtkSmartPointer<vtkCellArray> PolyFaceConn;
   vtkSmartPointer<vtkCellArray> PolyFaceLocs;
   vtkSmartPointer<vtkPoints> Coords;
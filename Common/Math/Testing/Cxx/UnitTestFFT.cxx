@@ -74,6 +74,7 @@ static int Test_complex_module();
 static int Test_fftfreq();
 static int Test_rfftfreq();
 static int Test_fft_direct_inverse();
+static int Test_fft_batch();
 static int Test_kernel_generation();
 static int Test_csd();
 static int Test_transpose();
@@ -91,6 +92,7 @@ int UnitTestFFT(int, char*[])
   status += Test_fftfreq();
   status += Test_rfftfreq();
   status += Test_fft_direct_inverse();
+  status += Test_fft_batch();
   status += Test_kernel_generation();
   status += Test_csd();
   status += Test_transpose();
@@ -511,6 +513,94 @@ int Test_fft_direct_inverse()
   return status;
 }
 
+int Test_fft_batch()
+{
+  int status = 0;
+  std::cout << "Test_fft_batch..";
+
+  auto comparator = [](vtkFFT::ComplexNumber l, vtkFFT::ComplexNumber r) {
+    return FuzzyCompare(l, r, 1e-10);
+  };
+
+  // Even and odd sizes, so that both the real and the complex paths are used
+  static constexpr std::size_t count = 37;
+  for (std::size_t size : { 1, 24, 25 })
+  {
+    const std::size_t outSize = size / 2 + 1;
+    std::vector<vtkFFT::ScalarNumber> signals(size * count);
+    std::vector<vtkFFT::ComplexNumber> complexSignals(size * count);
+    for (std::size_t i = 0; i < signals.size(); ++i)
+    {
+      signals[i] = std::sin(0.3 * i) + (i % 7);
+      complexSignals[i] = vtkFFT::ComplexNumber{ signals[i], std::cos(0.7 * i) };
+    }
+
+    std::vector<vtkFFT::ComplexNumber> rfft(outSize * count);
+    std::vector<vtkFFT::ComplexNumber> fft(size * count);
+    vtkFFT::BatchRFft(signals.data(), size, count, rfft.data());
+    vtkFFT::BatchFft(complexSignals.data(), size, count, fft.data());
+
+    // The inverse transform is computed in place
+    std::vector<vtkFFT::ComplexNumber> ifft(fft);
+    vtkFFT::BatchIFft(ifft.data(), size, count, ifft.data());
+    if (!std::equal(ifft.begin(), ifft.end(), complexSignals.begin(), comparator))
+    {
+      std::cerr << "..Error with BatchIFft of size " << size << "..";
+      status++;
+    }
+
+    if (size == 1)
+    {
+      continue;
+    }
+    for (std::size_t j = 0; j < count; ++j)
+    {
+      std::vector<vtkFFT::ScalarNumber> signal(
+        signals.begin() + j * size, signals.begin() + (j + 1) * size);
+      std::vector<vtkFFT::ComplexNumber> complexSignal(
+        complexSignals.begin() + j * size, complexSignals.begin() + (j + 1) * size);
+
+      auto expectedRFft = vtkFFT::RFft(signal);
+      auto expectedFft = vtkFFT::Fft(complexSignal);
+      if (!std::equal(expectedRFft.begin(), expectedRFft.end(), rfft.begin() + j * outSize,
+            comparator) ||
+        !std::equal(expectedFft.begin(), expectedFft.end(), fft.begin() + j * size, comparator))
+      {
+        std::cerr << "..Error with batch of size " << size << "..";
+        status++;
+      }
+
+      // The real transform of a real signal matches its complex transform
+      std::vector<vtkFFT::ComplexNumber> realAsComplex(size);
+      std::transform(signal.begin(), signal.end(), realAsComplex.begin(),
+        [](vtkFFT::ScalarNumber x) { return vtkFFT::ComplexNumber{ x, 0.0 }; });
+      auto expectedFull = vtkFFT::Fft(realAsComplex);
+      auto full = vtkFFT::Fft(signal);
+      if (full.size() != size ||
+        !std::equal(expectedFull.begin(), expectedFull.end(), full.begin(), comparator))
+      {
+        std::cerr << "..Error with Fft of a real signal of size " << size << "..";
+        status++;
+      }
+    }
+  }
+
+  // The transforms are the same once the plans are computed again
+  std::vector<vtkFFT::ScalarNumber> signal(16);
+  std::iota(signal.begin(), signal.end(), 0.0);
+  auto cached = vtkFFT::RFft(signal);
+  vtkFFT::ClearPlanCache();
+  auto computed = vtkFFT::RFft(signal);
+  if (!std::equal(cached.begin(), cached.end(), computed.begin(), comparator))
+  {
+    std::cerr << "..Error after ClearPlanCache..";
+    status++;
+  }
+
+  std::cout << (status ? "..FAILED" : ".PASSED") << std::endl;
+  return status;
+}
+
 // Reference values have been generated using the Scipy project
 int Test_kernel_generation()
 {
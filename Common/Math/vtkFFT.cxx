@@ -6,10 +6,256 @@
 #include "vtkObjectFactory.h"
 #include "vtkSMPTools.h"
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <utility>
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// The number of sizes for which the setups are kept, for each kind of transform
+const std::size_t vtkFFTMaximumNumberOfCachedSizes = 64;
+
+//------------------------------------------------------------------------------
+// The setups of the transforms that were computed, that is the factors of
+// their size and their twiddle factors, keyed by size and direction. The setup
+// of a complex transform is only read by kiss_fft, so it is shared by all the
+// threads. The setup of a real transform holds a work buffer, so each thread
+// takes one out of the cache and puts it back when it is done.
+class vtkFFTPlanCache
+{
+public:
+  using ComplexPlan = std::shared_ptr<std::remove_pointer<kiss_fft_cfg>::type>;
+
+  struct RealPlanDeleter
+  {
+    void operator()(kiss_fftr_cfg cfg) const { kiss_fftr_free(cfg); }
+  };
+  using RealPlan = std::unique_ptr<std::remove_pointer<kiss_fftr_cfg>::type, RealPlanDeleter>;
+
+  static vtkFFTPlanCache& GetInstance()
+  {
+    static vtkFFTPlanCache instance;
+    return instance;
+  }
+
+  ComplexPlan GetComplexPlan(std::size_t size, bool inverse)
+  {
+    const Key key(size, inverse);
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    auto it = this->ComplexPlans.find(key);
+    if (it != this->ComplexPlans.end())
+    {
+      return it->second;
+    }
+    ComplexPlan plan(kiss_fft_alloc(static_cast<int>(size), inverse, nullptr, nullptr),
+      [](kiss_fft_cfg cfg) { kiss_fft_free(cfg); });
+    if (plan)
+    {
+      if (this->ComplexPlans.size() >= vtkFFTMaximumNumberOfCachedSizes)
+      {
+        // the plans that are in use are kept alive by their users
+        this->ComplexPlans.clear();
+      }
+      this->ComplexPlans[key] = plan;
+    }
+    return plan;
+  }
+
+  RealPlan TakeRealPlan(std::size_t size, bool inverse)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      auto it = this->RealPlans.find(Key(size, inverse));
+      if (it != this->RealPlans.end() && !it->second.empty())
+      {
+        RealPlan plan = std::move(it->second.back());
+        it->second.pop_back();
+        return plan;
+      }
+    }
+    return RealPlan(kiss_fftr_alloc(static_cast<int>(size), inverse, nullptr, nullptr));
+  }
+
+  void PutRealPlan(std::size_t size, bool inverse, RealPlan plan)
+  {
+    const Key key(size, inverse);
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    if (this->RealPlans.size() >= vtkFFTMaximumNumberOfCachedSizes &&
+      this->RealPlans.find(key) == this->RealPlans.end())
+    {
+      this->RealPlans.clear();
+    }
+    // keep one plan per thread at most
+    auto& plans = this->RealPlans[key];
+    if (plans.size() < static_cast<std::size_t>(vtkSMPTools::GetEstimatedNumberOfThreads()))
+    {
+      plans.push_back(std::move(plan));
+    }
+  }
+
+  void Clear()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->ComplexPlans.clear();
+    this->RealPlans.clear();
+  }
+
+private:
+  using Key = std::pair<std::size_t, bool>;
+
+  std::mutex Mutex;
+  std::map<Key, ComplexPlan> ComplexPlans;
+  std::map<Key, std::vector<RealPlan>> RealPlans;
+};
+
+//------------------------------------------------------------------------------
+// A real plan taken from the cache, that is put back when it goes out of scope.
+class vtkFFTScopedRealPlan
+{
+public:
+  vtkFFTScopedRealPlan(std::size_t size, bool inverse)
+    : Size(size)
+    , Inverse(inverse)
+    , Plan(vtkFFTPlanCache::GetInstance().TakeRealPlan(size, inverse))
+  {
+  }
+
+  ~vtkFFTScopedRealPlan()
+  {
+    if (this->Plan)
+    {
+      vtkFFTPlanCache::GetInstance().PutRealPlan(this->Size, this->Inverse, std::move(this->Plan));
+    }
+  }
+
+  kiss_fftr_cfg Get() const { return this->Plan.get(); }
+
+private:
+  vtkFFTScopedRealPlan(const vtkFFTScopedRealPlan&) = delete;
+  void operator=(const vtkFFTScopedRealPlan&) = delete;
+
+  std::size_t Size;
+  bool Inverse;
+  vtkFFTPlanCache::RealPlan Plan;
+};
+
+//------------------------------------------------------------------------------
+// Call the functor on ranges of signals, in parallel when there are several.
+template <typename Functor>
+void vtkFFTForEachSignal(std::size_t count, Functor& functor)
+{
+  if (count == 1)
+  {
+    functor(0, 1);
+  }
+  else if (count > 1)
+  {
+    vtkSMPTools::For(0, static_cast<vtkIdType>(count), functor);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Transform count signals of size complex points. The inverse transform is
+// scaled by 1/size.
+bool vtkFFTComplexTransform(const vtkFFT::ComplexNumber* input, std::size_t size,
+  std::size_t count, vtkFFT::ComplexNumber* result, bool inverse)
+{
+  vtkFFTPlanCache::ComplexPlan plan = vtkFFTPlanCache::GetInstance().GetComplexPlan(size, inverse);
+  if (!plan)
+  {
+    return false;
+  }
+
+  const vtkIdType n = static_cast<vtkIdType>(size);
+  auto transform = [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType j = begin; j < end; ++j)
+    {
+      vtkFFT::ComplexNumber* out = result + j * n;
+      kiss_fft(plan.get(), input + j * n, out);
+      if (inverse)
+      {
+        std::for_each(out, out + n, [n](vtkFFT::ComplexNumber& x) {
+          x = vtkFFT::ComplexNumber{ x.r / n, x.i / n };
+        });
+      }
+    }
+  };
+  vtkFFTForEachSignal(count, transform);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Transform count signals of size real points, giving (size/2) + 1 complex
+// points per signal.
+bool vtkFFTRealTransform(const vtkFFT::ScalarNumber* input, std::size_t size, std::size_t count,
+  vtkFFT::ComplexNumber* result)
+{
+  const vtkIdType n = static_cast<vtkIdType>(size);
+  const vtkIdType outSize = n / 2 + 1;
+
+  // Real fft optimization needs an input with even size.
+  // Falling back to the complex transform if input size is odd.
+  if ((size % 2) != 0)
+  {
+    vtkFFTPlanCache::ComplexPlan plan =
+      vtkFFTPlanCache::GetInstance().GetComplexPlan(size, false);
+    if (!plan)
+    {
+      return false;
+    }
+    auto transform = [&](vtkIdType begin, vtkIdType end) {
+      std::vector<vtkFFT::ComplexNumber> signal(size);
+      std::vector<vtkFFT::ComplexNumber> spectrum(size);
+      for (vtkIdType j = begin; j < end; ++j)
+      {
+        const vtkFFT::ScalarNumber* in = input + j * n;
+        std::transform(in, in + n, signal.begin(), [](vtkFFT::ScalarNumber x) {
+          return vtkFFT::ComplexNumber{ x, 0 };
+        });
+        kiss_fft(plan.get(), signal.data(), spectrum.data());
+        std::copy(spectrum.begin(), spectrum.begin() + outSize, result + j * outSize);
+      }
+    };
+    vtkFFTForEachSignal(count, transform);
+    return true;
+  }
+
+  std::atomic<bool> valid(true);
+  auto transform = [&](vtkIdType begin, vtkIdType end) {
+    vtkFFTScopedRealPlan plan(size, false);
+    if (!plan.Get())
+    {
+      valid = false;
+      return;
+    }
+    for (vtkIdType j = begin; j < end; ++j)
+    {
+      kiss_fftr(plan.Get(), input + j * n, result + j * outSize);
+    }
+  };
+  vtkFFTForEachSignal(count, transform);
+  return valid;
+}
+
+//------------------------------------------------------------------------------
+// Fill the negative frequencies of the spectrum of a real signal, that are the
+// conjugates of the positive frequencies.
+void vtkFFTFillNegativeFrequencies(vtkFFT::ComplexNumber* spectrum, std::size_t size)
+{
+  for (std::size_t k = 1; k < (size + 1) / 2; ++k)
+  {
+    spectrum[size - k] = vtkFFT::Conjugate(spectrum[k]);
+  }
+}
+}
+
+//------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkFFT);
 
 //------------------------------------------------------------------------------
@@ -20,38 +266,45 @@ std::vector<vtkFFT::ComplexNumber> vtkFFT::Fft(const std::vector<ComplexNumber>&
     return {};
   }
 
-  kiss_fft_cfg cfg =
-    kiss_fft_alloc(static_cast<int>(in.size()), 0 /*is_inverse_fft*/, nullptr, nullptr);
-  if (cfg != nullptr)
+  std::vector<vtkFFT::ComplexNumber> result(in.size());
+  if (!vtkFFTComplexTransform(in.data(), in.size(), 1, result.data(), false))
   {
-    std::vector<vtkFFT::ComplexNumber> result(in.size());
-
-    kiss_fft(cfg, in.data(), result.data());
-    kiss_fft_free(cfg);
-
-    return result;
+    return {};
   }
-  return {};
+  return result;
 }
 
 //------------------------------------------------------------------------------
 std::vector<vtkFFT::ComplexNumber> vtkFFT::Fft(const std::vector<ScalarNumber>& in)
 {
-  std::vector<ComplexNumber> cplx(in.size());
-  std::transform(in.begin(), in.end(), cplx.begin(), [](ScalarNumber x) {
-    return ComplexNumber{ x, 0 };
-  });
-  return vtkFFT::Fft(cplx);
+  if (in.size() <= 1)
+  {
+    return {};
+  }
+
+  // The spectrum of a real signal is computed by the real transform, that
+  // gives the positive frequencies for half the work.
+  std::vector<vtkFFT::ComplexNumber> result(in.size());
+  if (!vtkFFTRealTransform(in.data(), in.size(), 1, result.data()))
+  {
+    return {};
+  }
+  vtkFFTFillNegativeFrequencies(result.data(), result.size());
+  return result;
 }
 
 //------------------------------------------------------------------------------
 void vtkFFT::Fft(ScalarNumber* input, std::size_t size, ComplexNumber* result)
 {
-  std::vector<ComplexNumber> cplx(size);
-  std::transform(input, input + size, cplx.begin(), [](ScalarNumber x) {
-    return ComplexNumber{ x, 0 };
-  });
-  vtkFFT::Fft(cplx.data(), cplx.size(), result);
+  if (size <= 1)
+  {
+    return;
+  }
+
+  if (vtkFFTRealTransform(input, size, 1, result))
+  {
+    vtkFFTFillNegativeFrequencies(result, size);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -62,12 +315,7 @@ void vtkFFT::Fft(ComplexNumber* input, std::size_t size, ComplexNumber* result)
     return;
   }
 
-  kiss_fft_cfg cfg = kiss_fft_alloc(static_cast<int>(size), 0 /*is_inverse_fft*/, nullptr, nullptr);
-  if (cfg != nullptr)
-  {
-    kiss_fft(cfg, input, result);
-    kiss_fft_free(cfg);
-  }
+  vtkFFTComplexTransform(input, size, 1, result, false);
 }
 
 //------------------------------------------------------------------------------
@@ -84,31 +332,21 @@ vtkSmartPointer<vtkFFT::vtkScalarNumberArray> vtkFFT::Fft(vtkScalarNumberArray*
     return vtkSmartPointer<vtkScalarNumberArray>::New();
   }
 
-  ComplexNumber* rawInput = static_cast<ComplexNumber*>(input->GetVoidPointer(0));
   const std::size_t size = static_cast<std::size_t>(input->GetNumberOfTuples());
+  ComplexNumber* rawResult = new ComplexNumber[size];
   if (input->GetNumberOfComponents() == 1)
   {
-    rawInput = new ComplexNumber[size];
-    auto inputRange = vtk::DataArrayValueRange<1>(input);
-    using ValueT = decltype(inputRange)::ConstReferenceType;
-    vtkSMPTools::Transform(inputRange.begin(), inputRange.end(), rawInput, [](ValueT val) {
-      return vtkFFT::ComplexNumber{ val, 0.0 };
-    });
+    vtkFFT::Fft(static_cast<ScalarNumber*>(input->GetVoidPointer(0)), size, rawResult);
+  }
+  else
+  {
+    vtkFFT::Fft(static_cast<ComplexNumber*>(input->GetVoidPointer(0)), size, rawResult);
   }
 
   auto result = vtkSmartPointer<vtkScalarNumberArray>::New();
-
-  ComplexNumber* rawResult = new ComplexNumber[size];
-  vtkFFT::Fft(rawInput, size, rawResult);
-
   result->SetNumberOfComponents(2);
   result->SetArray(&rawResult[0].r, size * 2, 0, vtkScalarNumberArray::VTK_DATA_ARRAY_DELETE);
 
-  if (input->GetNumberOfComponents() == 1)
-  {
-    delete[] rawInput;
-  }
-
   return result;
 }
 
@@ -120,28 +358,12 @@ std::vector<vtkFFT::ComplexNumber> vtkFFT::RFft(const std::vector<ScalarNumber>&
     return {};
   }
 
-  const std::size_t outSize = (in.size() / 2) + 1;
-
-  // Real fft optimization needs an input with even size. Falling back to vtkFFT::Fft() if odd sized
-  // input
-  if ((in.size() % 2) == 1)
-  {
-    const auto& res = vtkFFT::Fft(in);
-    return std::vector<ComplexNumber>(res.begin(), res.begin() + outSize);
-  }
-
-  kiss_fftr_cfg cfg =
-    kiss_fftr_alloc(static_cast<int>(in.size()), 0 /*is_inverse_fft*/, nullptr, nullptr);
-  if (cfg != nullptr)
+  std::vector<vtkFFT::ComplexNumber> result((in.size() / 2) + 1);
+  if (!vtkFFTRealTransform(in.data(), in.size(), 1, result.data()))
   {
-    std::vector<vtkFFT::ComplexNumber> result(outSize);
-
-    kiss_fftr(cfg, in.data(), result.data());
-    kiss_fftr_free(cfg);
-
-    return result;
+    return {};
   }
-  return {};
+  return result;
 }
 
 //------------------------------------------------------------------------------
@@ -152,24 +374,7 @@ void vtkFFT::RFft(ScalarNumber* input, std::size_t size, ComplexNumber* result)
     return;
   }
 
-  // Real fft optimization needs an input with even size.
-  // Falling back to vtkFFT::Fft() if input size is odd.
-  if ((size % 2) != 0)
-  {
-    std::vector<ComplexNumber> twoSided(size);
-    vtkFFT::Fft(input, size, twoSided.data());
-    std::copy(twoSided.data(), twoSided.data() + 1 + size / 2, result);
-  }
-  else
-  {
-    kiss_fftr_cfg cfg =
-      kiss_fftr_alloc(static_cast<int>(size), 0 /*is_inverse_fft*/, nullptr, nullptr);
-    if (cfg != nullptr)
-    {
-      kiss_fftr(cfg, input, result);
-      kiss_fft_free(cfg);
-    }
-  }
+  vtkFFTRealTransform(input, size, 1, result);
 }
 
 //------------------------------------------------------------------------------
@@ -208,22 +413,12 @@ std::vector<vtkFFT::ComplexNumber> vtkFFT::IFft(const std::vector<vtkFFT::Comple
     return {};
   }
 
-  std::size_t outSize = in.size();
-  kiss_fft_cfg cfg =
-    kiss_fft_alloc(static_cast<int>(outSize), 1 /*is_inverse_fft*/, nullptr, nullptr);
-  if (cfg != nullptr)
+  std::vector<vtkFFT::ComplexNumber> result(in.size());
+  if (!vtkFFTComplexTransform(in.data(), in.size(), 1, result.data(), true))
   {
-    std::vector<vtkFFT::ComplexNumber> result(outSize);
-
-    kiss_fft(cfg, in.data(), result.data());
-    std::for_each(result.begin(), result.end(), [outSize](vtkFFT::ComplexNumber& x) {
-      x = vtkFFT::ComplexNumber{ x.r / outSize, x.i / outSize };
-    });
-    kiss_fft_free(cfg);
-
-    return result;
+    return {};
   }
-  return {};
+  return result;
 }
 
 //------------------------------------------------------------------------------
@@ -235,22 +430,70 @@ std::vector<vtkFFT::ScalarNumber> vtkFFT::IRFft(const std::vector<vtkFFT::Comple
   }
 
   std::size_t outSize = (in.size() - 1) * 2;
-  kiss_fftr_cfg cfg =
-    kiss_fftr_alloc(static_cast<int>(outSize), 1 /*is_inverse_fft*/, nullptr, nullptr);
-  if (cfg != nullptr)
+  vtkFFTScopedRealPlan plan(outSize, true);
+  if (plan.Get() != nullptr)
   {
     std::vector<vtkFFT::ScalarNumber> result(outSize);
 
-    kiss_fftri(cfg, in.data(), result.data());
+    kiss_fftri(plan.Get(), in.data(), result.data());
     std::for_each(result.begin(), result.end(),
       [outSize](vtkFFT::ScalarNumber& num) { num /= static_cast<vtkFFT::ScalarNumber>(outSize); });
-    kiss_fftr_free(cfg);
 
     return result;
   }
   return {};
 }
 
+//------------------------------------------------------------------------------
+void vtkFFT::BatchFft(
+  const ComplexNumber* input, std::size_t size, std::size_t count, ComplexNumber* result)
+{
+  if (size == 1 && input != result)
+  {
+    std::copy(input, input + count, result);
+  }
+  else if (size > 1)
+  {
+    vtkFFTComplexTransform(input, size, count, result, false);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkFFT::BatchIFft(
+  const ComplexNumber* input, std::size_t size, std::size_t count, ComplexNumber* result)
+{
+  if (size == 1 && input != result)
+  {
+    std::copy(input, input + count, result);
+  }
+  else if (size > 1)
+  {
+    vtkFFTComplexTransform(input, size, count, result, true);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkFFT::BatchRFft(
+  const ScalarNumber* input, std::size_t size, std::size_t count, ComplexNumber* result)
+{
+  if (size == 1)
+  {
+    std::transform(input, input + count, result, [](ScalarNumber x) {
+      return ComplexNumber{ x, 0 };
+    });
+  }
+  else if (size > 1)
+  {
+    vtkFFTRealTransform(input, size, count, result);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkFFT::ClearPlanCache()
+{
+  vtkFFTPlanCache::GetInstance().Clear();
+}
+
 //------------------------------------------------------------------------------
 std::vector<vtkFFT::ScalarNumber> vtkFFT::FftFreq(int windowLength, double sampleSpacing)
 {
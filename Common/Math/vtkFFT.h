@@ -15,6 +15,13 @@
  *
  * Some functions provides pointer-based version of themself in order to
  * prevent copying memory when possible.
+ *
+ * The setup of a transform, that is the factorization of its size and its
+ * twiddle factors, is computed once for each size and kind of transform and
+ * kept for the next calls, see @c ClearPlanCache. The spectrum of a real
+ * signal is computed with the real transform, that takes half the work of the
+ * complex one. The batched functions transform many signals of the same size
+ * in parallel.
  */
 
 #ifndef vtkFFT_h
@@ -164,6 +171,34 @@ public:
    */
   static std::vector<ScalarNumber> IRFft(const std::vector<ComplexNumber>& in);
 
+  ///@{
+  /**
+   * Compute the one-dimensional DFT of count signals of the same size, in
+   * parallel across the signals. The signals are stored one after the other,
+   * and so are their results.
+   *
+   * BatchFft and BatchIFft: each signal has size complex points and so does its
+   * result, that may overwrite it. BatchIFft scales its results like @c IFft.
+   *
+   * BatchRFft: each signal has size scalar points, and its result has
+   * (size/2) + 1 complex points.
+   */
+#ifndef __VTK_WRAP__
+  static void BatchFft(
+    const ComplexNumber* input, std::size_t size, std::size_t count, ComplexNumber* result);
+  static void BatchIFft(
+    const ComplexNumber* input, std::size_t size, std::size_t count, ComplexNumber* result);
+  static void BatchRFft(
+    const ScalarNumber* input, std::size_t size, std::size_t count, ComplexNumber* result);
+#endif
+  ///@}
+
+  /**
+   * Release the setups of the transforms that are kept for the next calls.
+   * They are computed again when needed.
+   */
+  static void ClearPlanCache();
+
   /**
    * Return the absolute value (also known as norm, modulus, or magnitude) of complex number
    */
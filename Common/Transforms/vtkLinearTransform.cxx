@@ -2,11 +2,14 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkLinearTransform.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkMath.h"
 #include "vtkMatrix4x4.h"
 #include "vtkPoints.h"
 #include "vtkSMPTools.h"
+#include "vtkSOADataArrayTemplate.h"
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -94,6 +97,85 @@ inline void vtkLinearTransformPoints(T1 matrix[4][4], T2* in, T3* out, vtkIdType
   });
 }
 
+//------------------------------------------------------------------------------
+// Transform points stored in one contiguous array per coordinate.
+template <class T1, class T2, class T3>
+inline void vtkLinearTransformPointsSOA(
+  T1 matrix[4][4], T2* const in[3], T3* const out[3], vtkIdType n)
+{
+  vtkSMPTools::For(0, n, vtkSMPTools::THRESHOLD, [&](vtkIdType ptId, vtkIdType endPtId) {
+    const T2* inX = in[0];
+    const T2* inY = in[1];
+    const T2* inZ = in[2];
+    T3* outX = out[0];
+    T3* outY = out[1];
+    T3* outZ = out[2];
+    for (; ptId < endPtId; ++ptId)
+    {
+      const T2 x = inX[ptId];
+      const T2 y = inY[ptId];
+      const T2 z = inZ[ptId];
+      outX[ptId] =
+        static_cast<T3>(matrix[0][0] * x + matrix[0][1] * y + matrix[0][2] * z + matrix[0][3]);
+      outY[ptId] =
+        static_cast<T3>(matrix[1][0] * x + matrix[1][1] * y + matrix[1][2] * z + matrix[1][3]);
+      outZ[ptId] =
+        static_cast<T3>(matrix[2][0] * x + matrix[2][1] * y + matrix[2][2] * z + matrix[2][3]);
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// Transform points when either array uses the struct-of-arrays layout, for
+// which GetVoidPointer() would make an array-of-structs copy of the points.
+struct TransformPointsWorker
+{
+  double (*Matrix)[4];
+  vtkIdType OutStart;
+
+  template <typename InArrayT, typename OutArrayT>
+  void Transform(InArrayT* inArray, OutArrayT* outArray)
+  {
+    const auto inTuples = vtk::DataArrayTupleRange<3>(inArray);
+    auto outTuples = vtk::DataArrayTupleRange<3>(outArray, this->OutStart);
+    double(*matrix)[4] = this->Matrix;
+    vtkSMPTools::For(
+      0, inTuples.size(), vtkSMPTools::THRESHOLD, [&](vtkIdType ptId, vtkIdType endPtId) {
+        double point[3];
+        for (; ptId < endPtId; ++ptId)
+        {
+          inTuples.GetTuple(ptId, point);
+          vtkLinearTransformPoint(matrix, point, point);
+          outTuples.SetTuple(ptId, point);
+        }
+      });
+  }
+
+  template <typename InArrayT, typename OutArrayT>
+  void operator()(InArrayT* inArray, OutArrayT* outArray)
+  {
+    this->Transform(inArray, outArray);
+  }
+
+  template <typename T2, typename T3>
+  void operator()(vtkSOADataArrayTemplate<T2>* inArray, vtkSOADataArrayTemplate<T3>* outArray)
+  {
+    if (!inArray->HasComponentArrays() || !outArray->HasComponentArrays())
+    {
+      this->Transform(inArray, outArray);
+      return;
+    }
+    T2* in[3];
+    T3* out[3];
+    for (int comp = 0; comp < 3; ++comp)
+    {
+      in[comp] = inArray->GetComponentArrayPointer(comp);
+      out[comp] = outArray->GetComponentArrayPointer(comp) + this->OutStart;
+    }
+    vtkLinearTransformPointsSOA(this->Matrix, in, out, inArray->GetNumberOfTuples());
+  }
+};
+
 //------------------------------------------------------------------------------
 template <class T1, class T2, class T3>
 inline void vtkLinearTransformVectors(T1 matrix[4][4], T2* in, T3* out, vtkIdType n)
@@ -225,6 +307,19 @@ void vtkLinearTransform::TransformPoints(vtkPoints* inPts, vtkPoints* outPts)
   // operate directly on the memory to avoid GetPoint()/SetPoint() calls.
   vtkDataArray* inArray = inPts->GetData();
   vtkDataArray* outArray = outPts->GetData();
+  if (inPts->GetDataLayout() == vtkPoints::SOA_LAYOUT ||
+    outPts->GetDataLayout() == vtkPoints::SOA_LAYOUT)
+  {
+    outArray->SetNumberOfTuples(m + n);
+    TransformPointsWorker worker{ matrix, m };
+    using Dispatcher = vtkArrayDispatch::Dispatch2ByArray<vtkArrayDispatch::PointArrays,
+      vtkArrayDispatch::PointArrays>;
+    if (!Dispatcher::Execute(inArray, outArray, worker))
+    {
+      worker(inArray, outArray);
+    }
+    return;
+  }
   int inType = inArray->GetDataType();
   int outType = outArray->GetDataType();
   void* inPtr = inArray->GetVoidPointer(0);
@@ -9,7 +9,6 @@
 #include "vtkDataSet.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkDoubleArray.h"
-#include "vtkGenericCell.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -19,10 +18,10 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
-#include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <atomic>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -31,58 +30,6 @@ vtkStandardNewMacro(vtkCellCenters);
 namespace
 {
 
-class CellCenterFunctor
-{
-  vtkSMPThreadLocalObject<vtkGenericCell> TLCell;
-  vtkSMPThreadLocal<std::vector<double>> TLWeigths;
-  vtkDataSet* DataSet;
-  vtkDoubleArray* CellCenters;
-  vtkIdType MaxCellSize;
-
-public:
-  CellCenterFunctor(vtkDataSet* ds, vtkDoubleArray* cellCenters)
-    : DataSet(ds)
-    , CellCenters(cellCenters)
-    , MaxCellSize(ds->GetMaxCellSize())
-  {
-  }
-
-  void operator()(vtkIdType begin, vtkIdType end)
-  {
-    if (this->DataSet == nullptr)
-    {
-      return;
-    }
-
-    if (this->CellCenters == nullptr)
-    {
-      return;
-    }
-
-    auto& weights = this->TLWeigths.Local();
-    weights.resize(this->MaxCellSize);
-    auto cell = this->TLCell.Local();
-    for (vtkIdType cellId = begin; cellId < end; ++cellId)
-    {
-      this->DataSet->GetCell(cellId, cell);
-      double x[3] = { 0.0 };
-      if (cell->GetCellType() != VTK_EMPTY_CELL)
-      {
-        double pcoords[3];
-        int subId = cell->GetParametricCenter(pcoords);
-        cell->EvaluateLocation(subId, pcoords, x, weights.data());
-      }
-      else
-      {
-        x[0] = 0.0;
-        x[1] = 0.0;
-        x[2] = 0.0;
-      }
-      this->CellCenters->SetTypedTuple(cellId, x);
-    }
-  }
-};
-
 //==============================================================================
 struct InputGhostCellFinder
 {
@@ -156,19 +103,21 @@ struct GhostCellsToGhostPointsConverter
 //------------------------------------------------------------------------------
 void vtkCellCenters::ComputeCellCenters(vtkDataSet* dataset, vtkDoubleArray* centers)
 {
-  CellCenterFunctor functor(dataset, centers);
-
-  // Call this once one the main thread before calling on multiple threads.
-  // According to the documentation for vtkDataSet::GetCell(vtkIdType, vtkGenericCell*),
-  // this is required to make this call subsequently thread safe
-  if (dataset->GetNumberOfCells() > 0)
+  if (dataset == nullptr || centers == nullptr)
   {
-    vtkNew<vtkGenericCell> cell;
-    dataset->GetCell(0, cell);
+    return;
   }
 
-  // Now split the work among threads.
-  vtkSMPTools::For(0, dataset->GetNumberOfCells(), functor);
+  // The centers are cached by the dataset, so that they are computed once
+  // for all the filters and executions using them.
+  std::shared_ptr<std::vector<double>> cached = dataset->GetCellCentersCache();
+  const double* source = cached->data();
+  double* target = centers->GetPointer(0);
+  vtkSMPTools::For(0, dataset->GetNumberOfCells(),
+    [source, target](vtkIdType cellId, vtkIdType endCellId)
+    {
+      std::copy(source + 3 * cellId, source + 3 * endCellId, target + 3 * cellId);
+    });
 }
 
 //------------------------------------------------------------------------------
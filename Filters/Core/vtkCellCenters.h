@@ -81,7 +81,9 @@ public:
   ///@}
 
   /**
-   * Compute centers of cells from a dataset, storing them in the centers array.
+   * Compute centers of cells from a dataset, storing them in the centers array,
+   * which must have 3 components and one tuple per cell. The centers are
+   * cached by the dataset (see vtkDataSet::GetCellCentersCache()).
    */
   static void ComputeCellCenters(vtkDataSet* dataset, vtkDoubleArray* centers);
 
@@ -4,6 +4,7 @@
 
 #include "vtk3DLinearGridCrinkleExtractor.h"
 #include "vtkArrayDispatch.h"
+#include "vtkBox.h"
 #include "vtkDoubleArray.h"
 #include "vtkEventForwarderCommand.h"
 #include "vtkExtractCells.h"
@@ -13,6 +14,7 @@
 #include "vtkInformationVector.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPointSet.h"
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkUnstructuredGrid.h"
@@ -308,6 +310,110 @@ struct EvaluateCells
     }
   }
 };
+
+//------------------------------------------------------------------------------
+// Cells inside an axis-aligned vtkBox are the cells whose bounds are strictly
+// inside the box, since the function is negative strictly inside the box only.
+struct EvaluateCellsInBox
+{
+  vtkExtractGeometry* Self;
+  const double* CellBounds;
+  double Bounds[6];
+  vtkIdType NumberOfCells;
+  vtkIdList* KeptCellsList;
+
+  vtkNew<vtkUnsignedCharArray> InsidenessCellsArray;
+
+  EvaluateCellsInBox(vtkExtractGeometry* self, vtkDataSet* input, const double* cellBounds,
+    vtkBox* box, vtkIdList* keptCellsList)
+    : Self(self)
+    , CellBounds(cellBounds)
+    , NumberOfCells(input->GetNumberOfCells())
+    , KeptCellsList(keptCellsList)
+  {
+    box->GetBounds(this->Bounds);
+    this->InsidenessCellsArray->SetNumberOfValues(this->NumberOfCells);
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    auto insideCells = vtk::DataArrayValueRange<1>(this->InsidenessCellsArray);
+    const vtkIdType checkAbortInterval = std::min((end - begin) / 10 + 1, (vtkIdType)1000);
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      if (cellId % checkAbortInterval == 0)
+      {
+        if (isFirst)
+        {
+          this->Self->CheckAbort();
+        }
+        if (this->Self->GetAbortOutput())
+        {
+          break;
+        }
+      }
+
+      const double* bds = this->CellBounds + 6 * cellId;
+      // cells without points have uninitialized bounds, and are inside
+      bool inside = true;
+      if (bds[0] <= bds[1])
+      {
+        for (int i = 0; i < 3; ++i)
+        {
+          if (!(bds[2 * i] > this->Bounds[2 * i] && bds[2 * i + 1] < this->Bounds[2 * i + 1]))
+          {
+            inside = false;
+            break;
+          }
+        }
+      }
+      insideCells[cellId] = static_cast<unsigned char>(inside);
+    }
+    if (isFirst)
+    {
+      this->Self->UpdateProgress(0.5 + end * 0.5 / this->NumberOfCells);
+    }
+  }
+
+  void Reduce()
+  {
+    this->KeptCellsList->Allocate(this->NumberOfCells);
+    for (vtkIdType cellId = 0; cellId < this->NumberOfCells; ++cellId)
+    {
+      if (this->InsidenessCellsArray->GetValue(cellId))
+      {
+        this->KeptCellsList->InsertNextId(cellId);
+      }
+    }
+  }
+};
+//------------------------------------------------------------------------------
+// Extract the kept cells of the input with vtkExtractCells.
+int ExtractKeptCells(vtkExtractGeometry* self, vtkInformation* request,
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector, vtkDataSet* input,
+  vtkIdList* keptCellsList)
+{
+  // call vtkExtractCells
+  vtkNew<vtkExtractCells> extractCells;
+  extractCells->SetContainerAlgorithm(self);
+  extractCells->SetInputData(input);
+  extractCells->SetExtractAllCells(input->GetNumberOfCells() == keptCellsList->GetNumberOfIds());
+  if (!extractCells->GetExtractAllCells())
+  {
+    extractCells->SetCellList(keptCellsList);
+  }
+  extractCells->AssumeSortedAndUniqueIdsOn();
+  extractCells->PassThroughCellIdsOff();
+
+  vtkNew<vtkEventForwarderCommand> progressForwarder;
+  progressForwarder->SetTarget(self);
+  extractCells->AddObserver(vtkCommand::ProgressEvent, progressForwarder);
+
+  return extractCells->ProcessRequest(request, inputVector, outputVector);
+}
 } // end anon namespace
 
 //------------------------------------------------------------------------------
@@ -349,6 +455,27 @@ int vtkExtractGeometry::RequestData(
     return 1;
   }
 
+  // Extraction of the cells inside an axis-aligned box: compare the cell
+  // bounds cached by the input with the box, instead of evaluating the
+  // function at the points. Only explicit points are used, so that the cell
+  // bounds are exactly the bounds of the points evaluated otherwise.
+  vtkBox* box = vtkBox::SafeDownCast(this->ImplicitFunction);
+  if (box && !box->GetTransform() && this->ExtractInside && !this->ExtractBoundaryCells &&
+    vtkPointSet::SafeDownCast(input))
+  {
+    std::shared_ptr<std::vector<double>> cellBounds = input->GetCellBoundsCache();
+    this->UpdateProgress(0.25);
+    vtkNew<vtkIdList> keptCellsList;
+    EvaluateCellsInBox evaluateCells(this, input, cellBounds->data(), box, keptCellsList);
+    vtkSMPTools::For(0, input->GetNumberOfCells(), evaluateCells);
+    if (this->CheckAbort())
+    {
+      return 1;
+    }
+    this->UpdateProgress(0.5);
+    return ExtractKeptCells(this, request, inputVector, outputVector, input, keptCellsList);
+  }
+
   const double multiplier = this->ExtractInside ? 1.0 : -1.0;
 
   vtkNew<vtkUnsignedCharArray> insidenessArray;
@@ -388,23 +515,7 @@ int vtkExtractGeometry::RequestData(
   }
   this->UpdateProgress(0.5);
 
-  // call vtkExtractCells
-  vtkNew<vtkExtractCells> extractCells;
-  extractCells->SetContainerAlgorithm(this);
-  extractCells->SetInputData(input);
-  extractCells->SetExtractAllCells(input->GetNumberOfCells() == keptCellsList->GetNumberOfIds());
-  if (!extractCells->GetExtractAllCells())
-  {
-    extractCells->SetCellList(keptCellsList);
-  }
-  extractCells->AssumeSortedAndUniqueIdsOn();
-  extractCells->PassThroughCellIdsOff();
-
-  vtkNew<vtkEventForwarderCommand> progressForwarder;
-  progressForwarder->SetTarget(this);
-  extractCells->AddObserver(vtkCommand::ProgressEvent, progressForwarder);
-
-  return extractCells->ProcessRequest(request, inputVector, outputVector);
+  return ExtractKeptCells(this, request, inputVector, outputVector, input, keptCellsList);
 }
 
 //------------------------------------------------------------------------------
@@ -19,6 +19,12 @@
  * A more efficient version of this filter is available for vtkPolyData input.
  * See vtkExtractPolyDataGeometry.
  *
+ * When extracting the cells inside a vtkBox (without transform) from a
+ * vtkPointSet, and boundary cells are not extracted, the cells are selected by
+ * comparing their bounds with the box. The cell bounds are cached by the input
+ * (see vtkDataSet::GetCellBoundsCache()), so that repeated extractions with
+ * different boxes only compare the bounds.
+ *
  * @warning
  * This class has been threaded with vtkSMPTools. Using TBB or other
  * non-sequential type (set in the CMake variable
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkGeodesicDistanceFilter.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+double GetDistance(vtkGeodesicDistanceFilter* filter, vtkIdType p)
+{
+  return filter->GetOutput()->GetPointData()->GetArray("GeodesicDistance")->GetComponent(p, 0);
+}
+}
+
+int TestGeodesicDistanceFilter(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  // An image of 101 x 101 points, with a seed in the middle
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(101, 101, 1);
+  image->SetSpacing(0.5, 0.5, 1.0);
+  vtkNew<vtkDoubleArray> cost;
+  cost->SetName("Cost");
+  cost->SetNumberOfTuples(101 * 101);
+  cost->Fill(1.0);
+  image->GetPointData()->SetScalars(cost);
+
+  vtkNew<vtkIdList> seeds;
+  seeds->InsertNextId(50 + 50 * 101);
+  vtkNew<vtkGeodesicDistanceFilter> filter;
+  filter->SetInputData(image);
+  filter->SetSeeds(seeds);
+  filter->Update();
+
+  // Exact along the axes, close to euclidean along the diagonals
+  double distance = GetDistance(filter, 100 + 50 * 101);
+  if (std::abs(distance - 25.0) > 1e-6)
+  {
+    std::cerr << "Wrong distance along the X axis: " << distance << std::endl;
+    return EXIT_FAILURE;
+  }
+  distance = GetDistance(filter, 100 + 100 * 101);
+  if (std::abs(distance - 25.0 * std::sqrt(2.0)) > 0.05 * 25.0 * std::sqrt(2.0))
+  {
+    std::cerr << "Wrong distance along the diagonal: " << distance << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // With two seeds, the distance to the closest one
+  seeds->Initialize();
+  seeds->InsertNextId(0);
+  seeds->InsertNextId(100);
+  filter->Update();
+  if (std::abs(GetDistance(filter, 20) - 10.0) > 1e-6 ||
+    std::abs(GetDistance(filter, 70) - 15.0) > 1e-6)
+  {
+    std::cerr << "Wrong distance with two seeds" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A wall at X = 60 with a gap at its end, the path goes around it
+  for (int j = 0; j < 90; ++j)
+  {
+    cost->SetValue(60 + j * 101, 0.0);
+  }
+  seeds->Initialize();
+  seeds->InsertNextId(10 + 10 * 101);
+  vtkNew<vtkIdList> targets;
+  targets->InsertNextId(90 + 10 * 101);
+  filter->UseCostArrayOn();
+  filter->GeneratePathsOn();
+  filter->SetPathTargets(targets);
+  filter->Update();
+  distance = GetDistance(filter, 90 + 10 * 101);
+  if (distance < 80.0 || distance > 100.0)
+  {
+    std::cerr << "Wrong distance around the wall: " << distance << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (GetDistance(filter, 60 + 10 * 101) != VTK_DOUBLE_MAX)
+  {
+    std::cerr << "The wall was reached" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The path goes down the distance from the target to the seed
+  vtkPolyData* paths = filter->GetPathsOutput();
+  vtkDataArray* pathDistance = paths->GetPointData()->GetArray("GeodesicDistance");
+  if (paths->GetNumberOfLines() != 1 || !pathDistance ||
+    pathDistance->GetComponent(pathDistance->GetNumberOfTuples() - 1, 0) != 0.0)
+  {
+    std::cerr << "Wrong path" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType i = 1; i < pathDistance->GetNumberOfTuples(); ++i)
+  {
+    if (pathDistance->GetComponent(i, 0) >= pathDistance->GetComponent(i - 1, 0))
+    {
+      std::cerr << "The distance does not decrease along the path" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // On a sphere, from pole to pole
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetRadius(2.0);
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+  seeds->Initialize();
+  seeds->InsertNextId(0);
+  vtkNew<vtkGeodesicDistanceFilter> meshFilter;
+  meshFilter->SetInputConnection(sphere->GetOutputPort());
+  meshFilter->SetSeeds(seeds);
+  meshFilter->Update();
+  distance = GetDistance(meshFilter, 1);
+  if (std::abs(distance - 2.0 * vtkMath::Pi()) > 0.02 * 2.0 * vtkMath::Pi())
+  {
+    std::cerr << "Wrong distance between the poles: " << distance << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
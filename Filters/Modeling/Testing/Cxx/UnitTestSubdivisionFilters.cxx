@@ -7,9 +7,12 @@
 #include "vtkLoopSubdivisionFilter.h"
 
 #include "vtkCellArray.h"
+#include "vtkNew.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkQuad.h"
+#include "vtkSphereSource.h"
+#include "vtkTestUtilities.h"
 #include "vtkTriangle.h"
 
 #include "vtkCommand.h"
@@ -20,6 +23,7 @@
 
 template <typename T>
 int TestSubdivision();
+int TestLoopHalfEdges();
 
 int UnitTestSubdivisionFilters(int, char*[])
 {
@@ -28,6 +32,7 @@ int UnitTestSubdivisionFilters(int, char*[])
   status += TestSubdivision<vtkButterflySubdivisionFilter>();
   status += TestSubdivision<vtkLinearSubdivisionFilter>();
   status += TestSubdivision<vtkLoopSubdivisionFilter>();
+  status += TestLoopHalfEdges();
 
   return status;
 }
@@ -187,3 +192,48 @@ int TestSubdivision()
 
   return status;
 }
+
+// The Loop filter finds the neighbors with half-edges on manifold,
+// consistently oriented meshes, and with cell links otherwise. Reversing a
+// triangle switches to the cell links, without changing the surface.
+int TestLoopHalfEdges()
+{
+  int status = EXIT_SUCCESS;
+  std::cout << "Testing vtkLoopSubdivisionFilter half-edges" << std::endl;
+
+  for (double endTheta : { 360.0, 270.0 })
+  {
+    std::cout << "  Testing a sphere with EndTheta " << endTheta << "...";
+    vtkNew<vtkSphereSource> sphere;
+    sphere->SetThetaResolution(12);
+    sphere->SetPhiResolution(8);
+    sphere->SetEndTheta(endTheta);
+    sphere->Update();
+
+    vtkNew<vtkPolyData> reversed;
+    reversed->DeepCopy(sphere->GetOutput());
+    reversed->ReverseCell(reversed->GetNumberOfCells() / 2);
+
+    vtkNew<vtkLoopSubdivisionFilter> halfEdges;
+    halfEdges->SetInputConnection(sphere->GetOutputPort());
+    halfEdges->SetNumberOfSubdivisions(2);
+    halfEdges->Update();
+
+    vtkNew<vtkLoopSubdivisionFilter> links;
+    links->SetInputData(reversed);
+    links->SetNumberOfSubdivisions(2);
+    links->Update();
+
+    if (vtkTestUtilities::CompareDataObjects(halfEdges->GetOutput(), links->GetOutput()))
+    {
+      std::cout << "PASSED" << std::endl;
+    }
+    else
+    {
+      status++;
+      std::cout << "FAILED" << std::endl;
+    }
+  }
+
+  return status;
+}
@@ -5,13 +5,16 @@
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkDoubleArray.h"
+#include "vtkHalfEdgeMesh.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSmartPointer.h"
 #include "vtkSphere.h"
 #include "vtkTriangleStrip.h"
 
@@ -56,12 +59,11 @@ int vtkFillHolesFilter::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
 
-  vtkPolyData* Mesh = vtkPolyData::New();
-  Mesh->SetPoints(inPts);
-  vtkCellArray *newPolys, *inPolys = input->GetPolys();
+  vtkSmartPointer<vtkCellArray> newPolys;
+  vtkCellArray* inPolys = input->GetPolys();
   if (numStrips > 0)
   {
-    newPolys = vtkCellArray::New();
+    newPolys = vtkSmartPointer<vtkCellArray>::New();
     if (numPolys > 0)
     {
       newPolys->DeepCopy(inPolys);
@@ -75,15 +77,16 @@ int vtkFillHolesFilter::RequestData(vtkInformation* vtkNotUsed(request),
     {
       vtkTriangleStrip::DecomposeStrip(npts, pts, newPolys);
     }
-    Mesh->SetPolys(newPolys);
-    newPolys->Delete();
   }
   else
   {
     newPolys = inPolys;
-    Mesh->SetPolys(newPolys);
   }
-  Mesh->BuildLinks();
+
+  // The half-edges without twin are the free edges; other edges are used by
+  // several polygons.
+  vtkNew<vtkHalfEdgeMesh> mesh;
+  mesh->BuildFromPolys(newPolys, numPts);
 
   // Allocate storage for lines/points (arbitrary allocation sizes)
   //
@@ -95,11 +98,11 @@ int vtkFillHolesFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
   // grab all free edges and place them into a temporary polydata
   bool abort = false;
-  vtkIdType cellId, p1, p2, numNei, i, numCells = newPolys->GetNumberOfCells();
+  vtkIdType cellId, i, numCells = mesh->GetNumberOfFaces();
   vtkIdType progressInterval = numCells / 20 + 1;
   vtkIdList* neighbors = vtkIdList::New();
   neighbors->Allocate(VTK_CELL_SIZE);
-  for (cellId = 0, newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts) && !abort; cellId++)
+  for (cellId = 0; cellId < numCells && !abort; cellId++)
   {
     if (!(cellId % progressInterval)) // manage progress / early abort
     {
@@ -107,21 +110,22 @@ int vtkFillHolesFilter::RequestData(vtkInformation* vtkNotUsed(request),
       abort = this->CheckAbort();
     }
 
-    for (i = 0; i < npts; i++)
+    const vtkIdType firstEdge = mesh->GetFaceEdge(cellId);
+    if (firstEdge < 0)
     {
-      p1 = pts[i];
-      p2 = pts[(i + 1) % npts];
-
-      Mesh->GetCellEdgeNeighbors(cellId, p1, p2, neighbors);
-      numNei = neighbors->GetNumberOfIds();
-
-      if (numNei < 1)
+      continue;
+    }
+    vtkIdType edge = firstEdge;
+    do
+    {
+      if (mesh->IsBoundaryEdge(edge))
       {
         newLines->InsertNextCell(2);
-        newLines->InsertCellPoint(p1);
-        newLines->InsertCellPoint(p2);
+        newLines->InsertCellPoint(mesh->GetOrigin(edge));
+        newLines->InsertCellPoint(mesh->GetDestination(edge));
       }
-    }
+      edge = mesh->GetNext(edge);
+    } while (edge != firstEdge);
   }
 
   // Track all free edges and see whether polygons can be built from them.
@@ -238,7 +242,6 @@ int vtkFillHolesFilter::RequestData(vtkInformation* vtkNotUsed(request),
   }
   output->SetStrips(input->GetStrips());
 
-  Mesh->Delete();
   newLines->Delete();
   return 1;
 }
@@ -0,0 +1,754 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkGeodesicDistanceFilter.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+
+namespace
+{
+const double vtkGeodesicInfinity = std::numeric_limits<double>::infinity();
+
+//------------------------------------------------------------------------------
+// Whether the decrease of the distance of a point, from oldValue to newValue,
+// is too small to go on with it. This is also true if it increases.
+bool vtkGeodesicConverged(double oldValue, double newValue)
+{
+  return !(oldValue - newValue > 1e-9 * std::max(newValue, 1.0));
+}
+
+//------------------------------------------------------------------------------
+// Solve the upwind discretization of |grad(d)| = cost at a grid point, given
+// the smallest distance of its two neighbors along n axes, and the spacing
+// of these axes. The axes whose neighbors are farther than the solution are
+// not upwind, and are left out.
+double vtkGeodesicSolveUpwind(double values[3], double spacing[3], int n, double cost)
+{
+  // sort the axes by distance
+  for (int i = 1; i < n; ++i)
+  {
+    for (int j = i; j > 0 && values[j] < values[j - 1]; --j)
+    {
+      std::swap(values[j], values[j - 1]);
+      std::swap(spacing[j], spacing[j - 1]);
+    }
+  }
+
+  // solve sum(((d - values[i]) / spacing[i])^2) = cost^2 for the first axes
+  double a = 0.0;
+  double b = 0.0;
+  double c = 0.0;
+  double distance = vtkGeodesicInfinity;
+  for (int i = 0; i < n && values[i] < distance; ++i)
+  {
+    const double w = 1.0 / (spacing[i] * spacing[i]);
+    a += w;
+    b += values[i] * w;
+    c += values[i] * values[i] * w;
+    const double discriminant = b * b - a * (c - cost * cost);
+    if (discriminant < 0.0)
+    {
+      break;
+    }
+    distance = (b + std::sqrt(discriminant)) / a;
+  }
+  return distance;
+}
+
+//------------------------------------------------------------------------------
+// The distance at C of a plane wave that crosses the triangle ABC, given the
+// distances at A and B. The distance along AB is linear, and the wave reaches
+// C from the point P of AB that minimizes distance(P) + cost * |CP|.
+double vtkGeodesicSolveTriangle(const double pA[3], double dA, const double pB[3], double dB,
+  const double pC[3], double cost)
+{
+  double e[3] = { pB[0] - pA[0], pB[1] - pA[1], pB[2] - pA[2] };
+  double w[3] = { pC[0] - pA[0], pC[1] - pA[1], pC[2] - pA[2] };
+  double v[3] = { pC[0] - pB[0], pC[1] - pB[1], pC[2] - pB[2] };
+  const double ee = e[0] * e[0] + e[1] * e[1] + e[2] * e[2];
+  const double ew = e[0] * w[0] + e[1] * w[1] + e[2] * w[2];
+  const double ww = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  const double vv = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+
+  // the wave from A or from B
+  double distance = std::min(dA + cost * std::sqrt(ww), dB + cost * std::sqrt(vv));
+
+  // the wave from inside AB, where the derivative of the sum is zero
+  const double du = dB - dA;
+  const double denominator = ee * (cost * cost * ee - du * du);
+  if (ee > 0.0 && denominator > 0.0)
+  {
+    const double s0 = ew / ee;                            // the foot of C on AB
+    const double h2 = std::max(ww - ew * ew / ee, 0.0); // the squared height of C
+    const double s = s0 - du * std::sqrt(h2 / denominator);
+    if (s > 0.0 && s < 1.0)
+    {
+      const double r = std::sqrt(ee * (s - s0) * (s - s0) + h2);
+      distance = std::min(distance, dA + s * du + cost * r);
+    }
+  }
+  return distance;
+}
+
+//------------------------------------------------------------------------------
+// The voxels of an image. The front moves between the 6 face neighbors.
+struct vtkGeodesicImageDomain
+{
+  int Dimensions[3];
+  double Spacing[3];
+  vtkIdType Increments[3];
+  const double* Cost; // nullptr for a cost of 1
+
+  bool IsObstacle(vtkIdType p) const { return this->Cost && !(this->Cost[p] > 0.0); }
+
+  void GetIndex(vtkIdType p, int ijk[3]) const
+  {
+    ijk[0] = static_cast<int>(p % this->Dimensions[0]);
+    p /= this->Dimensions[0];
+    ijk[1] = static_cast<int>(p % this->Dimensions[1]);
+    ijk[2] = static_cast<int>(p / this->Dimensions[1]);
+  }
+
+  template <class F>
+  void ForEachNeighbor(vtkIdType p, F&& f) const
+  {
+    int ijk[3];
+    this->GetIndex(p, ijk);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      if (ijk[axis] > 0)
+      {
+        f(p - this->Increments[axis]);
+      }
+      if (ijk[axis] < this->Dimensions[axis] - 1)
+      {
+        f(p + this->Increments[axis]);
+      }
+    }
+  }
+
+  // The 26 neighbors, with their distance to the point
+  template <class F>
+  void ForEachPathNeighbor(vtkIdType p, F&& f) const
+  {
+    int ijk[3];
+    this->GetIndex(p, ijk);
+    for (int k = std::max(ijk[2] - 1, 0); k <= std::min(ijk[2] + 1, this->Dimensions[2] - 1); ++k)
+    {
+      for (int j = std::max(ijk[1] - 1, 0); j <= std::min(ijk[1] + 1, this->Dimensions[1] - 1);
+           ++j)
+      {
+        for (int i = std::max(ijk[0] - 1, 0); i <= std::min(ijk[0] + 1, this->Dimensions[0] - 1);
+             ++i)
+        {
+          const double dx = (i - ijk[0]) * this->Spacing[0];
+          const double dy = (j - ijk[1]) * this->Spacing[1];
+          const double dz = (k - ijk[2]) * this->Spacing[2];
+          const vtkIdType q = i + j * this->Increments[1] + k * this->Increments[2];
+          if (q != p)
+          {
+            f(q, std::sqrt(dx * dx + dy * dy + dz * dz));
+          }
+        }
+      }
+    }
+  }
+
+  double Update(vtkIdType p, const double* distance) const
+  {
+    int ijk[3];
+    this->GetIndex(p, ijk);
+    double values[3];
+    double spacing[3];
+    int n = 0;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      double value = vtkGeodesicInfinity;
+      if (ijk[axis] > 0)
+      {
+        value = distance[p - this->Increments[axis]];
+      }
+      if (ijk[axis] < this->Dimensions[axis] - 1)
+      {
+        value = std::min(value, distance[p + this->Increments[axis]]);
+      }
+      if (value < vtkGeodesicInfinity)
+      {
+        values[n] = value;
+        spacing[n] = this->Spacing[axis];
+        ++n;
+      }
+    }
+    return vtkGeodesicSolveUpwind(values, spacing, n, this->Cost ? this->Cost[p] : 1.0);
+  }
+};
+
+//------------------------------------------------------------------------------
+// The triangles of a mesh. The front moves between the points that share a
+// triangle.
+struct vtkGeodesicMeshDomain
+{
+  std::vector<double> Points;
+  std::vector<vtkIdType> Triangles;      // 3 point ids per triangle
+  std::vector<vtkIdType> Offsets;        // the triangles of each point, in
+  std::vector<vtkIdType> PointTriangles; // PointTriangles[Offsets[p]:Offsets[p + 1]]
+  const double* Cost;                    // nullptr for a cost of 1
+
+  void Build(vtkPolyData* mesh)
+  {
+    const vtkIdType numPts = mesh->GetNumberOfPoints();
+    this->Points.resize(3 * numPts);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType p = begin; p < end; ++p)
+      {
+        mesh->GetPoint(p, &this->Points[3 * p]);
+      }
+    });
+
+    // split the polygons into fans of triangles
+    this->Triangles.clear();
+    auto iter = vtk::TakeSmartPointer(mesh->GetPolys()->NewIterator());
+    for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+    {
+      vtkIdType npts;
+      const vtkIdType* pts;
+      iter->GetCurrentCell(npts, pts);
+      for (vtkIdType i = 1; i + 1 < npts; ++i)
+      {
+        this->Triangles.push_back(pts[0]);
+        this->Triangles.push_back(pts[i]);
+        this->Triangles.push_back(pts[i + 1]);
+      }
+    }
+
+    // the triangles of each point
+    this->Offsets.assign(numPts + 1, 0);
+    for (vtkIdType p : this->Triangles)
+    {
+      ++this->Offsets[p + 1];
+    }
+    for (vtkIdType p = 0; p < numPts; ++p)
+    {
+      this->Offsets[p + 1] += this->Offsets[p];
+    }
+    this->PointTriangles.resize(this->Triangles.size());
+    std::vector<vtkIdType> next(this->Offsets.begin(), this->Offsets.end() - 1);
+    for (size_t i = 0; i < this->Triangles.size(); ++i)
+    {
+      this->PointTriangles[next[this->Triangles[i]]++] = static_cast<vtkIdType>(i / 3);
+    }
+  }
+
+  bool IsObstacle(vtkIdType p) const { return this->Cost && !(this->Cost[p] > 0.0); }
+
+  template <class F>
+  void ForEachNeighbor(vtkIdType p, F&& f) const
+  {
+    for (vtkIdType i = this->Offsets[p]; i < this->Offsets[p + 1]; ++i)
+    {
+      const vtkIdType* triangle = &this->Triangles[3 * this->PointTriangles[i]];
+      for (int j = 0; j < 3; ++j)
+      {
+        if (triangle[j] != p)
+        {
+          f(triangle[j]);
+        }
+      }
+    }
+  }
+
+  template <class F>
+  void ForEachPathNeighbor(vtkIdType p, F&& f) const
+  {
+    const double* x = &this->Points[3 * p];
+    this->ForEachNeighbor(p, [&](vtkIdType q) {
+      const double* y = &this->Points[3 * q];
+      f(q,
+        std::sqrt((y[0] - x[0]) * (y[0] - x[0]) + (y[1] - x[1]) * (y[1] - x[1]) +
+          (y[2] - x[2]) * (y[2] - x[2])));
+    });
+  }
+
+  double Update(vtkIdType p, const double* distance) const
+  {
+    const double cost = this->Cost ? this->Cost[p] : 1.0;
+    const double* pC = &this->Points[3 * p];
+    double result = vtkGeodesicInfinity;
+    for (vtkIdType i = this->Offsets[p]; i < this->Offsets[p + 1]; ++i)
+    {
+      const vtkIdType* triangle = &this->Triangles[3 * this->PointTriangles[i]];
+      const int k = (triangle[0] == p ? 0 : (triangle[1] == p ? 1 : 2));
+      const vtkIdType a = triangle[(k + 1) % 3];
+      const vtkIdType b = triangle[(k + 2) % 3];
+      const double* pA = &this->Points[3 * a];
+      const double* pB = &this->Points[3 * b];
+      const bool reachedA = (a != p && distance[a] < vtkGeodesicInfinity);
+      const bool reachedB = (b != p && distance[b] < vtkGeodesicInfinity);
+      if (reachedA && reachedB && a != b)
+      {
+        result =
+          std::min(result, vtkGeodesicSolveTriangle(pA, distance[a], pB, distance[b], pC, cost));
+      }
+      else if (reachedA)
+      {
+        result =
+          std::min(result, vtkGeodesicSolveTriangle(pA, distance[a], pA, distance[a], pC, cost));
+      }
+      else if (reachedB)
+      {
+        result =
+          std::min(result, vtkGeodesicSolveTriangle(pB, distance[b], pB, distance[b], pC, cost));
+      }
+    }
+    return result;
+  }
+};
+
+//------------------------------------------------------------------------------
+// The Fast Iterative Method. The points of the front are updated together
+// from the distances of the previous iteration, so that the result does not
+// depend on the threads. The points whose distance converged leave the
+// front, and their neighbors whose distance decreases join it.
+template <class TDomain>
+int vtkGeodesicFastIterativeMethod(const TDomain& domain, const std::vector<vtkIdType>& seeds,
+  double maximumDistance, std::vector<double>& distance, vtkGeodesicDistanceFilter* self)
+{
+  const vtkIdType numPts = static_cast<vtkIdType>(distance.size());
+  std::fill(distance.begin(), distance.end(), vtkGeodesicInfinity);
+  std::vector<unsigned char> inFront(numPts, 0);
+  std::vector<vtkIdType> front;
+  for (vtkIdType seed : seeds)
+  {
+    distance[seed] = 0.0;
+  }
+  for (vtkIdType seed : seeds)
+  {
+    domain.ForEachNeighbor(seed, [&](vtkIdType q) {
+      if (distance[q] > 0.0 && !inFront[q] && !domain.IsObstacle(q))
+      {
+        inFront[q] = 1;
+        front.push_back(q);
+      }
+    });
+  }
+
+  std::vector<double> previous;
+  std::vector<double> updated;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> localKept;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> localAdded;
+  int iterations = 0;
+  while (!front.empty() && !self->CheckAbort())
+  {
+    ++iterations;
+    const vtkIdType n = static_cast<vtkIdType>(front.size());
+    previous.resize(n);
+    updated.resize(n);
+    vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        previous[i] = distance[front[i]];
+        updated[i] = std::min(previous[i], domain.Update(front[i], distance.data()));
+      }
+    });
+    vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        distance[front[i]] = updated[i];
+      }
+    });
+
+    vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+      std::vector<vtkIdType>& kept = localKept.Local();
+      std::vector<vtkIdType>& added = localAdded.Local();
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        if (!vtkGeodesicConverged(previous[i], updated[i]))
+        {
+          kept.push_back(front[i]);
+          continue;
+        }
+        domain.ForEachNeighbor(front[i], [&](vtkIdType q) {
+          if (!inFront[q] && !domain.IsObstacle(q))
+          {
+            const double value = domain.Update(q, distance.data());
+            if (value <= maximumDistance && !vtkGeodesicConverged(distance[q], value))
+            {
+              added.push_back(q);
+            }
+          }
+        });
+      }
+    });
+
+    // the next front
+    for (vtkIdType i = 0; i < n; ++i)
+    {
+      if (vtkGeodesicConverged(previous[i], updated[i]))
+      {
+        inFront[front[i]] = 0;
+      }
+    }
+    front.clear();
+    for (std::vector<vtkIdType>& kept : localKept)
+    {
+      front.insert(front.end(), kept.begin(), kept.end());
+      kept.clear();
+    }
+    for (std::vector<vtkIdType>& added : localAdded)
+    {
+      for (vtkIdType q : added)
+      {
+        if (!inFront[q])
+        {
+          inFront[q] = 1;
+          front.push_back(q);
+        }
+      }
+      added.clear();
+    }
+  }
+  return iterations;
+}
+
+//------------------------------------------------------------------------------
+// Go down the distance from a target to a seed, each step to the neighbor
+// of steepest descent. The path is empty if the target is not reached.
+template <class TDomain>
+void vtkGeodesicTracePath(const TDomain& domain, const std::vector<double>& distance,
+  double maximumDistance, vtkIdType target, std::vector<vtkIdType>& path)
+{
+  path.clear();
+  if (!(distance[target] <= maximumDistance))
+  {
+    return;
+  }
+  vtkIdType p = target;
+  path.push_back(p);
+  while (distance[p] > 0.0)
+  {
+    vtkIdType next = p;
+    double steepest = 0.0;
+    domain.ForEachPathNeighbor(p, [&](vtkIdType q, double length) {
+      const double slope = (distance[p] - distance[q]) / length;
+      if (distance[q] < distance[p] && slope > steepest)
+      {
+        steepest = slope;
+        next = q;
+      }
+    });
+    if (next == p)
+    {
+      break;
+    }
+    p = next;
+    path.push_back(p);
+  }
+}
+
+//------------------------------------------------------------------------------
+template <class TDomain>
+int vtkGeodesicExecute(const TDomain& domain, const std::vector<vtkIdType>& seeds,
+  const std::vector<vtkIdType>& targets, double maximumDistance, std::vector<double>& distance,
+  std::vector<std::vector<vtkIdType>>& paths, vtkGeodesicDistanceFilter* self)
+{
+  int iterations =
+    vtkGeodesicFastIterativeMethod(domain, seeds, maximumDistance, distance, self);
+
+  paths.resize(targets.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(targets.size()), [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      vtkGeodesicTracePath(domain, distance, maximumDistance, targets[i], paths[i]);
+    }
+  });
+  return iterations;
+}
+
+//------------------------------------------------------------------------------
+// The valid point ids of a list.
+std::vector<vtkIdType> vtkGeodesicGetIds(vtkIdList* list, vtkIdType numPts)
+{
+  std::vector<vtkIdType> ids;
+  for (vtkIdType i = 0; list && i < list->GetNumberOfIds(); ++i)
+  {
+    vtkIdType id = list->GetId(i);
+    if (id >= 0 && id < numPts)
+    {
+      ids.push_back(id);
+    }
+  }
+  return ids;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkStandardNewMacro(vtkGeodesicDistanceFilter);
+vtkCxxSetObjectMacro(vtkGeodesicDistanceFilter, Seeds, vtkIdList);
+vtkCxxSetObjectMacro(vtkGeodesicDistanceFilter, PathTargets, vtkIdList);
+
+//------------------------------------------------------------------------------
+vtkGeodesicDistanceFilter::vtkGeodesicDistanceFilter()
+{
+  this->Seeds = vtkIdList::New();
+  this->UseCostArray = 0;
+  this->MaximumDistance = VTK_DOUBLE_MAX;
+  this->DistanceArrayName = nullptr;
+  this->SetDistanceArrayName("GeodesicDistance");
+  this->GeneratePaths = 0;
+  this->PathTargets = vtkIdList::New();
+  this->NumberOfIterations = 0;
+
+  this->SetNumberOfOutputPorts(2);
+
+  // by default, process the point scalars
+  this->SetInputArrayToProcess(
+    0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
+}
+
+//------------------------------------------------------------------------------
+vtkGeodesicDistanceFilter::~vtkGeodesicDistanceFilter()
+{
+  this->SetSeeds(nullptr);
+  this->SetPathTargets(nullptr);
+  this->SetDistanceArrayName(nullptr);
+}
+
+//------------------------------------------------------------------------------
+vtkPolyData* vtkGeodesicDistanceFilter::GetPathsOutput()
+{
+  return vtkPolyData::SafeDownCast(this->GetOutputDataObject(1));
+}
+
+//------------------------------------------------------------------------------
+vtkMTimeType vtkGeodesicDistanceFilter::GetMTime()
+{
+  vtkMTimeType mTime = this->Superclass::GetMTime();
+  if (this->Seeds)
+  {
+    mTime = std::max(mTime, this->Seeds->GetMTime());
+  }
+  if (this->PathTargets)
+  {
+    mTime = std::max(mTime, this->PathTargets->GetMTime());
+  }
+  return mTime;
+}
+
+//------------------------------------------------------------------------------
+int vtkGeodesicDistanceFilter::FillInputPortInformation(int, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageData");
+  info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkPolyData");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkGeodesicDistanceFilter::FillOutputPortInformation(int port, vtkInformation* info)
+{
+  if (port == 1)
+  {
+    info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkPolyData");
+    return 1;
+  }
+  return this->Superclass::FillOutputPortInformation(port, info);
+}
+
+//------------------------------------------------------------------------------
+// The first output has the type of the input, the second one is polydata.
+int vtkGeodesicDistanceFilter::RequestDataObject(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkDataSet* input = vtkDataSet::GetData(inputVector[0]);
+  if (!input)
+  {
+    return 0;
+  }
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkDataSet* output = vtkDataSet::GetData(outInfo);
+  if (!output || !output->IsA(input->GetClassName()))
+  {
+    vtkDataSet* newOutput = input->NewInstance();
+    outInfo->Set(vtkDataObject::DATA_OBJECT(), newOutput);
+    newOutput->Delete();
+  }
+  vtkInformation* pathsInfo = outputVector->GetInformationObject(1);
+  if (!vtkPolyData::GetData(pathsInfo))
+  {
+    vtkNew<vtkPolyData> paths;
+    pathsInfo->Set(vtkDataObject::DATA_OBJECT(), paths);
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+// The distance depends on the whole input.
+int vtkGeodesicDistanceFilter::RequestUpdateExtent(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector*)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  if (inInfo->Has(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()))
+  {
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(),
+      inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()), 6);
+  }
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(), 0);
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(), 1);
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS(), 0);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkGeodesicDistanceFilter::RequestData(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkDataSet* input = vtkDataSet::GetData(inputVector[0]);
+  vtkDataSet* output = vtkDataSet::GetData(outputVector, 0);
+  vtkPolyData* pathsOutput = vtkPolyData::GetData(outputVector, 1);
+  if (!input || !output)
+  {
+    return 0;
+  }
+  output->ShallowCopy(input);
+  this->NumberOfIterations = 0;
+
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  std::vector<vtkIdType> seeds = vtkGeodesicGetIds(this->Seeds, numPts);
+  std::vector<vtkIdType> targets;
+  if (this->GeneratePaths)
+  {
+    targets = vtkGeodesicGetIds(this->PathTargets, numPts);
+  }
+
+  // the cost of each point
+  std::vector<double> cost;
+  if (this->UseCostArray)
+  {
+    vtkDataArray* array = this->GetInputArrayToProcess(0, inputVector);
+    if (!array)
+    {
+      vtkWarningMacro("No cost array, the cost is 1 everywhere.");
+    }
+    else
+    {
+      cost.resize(numPts);
+      vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType p = begin; p < end; ++p)
+        {
+          cost[p] = array->GetComponent(p, 0);
+        }
+      });
+    }
+  }
+  const double* costPtr = (cost.empty() ? nullptr : cost.data());
+
+  std::vector<double> distance(numPts);
+  std::vector<std::vector<vtkIdType>> paths;
+  if (vtkImageData* image = vtkImageData::SafeDownCast(input))
+  {
+    vtkGeodesicImageDomain domain;
+    image->GetDimensions(domain.Dimensions);
+    image->GetSpacing(domain.Spacing);
+    for (int i = 0; i < 3; ++i)
+    {
+      domain.Spacing[i] = std::abs(domain.Spacing[i]);
+    }
+    domain.Increments[0] = 1;
+    domain.Increments[1] = domain.Dimensions[0];
+    domain.Increments[2] = static_cast<vtkIdType>(domain.Dimensions[0]) * domain.Dimensions[1];
+    domain.Cost = costPtr;
+    this->NumberOfIterations = vtkGeodesicExecute(
+      domain, seeds, targets, this->MaximumDistance, distance, paths, this);
+  }
+  else if (vtkPolyData* mesh = vtkPolyData::SafeDownCast(input))
+  {
+    vtkGeodesicMeshDomain domain;
+    domain.Build(mesh);
+    domain.Cost = costPtr;
+    this->NumberOfIterations = vtkGeodesicExecute(
+      domain, seeds, targets, this->MaximumDistance, distance, paths, this);
+  }
+  else
+  {
+    vtkErrorMacro("The input must be a vtkImageData or a vtkPolyData.");
+    return 0;
+  }
+
+  // the distance
+  vtkNew<vtkDoubleArray> distanceArray;
+  distanceArray->SetName(this->DistanceArrayName);
+  distanceArray->SetNumberOfTuples(numPts);
+  const double maximumDistance = this->MaximumDistance;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType p = begin; p < end; ++p)
+    {
+      distanceArray->SetValue(p, distance[p] <= maximumDistance ? distance[p] : maximumDistance);
+    }
+  });
+  output->GetPointData()->AddArray(distanceArray);
+
+  // the paths
+  if (pathsOutput)
+  {
+    vtkNew<vtkPoints> points;
+    points->SetDataTypeToDouble();
+    vtkNew<vtkCellArray> lines;
+    vtkNew<vtkDoubleArray> pathDistance;
+    pathDistance->SetName(this->DistanceArrayName);
+    for (const std::vector<vtkIdType>& path : paths)
+    {
+      if (path.empty())
+      {
+        continue;
+      }
+      lines->InsertNextCell(static_cast<vtkIdType>(path.size()));
+      for (vtkIdType p : path)
+      {
+        lines->InsertCellPoint(points->InsertNextPoint(input->GetPoint(p)));
+        pathDistance->InsertNextValue(distance[p]);
+      }
+    }
+    pathsOutput->SetPoints(points);
+    pathsOutput->SetLines(lines);
+    pathsOutput->GetPointData()->AddArray(pathDistance);
+  }
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkGeodesicDistanceFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Seeds: " << (this->Seeds ? this->Seeds->GetNumberOfIds() : 0) << "\n";
+  os << indent << "UseCostArray: " << (this->UseCostArray ? "On\n" : "Off\n");
+  os << indent << "MaximumDistance: " << this->MaximumDistance << "\n";
+  os << indent << "DistanceArrayName: "
+     << (this->DistanceArrayName ? this->DistanceArrayName : "(none)") << "\n";
+  os << indent << "GeneratePaths: " << (this->GeneratePaths ? "On\n" : "Off\n");
+  os << indent << "PathTargets: " << (this->PathTargets ? this->PathTargets->GetNumberOfIds() : 0)
+     << "\n";
+  os << indent << "NumberOfIterations: " << this->NumberOfIterations << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkGeodesicDistanceFilter
+ * @brief   multi-source geodesic distance over images and triangle meshes
+ *
+ * vtkGeodesicDistanceFilter computes, for each point of its input, the length
+ * of the shortest path to the closest of a set of seed points, the path being
+ * constrained to the input. The input is either a vtkImageData, where the
+ * paths go through the voxels, or a vtkPolyData, where the paths go over the
+ * triangles. The distance is added to the point data of the output, that
+ * otherwise is a shallow copy of the input.
+ *
+ * The distance is the solution of the eikonal equation |grad(d)| = cost,
+ * where the cost is 1, or given by the point scalars when UseCostArray is
+ * on. A point with a cost that is not positive, or that is not a number, is
+ * an obstacle that the paths go around. On images, the equation is solved
+ * with the first order upwind scheme, using the spacing of each axis. On
+ * meshes, the front crosses each triangle as a plane wave from its two other
+ * vertices, so that the paths cross the triangles instead of following their
+ * edges. Polygons are split into fans of triangles, the other cells are
+ * ignored.
+ *
+ * Both are solved with the Fast Iterative Method of Jeong and Whitaker: the
+ * points of the front are updated together, in parallel with vtkSMPTools,
+ * until their distance does not decrease anymore, and the points next to the
+ * points that converged join the front. Unlike the serial heap of
+ * vtkDijkstraGraphGeodesicPath, any number of seeds is handled in one pass.
+ *
+ * When GeneratePaths is on, the second output is a vtkPolyData with one
+ * polyline per path target, from the target to its closest seed. The path
+ * goes from point to point of the input, following the neighbor of steepest
+ * descent of the distance (among the 26 neighbors of a voxel, or the points
+ * that share a triangle with a mesh point).
+ *
+ * @sa
+ * vtkDijkstraGraphGeodesicPath vtkDijkstraImageGeodesicPath vtkImageEuclideanDistance
+ */
+
+#ifndef vtkGeodesicDistanceFilter_h
+#define vtkGeodesicDistanceFilter_h
+
+#include "vtkDataSetAlgorithm.h"
+#include "vtkFiltersModelingModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkIdList;
+class vtkPolyData;
+
+class VTKFILTERSMODELING_EXPORT vtkGeodesicDistanceFilter : public vtkDataSetAlgorithm
+{
+public:
+  ///@{
+  /**
+   * Standard methods for construction, type and printing.
+   */
+  static vtkGeodesicDistanceFilter* New();
+  vtkTypeMacro(vtkGeodesicDistanceFilter, vtkDataSetAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * The ids of the input points where the distance is zero. It is empty by
+   * default.
+   */
+  virtual void SetSeeds(vtkIdList*);
+  vtkGetObjectMacro(Seeds, vtkIdList);
+  ///@}
+
+  ///@{
+  /**
+   * When on, the first array to process, the point scalars by default, gives
+   * the cost of a unit length at each point. Otherwise the cost is 1 at all
+   * the points, and the distance is a length. The default is off.
+   */
+  vtkSetMacro(UseCostArray, vtkTypeBool);
+  vtkGetMacro(UseCostArray, vtkTypeBool);
+  vtkBooleanMacro(UseCostArray, vtkTypeBool);
+  ///@}
+
+  ///@{
+  /**
+   * The front stops at this distance. The points that are farther, or that
+   * cannot be reached, get this distance. The default is VTK_DOUBLE_MAX.
+   */
+  vtkSetMacro(MaximumDistance, double);
+  vtkGetMacro(MaximumDistance, double);
+  ///@}
+
+  ///@{
+  /**
+   * The name of the point array of the distance. The default is
+   * "GeodesicDistance".
+   */
+  vtkSetStringMacro(DistanceArrayName);
+  vtkGetStringMacro(DistanceArrayName);
+  ///@}
+
+  ///@{
+  /**
+   * When on, the shortest paths from the path targets are output on the
+   * second port. The default is off.
+   */
+  vtkSetMacro(GeneratePaths, vtkTypeBool);
+  vtkGetMacro(GeneratePaths, vtkTypeBool);
+  vtkBooleanMacro(GeneratePaths, vtkTypeBool);
+  ///@}
+
+  ///@{
+  /**
+   * The ids of the input points from which the shortest paths start. The
+   * targets that are not reached have no path. It is empty by default.
+   */
+  virtual void SetPathTargets(vtkIdList*);
+  vtkGetObjectMacro(PathTargets, vtkIdList);
+  ///@}
+
+  /**
+   * Get the shortest paths, the output of the second port.
+   */
+  vtkPolyData* GetPathsOutput();
+
+  /**
+   * Get the number of updates of the front by the last execution.
+   */
+  vtkGetMacro(NumberOfIterations, int);
+
+  /**
+   * Include the modification times of the seeds and of the path targets.
+   */
+  vtkMTimeType GetMTime() override;
+
+protected:
+  vtkGeodesicDistanceFilter();
+  ~vtkGeodesicDistanceFilter() override;
+
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+  int FillOutputPortInformation(int port, vtkInformation* info) override;
+  int RequestDataObject(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  vtkIdList* Seeds;
+  vtkTypeBool UseCostArray;
+  double MaximumDistance;
+  char* DistanceArrayName;
+  vtkTypeBool GeneratePaths;
+  vtkIdList* PathTargets;
+  int NumberOfIterations;
+
+private:
+  vtkGeodesicDistanceFilter(const vtkGeodesicDistanceFilter&) = delete;
+  void operator=(const vtkGeodesicDistanceFilter&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -6,16 +6,20 @@
 #include "vtkCellArray.h"
 #include "vtkCellIterator.h"
 #include "vtkEdgeTable.h"
+#include "vtkHalfEdgeMesh.h"
 #include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkLoopSubdivisionFilter);
 
@@ -26,6 +30,48 @@ void vtkLoopSubdivisionFilter::PrintSelf(ostream& os, vtkIndent indent)
 
 static const double LoopWeights[4] = { .375, .375, .125, .125 };
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Build the half-edges of the input when its cells are triangles forming a
+// manifold, consistently oriented surface, where the triangles around each
+// point are a single fan. The neighbors walked by the cell links are then
+// those of the half-edges.
+bool BuildManifoldTriangles(vtkPolyData* input, vtkHalfEdgeMesh* mesh)
+{
+  vtkCellArray* polys = input->GetPolys();
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  if (input->GetNumberOfCells() != polys->GetNumberOfCells() || polys->IsHomogeneous() != 3 ||
+    !mesh->BuildFromPolys(polys, numPts) || mesh->GetNumberOfNonManifoldEdges() != 0)
+  {
+    return false;
+  }
+
+  std::vector<vtkIdType> numCells(numPts, 0);
+  const vtkIdType* pts;
+  vtkIdType npts;
+  for (polys->InitTraversal(); polys->GetNextCell(npts, pts);)
+  {
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      ++numCells[pts[i]];
+    }
+  }
+  vtkNew<vtkIdList> ring;
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    mesh->GetVertexNeighbors(ptId, ring);
+    const vtkIdType numFanCells =
+      ring->GetNumberOfIds() - (mesh->IsBoundaryVertex(ptId) ? 1 : 0);
+    if (numCells[ptId] != 0 && numFanCells != numCells[ptId])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
 //------------------------------------------------------------------------------
 int vtkLoopSubdivisionFilter::GenerateSubdivisionPoints(
   vtkPolyData* inputDS, vtkIntArray* edgeData, vtkPoints* outputPts, vtkPointData* outputPD)
@@ -42,6 +88,12 @@ int vtkLoopSubdivisionFilter::GenerateSubdivisionPoints(
   vtkPoints* inputPts = inputDS->GetPoints();
   vtkPointData* inputPD = inputDS->GetPointData();
 
+  vtkNew<vtkHalfEdgeMesh> mesh;
+  if (BuildManifoldTriangles(inputDS, mesh))
+  {
+    return this->GenerateHalfEdgeSubdivisionPoints(mesh, inputDS, edgeData, outputPts, outputPD);
+  }
+
   double weights[256];
   bool abort = false;
 
@@ -126,6 +178,116 @@ int vtkLoopSubdivisionFilter::GenerateSubdivisionPoints(
   return 1;
 }
 
+//------------------------------------------------------------------------------
+int vtkLoopSubdivisionFilter::GenerateHalfEdgeSubdivisionPoints(vtkHalfEdgeMesh* mesh,
+  vtkPolyData* inputDS, vtkIntArray* edgeData, vtkPoints* outputPts, vtkPointData* outputPD)
+{
+  vtkPoints* inputPts = inputDS->GetPoints();
+  vtkPointData* inputPD = inputDS->GetPointData();
+  vtkNew<vtkIdList> stencil;
+  double weights[256];
+
+  // Generate even points from the one-ring of the old points
+  const vtkIdType numPts = inputDS->GetNumberOfPoints();
+  for (vtkIdType ptId = 0; ptId < numPts; ptId++)
+  {
+    if (this->CheckAbort())
+    {
+      return 1;
+    }
+    if (mesh->GetVertexEdge(ptId) < 0)
+    {
+      vtkWarningMacro("numCellsInLoop < 1: 0");
+      return 0;
+    }
+    mesh->GetVertexNeighbors(ptId, stencil);
+    const vtkIdType K = stencil->GetNumberOfIds();
+    if (mesh->IsBoundaryVertex(ptId))
+    {
+      // The ring goes from one boundary neighbor to the other
+      const vtkIdType bp1 = stencil->GetId(0);
+      const vtkIdType bp2 = stencil->GetId(K - 1);
+      stencil->SetNumberOfIds(3);
+      stencil->SetId(0, bp1);
+      stencil->SetId(1, bp2);
+      stencil->SetId(2, ptId);
+      weights[0] = .125;
+      weights[1] = .125;
+      weights[2] = .75;
+    }
+    else
+    {
+      double beta = 3.0 / 16.0;
+      if (K > 3)
+      {
+        double cosSQ = .375 + .25 * cos(2.0 * vtkMath::Pi() / static_cast<double>(K));
+        cosSQ = cosSQ * cosSQ;
+        beta = (.625 - cosSQ) / static_cast<double>(K);
+      }
+      for (vtkIdType j = 0; j < K; j++)
+      {
+        weights[j] = beta;
+      }
+      weights[K] = 1.0 - K * beta;
+      stencil->InsertNextId(ptId);
+    }
+    this->InterpolatePosition(inputPts, outputPts, stencil, weights);
+    outputPD->InterpolatePoint(inputPD, ptId, stencil, weights);
+  }
+
+  // Generate odd points. Edge edgeId of a cell goes from its point
+  // (edgeId + 2) % 3 to its point edgeId, i.e. it is its half-edge
+  // (edgeId + 2) % 3. As with the edge table of the cell links path, the
+  // point of an edge is created by the first cell using it, so that both
+  // paths number the new points the same way.
+  const vtkIdType numCells = mesh->GetNumberOfFaces();
+  for (vtkIdType cellId = 0; cellId < numCells; cellId++)
+  {
+    if (this->CheckAbort())
+    {
+      break;
+    }
+    const vtkIdType firstEdge = mesh->GetFaceEdge(cellId);
+    for (int edgeId = 0; edgeId < 3; edgeId++)
+    {
+      const vtkIdType edge = firstEdge + (edgeId + 2) % 3;
+      const vtkIdType twin = mesh->GetTwin(edge);
+      vtkIdType newId;
+      if (twin < 0 || mesh->GetFace(twin) > cellId)
+      {
+        stencil->SetNumberOfIds(2);
+        stencil->SetId(0, mesh->GetOrigin(edge));
+        stencil->SetId(1, mesh->GetDestination(edge));
+        if (twin < 0)
+        {
+          weights[0] = .5;
+          weights[1] = .5;
+        } // boundary edge
+        else
+        {
+          stencil->InsertNextId(mesh->GetOrigin(mesh->GetPrevious(edge)));
+          stencil->InsertNextId(mesh->GetOrigin(mesh->GetPrevious(twin)));
+          for (int i = 0; i < 4; i++)
+          {
+            weights[i] = LoopWeights[i];
+          }
+        }
+        newId = this->InterpolatePosition(inputPts, outputPts, stencil, weights);
+        outputPD->InterpolatePoint(inputPD, newId, stencil, weights);
+      }
+      else // the point was created by the neighbor
+      {
+        const vtkIdType twinFace = mesh->GetFace(twin);
+        const vtkIdType twinEdgeId = (twin - mesh->GetFaceEdge(twinFace) + 1) % 3;
+        newId = static_cast<vtkIdType>(edgeData->GetComponent(twinFace, twinEdgeId));
+      }
+      edgeData->InsertComponent(cellId, edgeId, newId);
+    }
+  }
+
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 int vtkLoopSubdivisionFilter::GenerateEvenStencil(
   vtkIdType p1, vtkPolyData* polys, vtkIdList* stencilIds, double* weights)
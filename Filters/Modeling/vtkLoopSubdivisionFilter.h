@@ -22,13 +22,18 @@
  * The filter approximates point data using the same scheme. New
  * triangles create at a subdivision step will have the cell data of
  * their parent cell.
+ * <P>
+ * When the triangles form a manifold surface with a consistent
+ * orientation, the neighbors of the points and edges are found with a
+ * vtkHalfEdgeMesh built at each subdivision step. Other meshes use the
+ * cell links of the input, which give the same points.
  *
  * @par Thanks:
  * This work was supported by PHS Research Grant No. 1 P41 RR13218-01
  * from the National Center for Research Resources.
  *
  * @sa
- * vtkApproximatingSubdivisionFilter
+ * vtkApproximatingSubdivisionFilter vtkHalfEdgeMesh
  */
 
 #ifndef vtkLoopSubdivisionFilter_h
@@ -42,6 +47,7 @@ class vtkPolyData;
 class vtkIntArray;
 class vtkPoints;
 class vtkIdList;
+class vtkHalfEdgeMesh;
 
 class VTKFILTERSMODELING_EXPORT vtkLoopSubdivisionFilter : public vtkApproximatingSubdivisionFilter
 {
@@ -65,6 +71,11 @@ protected:
   void GenerateOddStencil(
     vtkIdType p1, vtkIdType p2, vtkPolyData* polys, vtkIdList* stencilIds, double* weights);
 
+  // Same as GenerateSubdivisionPoints(), the neighbors being given by the
+  // half-edges of a manifold, consistently oriented triangle mesh.
+  int GenerateHalfEdgeSubdivisionPoints(vtkHalfEdgeMesh* mesh, vtkPolyData* inputDS,
+    vtkIntArray* edgeData, vtkPoints* outputPts, vtkPointData* outputPD);
+
   int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
 private:
@@ -3,10 +3,12 @@
 
 #include <vtkXMLUniformGridAMRWriter.h>
 
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCellIterator.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkConduitSource.h"
+#include "vtkIdList.h"
 #include "vtkImageData.h"
 #include "vtkLogger.h"
 #include "vtkMultiProcessController.h"
@@ -14,6 +16,7 @@
 #include "vtkOverlappingAMR.h"
 #include "vtkPartitionedDataSet.h"
 #include "vtkPointData.h"
+#include "vtkPoints.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredGrid.h"
@@ -767,6 +770,12 @@ bool ValidateMeshTypeMixed2D()
   VERIFY(ug->GetNumberOfCells() == 24, "expected 24 cells, got %lld", ug->GetNumberOfCells());
   VERIFY(ug->GetNumberOfPoints() == 25, "Expected 25 points, got %lld", ug->GetNumberOfPoints());
 
+  // the connectivity is used without copy
+  const void* connectivity = mesh["topologies/mesh/elements/connectivity"].element_ptr(0);
+  VERIFY(!ug->GetCells()->IsStorage64Bit() &&
+      ug->GetCells()->GetConnectivityArray32()->GetPointer(0) == connectivity,
+    "expected the elements connectivity to be used as is");
+
   // check cell types
   const auto it = vtkSmartPointer<vtkCellIterator>::Take(ug->NewCellIterator());
   int nTris(0), nQuads(0);
@@ -1060,6 +1069,84 @@ bool ValidateMeshTypeMixed()
   return true;
 }
 
+void CreateStridedTrisMesh(unsigned int nptsX, unsigned int nptsY,
+  std::vector<double>& xyzw, std::vector<conduit_int16>& connectivity, conduit_cpp::Node& res)
+{
+  // coordinates interleaved with an extra padding component
+  const unsigned int npts = nptsX * nptsY;
+  xyzw.resize(4 * npts);
+  for (unsigned int j = 0; j < nptsY; ++j)
+  {
+    for (unsigned int i = 0; i < nptsX; ++i)
+    {
+      const unsigned int idx = i + j * nptsX;
+      xyzw[4 * idx + 0] = i;
+      xyzw[4 * idx + 1] = j;
+      xyzw[4 * idx + 2] = 0.5;
+      xyzw[4 * idx + 3] = -1.0;
+    }
+  }
+  conduit_cpp::Node coords = res["coordsets/coords"];
+  coords["type"] = "explicit";
+  const conduit_index_t stride = 4 * sizeof(double);
+  coords["values/x"].set_external_float64_ptr(xyzw.data(), npts, 0, stride);
+  coords["values/y"].set_external_float64_ptr(xyzw.data(), npts, sizeof(double), stride);
+  coords["values/z"].set_external_float64_ptr(xyzw.data(), npts, 2 * sizeof(double), stride);
+
+  // 16-bit connectivity
+  connectivity.clear();
+  for (unsigned int j = 0; j + 1 < nptsY; ++j)
+  {
+    for (unsigned int i = 0; i + 1 < nptsX; ++i)
+    {
+      const conduit_int16 p0 = static_cast<conduit_int16>(i + j * nptsX);
+      const conduit_int16 p1 = static_cast<conduit_int16>(p0 + 1);
+      const conduit_int16 p2 = static_cast<conduit_int16>(p0 + nptsX + 1);
+      const conduit_int16 p3 = static_cast<conduit_int16>(p0 + nptsX);
+      connectivity.insert(connectivity.end(), { p0, p1, p2, p0, p2, p3 });
+    }
+  }
+  res["topologies/mesh/type"] = "unstructured";
+  res["topologies/mesh/coordset"] = "coords";
+  res["topologies/mesh/elements/shape"] = "tri";
+  res["topologies/mesh/elements/connectivity"].set_external_int16_ptr(
+    connectivity.data(), connectivity.size());
+}
+
+bool ValidateStridedLayouts()
+{
+  conduit_cpp::Node mesh;
+  std::vector<double> xyzw;
+  std::vector<conduit_int16> connectivity;
+  CreateStridedTrisMesh(4, 3, xyzw, connectivity, mesh);
+  const auto data = Convert(mesh);
+
+  auto pds = vtkPartitionedDataSet::SafeDownCast(data);
+  VERIFY(pds != nullptr && pds->GetNumberOfPartitions() == 1, "expected one partition");
+  auto ug = vtkUnstructuredGrid::SafeDownCast(pds->GetPartition(0));
+  VERIFY(ug != nullptr, "missing partition 0");
+  VERIFY(ug->GetNumberOfPoints() == 12, "expected 12 points, got %lld", ug->GetNumberOfPoints());
+  VERIFY(ug->GetNumberOfCells() == 12, "expected 12 cells, got %lld", ug->GetNumberOfCells());
+
+  // the padded coordinates are read in place
+  VERIFY(!ug->GetPoints()->GetData()->HasStandardMemoryLayout(),
+    "expected the coordinates to be used without copy");
+  double pt[3];
+  ug->GetPoint(6, pt);
+  VERIFY(pt[0] == 2 && pt[1] == 1 && pt[2] == 0.5, "wrong point 6 (%g, %g, %g)", pt[0], pt[1],
+    pt[2]);
+
+  // the 16-bit connectivity is converted to 32-bit storage
+  VERIFY(!ug->GetCells()->IsStorage64Bit(), "expected 32-bit cell storage");
+  vtkNew<vtkIdList> ptIds;
+  ug->GetCellPoints(5, ptIds);
+  VERIFY(ptIds->GetNumberOfIds() == 3 && ptIds->GetId(0) == 2 && ptIds->GetId(1) == 7 &&
+      ptIds->GetId(2) == 6,
+    "wrong points for cell 5");
+
+  return true;
+}
+
 } // end namespace
 
 int TestConduitSource(int argc, char** argv)
@@ -1079,7 +1166,7 @@ int TestConduitSource(int argc, char** argv)
       ValidateMeshTypeStructured() && ValidateMeshTypeUnstructured() && ValidateFieldData() &&
       ValidateRectilinearGridWithDifferentDimensions() && Validate1DRectilinearGrid() &&
       ValidateMeshTypeMixed() && ValidateMeshTypeMixed2D() && ValidateMeshTypeAMR(amrFile) &&
-      ValidateAscentGhostCellData() && ValidateAscentGhostPointData()
+      ValidateAscentGhostCellData() && ValidateAscentGhostPointData() && ValidateStridedLayouts()
 
     ? EXIT_SUCCESS
     : EXIT_FAILURE;
@@ -4,9 +4,12 @@
 
 #include "vtkArrayDispatch.h"
 #include "vtkCellArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataSetAttributes.h"
+#include "vtkImplicitArray.h"
 #include "vtkLogger.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkSOADataArrayTemplate.h"
 #include "vtkTypeFloat32Array.h"
 #include "vtkTypeFloat64Array.h"
@@ -22,6 +25,9 @@
 #include <catalyst_conduit.hpp>
 #include <catalyst_conduit_blueprint.hpp>
 
+#include <atomic>
+#include <cstring>
+#include <limits>
 #include <vector>
 
 namespace internals
@@ -42,6 +48,22 @@ using SOAArrays = vtkTypeList::Unique<
     vtkSOADataArrayTemplate<vtkTypeUInt32>, vtkSOADataArrayTemplate<vtkTypeUInt64>,
     vtkSOADataArrayTemplate<vtkTypeFloat32>, vtkSOADataArrayTemplate<vtkTypeFloat64>>>::Result;
 
+// true if the values of the node are packed, i.e. without stride or padding
+bool is_packed(const conduit_cpp::Node& node)
+{
+  const conduit_cpp::DataType dtype = node.dtype();
+  return dtype.number_of_elements() <= 1 || dtype.stride() == dtype.element_bytes();
+}
+
+// true if all the components of the mcarray are interleaved without padding
+bool is_packed_interleaved(const conduit_cpp::Node& mcarray)
+{
+  const conduit_cpp::DataType dtype0 = mcarray.child(0).dtype();
+  const conduit_index_t nchildren = mcarray.number_of_children();
+  return dtype0.number_of_elements() <= 1 ||
+    dtype0.stride() == static_cast<conduit_index_t>(nchildren * dtype0.element_bytes());
+}
+
 bool is_contiguous(const conduit_cpp::Node& node)
 {
   if (node.is_contiguous())
@@ -85,6 +107,202 @@ vtkSmartPointer<vtkSOADataArrayTemplate<ValueT>> CreateSOArray(
   return array;
 }
 
+//----------------------------------------------------------------------------
+// internal: implicit array backend reading the components of a conduit mcarray
+// in place, with any stride and alignment.
+template <typename ValueT>
+struct StridedBackend
+{
+  std::vector<const unsigned char*> Components;
+  std::vector<vtkIdType> Strides;
+
+  StridedBackend(const std::vector<const unsigned char*>& components,
+    const std::vector<vtkIdType>& strides)
+    : Components(components)
+    , Strides(strides)
+  {
+  }
+
+  ValueT mapComponent(vtkIdType tupleIdx, int comp) const
+  {
+    ValueT value;
+    std::memcpy(&value, this->Components[comp] + tupleIdx * this->Strides[comp], sizeof(ValueT));
+    return value;
+  }
+
+  ValueT map(vtkIdType idx) const
+  {
+    const int numComps = static_cast<int>(this->Components.size());
+    return this->mapComponent(idx / numComps, static_cast<int>(idx % numComps));
+  }
+};
+
+template <typename ValueT>
+vtkSmartPointer<vtkDataArray> CreateStridedArray(vtkIdType number_of_tuples,
+  const std::vector<const unsigned char*>& components, const std::vector<vtkIdType>& strides)
+{
+  auto array = vtkSmartPointer<vtkImplicitArray<StridedBackend<ValueT>>>::New();
+  array->ConstructBackend(components, strides);
+  array->SetNumberOfComponents(static_cast<int>(components.size()));
+  array->SetNumberOfTuples(number_of_tuples);
+  return array;
+}
+
+//----------------------------------------------------------------------------
+// internal: parallel copy of the values of any single component array.
+struct CopyValuesImpl
+{
+  template <typename InArrayT, typename OutValueT>
+  void operator()(InArrayT* input, OutValueT* output)
+  {
+    const auto values = vtk::DataArrayValueRange<1>(input);
+    vtkSMPTools::For(0, values.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        output[cc] = static_cast<OutValueT>(values[cc]);
+      }
+    });
+  }
+};
+
+template <typename ArrayT>
+vtkSmartPointer<vtkDataArray> CopyToCellArrayStorage(vtkDataArray* array)
+{
+  auto result = vtkSmartPointer<ArrayT>::New();
+  result->SetNumberOfValues(array->GetNumberOfValues());
+  CopyValuesImpl worker;
+  if (!vtkArrayDispatch::Dispatch::Execute(array, worker, result->GetPointer(0)))
+  {
+    worker(array, result->GetPointer(0));
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+// internal: true if both the values of the array and the offsets of a cell
+// array using it as connectivity can be stored in 32 bits.
+bool FitsInt32(vtkDataArray* array)
+{
+  using Limits = std::numeric_limits<vtkTypeInt32>;
+  if (array->GetNumberOfValues() >= static_cast<vtkIdType>(Limits::max()))
+  {
+    return false;
+  }
+  if (vtkArrayDownCast<vtkTypeInt32Array>(array) || array->GetDataTypeSize() < 4)
+  {
+    return true;
+  }
+  // unsigned, floating point or 64-bit values may be out of range.
+  double range[2];
+  array->GetRange(range, 0);
+  return range[0] >= Limits::min() && range[1] <= Limits::max();
+}
+
+//----------------------------------------------------------------------------
+// internal: return the array as is if vtkCellArray can use it, otherwise a copy
+// in the narrowest storage able to address its values.
+vtkSmartPointer<vtkDataArray> ToCellArrayStorage(vtkDataArray* array)
+{
+  if (!array || array->GetNumberOfComponents() != 1)
+  {
+    return nullptr;
+  }
+  if (vtkArrayDownCast<vtkTypeInt64Array>(array))
+  {
+    return array;
+  }
+  if (!FitsInt32(array))
+  {
+    return CopyToCellArrayStorage<vtkTypeInt64Array>(array);
+  }
+  if (vtkArrayDownCast<vtkTypeInt32Array>(array))
+  {
+    return array;
+  }
+  return CopyToCellArrayStorage<vtkTypeInt32Array>(array);
+}
+
+//----------------------------------------------------------------------------
+// internal: offsets of a vtkCellArray from the offsets and/or sizes of an O2M relation.
+// Returns false if the O2M elements are not stored contiguously in the same order as
+// the cells, in which case its connectivity cannot be used as is.
+template <typename ArrayT>
+bool CompactOffsets(ArrayT* offsets, vtkIdType connectivitySize, vtkDataArray* o2mOffsets,
+  vtkDataArray* o2mSizes)
+{
+  using ValueT = typename ArrayT::ValueType;
+  const vtkIdType nCells = offsets->GetNumberOfValues() - 1;
+  ValueT* out = offsets->GetPointer(0);
+
+  if (!o2mOffsets)
+  {
+    // sizes only: the elements are contiguous by definition.
+    const auto inSizes = vtk::DataArrayValueRange<1>(o2mSizes);
+    out[0] = 0;
+    for (vtkIdType cc = 0; cc < nCells; ++cc)
+    {
+      out[cc + 1] = out[cc] + static_cast<ValueT>(inSizes[cc]);
+    }
+    return out[nCells] == static_cast<ValueT>(connectivitySize);
+  }
+
+  const auto inOffsets = vtk::DataArrayValueRange<1>(o2mOffsets);
+  vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      out[cc] = static_cast<ValueT>(inOffsets[cc]);
+    }
+  });
+  out[nCells] = static_cast<ValueT>(connectivitySize);
+
+  // the elements must follow each other and cover the whole connectivity.
+  std::atomic<bool> compact(nCells == 0 || out[0] == 0);
+  if (o2mSizes)
+  {
+    const auto inSizes = vtk::DataArrayValueRange<1>(o2mSizes);
+    vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end && compact; ++cc)
+      {
+        if (out[cc] + static_cast<ValueT>(inSizes[cc]) != out[cc + 1])
+        {
+          compact = false;
+        }
+      }
+    });
+  }
+  else
+  {
+    vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end && compact; ++cc)
+      {
+        if (out[cc] > out[cc + 1])
+        {
+          compact = false;
+        }
+      }
+    });
+  }
+  return compact;
+}
+
+//----------------------------------------------------------------------------
+// internal: vtkCellArray using the connectivity array as is, if the O2M relation allows it.
+template <typename ArrayT>
+vtkSmartPointer<vtkCellArray> CreateCompactCellArray(
+  ArrayT* connectivity, vtkIdType nCells, vtkDataArray* o2mOffsets, vtkDataArray* o2mSizes)
+{
+  vtkNew<ArrayT> offsets;
+  offsets->SetNumberOfValues(nCells + 1);
+  if (!CompactOffsets(
+        offsets.GetPointer(), connectivity->GetNumberOfValues(), o2mOffsets, o2mSizes))
+  {
+    return nullptr;
+  }
+  auto cellArray = vtkSmartPointer<vtkCellArray>::New();
+  cellArray->SetData(offsets, connectivity);
+  return cellArray;
+}
+
 //----------------------------------------------------------------------------
 // internal: change components helper.
 struct ChangeComponentsAOSImpl
@@ -314,12 +532,19 @@ vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
     }
   }
 
-  if (conduit_cpp::BlueprintMcArray::is_interleaved(mcarray))
+  bool packed = true;
+  for (conduit_index_t cc = 0; cc < mcarray.number_of_children(); ++cc)
+  {
+    packed &= internals::is_packed(mcarray.child(cc));
+  }
+
+  if (conduit_cpp::BlueprintMcArray::is_interleaved(mcarray) &&
+    internals::is_packed_interleaved(mcarray))
   {
     return vtkConduitArrayUtilities::MCArrayToVTKAOSArray(
       conduit_cpp::c_node(&mcarray), force_signed);
   }
-  else if (internals::is_contiguous(mcarray))
+  else if (packed && internals::is_contiguous(mcarray))
   {
     return vtkConduitArrayUtilities::MCArrayToVTKSOAArray(
       conduit_cpp::c_node(&mcarray), force_signed);
@@ -331,12 +556,10 @@ vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
   }
   else
   {
-    // TODO: we can do a deep-copy in this case, so we can still handle it quite easily when needed.
-    vtkLogF(ERROR, "unsupported array layout.");
-    return nullptr;
+    // strided components, or interleaved with padding: read in place.
+    return vtkConduitArrayUtilities::MCArrayToVTKStridedArray(
+      conduit_cpp::c_node(&mcarray), force_signed);
   }
-
-  return nullptr;
 }
 
 //----------------------------------------------------------------------------
@@ -452,6 +675,64 @@ vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::MCArrayToVTKSOAArray(
   }
 }
 
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::MCArrayToVTKStridedArray(
+  const conduit_node* c_mcarray, bool force_signed)
+{
+  const conduit_cpp::Node mcarray = conduit_cpp::cpp_node(const_cast<conduit_node*>(c_mcarray));
+  const conduit_cpp::DataType dtype0 = mcarray.child(0).dtype();
+  const int num_components = static_cast<int>(mcarray.number_of_children());
+  const vtkIdType num_tuples = static_cast<vtkIdType>(dtype0.number_of_elements());
+
+  std::vector<const unsigned char*> ptrs;
+  std::vector<vtkIdType> strides;
+  ptrs.reserve(num_components);
+  strides.reserve(num_components);
+  for (int cc = 0; cc < num_components; ++cc)
+  {
+    const auto child = mcarray.child(cc);
+    ptrs.push_back(reinterpret_cast<const unsigned char*>(child.element_ptr(0)));
+    strides.push_back(static_cast<vtkIdType>(child.dtype().stride()));
+  }
+
+  switch (internals::GetTypeId(dtype0.id(), force_signed))
+  {
+    case conduit_cpp::DataType::Id::int8:
+      return internals::CreateStridedArray<vtkTypeInt8>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::int16:
+      return internals::CreateStridedArray<vtkTypeInt16>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::int32:
+      return internals::CreateStridedArray<vtkTypeInt32>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::int64:
+      return internals::CreateStridedArray<vtkTypeInt64>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::uint8:
+      return internals::CreateStridedArray<vtkTypeUInt8>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::uint16:
+      return internals::CreateStridedArray<vtkTypeUInt16>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::uint32:
+      return internals::CreateStridedArray<vtkTypeUInt32>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::uint64:
+      return internals::CreateStridedArray<vtkTypeUInt64>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::float32:
+      return internals::CreateStridedArray<vtkTypeFloat32>(num_tuples, ptrs, strides);
+
+    case conduit_cpp::DataType::Id::float64:
+      return internals::CreateStridedArray<vtkTypeFloat64>(num_tuples, ptrs, strides);
+
+    default:
+      vtkLogF(ERROR, "unsupported data type '%s' ", dtype0.name().c_str());
+      return nullptr;
+  }
+}
+
 //----------------------------------------------------------------------------
 vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::SetNumberOfComponents(
   vtkDataArray* array, int num_components)
@@ -465,10 +746,32 @@ vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::SetNumberOfComponents(
   {
     return internals::ChangeComponentsAOS(array, num_components);
   }
-  else
+  else if (array->GetArrayType() == vtkAbstractArray::SoADataArrayTemplate)
   {
     return internals::ChangeComponentsSOA(array, num_components);
   }
+  else
+  {
+    // read-only arrays, e.g. strided: copy to an AOS array with the requested components.
+    vtkSmartPointer<vtkDataArray> aos;
+    aos.TakeReference(vtkDataArray::CreateDataArray(array->GetDataType()));
+    aos->SetName(array->GetName());
+    aos->SetNumberOfComponents(num_components);
+    aos->SetNumberOfTuples(array->GetNumberOfTuples());
+    const int numComps = std::min(num_components, array->GetNumberOfComponents());
+    for (int cc = 0; cc < num_components; ++cc)
+    {
+      if (cc < numComps)
+      {
+        aos->CopyComponent(cc, array, cc);
+      }
+      else
+      {
+        aos->FillComponent(cc, 0);
+      }
+    }
+    return aos;
+  }
 }
 
 struct NoOp
@@ -483,18 +786,26 @@ struct NoOp
 vtkSmartPointer<vtkCellArray> vtkConduitArrayUtilities::MCArrayToVTKCellArray(
   vtkIdType cellSize, const conduit_node* mcarray)
 {
-  auto array = vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(mcarray, /*force_signed*/ true);
+  auto array = vtkConduitArrayUtilities::MCArrayToVTKCellArrayStorage(mcarray);
   if (!array)
   {
     return nullptr;
   }
 
-  // now the array matches the type accepted by vtkCellArray (in most cases).
+  // now the array matches the type accepted by vtkCellArray.
   vtkNew<vtkCellArray> cellArray;
-  cellArray->SetData(cellSize, array);
+  cellArray->SetFixedSizeData(cellSize, array);
   return cellArray;
 }
 
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::MCArrayToVTKCellArrayStorage(
+  const conduit_node* mcarray)
+{
+  auto array = vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(mcarray, /*force_signed*/ true);
+  return internals::ToCellArrayStorage(array);
+}
+
 VTK_ABI_NAMESPACE_END
 
 namespace
@@ -553,17 +864,56 @@ vtkSmartPointer<vtkCellArray> vtkConduitArrayUtilities::O2MRelationToVTKCellArra
     return nullptr;
   }
 
-  if (o2mrelation.has_child("indices"))
+  const bool has_indices = o2mrelation.has_child("indices");
+  if (has_indices)
   {
     vtkLogF(WARNING, "'indices' in a O2MRelation are currently ignored.");
   }
 
-  const auto node_sizes = o2mrelation["sizes"];
-  auto sizes = vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
-    conduit_cpp::c_node(&node_sizes), /*force_signed*/ true);
-  const auto node_offsets = o2mrelation["offsets"];
-  auto offsets = vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
-    conduit_cpp::c_node(&node_offsets), /*force_signed*/ true);
+  vtkSmartPointer<vtkDataArray> sizes, offsets;
+  if (o2mrelation.has_child("sizes"))
+  {
+    const auto node_sizes = o2mrelation["sizes"];
+    sizes = vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
+      conduit_cpp::c_node(&node_sizes), /*force_signed*/ true);
+  }
+  if (o2mrelation.has_child("offsets"))
+  {
+    const auto node_offsets = o2mrelation["offsets"];
+    offsets = vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
+      conduit_cpp::c_node(&node_offsets), /*force_signed*/ true);
+  }
+  if (!sizes && !offsets)
+  {
+    vtkLogF(ERROR, "O2MRelation requires 'sizes' or 'offsets'.");
+    return nullptr;
+  }
+
+  // When the elements are stored in order and without gaps, which is the common case,
+  // the connectivity is used as is and only the offsets are created.
+  if (!has_indices)
+  {
+    const vtkIdType nCells = (sizes ? sizes : offsets)->GetNumberOfTuples();
+    auto storage = internals::ToCellArrayStorage(elements);
+    vtkSmartPointer<vtkCellArray> cellArray;
+    if (auto conn32 = vtkArrayDownCast<vtkTypeInt32Array>(storage))
+    {
+      cellArray = internals::CreateCompactCellArray(conn32, nCells, offsets, sizes);
+    }
+    else if (auto conn64 = vtkArrayDownCast<vtkTypeInt64Array>(storage))
+    {
+      cellArray = internals::CreateCompactCellArray(conn64, nCells, offsets, sizes);
+    }
+    if (cellArray)
+    {
+      return cellArray;
+    }
+  }
+  if (!sizes || !offsets)
+  {
+    vtkLogF(ERROR, "non-contiguous O2MRelation requires both 'sizes' and 'offsets'.");
+    return nullptr;
+  }
 
   O2MRelationToVTKCellArrayWorker worker;
 
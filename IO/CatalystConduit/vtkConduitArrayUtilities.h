@@ -6,9 +6,14 @@
  * @ingroup Insitu
  *
  * vtkConduitArrayUtilities is intended to convert Conduit nodes satisfying the
- * `mcarray` protocol to VTK arrays. It uses zero-copy, as much as possible.
- * Currently implementation fails if zero-copy is not possible. In future, that
- * may be changed to do a deep-copy (with appropriate warnings) if necessary.
+ * `mcarray` protocol to VTK arrays. It uses zero-copy, as much as possible:
+ * interleaved components are wrapped in AOS arrays, contiguous components in
+ * vtkSOADataArrayTemplate and strided or padded components in read-only implicit
+ * arrays reading the Conduit memory in place.
+ *
+ * Connectivity arrays are used as vtkCellArray storage without copy when their
+ * values are 32 or 64-bit integers stored contiguously. Narrower or strided index
+ * arrays are converted to the narrowest vtkCellArray storage able to hold them.
  *
  * This is primarily designed for use by vtkConduitSource.
  */
@@ -62,6 +67,14 @@ public:
   static vtkSmartPointer<vtkCellArray> MCArrayToVTKCellArray(
     vtkIdType cellSize, const conduit_node* mcarray);
 
+  /**
+   * Returns a single component vtkTypeInt32Array or vtkTypeInt64Array, usable as
+   * vtkCellArray connectivity or offsets, from a conduit node in the mcarray protocol.
+   * The Conduit memory is used directly when possible, otherwise the values are
+   * copied in parallel, using 32-bit storage when it is large enough.
+   */
+  static vtkSmartPointer<vtkDataArray> MCArrayToVTKCellArrayStorage(const conduit_node* mcarray);
+
   /**
    * If the number of components in the array does not match the target, a new
    * array is created.
@@ -70,7 +83,12 @@ public:
     vtkDataArray* array, int num_components);
 
   /**
-   * Read a O2MRelation element
+   * Read a O2MRelation element.
+   *
+   * When the elements are stored contiguously and in order, which is the case for
+   * most simulation codes, the leaf array is used as the vtkCellArray connectivity
+   * without copy and only the offsets are created. 'offsets' or 'sizes' may then be
+   * omitted. Other relations are copied.
    */
   static vtkSmartPointer<vtkCellArray> O2MRelationToVTKCellArray(
     const conduit_node* o2mrelation, const std::string& leafname);
@@ -85,6 +103,8 @@ protected:
     const conduit_node* mcarray, bool force_signed);
   static vtkSmartPointer<vtkDataArray> MCArrayToVTKSOAArray(
     const conduit_node* mcarray, bool force_signed);
+  static vtkSmartPointer<vtkDataArray> MCArrayToVTKStridedArray(
+    const conduit_node* mcarray, bool force_signed);
 
 private:
   vtkConduitArrayUtilities(const vtkConduitArrayUtilities&) = delete;
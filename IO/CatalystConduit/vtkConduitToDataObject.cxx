@@ -3,13 +3,15 @@
 #include "vtkConduitToDataObject.h"
 
 #include "vtkAMRBox.h"
-#include "vtkArrayDispatch.h"
-#include "vtkCellArrayIterator.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkConduitArrayUtilities.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkDataSetAttributes.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkLogger.h"
@@ -18,16 +20,172 @@
 #include "vtkParallelAMRUtilities.h"
 #include "vtkPartitionedDataSet.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStringArray.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUniformGrid.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
 #include <catalyst_conduit.hpp>
 #include <catalyst_conduit_blueprint.hpp>
 
+#include <algorithm>
 #include <numeric>
-#include <set>
+#include <vector>
+
+namespace
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+//----------------------------------------------------------------------------
+// Cell types of a mixed topology. The shape ids are the VTK cell types, the
+// shapes array is used as is when it is already stored as unsigned char.
+vtkSmartPointer<vtkUnsignedCharArray> CreateCellTypes(const conduit_cpp::Node& shapes)
+{
+  auto array = vtkConduitArrayUtilities::MCArrayToVTKArray(conduit_cpp::c_node(&shapes));
+  if (array == nullptr || array->GetNumberOfComponents() != 1)
+  {
+    throw std::runtime_error("elements/shapes not available (nullptr)");
+  }
+  if (auto types = vtkArrayDownCast<vtkUnsignedCharArray>(array))
+  {
+    return types;
+  }
+
+  auto types = vtkSmartPointer<vtkUnsignedCharArray>::New();
+  types->SetNumberOfValues(array->GetNumberOfValues());
+  unsigned char* out = types->GetPointer(0);
+  vtkDataArray* in = array;
+  vtkSMPTools::For(0, array->GetNumberOfValues(), [&](vtkIdType begin, vtkIdType end) {
+    const auto values = vtk::DataArrayValueRange<1>(in, begin, end);
+    std::transform(values.cbegin(), values.cend(), out + begin,
+      [](double value) { return static_cast<unsigned char>(value); });
+  });
+  return types;
+}
+
+//----------------------------------------------------------------------------
+// Point connectivity and face locations of a topology with polyhedra. For the
+// polyhedral cells, 'elements' lists face ids in 'faces' and the points of the
+// cell are the sorted unique points of its faces. The other cells use their
+// 'elements' as is. Cells are processed in parallel in two passes: sizes, then
+// values at their prefix-summed offsets.
+class PolyhedralCellsBuilder
+{
+public:
+  PolyhedralCellsBuilder(const unsigned char* types, vtkCellArray* elements, vtkCellArray* faces)
+    : Types(types)
+    , Elements(elements)
+    , Faces(faces)
+  {
+  }
+
+  void Build(vtkCellArray* connectivity, vtkCellArray* faceLocations)
+  {
+    const vtkIdType nCells = this->Elements->GetNumberOfCells();
+    vtkNew<vtkIdTypeArray> offsets;
+    offsets->SetNumberOfValues(nCells + 1);
+    vtkIdType* pointOffsets = offsets->GetPointer(0);
+    std::vector<vtkIdType> faceOffsets(faceLocations ? nCells + 1 : 0);
+
+    pointOffsets[0] = 0;
+    vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        vtkIdType nFaces;
+        pointOffsets[cellId + 1] =
+          static_cast<vtkIdType>(this->GetCellPoints(cellId, nFaces).size());
+        if (faceLocations)
+        {
+          faceOffsets[cellId + 1] = nFaces;
+        }
+      }
+    });
+    std::partial_sum(pointOffsets, pointOffsets + nCells + 1, pointOffsets);
+
+    vtkNew<vtkIdTypeArray> points;
+    points->SetNumberOfValues(pointOffsets[nCells]);
+    vtkIdType* cellPoints = points->GetPointer(0);
+
+    vtkNew<vtkIdTypeArray> faceIds;
+    vtkIdType* cellFaces = nullptr;
+    if (faceLocations)
+    {
+      std::partial_sum(faceOffsets.begin(), faceOffsets.end(), faceOffsets.begin());
+      faceIds->SetNumberOfValues(faceOffsets[nCells]);
+      cellFaces = faceIds->GetPointer(0);
+    }
+
+    vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+      vtkIdList* elementIds = this->ElementIds.Local();
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        vtkIdType nFaces;
+        const auto& pts = this->GetCellPoints(cellId, nFaces);
+        std::copy(pts.begin(), pts.end(), cellPoints + pointOffsets[cellId]);
+        if (cellFaces && nFaces > 0)
+        {
+          vtkIdType size;
+          const vtkIdType* ids;
+          this->Elements->GetCellAtId(cellId, size, ids, elementIds);
+          std::copy(ids, ids + size, cellFaces + faceOffsets[cellId]);
+        }
+      }
+    });
+
+    connectivity->SetData(offsets, points);
+    if (faceLocations)
+    {
+      vtkNew<vtkIdTypeArray> locationOffsets;
+      locationOffsets->SetNumberOfValues(nCells + 1);
+      std::copy(faceOffsets.begin(), faceOffsets.end(), locationOffsets->GetPointer(0));
+      faceLocations->SetData(locationOffsets, faceIds);
+    }
+  }
+
+private:
+  // Points of the cell, in the thread local scratch vector. nFaces is 0 for non polyhedra.
+  const std::vector<vtkIdType>& GetCellPoints(vtkIdType cellId, vtkIdType& nFaces)
+  {
+    std::vector<vtkIdType>& pts = this->Points.Local();
+    vtkIdType size;
+    const vtkIdType* ids;
+    this->Elements->GetCellAtId(cellId, size, ids, this->ElementIds.Local());
+    if (this->Types[cellId] != VTK_POLYHEDRON)
+    {
+      nFaces = 0;
+      pts.assign(ids, ids + size);
+      return pts;
+    }
+
+    nFaces = size;
+    pts.clear();
+    vtkIdList* faceIds = this->FaceIds.Local();
+    for (vtkIdType faceIdx = 0; faceIdx < size; ++faceIdx)
+    {
+      vtkIdType facePtsSize;
+      const vtkIdType* facePts;
+      this->Faces->GetCellAtId(ids[faceIdx], facePtsSize, facePts, faceIds);
+      pts.insert(pts.end(), facePts, facePts + facePtsSize);
+    }
+    std::sort(pts.begin(), pts.end());
+    pts.erase(std::unique(pts.begin(), pts.end()), pts.end());
+    return pts;
+  }
+
+  const unsigned char* Types;
+  vtkCellArray* Elements;
+  vtkCellArray* Faces;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> Points;
+  vtkSMPThreadLocalObject<vtkIdList> ElementIds;
+  vtkSMPThreadLocalObject<vtkIdList> FaceIds;
+};
+
+VTK_ABI_NAMESPACE_END
+}
 
 namespace vtkConduitToDataObject
 {
@@ -557,8 +715,6 @@ vtkSmartPointer<vtkDataSet> CreateMonoShapedUnstructuredGrid(
       auto subelements = vtkConduitArrayUtilities::O2MRelationToVTKCellArray(
         conduit_cpp::c_node(&t_subelements), "connectivity");
 
-      // currently, this is an ugly deep-copy. Once vtkUnstructuredGrid is modified
-      // as proposed here (vtk/vtk#18190), this will get simpler.
       SetPolyhedralCells(unstructured, elements, subelements);
     }
     else if (vtk_cell_type == VTK_POLYGON)
@@ -582,138 +738,6 @@ vtkSmartPointer<vtkDataSet> CreateMonoShapedUnstructuredGrid(
   return unstructured;
 }
 
-/**
- * Internal struct to be passed to a worker.
- * See CreateMixedUnstructuredGrid.
- */
-struct MixedPolyhedralCells
-{
-  conduit_cpp::Node* ElementShapes;
-  conduit_cpp::Node* ElementSizes;
-  conduit_cpp::Node* ElementOffsets;
-
-  conduit_cpp::Node* SubElementSizes;
-  conduit_cpp::Node* SubElementOffsets;
-
-  MixedPolyhedralCells(conduit_cpp::Node* elementShapes, conduit_cpp::Node* elementSizes,
-    conduit_cpp::Node* elementOffsets, conduit_cpp::Node* subElementSizes,
-    conduit_cpp::Node* subElementOffsets)
-    : ElementShapes(elementShapes)
-    , ElementSizes(elementSizes)
-    , ElementOffsets(elementOffsets)
-    , SubElementSizes(subElementSizes)
-    , SubElementOffsets(subElementOffsets)
-  {
-  }
-
-  template <typename ConnectivityArray, typename SubConnectivityArray>
-  void operator()(ConnectivityArray* elementConnectivity,
-    SubConnectivityArray* subElementConnectivity, vtkUnstructuredGrid* ug)
-  {
-    using ConnectivityArrayType = vtk::GetAPIType<ConnectivityArray>;
-    using SubConnectivityArrayType = vtk::GetAPIType<SubConnectivityArray>;
-
-    const auto elementShapesArray =
-      vtkConduitArrayUtilities::MCArrayToVTKArray(conduit_cpp::c_node(this->ElementShapes));
-    const auto elementSizesArray =
-      vtkConduitArrayUtilities::MCArrayToVTKArray(conduit_cpp::c_node(this->ElementSizes));
-    const auto elementOffsetsArray =
-      vtkConduitArrayUtilities::MCArrayToVTKArray(conduit_cpp::c_node(this->ElementOffsets));
-
-    vtkSmartPointer<vtkDataArray> subElementSizesArray(nullptr), subElementOffsetsArray(nullptr);
-    if (this->SubElementSizes != nullptr)
-    {
-      subElementSizesArray =
-        vtkConduitArrayUtilities::MCArrayToVTKArray(conduit_cpp::c_node(this->SubElementSizes));
-    }
-    if (this->SubElementOffsets != nullptr)
-    {
-      subElementOffsetsArray =
-        vtkConduitArrayUtilities::MCArrayToVTKArray(conduit_cpp::c_node(this->SubElementOffsets));
-    }
-
-    auto elementShapesRange = vtk::DataArrayValueRange(elementShapesArray);
-    auto elementSizesRange = vtk::DataArrayValueRange(elementSizesArray);
-    auto elementOffsetsRange = vtk::DataArrayValueRange(elementOffsetsArray);
-
-    assert(elementShapesRange.size() == elementSizesRange.size());
-    assert(elementShapesRange.size() == elementOffsetsRange.size());
-
-    auto elementSizesIterator = elementSizesRange.begin();
-    auto elementOffsetsIterator = elementOffsetsRange.begin();
-
-    const vtkNew<vtkUnsignedCharArray> cellTypes;
-    const vtkNew<vtkCellArray> connectivity;
-    const vtkNew<vtkCellArray> faces;
-    const vtkNew<vtkCellArray> faceLocations;
-    vtkIdType numFace = 0;
-
-    for (const auto& cellType : elementShapesRange)
-    {
-      auto type = static_cast<unsigned char>(cellType);
-      cellTypes->InsertNextValue(type);
-      if (type == VTK_POLYHEDRON)
-      {
-        assert(subElementSizesArray != nullptr);
-        assert(subElementOffsetsArray != nullptr);
-
-        std::set<vtkIdType> cellPointSet;
-        auto nCellFaces = static_cast<vtkIdType>(*elementSizesIterator++);
-        auto offset = static_cast<vtkIdType>(*elementOffsetsIterator++);
-        faceLocations->InsertNextCell(nCellFaces);
-
-        auto elementRange =
-          vtk::DataArrayValueRange(elementConnectivity, offset, offset + nCellFaces);
-
-        for (const ConnectivityArrayType faceId : elementRange)
-        {
-          const vtkIdType nFacePts = subElementSizesArray->GetVariantValue(faceId).ToLongLong();
-          const vtkIdType faceOffset = subElementOffsetsArray->GetVariantValue(faceId).ToLongLong();
-          faceLocations->InsertCellPoint(numFace++);
-
-          auto facePtRange =
-            vtk::DataArrayValueRange(subElementConnectivity, faceOffset, faceOffset + nFacePts);
-
-          faces->InsertNextCell(nFacePts);
-          for (const SubConnectivityArrayType ptId : facePtRange)
-          {
-            faces->InsertCellPoint(ptId);
-            cellPointSet.insert(ptId);
-          }
-        }
-
-        connectivity->InsertNextCell(static_cast<int>(cellPointSet.size()));
-        for (const vtkIdType cellPoint : cellPointSet)
-        {
-          connectivity->InsertCellPoint(cellPoint);
-        }
-      }
-      else
-      {
-        auto npts = static_cast<vtkIdType>(*elementSizesIterator++);
-        auto offset = static_cast<vtkIdType>(*elementOffsetsIterator++);
-        auto elementRange = vtk::DataArrayValueRange(elementConnectivity, offset, offset + npts);
-
-        connectivity->InsertNextCell(static_cast<int>(npts));
-        for (const ConnectivityArrayType item : elementRange)
-        {
-          connectivity->InsertCellPoint(static_cast<vtkIdType>(item));
-        }
-        faceLocations->InsertNextCell(0);
-      }
-    }
-
-    if (faces->GetNumberOfCells() > 0)
-    {
-      ug->SetPolyhedralCells(cellTypes, connectivity, faceLocations, faces);
-    }
-    else
-    {
-      ug->SetPolyhedralCells(cellTypes, connectivity, nullptr, nullptr);
-    }
-  }
-};
-
 //----------------------------------------------------------------------------
 vtkSmartPointer<vtkDataSet> CreateMixedUnstructuredGrid(
   const conduit_cpp::Node& topologyNode, const conduit_cpp::Node& coords)
@@ -743,50 +767,40 @@ vtkSmartPointer<vtkDataSet> CreateMixedUnstructuredGrid(
   {
     unstructured->SetPoints(CreatePoints(coords));
 
-    conduit_cpp::Node t_elementShapes = topologyNode["elements/shapes"];
-    conduit_cpp::Node t_elementSizes = topologyNode["elements/sizes"];
-    conduit_cpp::Node t_elementOffsets = topologyNode["elements/offsets"];
-    conduit_cpp::Node t_elementConnectivity = topologyNode["elements/connectivity"];
-
-    auto elementConnectivity =
-      vtkConduitArrayUtilities::MCArrayToVTKArray(conduit_cpp::c_node(&t_elementConnectivity));
-
-    if (elementConnectivity == nullptr)
+    // the elements connectivity is used as is when the cells are stored contiguously.
+    conduit_cpp::Node t_elements = topologyNode["elements"];
+    auto elements = vtkConduitArrayUtilities::O2MRelationToVTKCellArray(
+      conduit_cpp::c_node(&t_elements), "connectivity");
+    if (elements == nullptr)
     {
       throw std::runtime_error("element/connectivity not available (nullptr)");
     }
-
-    conduit_cpp::Node* p_subElementSizes(nullptr);
-    conduit_cpp::Node* p_subElementOffsets(nullptr);
-
-    vtkSmartPointer<vtkDataArray> subConnectivity(nullptr);
-    if (hasPolyhedra)
+    auto cellTypes = ::CreateCellTypes(topologyNode["elements/shapes"]);
+    if (cellTypes->GetNumberOfValues() != elements->GetNumberOfCells())
     {
-      // get the face nodes for size, offset and connectivity
-      conduit_cpp::Node t_subElementSizes = topologyNode["subelements/sizes"];
-      conduit_cpp::Node t_subElementOffsets = topologyNode["subelements/offsets"];
-      conduit_cpp::Node t_subElementConnectivity = topologyNode["subelements/connectivity"];
-
-      p_subElementOffsets = &t_subElementOffsets;
-      p_subElementSizes = &t_subElementSizes;
-
-      subConnectivity =
-        vtkConduitArrayUtilities::MCArrayToVTKArray(conduit_cpp::c_node(&t_subElementConnectivity));
+      throw std::runtime_error("elements/shapes and elements/sizes do not match.");
+    }
 
-      if (subConnectivity == nullptr)
-      {
-        throw std::runtime_error("subelements/connectivity not available (nullptr)");
-      }
+    if (!hasPolyhedra)
+    {
+      unstructured->SetCells(cellTypes, elements);
+      return unstructured;
     }
 
-    // dispatch the mcarrays to create the mixed element grid
-    MixedPolyhedralCells worker(
-      &t_elementShapes, &t_elementSizes, &t_elementOffsets, p_subElementSizes, p_subElementOffsets);
-    if (!vtkArrayDispatch::Dispatch2::Execute(
-          elementConnectivity, subConnectivity, worker, unstructured))
+    // the faces are used as is, the points of the polyhedra are their unique face points.
+    conduit_cpp::Node t_subelements = topologyNode["subelements"];
+    auto faces = vtkConduitArrayUtilities::O2MRelationToVTKCellArray(
+      conduit_cpp::c_node(&t_subelements), "connectivity");
+    if (faces == nullptr)
     {
-      worker(elementConnectivity.GetPointer(), subConnectivity.GetPointer(), unstructured);
+      throw std::runtime_error("subelements/connectivity not available (nullptr)");
     }
+
+    vtkNew<vtkCellArray> connectivity;
+    vtkNew<vtkCellArray> faceLocations;
+    ::PolyhedralCellsBuilder builder(cellTypes->GetPointer(0), elements, faces);
+    builder.Build(connectivity, faceLocations);
+    unstructured->SetPolyhedralCells(cellTypes, connectivity, faceLocations, faces);
   }
 
   return unstructured;
@@ -895,56 +909,16 @@ vtkSmartPointer<vtkPoints> CreatePoints(const conduit_cpp::Node& coords)
 void SetPolyhedralCells(
   vtkUnstructuredGrid* grid, vtkCellArray* elements, vtkCellArray* subelements)
 {
-  vtkNew<vtkCellArray> connectivity;
-  vtkNew<vtkCellArray> faces;
-  vtkNew<vtkCellArray> faceLocations;
-
-  connectivity->AllocateEstimate(elements->GetNumberOfCells(), 10);
-  faces->AllocateExact(
-    subelements->GetNumberOfCells(), subelements->GetConnectivityArray()->GetNumberOfTuples());
-  faceLocations->AllocateExact(elements->GetNumberOfCells(), subelements->GetNumberOfCells());
-
-  auto eIter = vtk::TakeSmartPointer(elements->NewIterator());
-  auto seIter = vtk::TakeSmartPointer(subelements->NewIterator());
-
-  std::vector<vtkIdType> cellPoints;
-  vtkIdType faceNum = 0;
-  for (eIter->GoToFirstCell(); !eIter->IsDoneWithTraversal(); eIter->GoToNextCell())
-  {
-    // init;
-    cellPoints.clear();
-
-    // get cell from 'elements'.
-    vtkIdType size;
-    vtkIdType const* seIds;
-    eIter->GetCurrentCell(size, seIds);
-
-    faceLocations->InsertNextCell(size);
-    for (vtkIdType fIdx = 0; fIdx < size; ++fIdx)
-    {
-      faceLocations->InsertCellPoint(faceNum++);
-      seIter->GoToCell(seIds[fIdx]);
-
-      vtkIdType ptSize;
-      vtkIdType const* ptIds;
-      seIter->GetCurrentCell(ptSize, ptIds);
-      faces->InsertNextCell(ptSize, ptIds);
-      // accumulate pts from all faces in this cell to build the 'connectivity' array.
-      std::copy(ptIds, ptIds + ptSize, std::back_inserter(cellPoints));
-    }
-
-    connectivity->InsertNextCell(
-      static_cast<vtkIdType>(cellPoints.size()), cellPoints.empty() ? nullptr : cellPoints.data());
-  }
-
-  connectivity->Squeeze();
-  faces->Squeeze();
-  faceLocations->Squeeze();
-
+  // 'elements' lists the face ids of each cell in 'subelements': they are used as
+  // is as face locations and faces. Only the point connectivity is created.
   vtkNew<vtkUnsignedCharArray> cellTypes;
-  cellTypes->SetNumberOfTuples(connectivity->GetNumberOfCells());
+  cellTypes->SetNumberOfTuples(elements->GetNumberOfCells());
   cellTypes->FillValue(static_cast<unsigned char>(VTK_POLYHEDRON));
-  grid->SetPolyhedralCells(cellTypes, connectivity, faceLocations, faces);
+
+  vtkNew<vtkCellArray> connectivity;
+  ::PolyhedralCellsBuilder builder(cellTypes->GetPointer(0), elements, subelements);
+  builder.Build(connectivity, nullptr);
+  grid->SetPolyhedralCells(cellTypes, connectivity, elements, subelements);
 }
 
 //----------------------------------------------------------------------------
@@ -277,6 +277,43 @@ class TestEnSightGoldCombinedReader(Testing.vtkTest):
     mapper = self.setupMapper(geom, "evect")
     self.renderAndCompare(mapper, "TestEnSightGoldCombinedReader_15.png", [26.4, 2.7, 1.4])
 
+  def comparePoints(self, output, expected):
+    self.assertEqual(output.GetNumberOfPartitionedDataSets(),
+                     expected.GetNumberOfPartitionedDataSets())
+    for i in range(expected.GetNumberOfPartitionedDataSets()):
+      part = output.GetPartitionedDataSet(i).GetPartition(0)
+      expectedPart = expected.GetPartitionedDataSet(i).GetPartition(0)
+      self.assertEqual(part.GetNumberOfPoints(), expectedPart.GetNumberOfPoints())
+      self.assertEqual(part.GetNumberOfCells(), expectedPart.GetNumberOfCells())
+      for ptId in range(0, part.GetNumberOfPoints(), 7):
+        self.assertEqual(part.GetPoint(ptId), expectedPart.GetPoint(ptId))
+
+  def testMemoryMapping(self):
+    for casefile in ["ensight-gold-test-bin.case", "RectGrid_bin.case", "elements-bin.case"]:
+      reference = self.setupReader(casefile)
+      reference.Update()
+
+      reader = self.setupReader(casefile)
+      reader.UseMemoryMappingOn()
+      reader.Update()
+      self.comparePoints(reader.GetOutput(), reference.GetOutput())
+
+  def testReselectParts(self):
+    reference = self.setupReader("ensight-gold-test-bin.case")
+    reference.Update()
+
+    # the second read of the time step uses the part index built by the first one
+    reader = self.setupReader("ensight-gold-test-bin.case")
+    reader.UpdateInformation()
+    selection = reader.GetPartSelection()
+    selection.DisableAllArrays()
+    selection.EnableArray(selection.GetArrayName(1))
+    reader.Update()
+    self.assertIsNone(reader.GetOutput().GetPartitionedDataSet(0).GetPartition(0))
+    selection.EnableAllArrays()
+    reader.Update()
+    self.comparePoints(reader.GetOutput(), reference.GetOutput())
+
   def testSelectArrays(self):
     reader = self.setupReader("blow1_ascii.case")
     reader.UpdateInformation()
@@ -22,6 +22,7 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSOADataArrayTemplate.h"
 #include "vtkSetGet.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredGrid.h"
@@ -1020,108 +1021,112 @@ bool EnSightDataSet::ReadGeometry(
     result = this->GeometryFile.ReadNextLine(); // "part"
   }
 
-  while (result.first && result.second.find("part") != std::string::npos)
+  // The parts of a time step are indexed the first time it is read, so that only the
+  // selected parts need to be parsed when it is read again, e.g. after the part selection
+  // changed. With change_coords_only, the connectivity is not read for all the time steps,
+  // so the parts cannot be indexed.
+  PartIndex* index = nullptr;
+  if (!this->GeometryChangeCoordsOnly)
   {
-    int partId = this->ReadPartId(this->GeometryFile);
-    partId--; // EnSight starts counts at 1
-
-    result = this->GeometryFile.ReadNextLine(); // part description line
-    auto partName = result.second;
-    bool readPart = false;
-    if (selection->ArrayIsEnabled(partName.c_str()))
+    const std::string& fileName = this->GeometryFile.GetCurrentOpenFileName();
+    index = &this->GeometryPartIndices[std::make_pair(
+      fileName, static_cast<std::streamoff>(this->GeometryFile.GetCurrentPosition()))];
+    long int modifiedTime = vtksys::SystemTools::ModifiedTime(fileName);
+    if (index->FileModifiedTime != modifiedTime)
     {
-      readPart = true;
+      *index = PartIndex();
+      index->FileModifiedTime = modifiedTime;
     }
+  }
 
-    result = this->GeometryFile.ReadNextLine();
-    auto opts = getGridOptions(result.second);
-    if (readPart)
+  if (index && index->Complete)
+  {
+    for (auto& entry : index->Parts)
     {
-      bool addToPDC = true;
-      vtkDataSet* grid = nullptr;
-      if (static_cast<unsigned int>(partId) < output->GetNumberOfPartitionedDataSets())
-      {
-        grid = output->GetPartitionedDataSet(partId)->GetPartition(0);
-        addToPDC = false;
-      }
-      switch (opts.Type)
+      bool readPart = selection->ArrayIsEnabled(entry.Name.c_str()) != 0;
+      if (!readPart && entry.HasInfo)
       {
-        case GridType::Uniform:
-          if (!grid)
-          {
-            grid = vtkUniformGrid::New();
-          }
-          this->CreateUniformGridOutput(opts, vtkUniformGrid::SafeDownCast(grid));
-          break;
-        case GridType::Rectilinear:
-          if (!grid)
-          {
-            grid = vtkRectilinearGrid::New();
-          }
-          this->CreateRectilinearGridOutput(opts, vtkRectilinearGrid::SafeDownCast(grid));
-          break;
-        case GridType::Curvilinear:
-          if (!grid)
-          {
-            grid = vtkStructuredGrid::New();
-          }
-          this->CreateStructuredGridOutput(opts, vtkStructuredGrid::SafeDownCast(grid));
-          break;
-        case GridType::Unstructured:
-          if (!grid)
-          {
-            grid = vtkUnstructuredGrid::New();
-          }
-          this->CreateUnstructuredGridOutput(opts, vtkUnstructuredGrid::SafeDownCast(grid));
-          break;
-        default:
-          vtkGenericWarningMacro("Grid type not correctly specified");
-          return false;
+        // the sizes of skipped parts are needed to skip them in the variable files
+        this->PartInfoMap[entry.PartId] = entry.Info;
+        continue;
       }
-      if (grid)
+
+      this->GeometryFile.MoveToPosition(entry.Position);
+      int partId = this->ReadPartId(this->GeometryFile) - 1;
+      this->GeometryFile.ReadNextLine(); // part description line
+      result = this->GeometryFile.ReadNextLine();
+      if (!this->ReadPart(partId, entry.Name, getGridOptions(result.second), readPart, output))
       {
-        this->ApplyRigidBodyTransforms(partId, partName, grid);
+        return false;
       }
-      if (grid && addToPDC)
+      if (!readPart)
       {
-        vtkNew<vtkPartitionedDataSet> pds;
-        pds->SetPartition(0, grid);
-        grid->Delete();
-        output->SetPartitionedDataSet(partId, pds);
-        output->GetMetaData(partId)->Set(vtkCompositeDataSet::NAME(), partName);
-
-        auto assembly = output->GetDataAssembly();
-        auto validName = vtkDataAssembly::MakeValidNodeName(partName.c_str());
-        auto node = assembly->AddNode(validName.c_str());
-        assembly->AddDataSetIndex(node, partId);
+        entry.Info = this->PartInfoMap[partId];
+        entry.HasInfo = true;
       }
     }
-    else
+    // leave the file where reading all the parts does
+    this->GeometryFile.MoveToPosition(index->End);
+  }
+  else
+  {
+    if (index)
+    {
+      index->Parts.clear();
+    }
+    while (result.first && result.second.find("part") != std::string::npos)
     {
-      switch (opts.Type)
+      std::streampos position = this->GeometryFile.GetCurrentPosition();
+      int partId = this->ReadPartId(this->GeometryFile);
+      partId--; // EnSight starts counts at 1
+
+      result = this->GeometryFile.ReadNextLine(); // part description line
+      auto partName = result.second;
+      bool readPart = false;
+      if (selection->ArrayIsEnabled(partName.c_str()))
       {
-        case GridType::Uniform:
-          this->PassThroughUniformGrid(opts, partId);
-          break;
-        case GridType::Rectilinear:
-          this->PassThroughRectilinearGrid(opts, partId);
-          break;
-        case GridType::Curvilinear:
-          this->PassThroughStructuredGrid(opts, partId);
-          break;
-        case GridType::Unstructured:
-          this->PassThroughUnstructuredGrid(opts, partId);
-          break;
-        default:
-          vtkGenericWarningMacro("Grid type not correctly specified");
-          return false;
+        readPart = true;
+      }
+
+      result = this->GeometryFile.ReadNextLine();
+      auto opts = getGridOptions(result.second);
+      if (!this->ReadPart(partId, partName, opts, readPart, output))
+      {
+        return false;
+      }
+
+      if (index)
+      {
+        PartIndex::Entry entry;
+        entry.PartId = partId;
+        entry.Name = partName;
+        entry.Position = position;
+        if (!readPart)
+        {
+          // only the pass through fills the sizes of the part
+          entry.Info = this->PartInfoMap[partId];
+          entry.HasInfo = true;
+        }
+        index->Parts.push_back(entry);
+      }
+
+      if (this->GeometryFile.CheckForEndTimeStepLine())
+      {
+        break;
       }
+      result = this->GeometryFile.ReadNextLine();
     }
-    if (this->GeometryFile.CheckForEndTimeStepLine())
+    if (index)
     {
-      break;
+      // the last line read may be the end of the file, that has no position
+      index->End = this->GeometryFile.GetCurrentPosition();
+      if (index->End == std::streampos(-1))
+      {
+        index->End = static_cast<std::streamoff>(
+          vtksys::SystemTools::FileLength(this->GeometryFile.GetCurrentOpenFileName()));
+      }
+      index->Complete = true;
     }
-    result = this->GeometryFile.ReadNextLine();
   }
 
   // We may have a case where a part was not processed,
@@ -1151,6 +1156,95 @@ bool EnSightDataSet::ReadGeometry(
   return true;
 }
 
+//------------------------------------------------------------------------------
+bool EnSightDataSet::ReadPart(int partId, const std::string& partName, const GridOptions& opts,
+  bool readPart, vtkPartitionedDataSetCollection* output)
+{
+  if (readPart)
+  {
+    bool addToPDC = true;
+    vtkDataSet* grid = nullptr;
+    if (static_cast<unsigned int>(partId) < output->GetNumberOfPartitionedDataSets())
+    {
+      grid = output->GetPartitionedDataSet(partId)->GetPartition(0);
+      addToPDC = false;
+    }
+    switch (opts.Type)
+    {
+      case GridType::Uniform:
+        if (!grid)
+        {
+          grid = vtkUniformGrid::New();
+        }
+        this->CreateUniformGridOutput(opts, vtkUniformGrid::SafeDownCast(grid));
+        break;
+      case GridType::Rectilinear:
+        if (!grid)
+        {
+          grid = vtkRectilinearGrid::New();
+        }
+        this->CreateRectilinearGridOutput(opts, vtkRectilinearGrid::SafeDownCast(grid));
+        break;
+      case GridType::Curvilinear:
+        if (!grid)
+        {
+          grid = vtkStructuredGrid::New();
+        }
+        this->CreateStructuredGridOutput(opts, vtkStructuredGrid::SafeDownCast(grid));
+        break;
+      case GridType::Unstructured:
+        if (!grid)
+        {
+          grid = vtkUnstructuredGrid::New();
+        }
+        this->CreateUnstructuredGridOutput(opts, vtkUnstructuredGrid::SafeDownCast(grid));
+        break;
+      default:
+        vtkGenericWarningMacro("Grid type not correctly specified");
+        return false;
+    }
+    if (grid)
+    {
+      this->ApplyRigidBodyTransforms(partId, partName, grid);
+    }
+    if (grid && addToPDC)
+    {
+      vtkNew<vtkPartitionedDataSet> pds;
+      pds->SetPartition(0, grid);
+      grid->Delete();
+      output->SetPartitionedDataSet(partId, pds);
+      output->GetMetaData(partId)->Set(vtkCompositeDataSet::NAME(), partName);
+
+      auto assembly = output->GetDataAssembly();
+      auto validName = vtkDataAssembly::MakeValidNodeName(partName.c_str());
+      auto node = assembly->AddNode(validName.c_str());
+      assembly->AddDataSetIndex(node, partId);
+    }
+  }
+  else
+  {
+    switch (opts.Type)
+    {
+      case GridType::Uniform:
+        this->PassThroughUniformGrid(opts, partId);
+        break;
+      case GridType::Rectilinear:
+        this->PassThroughRectilinearGrid(opts, partId);
+        break;
+      case GridType::Curvilinear:
+        this->PassThroughStructuredGrid(opts, partId);
+        break;
+      case GridType::Unstructured:
+        this->PassThroughUnstructuredGrid(opts, partId);
+        break;
+      default:
+        vtkGenericWarningMacro("Grid type not correctly specified");
+        return false;
+    }
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 bool EnSightDataSet::ReadMeasuredGeometry(
   vtkPartitionedDataSetCollection* output, vtkDataArraySelection* selection)
@@ -2086,6 +2180,31 @@ void EnSightDataSet::PassThroughUniformGrid(const GridOptions& opts, int partId)
   this->PassThroughOptionalSections(opts, numPts, numCells);
 }
 
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> EnSightDataSet::ReadCoordinates(int numPts)
+{
+  // the coordinates are stored component by component, so they can be used in place as the
+  // components of a SOA array when the geometry file is memory mapped
+  vtkNew<vtkSOADataArrayTemplate<float>> mapped;
+  mapped->SetNumberOfComponents(3);
+  if (this->GeometryFile.MapArray(mapped, numPts))
+  {
+    return mapped.Get();
+  }
+
+  vtkNew<vtkFloatArray> ptsArray;
+  ptsArray->SetNumberOfComponents(3);
+  ptsArray->SetNumberOfTuples(numPts);
+  vtkNew<vtkFloatArray> buffer;
+  buffer->SetNumberOfTuples(numPts);
+  for (int i = 0; i < 3; i++)
+  {
+    this->GeometryFile.ReadArray(buffer->WritePointer(0, numPts), numPts);
+    ptsArray->CopyComponent(i, buffer, 0);
+  }
+  return ptsArray.Get();
+}
+
 //------------------------------------------------------------------------------
 void EnSightDataSet::CreateRectilinearGridOutput(
   const GridOptions& opts, vtkRectilinearGrid* output)
@@ -2098,13 +2217,15 @@ void EnSightDataSet::CreateRectilinearGridOutput(
   vtkNew<vtkFloatArray> xCoords;
   vtkNew<vtkFloatArray> yCoords;
   vtkNew<vtkFloatArray> zCoords;
-  xCoords->SetNumberOfTuples(dimensions[0]);
-  yCoords->SetNumberOfTuples(dimensions[1]);
-  zCoords->SetNumberOfTuples(dimensions[2]);
-
-  this->GeometryFile.ReadArray(xCoords->WritePointer(0, dimensions[0]), dimensions[0]);
-  this->GeometryFile.ReadArray(yCoords->WritePointer(0, dimensions[1]), dimensions[1]);
-  this->GeometryFile.ReadArray(zCoords->WritePointer(0, dimensions[2]), dimensions[2]);
+  vtkFloatArray* coords[3] = { xCoords, yCoords, zCoords };
+  for (int i = 0; i < 3; i++)
+  {
+    if (!this->GeometryFile.MapArray(coords[i], dimensions[i]))
+    {
+      coords[i]->SetNumberOfTuples(dimensions[i]);
+      this->GeometryFile.ReadArray(coords[i]->WritePointer(0, dimensions[i]), dimensions[i]);
+    }
+  }
 
   output->SetXCoordinates(xCoords);
   output->SetYCoordinates(yCoords);
@@ -2169,25 +2290,7 @@ void EnSightDataSet::CreateStructuredGridOutput(const GridOptions& opts, vtkStru
   output->SetDimensions(dimensions);
 
   vtkNew<vtkPoints> points;
-  points->SetNumberOfPoints(numPts);
-
-  auto readComponent = [&](vtkIdType count) {
-    vtkNew<vtkFloatArray> buffer;
-    buffer->SetNumberOfTuples(count);
-    this->GeometryFile.ReadArray(buffer->WritePointer(0, count), count);
-    return buffer;
-  };
-
-  vtkNew<vtkFloatArray> ptsArray;
-  ptsArray->SetNumberOfComponents(3);
-  ptsArray->SetNumberOfTuples(numPts);
-
-  for (int i = 0; i < 3; i++)
-  {
-    auto buffer = readComponent(numPts);
-    ptsArray->CopyComponent(i, buffer, 0);
-  }
-  points->SetData(ptsArray);
+  points->SetData(this->ReadCoordinates(numPts));
   output->SetPoints(points);
 
   if (opts.IBlanked)
@@ -2272,25 +2375,7 @@ void EnSightDataSet::CreateUnstructuredGridOutput(
   }
 
   vtkNew<vtkPoints> points;
-  points->SetNumberOfPoints(numPts);
-
-  auto readComponent = [&](vtkIdType count) {
-    vtkNew<vtkFloatArray> buffer;
-    buffer->SetNumberOfTuples(count);
-    this->GeometryFile.ReadArray(buffer->WritePointer(0, count), count);
-    return buffer;
-  };
-
-  vtkNew<vtkFloatArray> ptsArray;
-  ptsArray->SetNumberOfComponents(3);
-  ptsArray->SetNumberOfTuples(numPts);
-
-  for (int i = 0; i < 3; i++)
-  {
-    auto buffer = readComponent(numPts);
-    ptsArray->CopyComponent(i, buffer, 0);
-  }
-  points->SetData(ptsArray);
+  points->SetData(this->ReadCoordinates(numPts));
   output->SetPoints(points);
 
   // it sounds like its possible that change_coords_only could be set, but if there is no
@@ -3325,5 +3410,11 @@ void EnSightDataSet::SetActualTimeValue(double time)
   this->ActualTimeValue = time;
 }
 
+//------------------------------------------------------------------------------
+void EnSightDataSet::SetUseMemoryMapping(bool useMapping)
+{
+  this->GeometryFile.UseMemoryMapping = useMapping;
+}
+
 VTK_ABI_NAMESPACE_END
 } // end namespace ensight_gold
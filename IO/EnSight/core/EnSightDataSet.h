@@ -9,10 +9,12 @@
 #include "vtkSmartPointer.h"
 #include "vtkTransform.h"
 
+#include <map>
 #include <string>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
 class vtkDataArraySelection;
 class vtkDataSet;
 class vtkFloatArray;
@@ -99,6 +101,32 @@ struct PartInfo
 
 using PartInfoMapType = std::map<int, PartInfo>;
 
+/**
+ * Position of each part in one time step of a geometry file, so that the selected parts
+ * can be read directly when the same time step is read again.
+ */
+struct PartIndex
+{
+  struct Entry
+  {
+    int PartId = -1;
+    std::string Name;
+    // position of the part id, just after the "part" line
+    std::streampos Position;
+    // sizes of the part, only known once it has been skipped at least once
+    PartInfo Info;
+    bool HasInfo = false;
+  };
+
+  // modification time of the file when the index was built
+  long int FileModifiedTime = 0;
+  // true once all the parts of the time step have been indexed
+  bool Complete = false;
+  std::vector<Entry> Parts;
+  // read position after the parts, where reading the time step stops
+  std::streampos End;
+};
+
 enum class VariableType
 {
   Unknown,
@@ -204,6 +232,12 @@ public:
 
   void SetActualTimeValue(double time);
 
+  /**
+   * When true, the coordinates of binary geometry files written in the byte order of the
+   * host are memory mapped instead of being read, and used without copy.
+   */
+  void SetUseMemoryMapping(bool useMapping);
+
 private:
   bool ParseFormatSection();
   void ParseGeometrySection();
@@ -220,6 +254,18 @@ private:
   void CreateStructuredGridOutput(const GridOptions& opts, vtkStructuredGrid* output);
   void CreateUnstructuredGridOutput(const GridOptions& opts, vtkUnstructuredGrid* output);
 
+  /**
+   * Read or pass through the current part of the geometry file, whose part id and description
+   * lines have already been read.
+   */
+  bool ReadPart(int partId, const std::string& partName, const GridOptions& opts, bool readPart,
+    vtkPartitionedDataSetCollection* output);
+
+  /**
+   * Read the x, y and z coordinates of numPts points from the geometry file.
+   */
+  vtkSmartPointer<vtkDataArray> ReadCoordinates(int numPts);
+
   void PassThroughUniformGrid(const GridOptions& opts, int partId);
   void PassThroughRectilinearGrid(const GridOptions& opts, int partId);
   void PassThroughStructuredGrid(const GridOptions& opts, int partId);
@@ -295,6 +341,9 @@ private:
 
   vtkSmartPointer<vtkPartitionedDataSetCollection> Cache;
 
+  // Part indices of the geometry file(s), for each file name and time step position
+  std::map<std::pair<std::string, std::streamoff>, PartIndex> GeometryPartIndices;
+
   std::string MeasuredFileName;
   EnSightFile MeasuredFile;
   int MeasuredPartitionId;
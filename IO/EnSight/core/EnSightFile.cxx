@@ -3,8 +3,22 @@
 
 #include "EnSightFile.h"
 
+#include "vtkEndian.h"
+
+#include <map>
+#include <mutex>
 #include <regex>
 
+#if defined(_WIN32)
+#include "vtkWindows.h"
+#include <vtksys/Encoding.hxx>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <vtk_fmt.h>
 // clang-format off
 #include VTK_FMT(fmt/core.h)
@@ -121,6 +135,128 @@ std::string replaceWildcards(const std::string& pattern, int num)
   return filename;
 }
 
+//------------------------------------------------------------------------------
+// Copy-on-write memory mapping of a whole file. Pages are only read from disk when
+// accessed, and modifying the mapped memory never modifies the file.
+struct MappedFile
+{
+  char* Data = nullptr;
+  size_t Size = 0;
+#if defined(_WIN32)
+  HANDLE Mapping = nullptr;
+#endif
+
+  MappedFile() = default;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile()
+  {
+#if defined(_WIN32)
+    if (this->Data)
+    {
+      UnmapViewOfFile(this->Data);
+    }
+    if (this->Mapping)
+    {
+      CloseHandle(this->Mapping);
+    }
+#else
+    if (this->Data)
+    {
+      munmap(this->Data, this->Size);
+    }
+#endif
+  }
+
+  static std::shared_ptr<MappedFile> Open(const std::string& filename)
+  {
+    auto mapped = std::make_shared<MappedFile>();
+#if defined(_WIN32)
+    HANDLE file = CreateFileW(vtksys::Encoding::ToWide(filename).c_str(), GENERIC_READ,
+      FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+      return nullptr;
+    }
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    {
+      mapped->Size = static_cast<size_t>(size.QuadPart);
+      mapped->Mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    }
+    // the mapping keeps its own reference to the file
+    CloseHandle(file);
+    if (!mapped->Mapping)
+    {
+      return nullptr;
+    }
+    mapped->Data = static_cast<char*>(MapViewOfFile(mapped->Mapping, FILE_MAP_COPY, 0, 0, 0));
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      return nullptr;
+    }
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size > 0)
+    {
+      mapped->Size = static_cast<size_t>(info.st_size);
+      void* data = mmap(nullptr, mapped->Size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+      mapped->Data = data == MAP_FAILED ? nullptr : static_cast<char*>(data);
+    }
+    // the mapping keeps its own reference to the file
+    close(fd);
+#endif
+    return mapped->Data ? mapped : nullptr;
+  }
+};
+
+namespace
+{
+// Mappings referenced by the arrays created by EnSightFile::MapArray(), with their number of
+// references. vtkBuffer only gives the data pointer to its freeing function, which is then used
+// to find the mapping it points into. The registry is never destroyed, since arrays may be
+// released by static destructors.
+struct MappingRegistry
+{
+  std::mutex Mutex;
+  std::map<const char*, std::pair<std::shared_ptr<MappedFile>, vtkIdType>> Mappings;
+};
+
+MappingRegistry& GetMappingRegistry()
+{
+  static MappingRegistry* registry = new MappingRegistry;
+  return *registry;
+}
+
+void AcquireMappedFile(const std::shared_ptr<MappedFile>& mapped, vtkIdType count)
+{
+  auto& registry = GetMappingRegistry();
+  std::lock_guard<std::mutex> lock(registry.Mutex);
+  auto& entry = registry.Mappings[mapped->Data];
+  entry.first = mapped;
+  entry.second += count;
+}
+
+void ReleaseMappedValues(void* ptr)
+{
+  auto& registry = GetMappingRegistry();
+  std::lock_guard<std::mutex> lock(registry.Mutex);
+  const char* data = static_cast<const char*>(ptr);
+  auto it = registry.Mappings.upper_bound(data);
+  if (it == registry.Mappings.begin())
+  {
+    return;
+  }
+  --it;
+  if (data < it->first + it->second.first->Size && --it->second.second == 0)
+  {
+    registry.Mappings.erase(it);
+  }
+}
+}
+
 //------------------------------------------------------------------------------
 EnSightFile::EnSightFile()
 {
@@ -462,6 +598,9 @@ void EnSightFile::CloseFile()
     this->Stream = nullptr;
   }
   this->CurrentOpenFileName.clear();
+  // arrays created by MapArray() keep their own reference to the mapping
+  this->Mapping = nullptr;
+  this->MappingOpened = false;
 }
 
 //------------------------------------------------------------------------------
@@ -600,6 +739,86 @@ bool EnSightFile::DetectByteOrder(int* result)
   return true;
 }
 
+//------------------------------------------------------------------------------
+float* EnSightFile::MapFloats(vtkIdType n, int numArrays)
+{
+  if (!this->UseMemoryMapping || n <= 0 ||
+    (this->Format != FileType::CBinary && this->Format != FileType::FBinary))
+  {
+    return nullptr;
+  }
+#ifdef VTK_WORDS_BIGENDIAN
+  if (this->ByteOrder != Endianness::Big)
+#else
+  if (this->ByteOrder != Endianness::Little)
+#endif
+  {
+    // values need to be swapped
+    return nullptr;
+  }
+
+  if (!this->MappingOpened)
+  {
+    this->MappingOpened = true;
+    this->Mapping = MappedFile::Open(this->CurrentOpenFileName);
+  }
+  if (!this->Mapping)
+  {
+    return nullptr;
+  }
+
+  // Fortran files pad each array with its size in bytes
+  const std::streamoff arrayBytes = n * static_cast<std::streamoff>(sizeof(float));
+  const std::streamoff stride = arrayBytes + 2 * this->FortranSkipBytes;
+  const std::streamoff begin =
+    static_cast<std::streamoff>(this->GetCurrentPosition()) + this->FortranSkipBytes;
+  const std::streamoff end = begin + (numArrays - 1) * stride + arrayBytes;
+  if (begin < 0 || end > static_cast<std::streamoff>(this->Mapping->Size) ||
+    (begin % alignof(float)) != 0 || (stride % alignof(float)) != 0)
+  {
+    return nullptr;
+  }
+
+  AcquireMappedFile(this->Mapping, numArrays);
+  this->MoveToPosition(begin + numArrays * stride - this->FortranSkipBytes);
+  return reinterpret_cast<float*>(this->Mapping->Data + begin);
+}
+
+//------------------------------------------------------------------------------
+bool EnSightFile::MapArray(vtkSOADataArrayTemplate<float>* array, vtkIdType n)
+{
+  const int numComps = array->GetNumberOfComponents();
+  float* values = this->MapFloats(n, numComps);
+  if (!values)
+  {
+    return false;
+  }
+
+  const vtkIdType stride = n + 2 * this->FortranSkipBytes / static_cast<vtkIdType>(sizeof(float));
+  for (int comp = 0; comp < numComps; ++comp)
+  {
+    array->SetArray(comp, values + comp * stride, n, /*updateMaxId=*/true, /*save=*/false,
+      vtkAbstractArray::VTK_DATA_ARRAY_USER_DEFINED);
+    array->SetArrayFreeFunction(comp, ReleaseMappedValues);
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool EnSightFile::MapArray(vtkFloatArray* array, vtkIdType n)
+{
+  float* values = this->MapFloats(n, 1);
+  if (!values)
+  {
+    return false;
+  }
+
+  array->SetNumberOfComponents(1);
+  array->SetArray(values, n, 0, vtkAbstractArray::VTK_DATA_ARRAY_USER_DEFINED);
+  array->SetArrayFreeFunction(ReleaseMappedValues);
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void EnSightFile::MoveReadPosition(int numBytes)
 {
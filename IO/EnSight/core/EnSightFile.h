@@ -5,6 +5,8 @@
 #define EnSightFile_h
 
 #include "vtkByteSwap.h"
+#include "vtkFloatArray.h"
+#include "vtkSOADataArrayTemplate.h"
 
 #include "vtksys/FStream.hxx"
 
@@ -54,6 +56,8 @@ struct FileSetInfo
 
 using FileSetInfoMapType = std::map<int, std::shared_ptr<FileSetInfo>>;
 
+struct MappedFile;
+
 /**
  * EnSightFile performs processing on a single file, whether it's a case file,
  * geometry, etc. It also works on ASCII, C binary, and Fortran binary files.
@@ -64,6 +68,8 @@ struct EnSightFile
   Endianness ByteOrder = Endianness::Unknown;
   int TimeSet = -1;
   int FileSet = -1;
+  // When true, arrays of binary files may be wrapped without copy using MapArray()
+  bool UseMemoryMapping = false;
 
   EnSightFile();
   ~EnSightFile();
@@ -172,16 +178,38 @@ struct EnSightFile
   bool ReadArray(
     T* result, vtkIdType n, bool singleLine = false, bool padBeginning = true, bool padEnd = true);
 
+  /**
+   * Wrap the next n floats of a binary file into the components of array, without copying
+   * them, using a memory mapping of the file. Each component is read as a separate array,
+   * as done by ReadArray(). The mapping is kept alive as long as the array uses it, even
+   * once the file is closed.
+   * This is only possible when UseMemoryMapping is true and the file is written in the byte
+   * order of the host. Returns false, leaving the read position unchanged, when the values
+   * could not be mapped; they must then be read using ReadArray().
+   */
+  bool MapArray(vtkSOADataArrayTemplate<float>* array, vtkIdType n);
+  bool MapArray(vtkFloatArray* array, vtkIdType n);
+
   /**
    * Move the read position ahead n bytes.
    */
   void MoveReadPosition(int numBytes);
 
+  /**
+   * Move the read position ahead to position pos.
+   */
+  void MoveToPosition(std::streampos pos);
+
   /**
    * Get current position of reader in stream.
    */
   std::streampos GetCurrentPosition();
 
+  /**
+   * Get the name of the file currently open, if any.
+   */
+  const std::string& GetCurrentOpenFileName() const { return this->CurrentOpenFileName; }
+
   /**
    * This is used when change_coords_only is set, for determining if the file we currently have
    * open is the file that contains the connectivity.
@@ -213,6 +241,10 @@ private:
   bool HasBinaryHeader = false;
   int FortranSkipBytes = 0;
 
+  // Memory mapping of the current file, created on the first call to MapArray()
+  std::shared_ptr<MappedFile> Mapping;
+  bool MappingOpened = false;
+
   /**
    * Resets the read position of the file.
    */
@@ -224,9 +256,10 @@ private:
   void CloseFile();
 
   /**
-   * Move the read position ahead to position pos.
+   * Return a pointer to numArrays consecutive arrays of n floats in the memory mapping
+   * of the file, and move the read position past them, or nullptr if they cannot be mapped.
    */
-  void MoveToPosition(std::streampos pos);
+  float* MapFloats(vtkIdType n, int numArrays);
 };
 
 template <typename T>
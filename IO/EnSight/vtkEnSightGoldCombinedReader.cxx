@@ -154,6 +154,7 @@ int vtkEnSightGoldCombinedReader::RequestData(
   }
   output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), actualTimeValue);
   this->Impl->Reader.SetActualTimeValue(actualTimeValue);
+  this->Impl->Reader.SetUseMemoryMapping(this->UseMemoryMapping);
 
   if (!this->Impl->Reader.ReadGeometry(output, this->Impl->PartSelection))
   {
@@ -217,5 +218,6 @@ void vtkEnSightGoldCombinedReader::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Case FileName: " << (this->CaseFileName ? this->CaseFileName : "(none)") << endl;
   os << indent << "File path: " << (this->FilePath ? this->FilePath : "(none)") << endl;
+  os << indent << "UseMemoryMapping: " << this->UseMemoryMapping << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -60,6 +60,19 @@ public:
   vtkGetMacro(TimeValue, double);
   ///@}
 
+  ///@{
+  /**
+   * When on, the coordinates of binary geometry files written in the byte order of the host
+   * are memory mapped and used in place as the components of a vtkSOADataArrayTemplate<float>,
+   * instead of being read and interleaved. The mapping is copy-on-write, so the output can be
+   * modified, but the geometry files must not be truncated while the output is in use.
+   * Default is off.
+   */
+  vtkSetMacro(UseMemoryMapping, bool);
+  vtkGetMacro(UseMemoryMapping, bool);
+  vtkBooleanMacro(UseMemoryMapping, bool);
+  ///@}
+
   /**
    * Checks version information in the case file to determine if the file
    * can be read by this reader.
@@ -107,6 +120,7 @@ protected:
 
   vtkSmartPointer<vtkDoubleArray> AllTimeSteps;
   double TimeValue;
+  bool UseMemoryMapping = false;
 
 private:
   vtkEnSightGoldCombinedReader(const vtkEnSightGoldCombinedReader&) = delete;
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkExodusIIReader.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkTestUtilities.h"
+
+#include <iostream>
+
+int TestExodusPrefetch(int argc, char* argv[])
+{
+  char* fname = vtkTestUtilities::ExpandDataFileName(argc, argv, "Data/can.ex2");
+  if (!fname)
+  {
+    std::cerr << "Could not obtain filename for test data." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Reference reader, without prefetching
+  vtkNew<vtkExodusIIReader> reference;
+  reference->SetFileName(fname);
+  reference->UpdateInformation();
+  reference->SetAllArrayStatus(vtkExodusIIReader::NODAL, 1);
+  reference->SetAllArrayStatus(vtkExodusIIReader::ELEM_BLOCK, 1);
+  reference->SetAllArrayStatus(vtkExodusIIReader::GLOBAL, 1);
+
+  // Reader prefetching the next time step in the background,
+  // with a cache large enough to hold several time steps
+  vtkNew<vtkExodusIIReader> reader;
+  reader->SetFileName(fname);
+  reader->SetCacheSize(100.0);
+  reader->PrefetchNextTimeStepOn();
+  reader->UpdateInformation();
+  reader->SetAllArrayStatus(vtkExodusIIReader::NODAL, 1);
+  reader->SetAllArrayStatus(vtkExodusIIReader::ELEM_BLOCK, 1);
+  reader->SetAllArrayStatus(vtkExodusIIReader::GLOBAL, 1);
+  delete[] fname;
+
+  const int numberOfTimeSteps = reader->GetNumberOfTimeSteps();
+  if (numberOfTimeSteps < 2)
+  {
+    std::cerr << "Expected a time-dependent dataset." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Output must be the same whether the data comes from the prefetched cache or the file
+  for (int step = 0; step < numberOfTimeSteps; ++step)
+  {
+    reference->SetTimeStep(step);
+    reference->Update();
+    reader->SetTimeStep(step);
+    reader->Update();
+
+    if (!vtkTestUtilities::CompareDataObjects(reference->GetOutput(), reader->GetOutput()))
+    {
+      std::cerr << "Prefetched output differs from the reference at time step " << step
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // The arrays of the next time step must have been read in the background
+    // before it is requested, and only by the prefetching reader.
+    if (step + 1 < numberOfTimeSteps)
+    {
+      if (!reader->IsTimeStepCached(step + 1))
+      {
+        std::cerr << "Time step " << step + 1 << " was not prefetched." << std::endl;
+        return EXIT_FAILURE;
+      }
+      if (reference->IsTimeStepCached(step + 1))
+      {
+        std::cerr << "Time step " << step + 1 << " unexpectedly cached without prefetching."
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Nothing is prefetched past the last time step
+  if (reader->IsTimeStepCached(numberOfTimeSteps))
+  {
+    std::cerr << "Unexpected prefetching past the last time step." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -9,6 +9,7 @@
 #include "vtkCellData.h"
 #include "vtkDemandDrivenPipeline.h"
 #include "vtkDoubleArray.h"
+#include "vtkExodusIIReaderPrivate.h" // for GetLibraryMutex
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMultiBlockDataSet.h"
@@ -69,6 +70,8 @@ vtkTypeBool vtkCPExodusIIInSituReader::ProcessRequest(
 int vtkCPExodusIIInSituReader::RequestData(
   vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
 {
+  std::lock_guard<std::recursive_mutex> lock(vtkExodusIIReaderPrivate::GetLibraryMutex());
+
   // Get output object:
   vtkInformation* outInfo(outputVector->GetInformationObject(0));
   vtkMultiBlockDataSet* output(
@@ -129,6 +132,7 @@ int vtkCPExodusIIInSituReader::RequestData(
 int vtkCPExodusIIInSituReader::RequestInformation(
   vtkInformation*, vtkInformationVector**, vtkInformationVector*)
 {
+  std::lock_guard<std::recursive_mutex> lock(vtkExodusIIReaderPrivate::GetLibraryMutex());
   if (!this->ExOpen())
   {
     return 0;
@@ -87,6 +87,7 @@ vtkExodusIICache::~vtkExodusIICache()
 
 void vtkExodusIICache::PrintSelf(ostream& os, vtkIndent indent)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Capacity: " << this->Capacity << " MiB\n";
   os << indent << "Size: " << this->Size << " MiB\n";
@@ -102,6 +103,7 @@ void vtkExodusIICache::Clear()
 
 void vtkExodusIICache::SetCacheCapacity(double sizeInMiB)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   if (sizeInMiB == this->Capacity)
     return;
 
@@ -115,6 +117,7 @@ void vtkExodusIICache::SetCacheCapacity(double sizeInMiB)
 
 int vtkExodusIICache::ReduceToSize(double newSize)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   int deletedSomething = 0;
   while (this->Size > newSize && !this->LRU.empty())
   {
@@ -158,6 +161,7 @@ int vtkExodusIICache::ReduceToSize(double newSize)
 
 void vtkExodusIICache::Insert(vtkExodusIICacheKey& key, vtkDataArray* value)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   double vsize = value ? value->GetActualMemorySize() / 1024. : 0.;
 
   vtkExodusIICacheRef it = this->Cache.find(key);
@@ -199,10 +203,9 @@ void vtkExodusIICache::Insert(vtkExodusIICacheKey& key, vtkDataArray* value)
   // printCache( this->Cache, this->LRU );
 }
 
-vtkDataArray*& vtkExodusIICache::Find(const vtkExodusIICacheKey& key)
+vtkSmartPointer<vtkDataArray> vtkExodusIICache::Find(const vtkExodusIICacheKey& key)
 {
-  static vtkDataArray* dummy = nullptr;
-
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   vtkExodusIICacheRef it = this->Cache.find(key);
   if (it != this->Cache.end())
   {
@@ -211,12 +214,18 @@ vtkDataArray*& vtkExodusIICache::Find(const vtkExodusIICacheKey& key)
     return it->second->Value;
   }
 
-  dummy = nullptr;
-  return dummy;
+  return nullptr;
+}
+
+bool vtkExodusIICache::Contains(const vtkExodusIICacheKey& key)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
+  return this->Cache.find(key) != this->Cache.end();
 }
 
 int vtkExodusIICache::Invalidate(const vtkExodusIICacheKey& key)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   vtkExodusIICacheRef it = this->Cache.find(key);
   if (it != this->Cache.end())
   {
@@ -246,6 +255,7 @@ int vtkExodusIICache::Invalidate(const vtkExodusIICacheKey& key)
 
 int vtkExodusIICache::Invalidate(const vtkExodusIICacheKey& key, const vtkExodusIICacheKey& pattern)
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   vtkExodusIICacheRef it;
   int nDropped = 0;
   it = this->Cache.begin();
@@ -284,6 +294,7 @@ int vtkExodusIICache::Invalidate(const vtkExodusIICacheKey& key, const vtkExodus
 
 void vtkExodusIICache::RecomputeSize()
 {
+  std::lock_guard<std::recursive_mutex> lock(this->Mutex);
   this->Size = 0.;
   vtkExodusIICacheRef it;
   for (it = this->Cache.begin(); it != this->Cache.end(); ++it)
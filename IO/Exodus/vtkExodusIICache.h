@@ -24,12 +24,21 @@
 // entries O(1). Each cache entry stores an iterator into
 // the list of references so that it can be located quickly for
 // removal.
+//
+// The methods of vtkExodusIICache lock an internal mutex, so that the
+// size of the cache and its entries may be queried while a background
+// prefetching thread inserts arrays. Find() returns a new reference to
+// the array, taken under the lock, so that the array outlives its
+// eviction. This does not make the arrays themselves safe to modify
+// concurrently.
 
 #include "vtkIOExodusModule.h" // For export macro
 #include "vtkObject.h"
+#include "vtkSmartPointer.h" // For Find()
 
-#include <list> // use for LRU ordering
-#include <map>  // used for cache storage
+#include <list>  // use for LRU ordering
+#include <map>   // used for cache storage
+#include <mutex> // used for thread safety
 
 VTK_ABI_NAMESPACE_BEGIN
 class VTKIOEXODUS_EXPORT vtkExodusIICacheKey
@@ -138,7 +147,11 @@ public:
    * This is the difference between the capacity and the size of the cache.
    * The result is in MiB.
    */
-  double GetSpaceLeft() { return this->Capacity - this->Size; }
+  double GetSpaceLeft()
+  {
+    std::lock_guard<std::recursive_mutex> lock(this->Mutex);
+    return this->Capacity - this->Size;
+  }
 
   /** Remove cache entries until the size of the cache is at or below the given size.
    * Returns a nonzero value if deletions were required.
@@ -151,7 +164,11 @@ public:
   /** Determine whether a cache entry exists. If it does, return it -- otherwise return nullptr.
    * If a cache entry exists, it is marked as most recently used.
    */
-  vtkDataArray*& Find(const vtkExodusIICacheKey&);
+  vtkSmartPointer<vtkDataArray> Find(const vtkExodusIICacheKey&);
+
+  /** Determine whether a cache entry exists, without marking it as most recently used.
+   */
+  bool Contains(const vtkExodusIICacheKey& key);
 
   /** Invalidate a cache entry (drop it from the cache) if the key exists.
    * This does nothing if the cache entry does not exist.
@@ -198,6 +215,9 @@ protected:
   /// The actual LRU list (indices into the cache ordered least to most recently used).
   vtkExodusIICacheLRU LRU;
 
+  /// Protects the cache storage and LRU list from concurrent accesses.
+  std::recursive_mutex Mutex;
+
 private:
   vtkExodusIICache(const vtkExodusIICache&) = delete;
   void operator=(const vtkExodusIICache&) = delete;
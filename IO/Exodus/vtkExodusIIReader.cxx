@@ -40,6 +40,7 @@
 #include <algorithm>
 #include <deque>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -305,6 +306,8 @@ vtkExodusIIReaderPrivate::vtkExodusIIReaderPrivate()
 
   this->Cache = vtkExodusIICache::New();
   this->CacheSize = 0;
+  this->PrefetchNextTimeStep = false;
+  this->TimeStepKeysTime = -1;
 
   this->HasModeShapes = 0;
   this->ModeShapeTime = -1.;
@@ -336,6 +339,7 @@ vtkExodusIIReaderPrivate::vtkExodusIIReaderPrivate()
 //------------------------------------------------------------------------------
 vtkExodusIIReaderPrivate::~vtkExodusIIReaderPrivate()
 {
+  this->WaitForPrefetch();
   this->CloseFile();
   this->Cache->Delete();
   this->CacheSize = 0;
@@ -1568,6 +1572,13 @@ void vtkExodusIIReaderPrivate::InsertSetSides(
 //------------------------------------------------------------------------------
 vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
 {
+  // Keep track of the time-dependent arrays requested for the current time step,
+  // so the same arrays can be prefetched for the next one.
+  if (key.Time >= 0 && key.Time == this->TimeStepKeysTime)
+  {
+    this->TimeStepKeys.insert(key);
+  }
+
   vtkDataArray* arr;
   // Never cache points deflected for a mode shape animation... doubles don't make good keys.
   if (this->HasModeShapes && key.ObjectType == vtkExodusIIReader::NODAL_COORDS)
@@ -1586,7 +1597,9 @@ vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
   }
 
   int exoid = this->Exoid;
-  int maxNameLength = this->Parent->GetMaxNameLength();
+  // Do not go through vtkExodusIIReader::GetMaxNameLength(), which waits for prefetching:
+  // this may be run by the prefetching task itself.
+  int maxNameLength = ex_inquire_int(exoid, EX_INQ_DB_MAX_USED_NAME_LENGTH);
 
   // If array is nullptr, try reading it from file.
   if (key.ObjectType == vtkExodusIIReader::GLOBAL)
@@ -3836,6 +3849,7 @@ void vtkExodusIIReaderPrivate::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "GenerateObjectIdArray: " << this->GenerateObjectIdArray << "\n";
   os << indent << "GenerateFileIdArray: " << this->GenerateFileIdArray << "\n";
   os << indent << "FileId: " << this->FileId << "\n";
+  os << indent << "PrefetchNextTimeStep: " << this->PrefetchNextTimeStep << "\n";
 }
 
 int vtkExodusIIReaderPrivate::OpenFile(const char* filename)
@@ -3846,6 +3860,9 @@ int vtkExodusIIReaderPrivate::OpenFile(const char* filename)
     return 0;
   }
 
+  // The file may still be in use by the prefetching task
+  this->WaitForPrefetch();
+
   if (this->Exoid >= 0)
   {
     this->CloseFile();
@@ -4518,6 +4535,9 @@ int vtkExodusIIReaderPrivate::RequestData(vtkIdType timeStep, vtkMultiBlockDataS
     vtkErrorMacro("You must specify an output mesh");
   }
 
+  this->TimeStepKeys.clear();
+  this->TimeStepKeysTime = timeStep;
+
   // Iterate over all block and set types, creating a
   // multiblock dataset to hold objects of each type.
   int conntypidx;
@@ -4609,11 +4629,158 @@ int vtkExodusIIReaderPrivate::RequestData(vtkIdType timeStep, vtkMultiBlockDataS
     }
   }
 
-  this->CloseFile();
+  this->TimeStepKeysTime = -1;
+  if (this->PrefetchNextTimeStep && !this->HasModeShapes && !this->TimeStepKeys.empty() &&
+    timeStep + 1 < this->GetNumberOfTimeSteps())
+  {
+    // Read the next time step while the current one is processed downstream.
+    // The file is closed by the prefetching task.
+    if (!this->PrefetchQueue)
+    {
+      this->PrefetchQueue = vtkSmartPointer<vtkThreadedCallbackQueue>::New();
+    }
+    vtkIdType nextTimeStep = timeStep + 1;
+    std::set<vtkExodusIICacheKey> keys = this->TimeStepKeys;
+    this->PrefetchFuture = this->PrefetchQueue->Push(
+      [this, nextTimeStep, keys]() { this->PrefetchTimeStep(nextTimeStep, keys); });
+  }
+  else
+  {
+    this->CloseFile();
+  }
 
   return 0;
 }
 
+//------------------------------------------------------------------------------
+void vtkExodusIIReaderPrivate::PrefetchTimeStep(
+  vtkIdType timeStep, const std::set<vtkExodusIICacheKey>& keys)
+{
+  for (const vtkExodusIICacheKey& key : keys)
+  {
+    vtkExodusIICacheKey nextKey(key);
+    nextKey.Time = timeStep;
+    if (this->Cache->Contains(nextKey))
+    {
+      continue;
+    }
+
+    // Speculative reads should never evict arrays from the cache: skip the arrays
+    // which are not known to fit in the remaining space.
+    double size = this->EstimateArraySize(nextKey);
+    if (size < 0. || size > this->Cache->GetSpaceLeft())
+    {
+      continue;
+    }
+
+    // Lock for each array rather than for the whole time step, so that other
+    // readers are not blocked until the whole time step has been read.
+    std::lock_guard<std::recursive_mutex> lock(vtkExodusIIReaderPrivate::GetLibraryMutex());
+    this->GetCacheOrRead(nextKey);
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(vtkExodusIIReaderPrivate::GetLibraryMutex());
+  this->CloseFile();
+}
+
+//------------------------------------------------------------------------------
+double vtkExodusIIReaderPrivate::EstimateArraySize(const vtkExodusIICacheKey& key)
+{
+  // Components are promoted to 3 for 2-D vectors, see GetCacheOrRead()
+  auto numberOfComponents = [this](const ArrayInfoType& ainfo)
+  { return (this->ModelParameters.num_dim == 2 && ainfo.Components == 2) ? 3 : ainfo.Components; };
+
+  double bytes = -1.;
+  if (key.ObjectType == vtkExodusIIReader::GLOBAL)
+  {
+    bytes = static_cast<double>(this->ArrayInfo[vtkExodusIIReader::GLOBAL].size()) *
+      sizeof(double);
+  }
+  else if (key.ObjectType == vtkExodusIIReader::NODAL_COORDS)
+  {
+    bytes = 3. * this->ModelParameters.num_nodes * sizeof(double);
+    if (this->ApplyDisplacements && key.Time >= 0)
+    {
+      // The displacement vectors are read and cached along with the coordinates
+      bytes *= 2.;
+    }
+  }
+  else if (key.ObjectType == vtkExodusIIReader::NODAL)
+  {
+    const ArrayInfoType& ainfo = this->ArrayInfo[key.ObjectType][key.ArrayId];
+    bytes = static_cast<double>(numberOfComponents(ainfo)) * this->ModelParameters.num_nodes *
+      vtkDataArray::GetDataTypeSize(ainfo.StorageType);
+  }
+  else if (this->IsObjectTypeBlock(key.ObjectType) || this->IsObjectTypeSet(key.ObjectType))
+  {
+    const ArrayInfoType& ainfo = this->ArrayInfo[key.ObjectType][key.ArrayId];
+    ObjectInfoType* oinfop =
+      this->GetObjectInfo(this->GetObjectTypeIndexFromObjectType(key.ObjectType), key.ObjectId);
+    if (oinfop)
+    {
+      bytes = static_cast<double>(numberOfComponents(ainfo)) * oinfop->Size *
+        vtkDataArray::GetDataTypeSize(ainfo.StorageType);
+    }
+  }
+  else if (key.ObjectType == vtkExodusIIReader::ELEM_BLOCK_ATTRIB ||
+    key.ObjectType == vtkExodusIIReader::FACE_BLOCK_ATTRIB ||
+    key.ObjectType == vtkExodusIIReader::EDGE_BLOCK_ATTRIB)
+  {
+    int blkType = (key.ObjectType == vtkExodusIIReader::ELEM_BLOCK_ATTRIB
+        ? vtkExodusIIReader::ELEM_BLOCK
+        : (key.ObjectType == vtkExodusIIReader::FACE_BLOCK_ATTRIB ? vtkExodusIIReader::FACE_BLOCK
+                                                                  : vtkExodusIIReader::EDGE_BLOCK));
+    bytes = static_cast<double>(this->BlockInfo[blkType][key.ObjectId].Size) * sizeof(double);
+  }
+
+  // The cache accounts for array sizes in MiB
+  return bytes < 0. ? bytes : bytes / (1024. * 1024.);
+}
+
+//------------------------------------------------------------------------------
+std::recursive_mutex& vtkExodusIIReaderPrivate::GetLibraryMutex()
+{
+  static std::recursive_mutex mutex;
+  return mutex;
+}
+
+//------------------------------------------------------------------------------
+bool vtkExodusIIReaderPrivate::IsTimeStepCached(vtkIdType timeStep)
+{
+  this->WaitForPrefetch();
+  if (this->TimeStepKeys.empty())
+  {
+    return false;
+  }
+  for (const vtkExodusIICacheKey& key : this->TimeStepKeys)
+  {
+    vtkExodusIICacheKey stepKey(key);
+    stepKey.Time = timeStep;
+    if (!this->Cache->Contains(stepKey))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkExodusIIReaderPrivate::WaitForPrefetch()
+{
+  if (this->PrefetchFuture)
+  {
+    this->PrefetchFuture->Wait();
+    this->PrefetchFuture = nullptr;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkExodusIIReaderPrivate::Modified()
+{
+  this->WaitForPrefetch();
+  this->Superclass::Modified();
+}
+
 int vtkExodusIIReaderPrivate::SetUpEmptyGrid(vtkMultiBlockDataSet* output)
 {
   if (!output)
@@ -4746,6 +4913,7 @@ int vtkExodusIIReaderPrivate::SetUpEmptyGrid(vtkMultiBlockDataSet* output)
 void vtkExodusIIReaderPrivate::Reset()
 {
   vtkLogF(TRACE, "vtkExodusIIReaderPrivate(%p)::Reset", static_cast<void*>(this));
+  this->WaitForPrefetch();
   this->CloseFile();
   this->ResetCache(); // must come before BlockInfo and SetInfo are cleared.
   this->BlockInfo.clear();
@@ -4793,6 +4961,7 @@ void vtkExodusIIReaderPrivate::ResetSettings()
 
 void vtkExodusIIReaderPrivate::ResetCache()
 {
+  this->WaitForPrefetch();
   this->Cache->Clear();
   this->Cache->SetCacheCapacity(
     this->CacheSize); // FIXME: Perhaps Cache should have a Reset and a Clear method?
@@ -5350,6 +5519,7 @@ int vtkExodusIIReader::CanReadFile(const char* fname)
   int diskWordSize = 8;
   float version;
 
+  std::lock_guard<std::recursive_mutex> lock(vtkExodusIIReaderPrivate::GetLibraryMutex());
   if ((exoid = ex_open(fname, EX_READ, &appWordSize, &diskWordSize, &version)) < 0)
   {
     return 0;
@@ -5441,6 +5611,13 @@ void vtkExodusIIReader::SetXMLFileName(const char* fname)
 vtkTypeBool vtkExodusIIReader::ProcessRequest(
   vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
 {
+  // Metadata must not be updated while the next time step is being prefetched
+  if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA()) ||
+    request->Has(vtkDemandDrivenPipeline::REQUEST_INFORMATION()))
+  {
+    this->Metadata->WaitForPrefetch();
+  }
+
   if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA()))
   {
     return this->RequestData(request, inputVector, outputVector);
@@ -5465,6 +5642,7 @@ int vtkExodusIIReader::RequestInformation(vtkInformation* vtkNotUsed(request),
   // If the metadata is older than the filename
   if (this->GetMetadataMTime() < this->FileNameMTime)
   {
+    std::lock_guard<std::recursive_mutex> lock(vtkExodusIIReaderPrivate::GetLibraryMutex());
     if (this->Metadata->OpenFile(this->FileName))
     {
       // We need to initialize the XML parser before calling RequestInformation
@@ -5528,6 +5706,7 @@ int vtkExodusIIReader::RequestInformation(vtkInformation* vtkNotUsed(request),
 int vtkExodusIIReader::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
 {
+  std::lock_guard<std::recursive_mutex> lock(vtkExodusIIReaderPrivate::GetLibraryMutex());
   if (!this->FileName || !this->Metadata->OpenFile(this->FileName))
   {
     vtkErrorMacro("Unable to open file \"" << (this->FileName ? this->FileName : "(null)")
@@ -5595,6 +5774,8 @@ int vtkExodusIIReader::RequestData(vtkInformation* vtkNotUsed(request),
 
 int vtkExodusIIReader::GetMaxNameLength()
 {
+  this->Metadata->WaitForPrefetch();
+  std::lock_guard<std::recursive_mutex> lock(vtkExodusIIReaderPrivate::GetLibraryMutex());
   return ex_inquire_int(this->Metadata->Exoid, EX_INQ_DB_MAX_USED_NAME_LENGTH);
 }
 
@@ -6734,6 +6915,25 @@ double vtkExodusIIReader::GetCacheSize()
   return this->Metadata->GetCacheSize();
 }
 
+void vtkExodusIIReader::SetPrefetchNextTimeStep(bool prefetch)
+{
+  if (this->Metadata->GetPrefetchNextTimeStep() != prefetch)
+  {
+    this->Metadata->SetPrefetchNextTimeStep(prefetch);
+    this->Modified();
+  }
+}
+
+bool vtkExodusIIReader::GetPrefetchNextTimeStep()
+{
+  return this->Metadata->GetPrefetchNextTimeStep();
+}
+
+bool vtkExodusIIReader::IsTimeStepCached(int timeStep)
+{
+  return this->Metadata->IsTimeStepCached(timeStep);
+}
+
 void vtkExodusIIReader::SetSqueezePoints(bool sp)
 {
   this->Metadata->SetSqueezePoints(sp ? 1 : 0);
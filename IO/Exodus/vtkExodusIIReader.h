@@ -777,6 +777,34 @@ public:
    */
   double GetCacheSize();
 
+  ///@{
+  /**
+   * When on, once the output for a time step has been produced, the arrays of the next time
+   * step are read into the cache by a background thread. Disk access for the next time step
+   * then overlaps with the processing of the current one downstream, which keeps animations
+   * over large files smooth.
+   *
+   * Prefetching never evicts cached arrays: arrays which do not fit in the space left in the
+   * cache are not read, so the cache size (see SetCacheSize()) must be large enough to hold the
+   * arrays of two time steps. Default is off.
+   *
+   * All the calls to the Exodus library made by the readers and writers of this module are
+   * serialized by a single process-wide lock, since the netCDF and HDF5 libraries are not
+   * thread safe. Other readers calling these libraries directly are not synchronized with
+   * the background reads.
+   */
+  void SetPrefetchNextTimeStep(bool prefetch);
+  bool GetPrefetchNextTimeStep();
+  vtkBooleanMacro(PrefetchNextTimeStep, bool);
+  ///@}
+
+  /**
+   * Return true if all the time-dependent arrays read during the last update are in the cache
+   * for the given time step. This waits for the prefetching of the next time step, if any, to
+   * complete.
+   */
+  bool IsTimeStepCached(int timeStep);
+
   ///@{
   /**
    * Should the reader output only points used by elements in the output mesh,
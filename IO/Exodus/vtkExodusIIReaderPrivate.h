@@ -9,10 +9,14 @@
 #include "vtkExodusIICache.h"  // for vtkExodusIICacheKey
 #include "vtkExodusIIReader.h" // for vtkExodusIIReader
 #include "vtkObject.h"
+#include "vtkSmartPointer.h"            // for vtkSmartPointer
 #include "vtkStdString.h"               // for vtkStdString
+#include "vtkThreadedCallbackQueue.h"   // for vtkThreadedCallbackQueue
 #include "vtksys/RegularExpression.hxx" // for vtksys::RegularExpression
 
 #include <map>    // for std::map
+#include <mutex>  // for std::recursive_mutex
+#include <set>    // for std::set
 #include <vector> // for std::vector
 
 #include "vtkIOExodusModule.h" // For export macro
@@ -35,7 +39,9 @@ public:
   static vtkExodusIIReaderPrivate* New();
   void PrintSelf(ostream& os, vtkIndent indent) override;
   vtkTypeMacro(vtkExodusIIReaderPrivate, vtkObject);
-  // virtual void Modified();
+
+  /// Any modification of the reader state waits for a pending prefetch to complete first.
+  void Modified() override;
 
   /// Open an ExodusII file for reading. Returns 0 on success.
   int OpenFile(const char* filename);
@@ -86,6 +92,26 @@ public:
   /// Get the size of the cache in MiB.
   vtkGetMacro(CacheSize, double);
 
+  /** Set/get whether the arrays of the next time step are read into the cache by a
+   * background thread once RequestData() returns.
+   */
+  vtkSetMacro(PrefetchNextTimeStep, bool);
+  vtkGetMacro(PrefetchNextTimeStep, bool);
+
+  /// Block until the prefetching of the next time step, if any, has completed.
+  void WaitForPrefetch();
+
+  /** Return true if the time-dependent arrays read by the last call to RequestData()
+   * are all cached for \a timeStep. A pending prefetch is completed first.
+   */
+  bool IsTimeStepCached(vtkIdType timeStep);
+
+  /** The mutex serializing calls to the Exodus library, and thus to netCDF and HDF5.
+   * It is shared by all the readers and writers of the process, and must be held
+   * by any code opening, reading or closing an Exodus file.
+   */
+  static std::recursive_mutex& GetLibraryMutex();
+
   /** Return the number of time steps in the open file.
    * You must have called RequestInformation() before
    * invoking this member function.
@@ -522,6 +548,17 @@ protected:
   /// Add generated array information to array info lists.
   void PrepareGeneratedArrayInfo();
 
+  /** Read into the cache the arrays of \a timeStep matching the \a keys read for the
+   * previous time step, then close the file. This is run by the prefetching thread.
+   * Arrays which would not fit in the space left in the cache are skipped.
+   */
+  void PrefetchTimeStep(vtkIdType timeStep, const std::set<vtkExodusIICacheKey>& keys);
+
+  /** Estimate the size in MiB of the array GetCacheOrRead() would read for \a key, using
+   * the file metadata only. Returns a negative value when the size cannot be estimated.
+   */
+  double EstimateArraySize(const vtkExodusIICacheKey& key);
+
   /** Read connectivity information and populate an unstructured grid with cells corresponding to a
    * single block or set.
    *
@@ -817,6 +854,17 @@ protected:
   /// The size of the cache in MiB.
   double CacheSize;
 
+  /// Whether the next time step should be read in the background after RequestData().
+  bool PrefetchNextTimeStep;
+
+  /// Time-dependent keys requested by GetCacheOrRead() during the current RequestData().
+  std::set<vtkExodusIICacheKey> TimeStepKeys;
+  vtkIdType TimeStepKeysTime;
+
+  /// Single-threaded queue running prefetching tasks, created on first use.
+  vtkSmartPointer<vtkThreadedCallbackQueue> PrefetchQueue;
+  vtkThreadedCallbackQueue::SharedFutureBasePointer PrefetchFuture;
+
   vtkTypeBool ApplyDisplacements;
   float DisplacementMagnitude;
   vtkTypeBool HasModeShapes;
@@ -10,6 +10,7 @@
 #include "vtkDataObject.h"
 #include "vtkDataObjectTreeIterator.h"
 #include "vtkDoubleArray.h"
+#include "vtkExodusIIReaderPrivate.h" // for GetLibraryMutex
 #include "vtkFieldData.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
@@ -31,6 +32,7 @@
 #include <cctype>
 #include <ctime>
 #include <map>
+#include <mutex>
 #include <sstream>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -194,6 +196,9 @@ int vtkExodusIIWriter::RequestData(vtkInformation* request, vtkInformationVector
   vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
   this->OriginalInput = vtkDataObject::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
 
+  // Serialize with the other users of the Exodus library, such as prefetching readers
+  std::lock_guard<std::recursive_mutex> lock(vtkExodusIIReaderPrivate::GetLibraryMutex());
+
   // is this the first request
   if (this->CurrentTimeIndex == 0 && this->WriteAllTimeSteps)
   {
@@ -131,6 +131,13 @@
 // Support extra decomposition of polyhedral cells
 #define VTK_FOAMFILE_DECOMPOSE_POLYHEDRA 1
 
+// Default for the number of values from which the lists have their body parsed or
+// converted in parallel, and for the number of cells from which the meshes are
+// assembled in parallel, by ranges of VTK_FOAMFILE_CELL_CHUNK_SIZE cells.
+#define VTK_FOAMFILE_PARALLEL_LIST_SIZE (65536)
+#define VTK_FOAMFILE_PARALLEL_CELLS_SIZE (16384)
+#define VTK_FOAMFILE_CELL_CHUNK_SIZE (4096)
+
 //------------------------------------------------------------------------------
 // Developer option to debug the reader states
 #define VTK_FOAMFILE_DEBUG 0
@@ -196,6 +203,7 @@
 #include "vtkTypeInt8Array.h"
 #include "vtkTypeTraits.h"
 #include "vtkTypeUInt8Array.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 #include "vtkVertex.h"
 #include "vtkWedge.h"
@@ -207,12 +215,15 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cctype> // For isalnum(), isdigit(), isspace()
 #include <cmath>  // For abs()
 #include <map>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <sstream>
+#include <type_traits>
 #include <typeinfo>
 #include <unordered_map>
 #include <unordered_set>
@@ -360,6 +371,7 @@ void remapFoamTuple<true>(double data[])
 //------------------------------------------------------------------------------
 // Forward Declarations
 
+struct vtkFoamCellScratch;
 struct vtkFoamDict;
 struct vtkFoamEntry;
 struct vtkFoamEntryValue;
@@ -1228,6 +1240,11 @@ private:
   bool CheckFaceList(const vtkFoamLabelListList& faces);
 
   // Create volume mesh
+  template <typename SinkT>
+  int InsertCellToSink(vtkIdType cellId, const vtkFoamLabelListList& meshCells,
+    const vtkFoamLabelListList& meshFaces, vtkFoamCellScratch& scratch, SinkT& sink,
+    bool insertPolyhedra);
+
   void InsertCellsToGrid(vtkUnstructuredGrid*, std::unique_ptr<vtkFoamLabelListList>& meshCellsPtr,
     const vtkFoamLabelListList& meshFaces, vtkIdList* cellLabels = nullptr
 #if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
@@ -1236,6 +1253,9 @@ private:
 #endif
   );
 
+  void InsertCellsToGridParallel(vtkUnstructuredGrid*, const vtkFoamLabelListList& meshCells,
+    const vtkFoamLabelListList& meshFaces, vtkIdList* cellLabels);
+
   vtkUnstructuredGrid* MakeInternalMesh(std::unique_ptr<vtkFoamLabelListList>& meshCellsPtr,
     const vtkFoamLabelListList& meshFaces, vtkFloatArray* pointArray);
 
@@ -2085,6 +2105,16 @@ public:
   // Generic exception throwing with stack trace
   void ThrowStackTrace(const std::string& msg);
 
+  // Sizes from which the lists are parsed and the meshes assembled in parallel
+  vtkIdType GetMinimumParallelListSize() const
+  {
+    return this->Reader->GetMinimumParallelListSize();
+  }
+  vtkIdType GetMinimumParallelMeshSize() const
+  {
+    return this->Reader->GetMinimumParallelMeshSize();
+  }
+
 private:
   std::string CasePath; // The full path to the case - includes trailing '/'
 
@@ -2841,6 +2871,10 @@ public:
     }
   }
 
+  // Read the body of an ASCII list at once, up to and including its closing ')',
+  // with the comments removed. The first nNested ')' close the elements of the list.
+  void ReadListBody(std::string& body, vtkTypeInt64 nNested);
+
   // ASCII read of longest integer
   vtkTypeInt64 ReadIntegerValue();
 
@@ -2860,6 +2894,64 @@ int vtkFoamFile::ReadNext()
   return *this->Superclass::BufPtr++;
 }
 
+void vtkFoamFile::ReadListBody(std::string& body, vtkTypeInt64 nNested)
+{
+  body.clear();
+  int c;
+  while ((c = this->Getc()) != EOF)
+  {
+    if (c == '\n')
+    {
+      ++this->Superclass::LineNumber;
+    }
+    else if (c == ')')
+    {
+      if (nNested-- == 0)
+      {
+        return;
+      }
+    }
+    else if (c == '/')
+    {
+      const int next = this->Getc();
+      if (next == '/')
+      {
+        // C++ style comment, up to the end of the line
+        while ((c = this->Getc()) != EOF && c != '\n')
+        {
+        }
+        if (c == '\n')
+        {
+          ++this->Superclass::LineNumber;
+        }
+        body.push_back('\n');
+        continue;
+      }
+      else if (next == '*')
+      {
+        // C style comment
+        int prev = 0;
+        while ((c = this->Getc()) != EOF && !(prev == '*' && c == '/'))
+        {
+          if (c == '\n')
+          {
+            ++this->Superclass::LineNumber;
+          }
+          prev = c;
+        }
+        body.push_back(' ');
+        continue;
+      }
+      else if (next != EOF)
+      {
+        this->PutBack(next);
+      }
+    }
+    body.push_back(static_cast<char>(c));
+  }
+  this->ThrowUnexpectedEOFException();
+}
+
 // specialized for reading an integer value.
 // not using the standard strtol() for speed reason.
 vtkTypeInt64 vtkFoamFile::ReadIntegerValue()
@@ -3447,6 +3539,279 @@ inline double vtkFoamReadValue<double>::ReadValue(vtkFoamIOobject& io)
   return io.ReadDoubleValue();
 }
 
+//------------------------------------------------------------------------------
+// Parallel parsing and conversion of list bodies
+
+namespace
+{
+
+// Run the functor over [0, n) in parallel, for large lists only
+template <typename FunctorT>
+void ParallelListFor(const vtkFoamIOobject& io, vtkIdType n, FunctorT&& functor)
+{
+  if (n >= io.GetMinimumParallelListSize())
+  {
+    vtkSMPTools::For(0, n, functor);
+  }
+  else
+  {
+    functor(0, n);
+  }
+}
+
+// The values of an ASCII list body are separated by spaces and parentheses
+inline bool IsListSeparator(char c)
+{
+  return isspace(static_cast<unsigned char>(c)) || c == '(' || c == ')';
+}
+
+inline bool IsDigit(char c)
+{
+  return isdigit(static_cast<unsigned char>(c)) != 0;
+}
+
+// Same syntax as vtkFoamFile::ReadIntegerValue()
+bool ParseListValue(const char*& ptr, const char* end, vtkTypeInt64& value)
+{
+  const bool negNum = (*ptr == '-');
+  if (negNum || *ptr == '+')
+  {
+    ++ptr;
+  }
+  if (ptr == end || !IsDigit(*ptr))
+  {
+    return false;
+  }
+  vtkTypeInt64 num = 0;
+  for (; ptr != end && IsDigit(*ptr); ++ptr)
+  {
+    num = 10 * num + (*ptr - '0');
+  }
+  value = (negNum ? -num : num);
+  return true;
+}
+
+// Same syntax as vtkFoamFile::ReadDoubleValue()
+bool ParseListValue(const char*& ptr, const char* end, double& value)
+{
+  const bool negNum = (*ptr == '-');
+  if (negNum || *ptr == '+')
+  {
+    ++ptr;
+  }
+  if (ptr == end || (!IsDigit(*ptr) && *ptr != '.'))
+  {
+    return false;
+  }
+
+  double num = 0;
+  for (; ptr != end && IsDigit(*ptr); ++ptr)
+  {
+    num = num * 10.0 + (*ptr - '0');
+  }
+  if (ptr != end && *ptr == '.')
+  {
+    double divisor = 1.0;
+    for (++ptr; ptr != end && IsDigit(*ptr); ++ptr)
+    {
+      num = num * 10.0 + (*ptr - '0');
+      divisor *= 10.0;
+    }
+    num /= divisor;
+  }
+  if (ptr != end && (*ptr == 'E' || *ptr == 'e'))
+  {
+    ++ptr;
+    int esign = 1;
+    if (ptr != end && (*ptr == '-' || *ptr == '+'))
+    {
+      esign = (*ptr == '-' ? -1 : 1);
+      ++ptr;
+    }
+    int eval = 0;
+    for (; ptr != end && IsDigit(*ptr); ++ptr)
+    {
+      eval = eval * 10 + (*ptr - '0');
+    }
+    const double scale = std::pow(10.0, eval);
+    num = (esign < 0 ? num / scale : num * scale);
+  }
+  value = (negNum ? -num : num);
+  return true;
+}
+
+// Split a list body into chunks of about 256 kB, which end on separators or,
+// with afterClosing, just after a ')'
+std::vector<size_t> SplitListBody(const std::string& body, bool afterClosing)
+{
+  constexpr size_t chunkSize = 262144;
+  std::vector<size_t> bounds(1, 0);
+  size_t pos = chunkSize;
+  while (pos < body.size())
+  {
+    while (pos < body.size() &&
+      (afterClosing ? body[pos - 1] != ')' : !::IsListSeparator(body[pos])))
+    {
+      ++pos;
+    }
+    bounds.push_back(pos);
+    pos += chunkSize;
+  }
+  if (bounds.back() != body.size())
+  {
+    bounds.push_back(body.size());
+  }
+  return bounds;
+}
+
+// Number of values in a part of a list body
+vtkIdType CountListValues(const char* ptr, const char* end)
+{
+  vtkIdType count = 0;
+  bool inValue = false;
+  for (; ptr != end; ++ptr)
+  {
+    const bool isSeparator = ::IsListSeparator(*ptr);
+    count += (!isSeparator && !inValue);
+    inValue = !isSeparator;
+  }
+  return count;
+}
+
+// Parse the nValues values of an ASCII list body, with its chunks parsed in parallel.
+// Returns false if the number of values does not match or a value is malformed.
+template <typename primitiveT, typename ValueT>
+bool ParseAsciiListBody(const std::string& body, ValueT* values, vtkIdType nValues)
+{
+  using ParseT =
+    typename std::conditional<std::is_integral<primitiveT>::value, vtkTypeInt64, double>::type;
+
+  const std::vector<size_t> bounds = ::SplitListBody(body, false);
+  const vtkIdType nChunks = static_cast<vtkIdType>(bounds.size()) - 1;
+
+  // Prefix sum of the number of values of each chunk
+  std::vector<vtkIdType> chunkBegin(nChunks + 1, 0);
+  vtkSMPTools::For(0, nChunks, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType chunki = begin; chunki < end; ++chunki)
+    {
+      chunkBegin[chunki + 1] =
+        ::CountListValues(body.data() + bounds[chunki], body.data() + bounds[chunki + 1]);
+    }
+  });
+  std::partial_sum(chunkBegin.begin(), chunkBegin.end(), chunkBegin.begin());
+  if (chunkBegin[nChunks] != nValues)
+  {
+    return false;
+  }
+
+  std::atomic<bool> valid(true);
+  vtkSMPTools::For(0, nChunks, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType chunki = begin; chunki < end; ++chunki)
+    {
+      const char* ptr = body.data() + bounds[chunki];
+      const char* const last = body.data() + bounds[chunki + 1];
+      ValueT* out = values + chunkBegin[chunki];
+      while (true)
+      {
+        while (ptr != last && ::IsListSeparator(*ptr))
+        {
+          ++ptr;
+        }
+        if (ptr == last)
+        {
+          break;
+        }
+        ParseT value;
+        if (!::ParseListValue(ptr, last, value) || (ptr != last && !::IsListSeparator(*ptr)))
+        {
+          valid = false;
+          return;
+        }
+        *out++ = static_cast<ValueT>(value);
+      }
+    }
+  });
+  return valid;
+}
+
+// Parse the sublists "n(a b c)" or "(a b c)" of a part of an ASCII labelListList body.
+// Without offsets and values, only counts the sublists and their values.
+bool ParseAsciiLabelListListChunk(const char* ptr, const char* end, vtkIdType& nSublists,
+  vtkIdType& nValues, vtkTypeInt64 valueBase = 0, vtkTypeInt64* offsets = nullptr,
+  vtkTypeInt64* values = nullptr)
+{
+  nSublists = 0;
+  nValues = 0;
+  while (true)
+  {
+    while (ptr != end && isspace(static_cast<unsigned char>(*ptr)))
+    {
+      ++ptr;
+    }
+    if (ptr == end)
+    {
+      return true;
+    }
+
+    vtkTypeInt64 sublistLen = -1;
+    if (*ptr != '(')
+    {
+      if (!::ParseListValue(ptr, end, sublistLen) || sublistLen < 0)
+      {
+        return false;
+      }
+      while (ptr != end && isspace(static_cast<unsigned char>(*ptr)))
+      {
+        ++ptr;
+      }
+      if (ptr == end || *ptr != '(')
+      {
+        return false;
+      }
+    }
+    ++ptr;
+
+    if (offsets)
+    {
+      offsets[nSublists] = valueBase + nValues;
+    }
+    const vtkIdType sublistBegin = nValues;
+    while (true)
+    {
+      while (ptr != end && isspace(static_cast<unsigned char>(*ptr)))
+      {
+        ++ptr;
+      }
+      if (ptr == end)
+      {
+        return false;
+      }
+      if (*ptr == ')')
+      {
+        ++ptr;
+        break;
+      }
+      vtkTypeInt64 value;
+      if (!::ParseListValue(ptr, end, value) || (ptr != end && !::IsListSeparator(*ptr)))
+      {
+        return false;
+      }
+      if (values)
+      {
+        values[nValues] = value;
+      }
+      ++nValues;
+    }
+    if (sublistLen >= 0 && sublistLen != nValues - sublistBegin)
+    {
+      return false;
+    }
+    ++nSublists;
+  }
+}
+
+} // End anonymous namespace
+
 //------------------------------------------------------------------------------
 // struct vtkFoamRead for reading primitives, lists etc.
 
@@ -3489,13 +3854,25 @@ struct vtkFoamRead
       this->Ptr->FillValue(value);
     }
 
+    // Reads the values and the closing ')'
     void ReadAsciiList(vtkFoamIOobject& io)
     {
       const vtkIdType nTuples = this->Ptr->GetNumberOfTuples();
+      if (nTuples >= io.GetMinimumParallelListSize())
+      {
+        std::string body;
+        io.ReadListBody(body, 0);
+        if (!::ParseAsciiListBody<primitiveT>(body, this->Ptr->GetPointer(0), nTuples))
+        {
+          throw vtkFoamError() << "Failed to parse a list of " << nTuples << " values";
+        }
+        return;
+      }
       for (vtkIdType i = 0; i < nTuples; ++i)
       {
         this->Ptr->SetValue(i, vtkFoamReadValue<primitiveT>::ReadValue(io));
       }
+      io.ReadExpecting(')');
     }
 
     void ReadBinaryList(vtkFoamIOobject& io)
@@ -3510,12 +3887,15 @@ struct vtkFoamRead
       }
       else
       {
-        auto* fileData = vtkDataArray::CreateDataArray(vtkTypeTraits<primitiveT>::VTKTypeID());
-        // nComponents == 1
-        fileData->SetNumberOfTuples(nTuples);
-        io.Read(reinterpret_cast<unsigned char*>(fileData->GetVoidPointer(0)), nbytes);
-        this->Ptr->DeepCopy(fileData);
-        fileData->Delete();
+        std::vector<primitiveT> fileData(nTuples);
+        io.Read(reinterpret_cast<unsigned char*>(fileData.data()), nbytes);
+        ValueType* values = this->Ptr->GetPointer(0);
+        ::ParallelListFor(io, nTuples, [&](vtkIdType begin, vtkIdType end) {
+          for (vtkIdType i = begin; i < end; ++i)
+          {
+            values[i] = static_cast<ValueType>(fileData[i]);
+          }
+        });
       }
     }
   };
@@ -3597,10 +3977,34 @@ struct vtkFoamRead
       }
     }
 
+    // Reads the values and the closing ')'
     void ReadAsciiList(vtkFoamIOobject& io)
     {
       const vtkIdType nTuples = this->Ptr->GetNumberOfTuples();
 
+      if (!isPositions && nTuples * nComponents >= io.GetMinimumParallelListSize())
+      {
+        // The tuples are enclosed in parentheses, read up to the ')' closing the list
+        std::string body;
+        io.ReadListBody(body, nTuples);
+        ValueType* values = this->Ptr->GetPointer(0);
+        if (!::ParseAsciiListBody<primitiveT>(body, values, nTuples * nComponents))
+        {
+          throw vtkFoamError() << "Failed to parse a list of " << nTuples << " tuples of "
+                               << nComponents << " values";
+        }
+        if (nComponents == 6)
+        {
+          ::ParallelListFor(io, nTuples, [values](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType i = begin; i < end; ++i)
+            {
+              ::remapFoamTuple<nComponents == 6>(values + nComponents * i); // For symmTensor
+            }
+          });
+        }
+        return;
+      }
+
       for (vtkIdType i = 0; i < nTuples; ++i)
       {
         io.ReadExpecting('(');
@@ -3616,6 +4020,7 @@ struct vtkFoamRead
           this->LagrangianPositionsSkip(io);
         }
       }
+      io.ReadExpecting(')');
     }
 
     void ReadBinaryList(vtkFoamIOobject& io)
@@ -3646,26 +4051,35 @@ struct vtkFoamRead
       }
       else
       {
-        // Compiler hint for better unrolling:
-        VTK_ASSUME(this->Ptr->GetNumberOfComponents() == nComponents);
-
-        const unsigned tupleLength = (sizeof(primitiveT) * nComponents);
-        primitiveT tuple[nComponents];
+        // Read the whole list at once, then convert and remap the tuples in parallel
+        const vtkTypeInt64 nValues = nTuples * nComponents;
+        const vtkTypeInt64 nbytes = nValues * static_cast<vtkTypeInt64>(sizeof(primitiveT));
+        ValueType* values = this->Ptr->GetPointer(0);
+        std::vector<primitiveT> fileData;
+        primitiveT* tuples = reinterpret_cast<primitiveT*>(values);
+        if (typeid(ValueType) != typeid(primitiveT))
+        {
+          fileData.resize(nValues);
+          tuples = fileData.data();
+        }
 
-        for (vtkTypeInt64 i = 0; i < nTuples; ++i)
+        const vtkTypeInt64 readLength = io.Read(reinterpret_cast<unsigned char*>(tuples), nbytes);
+        if (readLength != nbytes)
         {
-          const int readLength = io.Read(reinterpret_cast<unsigned char*>(tuple), tupleLength);
-          if (readLength != tupleLength)
-          {
-            throw vtkFoamError() << "Failed to read tuple " << i << '/' << nTuples << ": Expected "
-                                 << tupleLength << " bytes, got " << readLength << " bytes.";
-          }
-          ::remapFoamTuple<nComponents == 6>(tuple); // For symmTensor
-          for (int cmpt = 0; cmpt < nComponents; ++cmpt)
+          throw vtkFoamError() << "Failed to read a list of " << nTuples << " tuples: Expected "
+                               << nbytes << " bytes, got " << readLength << " bytes.";
+        }
+        ::ParallelListFor(io, nTuples, [values, tuples](vtkIdType begin, vtkIdType end) {
+          for (vtkIdType i = begin; i < end; ++i)
           {
-            this->Ptr->SetTypedComponent(i, cmpt, static_cast<ValueType>(tuple[cmpt]));
+            primitiveT* tuple = tuples + nComponents * i;
+            ::remapFoamTuple<nComponents == 6>(tuple); // For symmTensor
+            for (int cmpt = 0; cmpt < nComponents; ++cmpt)
+            {
+              values[nComponents * i + cmpt] = static_cast<ValueType>(tuple[cmpt]);
+            }
           }
-        }
+        });
       }
     }
   };
@@ -3803,6 +4217,10 @@ public:
   // Read compact labelListList which has offsets and data
   void ReadCompactLabelListList(vtkFoamIOobject& io);
 
+  // Read the listLen sublists and the closing ')' of a large ASCII labelListList,
+  // with its chunks parsed in parallel
+  void ReadAsciiLabelListListParallel(vtkFoamIOobject& io, vtkTypeInt64 listLen);
+
   // Read dimensions set (always ASCII). The leading '[' has already been removed before calling.
   // - can be integer or floating point
   // - user-generated files may have only the first five dimensions.
@@ -3858,7 +4276,6 @@ void vtkFoamEntryValue::ReadNonUniformList(vtkFoamIOobject& io)
         throw vtkFoamError() << "Expected '(', found " << currToken;
       }
       list.ReadAsciiList(io);
-      io.ReadExpecting(')');
     }
     else
     {
@@ -4066,6 +4483,13 @@ void vtkFoamEntryValue::ReadLabelListList(vtkFoamIOobject& io)
 
     this->Superclass::Type = vtkFoamToken::LABELLISTLIST;
     io.ReadExpecting('(');
+
+    if (io.IsAsciiFormat() && listLen >= io.GetMinimumParallelMeshSize())
+    {
+      this->ReadAsciiLabelListListParallel(io, listLen);
+      return;
+    }
+
     vtkIdType nTotalElems = 0;
     for (vtkTypeInt64 idx = 0; idx < listLen; ++idx)
     {
@@ -4138,6 +4562,53 @@ void vtkFoamEntryValue::ReadLabelListList(vtkFoamIOobject& io)
   }
 }
 
+void vtkFoamEntryValue::ReadAsciiLabelListListParallel(vtkFoamIOobject& io, vtkTypeInt64 listLen)
+{
+  std::string body;
+  io.ReadListBody(body, listLen);
+
+  const std::vector<size_t> bounds = ::SplitListBody(body, true);
+  const vtkIdType nChunks = static_cast<vtkIdType>(bounds.size()) - 1;
+
+  // First pass: prefix sums of the number of sublists and values of each chunk
+  std::vector<vtkIdType> sublistBegin(nChunks + 1, 0);
+  std::vector<vtkIdType> valueBegin(nChunks + 1, 0);
+  std::atomic<bool> valid(true);
+  vtkSMPTools::For(0, nChunks, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType chunki = begin; chunki < end; ++chunki)
+    {
+      if (!::ParseAsciiLabelListListChunk(body.data() + bounds[chunki],
+            body.data() + bounds[chunki + 1], sublistBegin[chunki + 1], valueBegin[chunki + 1]))
+      {
+        valid = false;
+      }
+    }
+  });
+  std::partial_sum(sublistBegin.begin(), sublistBegin.end(), sublistBegin.begin());
+  std::partial_sum(valueBegin.begin(), valueBegin.end(), valueBegin.begin());
+  if (!valid || sublistBegin[nChunks] != listLen)
+  {
+    throw vtkFoamError() << "Failed to parse a list of " << listLen << " lists";
+  }
+
+  // Second pass: fill the offsets and values (always 64-bit for ASCII)
+  this->LabelListListPtr->ResizeExact(listLen, valueBegin[nChunks]);
+  vtkTypeInt64* offsets =
+    static_cast<vtkTypeInt64*>(this->LabelListListPtr->GetOffsetsArray()->GetVoidPointer(0));
+  vtkTypeInt64* values =
+    static_cast<vtkTypeInt64*>(this->LabelListListPtr->GetDataArray()->GetVoidPointer(0));
+  vtkSMPTools::For(0, nChunks, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType chunki = begin; chunki < end; ++chunki)
+    {
+      vtkIdType nSublists, nValues;
+      ::ParseAsciiLabelListListChunk(body.data() + bounds[chunki],
+        body.data() + bounds[chunki + 1], nSublists, nValues, valueBegin[chunki],
+        offsets + sublistBegin[chunki], values + valueBegin[chunki]);
+    }
+  });
+  offsets[listLen] = valueBegin[nChunks];
+}
+
 // Read compact labelListList which has offsets and data
 void vtkFoamEntryValue::ReadCompactLabelListList(vtkFoamIOobject& io)
 {
@@ -7175,181 +7646,396 @@ bool vtkOpenFOAMReaderPrivate::CheckFaceList(const vtkFoamLabelListList& faces)
 }
 
 //------------------------------------------------------------------------------
-// determine cell shape and insert the cell into the mesh
-// hexahedron, prism, pyramid, tetrahedron and decompose polyhedron
-void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
-  vtkUnstructuredGrid* internalMesh, std::unique_ptr<vtkFoamLabelListList>& meshCellsPtr,
-  const vtkFoamLabelListList& meshFaces, vtkIdList* cellLabels
-#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
-  ,
-  vtkIdTypeArray* additionalCells, vtkFloatArray* pointArray
-#endif
-)
+// Scratch space and cell sinks for vtkOpenFOAMReaderPrivate::InsertCellToSink()
+
+struct vtkFoamCellScratch
 {
-  // Scratch arrays
-  vtkFoamStackVector<vtkIdType, 256> cellPoints;  // For inserting primitive cell points
-  vtkFoamStackVector<vtkIdType, 256> polyOffsets; // For inserting polyhedral faces offsets
-  vtkFoamStackVector<vtkIdType, 1024> polyPoints; // For inserting polyhedral faces
-  vtkFoamLabelListList::CellType cellFaces;       // For analyzing cell types (shapes)
-  vtkFoamLabelListList::CellType facePoints;      // For processing individual cell faces
+  vtkFoamStackVector<vtkIdType, 256> CellPoints;  // For inserting primitive cell points
+  vtkFoamStackVector<vtkIdType, 256> PolyOffsets; // For inserting polyhedral faces offsets
+  vtkFoamStackVector<vtkIdType, 1024> PolyPoints; // For inserting polyhedral faces
+  vtkFoamLabelListList::CellType CellFaces;       // For analyzing cell types (shapes)
+  vtkFoamLabelListList::CellType FacePoints;      // For processing individual cell faces
+};
 
-  const bool faceOwner64Bit = ::Is64BitArray(this->FaceOwner);
-  const bool cellLabels64Bit = faceOwner64Bit; // reasonable assumption
+namespace
+{
 
-  const vtkIdType nCells = (cellLabels == nullptr ? this->NumCells : cellLabels->GetNumberOfIds());
+// Insert the cells directly into the grid
+struct vtkFoamGridCellSink
+{
+  vtkUnstructuredGrid* Grid;
 
-#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
-  // Local variable for polyhedral decomposition
-  vtkIdType nAdditionalPoints = 0;
+  void InsertCell(int cellType, vtkIdType nPoints, const vtkIdType* points)
+  {
+    this->Grid->InsertNextCell(cellType, nPoints, points);
+  }
 
-  if (additionalCells && cellLabels) // sanity check
+  void InsertPolyhedron(vtkIdType nPoints, const vtkIdType* points, vtkIdType nFaces,
+    vtkIdType* faceOffsets, vtkIdType* facePoints)
   {
-    vtkErrorMacro(<< "Decompose polyhedral is not supported on mesh subset");
-    return;
+    vtkNew<vtkIdTypeArray> offsets;
+    vtkNew<vtkIdTypeArray> connectivity;
+    vtkNew<vtkCellArray> faces;
+    offsets->SetArray(faceOffsets, nFaces + 1, 1);
+    connectivity->SetArray(facePoints, faceOffsets[nFaces], 1);
+    faces->SetData(offsets, connectivity);
+    this->Grid->InsertNextCell(VTK_POLYHEDRON, nPoints, points, faces);
   }
-#endif
-  if (!nCells)
+};
+
+// Collect the cells of a contiguous range of cells, so that ranges can be
+// built concurrently and then concatenated in order
+struct vtkFoamCellChunk
+{
+  std::vector<unsigned char> Types;
+  std::vector<vtkIdType> Sizes;
+  std::vector<vtkIdType> Connectivity;
+  // Polyhedral faces, NumFaces is zero for the other cell types
+  std::vector<vtkIdType> NumFaces;
+  std::vector<vtkIdType> FaceSizes;
+  std::vector<vtkIdType> FaceConnectivity;
+
+  void InsertCell(int cellType, vtkIdType nPoints, const vtkIdType* points)
   {
-    return;
+    this->Types.push_back(static_cast<unsigned char>(cellType));
+    this->Sizes.push_back(nPoints);
+    this->Connectivity.insert(this->Connectivity.end(), points, points + nPoints);
+    this->NumFaces.push_back(0);
   }
-  if (!meshCellsPtr)
+
+  void InsertPolyhedron(vtkIdType nPoints, const vtkIdType* points, vtkIdType nFaces,
+    const vtkIdType* faceOffsets, const vtkIdType* facePoints)
   {
-    meshCellsPtr = this->CreateCellFaces();
+    this->InsertCell(VTK_POLYHEDRON, nPoints, points);
+    this->NumFaces.back() = nFaces;
+    for (vtkIdType facei = 0; facei < nFaces; ++facei)
+    {
+      this->FaceSizes.push_back(faceOffsets[facei + 1] - faceOffsets[facei]);
+    }
+    this->FaceConnectivity.insert(
+      this->FaceConnectivity.end(), facePoints, facePoints + faceOffsets[nFaces]);
   }
-  const auto& meshCells = *meshCellsPtr;
+};
 
-  for (vtkIdType celli = 0; celli < nCells; ++celli)
+} // End anonymous namespace
+
+//------------------------------------------------------------------------------
+// determine cell shape and pass the cell to the sink
+// hexahedron, prism, pyramid, tetrahedron and polyhedron.
+// Polyhedra are only passed to the sink if insertPolyhedra is true, otherwise
+// VTK_POLYHEDRON is returned with the cell faces left in the scratch space
+template <typename SinkT>
+int vtkOpenFOAMReaderPrivate::InsertCellToSink(vtkIdType cellId,
+  const vtkFoamLabelListList& meshCells, const vtkFoamLabelListList& meshFaces,
+  vtkFoamCellScratch& scratch, SinkT& sink, bool insertPolyhedra)
+{
+  auto& cellPoints = scratch.CellPoints;
+  auto& polyOffsets = scratch.PolyOffsets;
+  auto& polyPoints = scratch.PolyPoints;
+  auto& cellFaces = scratch.CellFaces;
+  auto& facePoints = scratch.FacePoints;
+
+  const bool faceOwner64Bit = ::Is64BitArray(this->FaceOwner);
+
+  meshCells.GetCell(cellId, cellFaces);
+
+  // determine type of the cell
+  // cf. src/OpenFOAM/meshes/meshShapes/cellMatcher/{hex|prism|pyr|tet}-
+  // Matcher.C
+
+  int cellType = VTK_POLYHEDRON; // Fallback value
+  if (cellFaces.size() == 6)
   {
-    vtkIdType cellId = celli;
-    if (cellLabels != nullptr)
+    // Check for HEXAHEDRON
+    bool allQuads = false;
+    for (size_t facei = 0; facei < cellFaces.size(); ++facei)
     {
-      cellId = cellLabels->GetId(celli);
-      if (cellId < 0 || cellId >= this->NumCells)
+      allQuads = (meshFaces.GetSize(cellFaces[facei]) == 4);
+      if (!allQuads)
       {
-        // sanity check. bad values should have been removed before this
-        vtkWarningMacro(<< "cellLabels id " << cellId << " exceeds the number of cells " << nCells);
-        continue;
+        break;
+      }
+    }
+    if (allQuads)
+    {
+      cellType = VTK_HEXAHEDRON;
+    }
+  }
+  else if (cellFaces.size() == 5)
+  {
+    // Check for WEDGE or PYRAMID
+    int nTris = 0, nQuads = 0;
+    for (size_t facei = 0; facei < cellFaces.size(); ++facei)
+    {
+      const vtkIdType nPoints = meshFaces.GetSize(cellFaces[facei]);
+      if (nPoints == 3)
+      {
+        ++nTris;
+      }
+      else if (nPoints == 4)
+      {
+        ++nQuads;
+      }
+      else
+      {
+        break;
+      }
+    }
+    if (nTris == 2 && nQuads == 3)
+    {
+      cellType = VTK_WEDGE;
+    }
+    else if (nTris == 4 && nQuads == 1)
+    {
+      cellType = VTK_PYRAMID;
+    }
+  }
+  else if (cellFaces.size() == 4)
+  {
+    // Check for TETRA
+    bool allTris = false;
+    for (size_t facei = 0; facei < cellFaces.size(); ++facei)
+    {
+      allTris = (meshFaces.GetSize(cellFaces[facei]) == 3);
+      if (!allTris)
+      {
+        break;
       }
     }
+    if (allTris)
+    {
+      cellType = VTK_TETRA;
+    }
+  }
 
-    meshCells.GetCell(cellId, cellFaces);
+  // Cell shape constructor based on the one implemented by Terry
+  // Jordan, with lots of improvements. Not as elegant as the one in
+  // OpenFOAM but it's simple and works reasonably fast.
 
-    // determine type of the cell
-    // cf. src/OpenFOAM/meshes/meshShapes/cellMatcher/{hex|prism|pyr|tet}-
-    // Matcher.C
+  // Note: faces are flipped around their 0 point (as per OpenFOAM)
+  // to keep predictable face point ordering
 
-    int cellType = VTK_POLYHEDRON; // Fallback value
-    if (cellFaces.size() == 6)
+  // OpenFOAM "hex" | vtkHexahedron
+  if (cellType == VTK_HEXAHEDRON)
+  {
+    int nCellPoints = 0;
+
+    // Get first face in correct order
     {
-      // Check for HEXAHEDRON
-      bool allQuads = false;
-      for (size_t facei = 0; facei < cellFaces.size(); ++facei)
+      const vtkTypeInt64 cellFacei = cellFaces[0];
+      const bool isOwner = (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
+      meshFaces.GetCell(cellFacei, facePoints);
+
+      // Add face0 to cell points - flip owner to point inwards
+      cellPoints[nCellPoints++] = facePoints[0];
+      if (isOwner)
       {
-        allQuads = (meshFaces.GetSize(cellFaces[facei]) == 4);
-        if (!allQuads)
+        for (int fp = 3; fp > 0; --fp)
         {
-          break;
+          cellPoints[nCellPoints++] = facePoints[fp];
         }
       }
-      if (allQuads)
+      else
       {
-        cellType = VTK_HEXAHEDRON;
+        for (int fp = 1; fp < 4; ++fp)
+        {
+          cellPoints[nCellPoints++] = facePoints[fp];
+        }
       }
     }
-    else if (cellFaces.size() == 5)
+    const vtkIdType baseFacePoint0 = cellPoints[0];
+    const vtkIdType baseFacePoint2 = cellPoints[2];
+    vtkTypeInt64 cellOppositeFaceI = -1;
+    vtkTypeInt64 pivotMeshPoint = -1;
+    int dupPoint = -1;
+    for (int facei = 1; facei < 5; ++facei) // Skip face 0 (already done) and 5 (fallback)
     {
-      // Check for WEDGE or PYRAMID
-      int nTris = 0, nQuads = 0;
-      for (size_t facei = 0; facei < cellFaces.size(); ++facei)
+      const vtkTypeInt64 cellFacei = cellFaces[facei];
+      const bool isOwner = (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
+      meshFaces.GetCell(cellFacei, facePoints);
+
+      int foundDup = -1;
+      int pointI = 0;
+      for (; pointI < 4; ++pointI) // each face point
       {
-        const vtkIdType nPoints = meshFaces.GetSize(cellFaces[facei]);
-        if (nPoints == 3)
+        // matching two points in base face is enough to find a
+        // duplicated point since neighboring faces share two
+        // neighboring points (i. e. an edge)
+        if (baseFacePoint0 == facePoints[pointI])
         {
-          ++nTris;
+          foundDup = 0;
+          break;
         }
-        else if (nPoints == 4)
+        else if (baseFacePoint2 == facePoints[pointI])
         {
-          ++nQuads;
+          foundDup = 2;
+          break;
         }
-        else
+      }
+      if (foundDup == -1)
+      {
+        // No duplicate points found, this is the opposite face
+        cellOppositeFaceI = cellFacei;
+        if (pivotMeshPoint >= 0)
         {
           break;
         }
       }
-      if (nTris == 2 && nQuads == 3)
+      else if (pivotMeshPoint == -1)
       {
-        cellType = VTK_WEDGE;
+        // Has duplicate point(s) - find the pivot point if still unknown
+        dupPoint = foundDup;
+
+        const vtkTypeInt64 faceNextPoint = facePoints[(pointI + 1) % 4];
+        const vtkTypeInt64 facePrevPoint = facePoints[(3 + pointI) % 4];
+
+        // if the next point of the faceI-th face matches the
+        // previous point of the base face use the previous point
+        // of the faceI-th face as the pivot point; or use the
+        // next point otherwise
+        if (faceNextPoint == (isOwner ? cellPoints[1 + foundDup] : cellPoints[3 - foundDup]))
+        {
+          pivotMeshPoint = facePrevPoint;
+        }
+        else
+        {
+          pivotMeshPoint = faceNextPoint;
+        }
+
+        if (cellOppositeFaceI >= 0)
+        {
+          break;
+        }
       }
-      else if (nTris == 4 && nQuads == 1)
+    }
+
+    // if the opposite face is not found until face 4, face 5 is
+    // always the opposite face
+    if (cellOppositeFaceI == -1)
+    {
+      cellOppositeFaceI = cellFaces[5];
+    }
+
+    // Find the pivot point in opposite face
+    meshFaces.GetCell(cellOppositeFaceI, facePoints);
+    int pivotPointI = 0;
+    for (; pivotPointI < 4; ++pivotPointI)
+    {
+      if (pivotMeshPoint == facePoints[pivotPointI])
       {
-        cellType = VTK_PYRAMID;
+        break;
       }
     }
-    else if (cellFaces.size() == 4)
+
+    // shift the pivot point if the point corresponds to point 2
+    // of the base face
+    if (dupPoint == 2)
     {
-      // Check for TETRA
-      bool allTris = false;
-      for (size_t facei = 0; facei < cellFaces.size(); ++facei)
+      pivotPointI = (pivotPointI + 2) % 4;
+    }
+
+    // Copy last (opposite) face in correct order. Copy into cellPoints list
+    {
+      const bool isOwner =
+        (cellId == GetLabelValue(this->FaceOwner, cellOppositeFaceI, faceOwner64Bit));
+
+      if (isOwner)
       {
-        allTris = (meshFaces.GetSize(cellFaces[facei]) == 3);
-        if (!allTris)
+        for (int fp = pivotPointI; fp < 4; ++fp)
         {
-          break;
+          cellPoints[nCellPoints++] = facePoints[fp];
+        }
+        for (int fp = 0; fp < pivotPointI; ++fp)
+        {
+          cellPoints[nCellPoints++] = facePoints[fp];
         }
       }
-      if (allTris)
+      else
       {
-        cellType = VTK_TETRA;
+        for (int fp = pivotPointI; fp >= 0; --fp)
+        {
+          cellPoints[nCellPoints++] = facePoints[fp];
+        }
+        for (int fp = 3; fp > pivotPointI; --fp)
+        {
+          cellPoints[nCellPoints++] = facePoints[fp];
+        }
       }
     }
 
-    // Cell shape constructor based on the one implemented by Terry
-    // Jordan, with lots of improvements. Not as elegant as the one in
-    // OpenFOAM but it's simple and works reasonably fast.
+    // Add HEXAHEDRON (hex) cell to the mesh
+    sink.InsertCell(VTK_HEXAHEDRON, 8, cellPoints.data());
+  }
 
-    // Note: faces are flipped around their 0 point (as per OpenFOAM)
-    // to keep predictable face point ordering
+  // OpenFOAM "prism" | vtkWedge
+  // - cell construction similar to "hex",
+  // but the OpenFOAM face0 points inwards (like hex) and VTK face0 points outwards
+  // so point ordering is reversed
+  else if (cellType == VTK_WEDGE)
+  {
+    int nCellPoints = 0;
 
-    // OpenFOAM "hex" | vtkHexahedron
-    if (cellType == VTK_HEXAHEDRON)
+    // Find the base face number and get it in correct order
+    int baseFaceId = 0;
     {
-      int nCellPoints = 0;
-
-      // Get first face in correct order
+      for (int facei = 0; facei < 5; ++facei)
       {
-        const vtkTypeInt64 cellFacei = cellFaces[0];
-        const bool isOwner = (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
-        meshFaces.GetCell(cellFacei, facePoints);
+        if (meshFaces.GetSize(cellFaces[facei]) == 3)
+        {
+          baseFaceId = facei;
+          break;
+        }
+      }
+
+      const vtkTypeInt64 cellFacei = cellFaces[baseFaceId];
+      const bool isOwner = (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
+      meshFaces.GetCell(cellFacei, facePoints);
 
-        // Add face0 to cell points - flip owner to point inwards
-        cellPoints[nCellPoints++] = facePoints[0];
-        if (isOwner)
+      // Add face0 to cell points - flip neighbour to point outwards
+      // - OpenFOAM face0 points inwards
+      // - VTK face0 points outwards
+      cellPoints[nCellPoints++] = facePoints[0];
+      if (isOwner)
+      {
+        for (int fp = 1; fp < 3; ++fp)
         {
-          for (int fp = 3; fp > 0; --fp)
-          {
-            cellPoints[nCellPoints++] = facePoints[fp];
-          }
+          cellPoints[nCellPoints++] = facePoints[fp];
         }
-        else
+      }
+      else
+      {
+        for (int fp = 2; fp > 0; --fp)
         {
-          for (int fp = 1; fp < 4; ++fp)
-          {
-            cellPoints[nCellPoints++] = facePoints[fp];
-          }
+          cellPoints[nCellPoints++] = facePoints[fp];
         }
       }
-      const vtkIdType baseFacePoint0 = cellPoints[0];
-      const vtkIdType baseFacePoint2 = cellPoints[2];
-      vtkTypeInt64 cellOppositeFaceI = -1;
-      vtkTypeInt64 pivotMeshPoint = -1;
-      int dupPoint = -1;
-      for (int facei = 1; facei < 5; ++facei) // Skip face 0 (already done) and 5 (fallback)
+    }
+    const vtkIdType baseFacePoint0 = cellPoints[0];
+    const vtkIdType baseFacePoint2 = cellPoints[2];
+
+    vtkTypeInt64 cellOppositeFaceI = -1;
+    vtkTypeInt64 pivotMeshPoint = -1;
+    bool dupPoint2 = false;
+    // Search for opposite face and pivot point
+    for (int facei = 0; facei < 5; ++facei)
+    {
+      if (facei == baseFaceId)
       {
-        const vtkTypeInt64 cellFacei = cellFaces[facei];
-        const bool isOwner = (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
+        continue;
+      }
+      const vtkTypeInt64 cellFacei = cellFaces[facei];
+      if (meshFaces.GetSize(cellFacei) == 3)
+      {
+        cellOppositeFaceI = cellFacei;
+      }
+      else if (pivotMeshPoint == -1)
+      {
+        // Find the pivot point if still unknown
+        const bool isOwner =
+          (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
         meshFaces.GetCell(cellFacei, facePoints);
 
-        int foundDup = -1;
+        bool found0Dup = false;
         int pointI = 0;
         for (; pointI < 4; ++pointI) // each face point
         {
@@ -7358,663 +8044,688 @@ void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
           // neighboring points (i. e. an edge)
           if (baseFacePoint0 == facePoints[pointI])
           {
-            foundDup = 0;
+            found0Dup = true;
             break;
           }
           else if (baseFacePoint2 == facePoints[pointI])
           {
-            foundDup = 2;
             break;
           }
         }
-        if (foundDup == -1)
+        // the matching point must always be found so omit the check
+        vtkIdType baseFacePrevPoint;
+        vtkIdType baseFaceNextPoint;
+        if (found0Dup)
         {
-          // No duplicate points found, this is the opposite face
-          cellOppositeFaceI = cellFacei;
-          if (pivotMeshPoint >= 0)
-          {
-            break;
-          }
+          baseFacePrevPoint = cellPoints[2];
+          baseFaceNextPoint = cellPoints[1];
         }
-        else if (pivotMeshPoint == -1)
+        else
         {
-          // Has duplicate point(s) - find the pivot point if still unknown
-          dupPoint = foundDup;
+          baseFacePrevPoint = cellPoints[1];
+          baseFaceNextPoint = cellPoints[0];
+          dupPoint2 = true;
+        }
 
-          const vtkTypeInt64 faceNextPoint = facePoints[(pointI + 1) % 4];
-          const vtkTypeInt64 facePrevPoint = facePoints[(3 + pointI) % 4];
+        const vtkTypeInt64 faceNextPoint = facePoints[(pointI + 1) % 4];
+        const vtkTypeInt64 facePrevPoint = facePoints[(3 + pointI) % 4];
 
-          // if the next point of the faceI-th face matches the
-          // previous point of the base face use the previous point
-          // of the faceI-th face as the pivot point; or use the
-          // next point otherwise
-          if (faceNextPoint == (isOwner ? cellPoints[1 + foundDup] : cellPoints[3 - foundDup]))
-          {
-            pivotMeshPoint = facePrevPoint;
-          }
-          else
-          {
-            pivotMeshPoint = faceNextPoint;
-          }
+        // if the next point of the faceI-th face matches the
+        // previous point of the base face use the previous point of
+        // the faceI-th face as the pivot point; or use the next
+        // point otherwise
 
-          if (cellOppositeFaceI >= 0)
-          {
-            break;
-          }
+        if (faceNextPoint == (isOwner ? baseFacePrevPoint : baseFaceNextPoint))
+        {
+          pivotMeshPoint = facePrevPoint;
+        }
+        else
+        {
+          pivotMeshPoint = faceNextPoint;
         }
       }
 
-      // if the opposite face is not found until face 4, face 5 is
-      // always the opposite face
-      if (cellOppositeFaceI == -1)
+      // break when both of opposite face and pivot point are found
+      if (cellOppositeFaceI >= 0 && pivotMeshPoint >= 0)
       {
-        cellOppositeFaceI = cellFaces[5];
+        break;
       }
+    }
 
-      // Find the pivot point in opposite face
-      meshFaces.GetCell(cellOppositeFaceI, facePoints);
-      int pivotPointI = 0;
-      for (; pivotPointI < 4; ++pivotPointI)
+    // Find the pivot point in opposite face
+    meshFaces.GetCell(cellOppositeFaceI, facePoints);
+    int pivotPointI = -1;
+    for (int fp = 0; fp < 3; ++fp)
+    {
+      if (pivotMeshPoint == facePoints[fp])
       {
-        if (pivotMeshPoint == facePoints[pivotPointI])
-        {
-          break;
-        }
+        pivotPointI = fp;
+        break;
       }
+    }
+
+    if (pivotPointI == -1)
+    {
+      // No pivot found - does not look like a wedge, process as polyhedron instead.
+      cellType = VTK_POLYHEDRON;
+    }
+    else
+    {
+      // Found a pivot - can process cell as a wedge
+      const bool isOwner =
+        (cellId == GetLabelValue(this->FaceOwner, cellOppositeFaceI, faceOwner64Bit));
 
-      // shift the pivot point if the point corresponds to point 2
-      // of the base face
-      if (dupPoint == 2)
+      if (isOwner)
       {
-        pivotPointI = (pivotPointI + 2) % 4;
+        if (dupPoint2)
+        {
+          pivotPointI = (pivotPointI + 2) % 3;
+        }
+        for (int fp = pivotPointI; fp >= 0; --fp)
+        {
+          cellPoints[nCellPoints++] = facePoints[fp];
+        }
+        for (int fp = 2; fp > pivotPointI; --fp)
+        {
+          cellPoints[nCellPoints++] = facePoints[fp];
+        }
       }
-
-      // Copy last (opposite) face in correct order. Copy into cellPoints list
+      else
       {
-        const bool isOwner =
-          (cellId == GetLabelValue(this->FaceOwner, cellOppositeFaceI, faceOwner64Bit));
-
-        if (isOwner)
+        // shift the pivot point if the point corresponds to point 2
+        // of the base face
+        if (dupPoint2)
         {
-          for (int fp = pivotPointI; fp < 4; ++fp)
-          {
-            cellPoints[nCellPoints++] = facePoints[fp];
-          }
-          for (int fp = 0; fp < pivotPointI; ++fp)
-          {
-            cellPoints[nCellPoints++] = facePoints[fp];
-          }
+          pivotPointI = (1 + pivotPointI) % 3;
         }
-        else
+        // copy the face-point list of the opposite face to cellPoints list
+        for (int fp = pivotPointI; fp < 3; ++fp)
         {
-          for (int fp = pivotPointI; fp >= 0; --fp)
-          {
-            cellPoints[nCellPoints++] = facePoints[fp];
-          }
-          for (int fp = 3; fp > pivotPointI; --fp)
-          {
-            cellPoints[nCellPoints++] = facePoints[fp];
-          }
+          cellPoints[nCellPoints++] = facePoints[fp];
+        }
+        for (int fp = 0; fp < pivotPointI; ++fp)
+        {
+          cellPoints[nCellPoints++] = facePoints[fp];
         }
       }
 
-      // Add HEXAHEDRON (hex) cell to the mesh
-      internalMesh->InsertNextCell(VTK_HEXAHEDRON, 8, cellPoints.data());
+      // Add WEDGE (prism) cell to the mesh
+      sink.InsertCell(VTK_WEDGE, 6, cellPoints.data());
     }
+  }
 
-    // OpenFOAM "prism" | vtkWedge
-    // - cell construction similar to "hex",
-    // but the OpenFOAM face0 points inwards (like hex) and VTK face0 points outwards
-    // so point ordering is reversed
-    else if (cellType == VTK_WEDGE)
+  // OpenFOAM "pyr" | vtkPyramid || OpenFOAM "tet" | vtkTetrahedron
+  else if (cellType == VTK_PYRAMID || cellType == VTK_TETRA)
+  {
+    int nCellPoints = 0;
+    int baseFaceId = 0;
+    if (cellType == VTK_PYRAMID)
     {
-      int nCellPoints = 0;
-
-      // Find the base face number and get it in correct order
-      int baseFaceId = 0;
+      // Find the pyramid base
+      for (size_t facei = 0; facei < cellFaces.size(); ++facei)
       {
-        for (int facei = 0; facei < 5; ++facei)
+        if (meshFaces.GetSize(cellFaces[facei]) == 4)
         {
-          if (meshFaces.GetSize(cellFaces[facei]) == 3)
-          {
-            baseFaceId = facei;
-            break;
-          }
+          baseFaceId = static_cast<int>(facei);
+          break;
         }
+      }
+    }
 
-        const vtkTypeInt64 cellFacei = cellFaces[baseFaceId];
-        const bool isOwner = (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
-        meshFaces.GetCell(cellFacei, facePoints);
+    // Add base-face points to cell points - flip for owner (to point inwards)
+    {
+      const vtkTypeInt64 cellFacei = cellFaces[baseFaceId];
+      const bool isOwner = (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
+      meshFaces.GetCell(cellFacei, facePoints);
+      const size_t nFacePoints = facePoints.size();
 
-        // Add face0 to cell points - flip neighbour to point outwards
-        // - OpenFOAM face0 points inwards
-        // - VTK face0 points outwards
-        cellPoints[nCellPoints++] = facePoints[0];
-        if (isOwner)
+      cellPoints[nCellPoints++] = facePoints[0];
+      if (isOwner)
+      {
+        for (size_t fp = nFacePoints - 1; fp > 0; --fp)
         {
-          for (int fp = 1; fp < 3; ++fp)
-          {
-            cellPoints[nCellPoints++] = facePoints[fp];
-          }
+          cellPoints[nCellPoints++] = facePoints[fp];
         }
-        else
+      }
+      else
+      {
+        for (size_t fp = 1; fp < nFacePoints; ++fp)
         {
-          for (int fp = 2; fp > 0; --fp)
-          {
-            cellPoints[nCellPoints++] = facePoints[fp];
-          }
+          cellPoints[nCellPoints++] = facePoints[fp];
         }
       }
-      const vtkIdType baseFacePoint0 = cellPoints[0];
-      const vtkIdType baseFacePoint2 = cellPoints[2];
+    }
 
-      vtkTypeInt64 cellOppositeFaceI = -1;
-      vtkTypeInt64 pivotMeshPoint = -1;
-      bool dupPoint2 = false;
-      // Search for opposite face and pivot point
-      for (int facei = 0; facei < 5; ++facei)
+    // Take any other face to find the apex point
+    vtkFoamLabelListList::CellType otherFacePoints;
+    meshFaces.GetCell(cellFaces[(baseFaceId ? 0 : 1)], otherFacePoints);
+
+    // Find the apex point (non-common to the base)
+    // initialize with anything
+    // - if the search really fails, we have much bigger problems anyhow
+    vtkIdType apexMeshPointi = 0;
+    for (size_t otheri = 0; otheri < otherFacePoints.size(); ++otheri)
+    {
+      apexMeshPointi = otherFacePoints[otheri];
+      bool isUnique = true;
+      for (size_t fp = 0; isUnique && fp < facePoints.size(); ++fp)
       {
-        if (facei == baseFaceId)
-        {
-          continue;
-        }
-        const vtkTypeInt64 cellFacei = cellFaces[facei];
-        if (meshFaces.GetSize(cellFacei) == 3)
+        isUnique = (apexMeshPointi != facePoints[fp]);
+      }
+      if (isUnique)
+      {
+        break;
+      }
+    }
+
+    // ... and add the apex-point
+    cellPoints[nCellPoints++] = apexMeshPointi;
+
+    // Add tetra or pyramid to the mesh
+    sink.InsertCell(cellType, nCellPoints, cellPoints.data());
+  }
+
+  // Polyhedron cell (vtkPolyhedron)
+  if (cellType == VTK_POLYHEDRON)
+  {
+    // Preliminary checks for sizes and sanity check
+
+    size_t nPolyPoints = 0;
+    {
+      bool allEmpty = true;
+      for (size_t facei = 0; facei < cellFaces.size(); ++facei)
+      {
+        const size_t nFacePoints = meshFaces.GetSize(cellFaces[facei]);
+        nPolyPoints += nFacePoints;
+        if (nFacePoints)
         {
-          cellOppositeFaceI = cellFacei;
+          allEmpty = false;
         }
-        else if (pivotMeshPoint == -1)
-        {
-          // Find the pivot point if still unknown
-          const bool isOwner =
-            (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
-          meshFaces.GetCell(cellFacei, facePoints);
+      }
+      if (allEmpty)
+      {
+        vtkWarningMacro("Warning: No points in cellId " << cellId);
+        sink.InsertCell(VTK_EMPTY_CELL, 0, cellPoints.data());
+        return VTK_EMPTY_CELL;
+      }
+    }
 
-          bool found0Dup = false;
-          int pointI = 0;
-          for (; pointI < 4; ++pointI) // each face point
-          {
-            // matching two points in base face is enough to find a
-            // duplicated point since neighboring faces share two
-            // neighboring points (i. e. an edge)
-            if (baseFacePoint0 == facePoints[pointI])
-            {
-              found0Dup = true;
-              break;
-            }
-            else if (baseFacePoint2 == facePoints[pointI])
-            {
-              break;
-            }
-          }
-          // the matching point must always be found so omit the check
-          vtkIdType baseFacePrevPoint;
-          vtkIdType baseFaceNextPoint;
-          if (found0Dup)
-          {
-            baseFacePrevPoint = cellPoints[2];
-            baseFaceNextPoint = cellPoints[1];
-          }
-          else
-          {
-            baseFacePrevPoint = cellPoints[1];
-            baseFaceNextPoint = cellPoints[0];
-            dupPoint2 = true;
-          }
+    if (!insertPolyhedra)
+    {
+      return VTK_POLYHEDRON;
+    }
 
-          const vtkTypeInt64 faceNextPoint = facePoints[(pointI + 1) % 4];
-          const vtkTypeInt64 facePrevPoint = facePoints[(3 + pointI) % 4];
+    // Not decomposed - using VTK_POLYHEDRON
+    // Not decomposed - using VTK_POLYHEDRON
+
+    // Precalculated 'nPolyPoints' has all face points, including duplicates
+    // - need nPolyPoints + nPolyFaces for the face loops
+    // - use nPolyPoints to estimate unique cell points
+    //   (assume a point connects at least three faces)
+
+    cellPoints.copy_resize(0);
+    polyPoints.copy_resize(0);
+    polyOffsets.copy_resize(0);
+    cellPoints.copy_reserve(nPolyPoints / 3);
+    polyPoints.copy_reserve(nPolyPoints);
+    polyOffsets.copy_reserve(cellFaces.size() + 1);
+
+    size_t nCellPoints = 0;
+    nPolyPoints = 0; // Reset
+    polyOffsets[0] = 0;
+    for (size_t facei = 0; facei < cellFaces.size(); ++facei)
+    {
+      const vtkTypeInt64 cellFacei = cellFaces[facei];
+      const bool isOwner =
+        (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
+      meshFaces.GetCell(cellFacei, facePoints);
+      const size_t nFacePoints = facePoints.size();
+      size_t nUnique = 0;
 
-          // if the next point of the faceI-th face matches the
-          // previous point of the base face use the previous point of
-          // the faceI-th face as the pivot point; or use the next
-          // point otherwise
+      // Pass 1: add face points, and mark up duplicates on the way
 
-          if (faceNextPoint == (isOwner ? baseFacePrevPoint : baseFaceNextPoint))
-          {
-            pivotMeshPoint = facePrevPoint;
-          }
-          else
-          {
-            pivotMeshPoint = faceNextPoint;
-          }
-        }
+      polyPoints.copy_resize(nPolyPoints + nFacePoints);
+      polyOffsets[facei + 1] = polyOffsets[facei] + static_cast<vtkIdType>(nFacePoints);
 
-        // break when both of opposite face and pivot point are found
-        if (cellOppositeFaceI >= 0 && pivotMeshPoint >= 0)
-        {
-          break;
-        }
+      if (!nFacePoints)
+      {
+        continue;
       }
 
-      // Find the pivot point in opposite face
-      meshFaces.GetCell(cellOppositeFaceI, facePoints);
-      int pivotPointI = -1;
-      for (int fp = 0; fp < 3; ++fp)
+      // Add face point 0
       {
-        if (pivotMeshPoint == facePoints[fp])
+        const auto meshPointi = static_cast<vtkIdType>(facePoints[0]);
+        polyPoints[nPolyPoints++] = meshPointi;
+        bool isUnique = true;
+        for (size_t cp = 0; isUnique && cp < nCellPoints; ++cp)
         {
-          pivotPointI = fp;
-          break;
+          isUnique = (meshPointi != cellPoints[cp]);
+        }
+        if (isUnique)
+        {
+          ++nUnique;
+        }
+        else
+        {
+          facePoints[0] = -1; // Duplicate
         }
       }
 
-      if (pivotPointI == -1)
-      {
-        // No pivot found - does not look like a wedge, process as polyhedron instead.
-        cellType = VTK_POLYHEDRON;
-      }
-      else
+      // Add other face points
       {
-        // Found a pivot - can process cell as a wedge
-        const bool isOwner =
-          (cellId == GetLabelValue(this->FaceOwner, cellOppositeFaceI, faceOwner64Bit));
+        // Local face point indexing - must be signed
+        const int faceDirn = (isOwner ? 1 : -1); // Flip direction for neighbour face
+        int facePointi = (isOwner ? 1 : static_cast<int>(nFacePoints) - 1);
 
-        if (isOwner)
+        for (size_t fp = 1; fp < nFacePoints; ++fp, facePointi += faceDirn)
         {
-          if (dupPoint2)
+          const auto meshPointi = static_cast<vtkIdType>(facePoints[facePointi]);
+          polyPoints[nPolyPoints++] = meshPointi;
+          bool isUnique = true;
+          for (size_t cp = 0; isUnique && cp < nCellPoints; ++cp)
           {
-            pivotPointI = (pivotPointI + 2) % 3;
+            isUnique = (meshPointi != cellPoints[cp]);
           }
-          for (int fp = pivotPointI; fp >= 0; --fp)
+          if (isUnique)
           {
-            cellPoints[nCellPoints++] = facePoints[fp];
+            ++nUnique;
           }
-          for (int fp = 2; fp > pivotPointI; --fp)
+          else
           {
-            cellPoints[nCellPoints++] = facePoints[fp];
+            facePoints[facePointi] = -1; // Duplicate
           }
         }
-        else
+      }
+
+      cellPoints.copy_resize(nCellPoints + nUnique);
+
+      // Pass 2: add unique cell points - order is arbitrary
+      for (size_t fp = 0; fp < nFacePoints; ++fp)
+      {
+        const auto meshPointi = static_cast<vtkIdType>(facePoints[fp]);
+        if (meshPointi != -1) // isUnique
         {
-          // shift the pivot point if the point corresponds to point 2
-          // of the base face
-          if (dupPoint2)
-          {
-            pivotPointI = (1 + pivotPointI) % 3;
-          }
-          // copy the face-point list of the opposite face to cellPoints list
-          for (int fp = pivotPointI; fp < 3; ++fp)
-          {
-            cellPoints[nCellPoints++] = facePoints[fp];
-          }
-          for (int fp = 0; fp < pivotPointI; ++fp)
-          {
-            cellPoints[nCellPoints++] = facePoints[fp];
-          }
+          cellPoints[nCellPoints++] = meshPointi;
         }
+      }
+    }
+    // Create the poly cell and insert it into the mesh
+    sink.InsertPolyhedron(static_cast<vtkIdType>(nCellPoints), cellPoints.data(),
+      static_cast<vtkIdType>(cellFaces.size()), polyOffsets.data(), polyPoints.data());
+  }
+  return cellType;
+}
+
+//------------------------------------------------------------------------------
+// determine cell shape and insert the cell into the mesh
+// hexahedron, prism, pyramid, tetrahedron and decompose polyhedron
+void vtkOpenFOAMReaderPrivate::InsertCellsToGrid(
+  vtkUnstructuredGrid* internalMesh, std::unique_ptr<vtkFoamLabelListList>& meshCellsPtr,
+  const vtkFoamLabelListList& meshFaces, vtkIdList* cellLabels
+#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
+  ,
+  vtkIdTypeArray* additionalCells, vtkFloatArray* pointArray
+#endif
+)
+{
+  const vtkIdType nCells = (cellLabels == nullptr ? this->NumCells : cellLabels->GetNumberOfIds());
+
+  bool decompose = false;
+#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
+  // Local variable for polyhedral decomposition
+  vtkIdType nAdditionalPoints = 0;
+  const bool faceOwner64Bit = ::Is64BitArray(this->FaceOwner);
+  const bool cellLabels64Bit = faceOwner64Bit; // reasonable assumption
+
+  if (additionalCells && cellLabels) // sanity check
+  {
+    vtkErrorMacro(<< "Decompose polyhedral is not supported on mesh subset");
+    return;
+  }
+  decompose = (additionalCells != nullptr);
+#endif
+  if (!nCells)
+  {
+    return;
+  }
+  if (!meshCellsPtr)
+  {
+    meshCellsPtr = this->CreateCellFaces();
+  }
+  const auto& meshCells = *meshCellsPtr;
+
+  // The decomposition appends points and cells in cell order, so it remains serial
+  if (!decompose && nCells >= this->Parent->GetMinimumParallelMeshSize())
+  {
+    this->InsertCellsToGridParallel(internalMesh, meshCells, meshFaces, cellLabels);
+    return;
+  }
 
-        // Add WEDGE (prism) cell to the mesh
-        internalMesh->InsertNextCell(VTK_WEDGE, 6, cellPoints.data());
+  vtkFoamCellScratch scratch;
+  vtkFoamGridCellSink sink{ internalMesh };
+  for (vtkIdType celli = 0; celli < nCells; ++celli)
+  {
+    vtkIdType cellId = celli;
+    if (cellLabels != nullptr)
+    {
+      cellId = cellLabels->GetId(celli);
+      if (cellId < 0 || cellId >= this->NumCells)
+      {
+        // sanity check. bad values should have been removed before this
+        vtkWarningMacro(<< "cellLabels id " << cellId << " exceeds the number of cells " << nCells);
+        continue;
       }
     }
 
-    // OpenFOAM "pyr" | vtkPyramid || OpenFOAM "tet" | vtkTetrahedron
-    else if (cellType == VTK_PYRAMID || cellType == VTK_TETRA)
+    const int cellType =
+      this->InsertCellToSink(cellId, meshCells, meshFaces, scratch, sink, !decompose);
+
+#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
+    if (cellType == VTK_POLYHEDRON && decompose)
     {
-      int nCellPoints = 0;
-      int baseFaceId = 0;
-      if (cellType == VTK_PYRAMID)
+      auto& cellPoints = scratch.CellPoints;
+      auto& cellFaces = scratch.CellFaces;
+      auto& facePoints = scratch.FacePoints;
+
+      // Decompose into tets and pyramids
+
+      // Calculate cell centroid and insert it to point list
+      vtkDataArray* polyCellPoints;
+      if (cellLabels64Bit)
       {
-        // Find the pyramid base
-        for (size_t facei = 0; facei < cellFaces.size(); ++facei)
-        {
-          if (meshFaces.GetSize(cellFaces[facei]) == 4)
-          {
-            baseFaceId = static_cast<int>(facei);
-            break;
-          }
-        }
+        polyCellPoints = vtkTypeInt64Array::New();
+      }
+      else
+      {
+        polyCellPoints = vtkTypeInt32Array::New();
       }
+      this->AdditionalCellPoints->push_back(polyCellPoints);
 
-      // Add base-face points to cell points - flip for owner (to point inwards)
+      double centroid[3];
+      centroid[0] = centroid[1] = centroid[2] = 0; // zero the contents
+      for (size_t facei = 0; facei < cellFaces.size(); ++facei)
       {
-        const vtkTypeInt64 cellFacei = cellFaces[baseFaceId];
-        const bool isOwner = (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
+        // Eliminate duplicate points from faces
+        const vtkTypeInt64 cellFacei = cellFaces[facei];
         meshFaces.GetCell(cellFacei, facePoints);
-        const size_t nFacePoints = facePoints.size();
-
-        cellPoints[nCellPoints++] = facePoints[0];
-        if (isOwner)
+        for (size_t fp = 0; fp < facePoints.size(); ++fp)
         {
-          for (size_t fp = nFacePoints - 1; fp > 0; --fp)
+          const vtkTypeInt64 meshPointi = facePoints[fp];
+          bool isUnique = true;
+          for (vtkIdType cp = 0; isUnique && cp < polyCellPoints->GetDataSize(); ++cp)
           {
-            cellPoints[nCellPoints++] = facePoints[fp];
+            isUnique = (meshPointi != GetLabelValue(polyCellPoints, cp, cellLabels64Bit));
           }
-        }
-        else
-        {
-          for (size_t fp = 1; fp < nFacePoints; ++fp)
+          if (isUnique)
           {
-            cellPoints[nCellPoints++] = facePoints[fp];
+            AppendLabelValue(polyCellPoints, meshPointi, cellLabels64Bit);
+            const float* tuple = pointArray->GetPointer(3 * meshPointi);
+            centroid[0] += static_cast<double>(tuple[0]);
+            centroid[1] += static_cast<double>(tuple[1]);
+            centroid[2] += static_cast<double>(tuple[2]);
           }
         }
       }
-
-      // Take any other face to find the apex point
-      vtkFoamLabelListList::CellType otherFacePoints;
-      meshFaces.GetCell(cellFaces[(baseFaceId ? 0 : 1)], otherFacePoints);
-
-      // Find the apex point (non-common to the base)
-      // initialize with anything
-      // - if the search really fails, we have much bigger problems anyhow
-      vtkIdType apexMeshPointi = 0;
-      for (size_t otheri = 0; otheri < otherFacePoints.size(); ++otheri)
+      polyCellPoints->Squeeze();
       {
-        apexMeshPointi = otherFacePoints[otheri];
-        bool isUnique = true;
-        for (size_t fp = 0; isUnique && fp < facePoints.size(); ++fp)
-        {
-          isUnique = (apexMeshPointi != facePoints[fp]);
-        }
-        if (isUnique)
-        {
-          break;
-        }
+        const double weight = 1.0 / static_cast<double>(polyCellPoints->GetDataSize());
+        centroid[0] *= weight;
+        centroid[1] *= weight;
+        centroid[2] *= weight;
       }
+      pointArray->InsertNextTuple(centroid);
 
-      // ... and add the apex-point
-      cellPoints[nCellPoints++] = apexMeshPointi;
+      // polyhedron decomposition.
+      // a tweaked algorithm based on OpenFOAM
+      // src/fileFormats/vtk/part/foamVtuSizingTemplates.C
 
-      // Add tetra or pyramid to the mesh
-      internalMesh->InsertNextCell(cellType, nCellPoints, cellPoints.data());
-    }
+      // TODO: improve consistency of face point ordering.
+      // - currently just flips the faces without preserving the face point 0 order.
+      bool firstCell = true;
+      int nAdditionalCells = 0;
+      for (size_t facei = 0; facei < cellFaces.size(); ++facei)
+      {
+        const vtkTypeInt64 cellFacei = cellFaces[facei];
+        const bool isOwner =
+          (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
+        meshFaces.GetCell(cellFacei, facePoints);
+        const size_t nFacePoints = facePoints.size();
 
-    // Polyhedron cell (vtkPolyhedron)
-    if (cellType == VTK_POLYHEDRON)
-    {
-      // Preliminary checks for sizes and sanity check
+        const int flipNeighbor = (isOwner ? -1 : 1);
+        const size_t nTris = (nFacePoints % 2);
 
-      size_t nPolyPoints = 0;
-      {
-        bool allEmpty = true;
-        for (size_t facei = 0; facei < cellFaces.size(); ++facei)
+        size_t vertI = 2;
+
+        // shift the start and end of the vertex loop if the
+        // triangle of a decomposed face is going to be flat. Far
+        // from perfect but better than nothing to avoid flat cells
+        // which stops time integration of Stream Tracer especially
+        // for split-hex unstructured meshes created by
+        // e. g. autoRefineMesh
+        if (nFacePoints >= 5 && nTris)
         {
-          const size_t nFacePoints = meshFaces.GetSize(cellFaces[facei]);
-          nPolyPoints += nFacePoints;
-          if (nFacePoints)
+          const float* point0 = pointArray->GetPointer(3 * facePoints[nFacePoints - 1]);
+          const float* point1 = pointArray->GetPointer(3 * facePoints[0]);
+          const float* point2 = pointArray->GetPointer(3 * facePoints[nFacePoints - 2]);
+          float vsizeSqr1 = 0.0F, vsizeSqr2 = 0.0F, dotProduct = 0.0F;
+          for (int i = 0; i < 3; i++)
           {
-            allEmpty = false;
+            const float v1 = point1[i] - point0[i];
+            const float v2 = point2[i] - point0[i];
+            vsizeSqr1 += v1 * v1;
+            vsizeSqr2 += v2 * v2;
+            dotProduct += v1 * v2;
+          }
+          // compare in squared representation to avoid using sqrt()
+          if (dotProduct * (float)fabs(dotProduct) / (vsizeSqr1 * vsizeSqr2) < -1.0F + 1.0e-3F)
+          {
+            vertI = 1;
           }
         }
-        if (allEmpty)
-        {
-          vtkWarningMacro("Warning: No points in cellId " << cellId);
-          internalMesh->InsertNextCell(VTK_EMPTY_CELL, 0, cellPoints.data());
-          continue;
-        }
-      }
 
-#if VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
-      if (additionalCells != nullptr)
-      {
-        // Decompose into tets and pyramids
+        cellPoints[0] = facePoints[(vertI == 2) ? static_cast<vtkIdType>(0)
+                                                : static_cast<vtkIdType>(nFacePoints - 1)];
+        cellPoints[4] = static_cast<vtkIdType>(this->NumPoints + nAdditionalPoints); // apex
 
-        // Calculate cell centroid and insert it to point list
-        vtkDataArray* polyCellPoints;
-        if (cellLabels64Bit)
-        {
-          polyCellPoints = vtkTypeInt64Array::New();
-        }
-        else
+        // Decompose a face into quads in order (flipping decomposed face if owner)
+        const size_t nQuadVerts = nFacePoints - 1 - nTris;
+        for (; vertI < nQuadVerts; vertI += 2)
         {
-          polyCellPoints = vtkTypeInt32Array::New();
-        }
-        this->AdditionalCellPoints->push_back(polyCellPoints);
+          cellPoints[1] = facePoints[vertI - flipNeighbor];
+          cellPoints[2] = facePoints[vertI];
+          cellPoints[3] = facePoints[vertI + flipNeighbor];
 
-        double centroid[3];
-        centroid[0] = centroid[1] = centroid[2] = 0; // zero the contents
-        for (size_t facei = 0; facei < cellFaces.size(); ++facei)
-        {
-          // Eliminate duplicate points from faces
-          const vtkTypeInt64 cellFacei = cellFaces[facei];
-          meshFaces.GetCell(cellFacei, facePoints);
-          for (size_t fp = 0; fp < facePoints.size(); ++fp)
+          // Insert first decomposed cell into the original position,
+          // subsequent ones are appended to the decomposed cell list
+          if (firstCell)
           {
-            const vtkTypeInt64 meshPointi = facePoints[fp];
-            bool isUnique = true;
-            for (vtkIdType cp = 0; isUnique && cp < polyCellPoints->GetDataSize(); ++cp)
-            {
-              isUnique = (meshPointi != GetLabelValue(polyCellPoints, cp, cellLabels64Bit));
-            }
-            if (isUnique)
-            {
-              AppendLabelValue(polyCellPoints, meshPointi, cellLabels64Bit);
-              const float* tuple = pointArray->GetPointer(3 * meshPointi);
-              centroid[0] += static_cast<double>(tuple[0]);
-              centroid[1] += static_cast<double>(tuple[1]);
-              centroid[2] += static_cast<double>(tuple[2]);
-            }
+            firstCell = false;
+            internalMesh->InsertNextCell(VTK_PYRAMID, 5, cellPoints.data());
+          }
+          else
+          {
+            ++nAdditionalCells;
+            additionalCells->InsertNextTypedTuple(cellPoints.data());
           }
         }
-        polyCellPoints->Squeeze();
-        {
-          const double weight = 1.0 / static_cast<double>(polyCellPoints->GetDataSize());
-          centroid[0] *= weight;
-          centroid[1] *= weight;
-          centroid[2] *= weight;
-        }
-        pointArray->InsertNextTuple(centroid);
-
-        // polyhedron decomposition.
-        // a tweaked algorithm based on OpenFOAM
-        // src/fileFormats/vtk/part/foamVtuSizingTemplates.C
 
-        // TODO: improve consistency of face point ordering.
-        // - currently just flips the faces without preserving the face point 0 order.
-        bool firstCell = true;
-        int nAdditionalCells = 0;
-        for (size_t facei = 0; facei < cellFaces.size(); ++facei)
+        // if the number of vertices is odd there's a triangle
+        if (nTris)
         {
-          const vtkTypeInt64 cellFacei = cellFaces[facei];
-          const bool isOwner =
-            (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
-          meshFaces.GetCell(cellFacei, facePoints);
-          const size_t nFacePoints = facePoints.size();
-
-          const int flipNeighbor = (isOwner ? -1 : 1);
-          const size_t nTris = (nFacePoints % 2);
-
-          size_t vertI = 2;
-
-          // shift the start and end of the vertex loop if the
-          // triangle of a decomposed face is going to be flat. Far
-          // from perfect but better than nothing to avoid flat cells
-          // which stops time integration of Stream Tracer especially
-          // for split-hex unstructured meshes created by
-          // e. g. autoRefineMesh
-          if (nFacePoints >= 5 && nTris)
+          if (flipNeighbor == -1) // isOwner
           {
-            const float* point0 = pointArray->GetPointer(3 * facePoints[nFacePoints - 1]);
-            const float* point1 = pointArray->GetPointer(3 * facePoints[0]);
-            const float* point2 = pointArray->GetPointer(3 * facePoints[nFacePoints - 2]);
-            float vsizeSqr1 = 0.0F, vsizeSqr2 = 0.0F, dotProduct = 0.0F;
-            for (int i = 0; i < 3; i++)
-            {
-              const float v1 = point1[i] - point0[i];
-              const float v2 = point2[i] - point0[i];
-              vsizeSqr1 += v1 * v1;
-              vsizeSqr2 += v2 * v2;
-              dotProduct += v1 * v2;
-            }
-            // compare in squared representation to avoid using sqrt()
-            if (dotProduct * (float)fabs(dotProduct) / (vsizeSqr1 * vsizeSqr2) < -1.0F + 1.0e-3F)
-            {
-              vertI = 1;
-            }
+            cellPoints[1] = facePoints[vertI];
+            cellPoints[2] = facePoints[vertI - 1];
           }
-
-          cellPoints[0] = facePoints[(vertI == 2) ? static_cast<vtkIdType>(0)
-                                                  : static_cast<vtkIdType>(nFacePoints - 1)];
-          cellPoints[4] = static_cast<vtkIdType>(this->NumPoints + nAdditionalPoints); // apex
-
-          // Decompose a face into quads in order (flipping decomposed face if owner)
-          const size_t nQuadVerts = nFacePoints - 1 - nTris;
-          for (; vertI < nQuadVerts; vertI += 2)
+          else
           {
-            cellPoints[1] = facePoints[vertI - flipNeighbor];
+            cellPoints[1] = facePoints[vertI - 1];
             cellPoints[2] = facePoints[vertI];
-            cellPoints[3] = facePoints[vertI + flipNeighbor];
-
-            // Insert first decomposed cell into the original position,
-            // subsequent ones are appended to the decomposed cell list
-            if (firstCell)
-            {
-              firstCell = false;
-              internalMesh->InsertNextCell(VTK_PYRAMID, 5, cellPoints.data());
-            }
-            else
-            {
-              ++nAdditionalCells;
-              additionalCells->InsertNextTypedTuple(cellPoints.data());
-            }
           }
+          cellPoints[3] = static_cast<vtkIdType>(this->NumPoints + nAdditionalPoints);
 
-          // if the number of vertices is odd there's a triangle
-          if (nTris)
+          // Insert first decomposed cell into the original position,
+          // subsequent ones are appended to the decomposed cell list
+          if (firstCell)
           {
-            if (flipNeighbor == -1) // isOwner
-            {
-              cellPoints[1] = facePoints[vertI];
-              cellPoints[2] = facePoints[vertI - 1];
-            }
-            else
-            {
-              cellPoints[1] = facePoints[vertI - 1];
-              cellPoints[2] = facePoints[vertI];
-            }
-            cellPoints[3] = static_cast<vtkIdType>(this->NumPoints + nAdditionalPoints);
-
-            // Insert first decomposed cell into the original position,
-            // subsequent ones are appended to the decomposed cell list
-            if (firstCell)
-            {
-              firstCell = false;
-              internalMesh->InsertNextCell(VTK_TETRA, 4, cellPoints.data());
-            }
-            else
-            {
-              // set the 5th vertex number to -1 to distinguish a tetra cell
-              cellPoints[4] = -1;
-              ++nAdditionalCells;
-              additionalCells->InsertNextTypedTuple(cellPoints.data());
-            }
+            firstCell = false;
+            internalMesh->InsertNextCell(VTK_TETRA, 4, cellPoints.data());
+          }
+          else
+          {
+            // set the 5th vertex number to -1 to distinguish a tetra cell
+            cellPoints[4] = -1;
+            ++nAdditionalCells;
+            additionalCells->InsertNextTypedTuple(cellPoints.data());
           }
         }
-
-        ++nAdditionalPoints;
-        this->AdditionalCellIds->InsertNextValue(cellId);
-        this->NumAdditionalCells->InsertNextValue(nAdditionalCells);
-        this->NumTotalAdditionalCells += nAdditionalCells;
       }
-      else
-#endif // VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
-      {
-        // Not decomposed - using VTK_POLYHEDRON
 
-        // Precalculated 'nPolyPoints' has all face points, including duplicates
-        // - need nPolyPoints + nPolyFaces for the face loops
-        // - use nPolyPoints to estimate unique cell points
-        //   (assume a point connects at least three faces)
+      ++nAdditionalPoints;
+      this->AdditionalCellIds->InsertNextValue(cellId);
+      this->NumAdditionalCells->InsertNextValue(nAdditionalCells);
+      this->NumTotalAdditionalCells += nAdditionalCells;
+    }
+#else
+    (void)cellType;
+#endif // VTK_FOAMFILE_DECOMPOSE_POLYHEDRA
+  }
+}
 
-        cellPoints.copy_resize(0);
-        polyPoints.copy_resize(0);
-        polyOffsets.copy_resize(0);
-        cellPoints.copy_reserve(nPolyPoints / 3);
-        polyPoints.copy_reserve(nPolyPoints);
-        polyOffsets.copy_reserve(cellFaces.size() + 1);
+//------------------------------------------------------------------------------
+// Build the cells of contiguous ranges of cells concurrently, then concatenate
+// them into the cell arrays of the mesh using prefix sums of the range sizes
+void vtkOpenFOAMReaderPrivate::InsertCellsToGridParallel(vtkUnstructuredGrid* internalMesh,
+  const vtkFoamLabelListList& meshCells, const vtkFoamLabelListList& meshFaces,
+  vtkIdList* cellLabels)
+{
+  const vtkIdType nCells = (cellLabels == nullptr ? this->NumCells : cellLabels->GetNumberOfIds());
+  const vtkIdType chunkSize = VTK_FOAMFILE_CELL_CHUNK_SIZE;
+  const vtkIdType nChunks = (nCells + chunkSize - 1) / chunkSize;
+  std::vector<vtkFoamCellChunk> chunks(nChunks);
 
-        size_t nCellPoints = 0;
-        nPolyPoints = 0; // Reset
-        polyOffsets[0] = 0;
-        for (size_t facei = 0; facei < cellFaces.size(); ++facei)
+  vtkSMPTools::For(0, nChunks, [&](vtkIdType beginChunk, vtkIdType endChunk) {
+    vtkFoamCellScratch scratch;
+    for (vtkIdType chunki = beginChunk; chunki < endChunk; ++chunki)
+    {
+      vtkFoamCellChunk& chunk = chunks[chunki];
+      const vtkIdType endCell = std::min(nCells, (chunki + 1) * chunkSize);
+      chunk.Types.reserve(endCell - chunki * chunkSize);
+      for (vtkIdType celli = chunki * chunkSize; celli < endCell; ++celli)
+      {
+        vtkIdType cellId = celli;
+        if (cellLabels != nullptr)
         {
-          const vtkTypeInt64 cellFacei = cellFaces[facei];
-          const bool isOwner =
-            (cellId == GetLabelValue(this->FaceOwner, cellFacei, faceOwner64Bit));
-          meshFaces.GetCell(cellFacei, facePoints);
-          const size_t nFacePoints = facePoints.size();
-          size_t nUnique = 0;
-
-          // Pass 1: add face points, and mark up duplicates on the way
-
-          polyPoints.copy_resize(nPolyPoints + nFacePoints);
-          polyOffsets[facei + 1] = polyOffsets[facei] + static_cast<vtkIdType>(nFacePoints);
-
-          if (!nFacePoints)
+          cellId = cellLabels->GetId(celli);
+          if (cellId < 0 || cellId >= this->NumCells)
           {
+            // sanity check. bad values should have been removed before this
+            vtkWarningMacro(<< "cellLabels id " << cellId << " exceeds the number of cells "
+                            << nCells);
             continue;
           }
+        }
+        this->InsertCellToSink(cellId, meshCells, meshFaces, scratch, chunk, true);
+      }
+    }
+  });
 
-          // Add face point 0
-          {
-            const auto meshPointi = static_cast<vtkIdType>(facePoints[0]);
-            polyPoints[nPolyPoints++] = meshPointi;
-            bool isUnique = true;
-            for (size_t cp = 0; isUnique && cp < nCellPoints; ++cp)
-            {
-              isUnique = (meshPointi != cellPoints[cp]);
-            }
-            if (isUnique)
-            {
-              ++nUnique;
-            }
-            else
-            {
-              facePoints[0] = -1; // Duplicate
-            }
-          }
+  // Exclusive prefix sums give the location of each chunk in the output arrays
+  std::vector<vtkIdType> cellBegin(nChunks + 1, 0);
+  std::vector<vtkIdType> pointBegin(nChunks + 1, 0);
+  std::vector<vtkIdType> faceBegin(nChunks + 1, 0);
+  std::vector<vtkIdType> facePointBegin(nChunks + 1, 0);
+  for (vtkIdType chunki = 0; chunki < nChunks; ++chunki)
+  {
+    const vtkFoamCellChunk& chunk = chunks[chunki];
+    cellBegin[chunki + 1] = cellBegin[chunki] + static_cast<vtkIdType>(chunk.Types.size());
+    pointBegin[chunki + 1] =
+      pointBegin[chunki] + static_cast<vtkIdType>(chunk.Connectivity.size());
+    faceBegin[chunki + 1] = faceBegin[chunki] + static_cast<vtkIdType>(chunk.FaceSizes.size());
+    facePointBegin[chunki + 1] =
+      facePointBegin[chunki] + static_cast<vtkIdType>(chunk.FaceConnectivity.size());
+  }
+  const vtkIdType nOutCells = cellBegin[nChunks];
+  const vtkIdType nFaces = faceBegin[nChunks];
+  const bool hasPolyhedra = (nFaces > 0);
 
-          // Add other face points
-          {
-            // Local face point indexing - must be signed
-            const int faceDirn = (isOwner ? 1 : -1); // Flip direction for neighbour face
-            int facePointi = (isOwner ? 1 : static_cast<int>(nFacePoints) - 1);
+  vtkNew<vtkUnsignedCharArray> types;
+  vtkNew<vtkIdTypeArray> offsets;
+  vtkNew<vtkIdTypeArray> connectivity;
+  types->SetNumberOfValues(nOutCells);
+  offsets->SetNumberOfValues(nOutCells + 1);
+  connectivity->SetNumberOfValues(pointBegin[nChunks]);
+  offsets->SetValue(nOutCells, pointBegin[nChunks]);
 
-            for (size_t fp = 1; fp < nFacePoints; ++fp, facePointi += faceDirn)
-            {
-              const auto meshPointi = static_cast<vtkIdType>(facePoints[facePointi]);
-              polyPoints[nPolyPoints++] = meshPointi;
-              bool isUnique = true;
-              for (size_t cp = 0; isUnique && cp < nCellPoints; ++cp)
-              {
-                isUnique = (meshPointi != cellPoints[cp]);
-              }
-              if (isUnique)
-              {
-                ++nUnique;
-              }
-              else
-              {
-                facePoints[facePointi] = -1; // Duplicate
-              }
-            }
-          }
+  vtkNew<vtkIdTypeArray> faceLocationOffsets;
+  vtkNew<vtkIdTypeArray> faceLocationIds;
+  vtkNew<vtkIdTypeArray> faceOffsets;
+  vtkNew<vtkIdTypeArray> faceConnectivity;
+  if (hasPolyhedra)
+  {
+    faceLocationOffsets->SetNumberOfValues(nOutCells + 1);
+    faceLocationIds->SetNumberOfValues(nFaces);
+    faceOffsets->SetNumberOfValues(nFaces + 1);
+    faceConnectivity->SetNumberOfValues(facePointBegin[nChunks]);
+    faceLocationOffsets->SetValue(nOutCells, nFaces);
+    faceOffsets->SetValue(nFaces, facePointBegin[nChunks]);
+  }
 
-          cellPoints.copy_resize(nCellPoints + nUnique);
+  vtkSMPTools::For(0, nChunks, [&](vtkIdType beginChunk, vtkIdType endChunk) {
+    for (vtkIdType chunki = beginChunk; chunki < endChunk; ++chunki)
+    {
+      const vtkFoamCellChunk& chunk = chunks[chunki];
+      const vtkIdType nChunkCells = static_cast<vtkIdType>(chunk.Types.size());
 
-          // Pass 2: add unique cell points - order is arbitrary
-          for (size_t fp = 0; fp < nFacePoints; ++fp)
-          {
-            const auto meshPointi = static_cast<vtkIdType>(facePoints[fp]);
-            if (meshPointi != -1) // isUnique
-            {
-              cellPoints[nCellPoints++] = meshPointi;
-            }
-          }
-        }
-        vtkNew<vtkIdTypeArray> offsets;
-        vtkNew<vtkIdTypeArray> connectivity;
-        vtkNew<vtkCellArray> faces;
-        offsets->SetArray(polyOffsets.data(), cellFaces.size() + 1, 1);
-        connectivity->SetArray(polyPoints.data(), nPolyPoints, 1);
-        faces->SetData(offsets, connectivity);
+      std::copy(chunk.Types.begin(), chunk.Types.end(), types->GetPointer(cellBegin[chunki]));
+      std::copy(chunk.Connectivity.begin(), chunk.Connectivity.end(),
+        connectivity->GetPointer(pointBegin[chunki]));
+      vtkIdType* cellOffsets = offsets->GetPointer(cellBegin[chunki]);
+      vtkIdType offset = pointBegin[chunki];
+      for (vtkIdType i = 0; i < nChunkCells; ++i)
+      {
+        cellOffsets[i] = offset;
+        offset += chunk.Sizes[i];
+      }
 
-        // Create the poly cell and insert it into the mesh
-        internalMesh->InsertNextCell(
-          VTK_POLYHEDRON, static_cast<vtkIdType>(nCellPoints), cellPoints.data(), faces);
+      if (hasPolyhedra)
+      {
+        vtkIdType* locations = faceLocationOffsets->GetPointer(cellBegin[chunki]);
+        vtkIdType faceId = faceBegin[chunki];
+        for (vtkIdType i = 0; i < nChunkCells; ++i)
+        {
+          locations[i] = faceId;
+          faceId += chunk.NumFaces[i];
+        }
+        const vtkIdType nChunkFaces = static_cast<vtkIdType>(chunk.FaceSizes.size());
+        vtkIdType* faceIds = faceLocationIds->GetPointer(faceBegin[chunki]);
+        vtkIdType* facePointOffsets = faceOffsets->GetPointer(faceBegin[chunki]);
+        offset = facePointBegin[chunki];
+        for (vtkIdType i = 0; i < nChunkFaces; ++i)
+        {
+          faceIds[i] = faceBegin[chunki] + i;
+          facePointOffsets[i] = offset;
+          offset += chunk.FaceSizes[i];
+        }
+        std::copy(chunk.FaceConnectivity.begin(), chunk.FaceConnectivity.end(),
+          faceConnectivity->GetPointer(facePointBegin[chunki]));
       }
     }
+  });
+
+  vtkNew<vtkCellArray> cells;
+  cells->SetData(offsets, connectivity);
+  if (hasPolyhedra)
+  {
+    vtkNew<vtkCellArray> faceLocations;
+    vtkNew<vtkCellArray> faces;
+    faceLocations->SetData(faceLocationOffsets, faceLocationIds);
+    faces->SetData(faceOffsets, faceConnectivity);
+    internalMesh->SetPolyhedralCells(types, cells, faceLocations, faces);
+  }
+  else
+  {
+    internalMesh->SetCells(types, cells);
   }
 }
 
@@ -11064,6 +11775,9 @@ vtkOpenFOAMReader::vtkOpenFOAMReader()
   this->Use64BitFloats = true;
   this->Use64BitLabelsOld = false;
   this->Use64BitFloatsOld = true;
+
+  this->MinimumParallelListSize = VTK_FOAMFILE_PARALLEL_LIST_SIZE;
+  this->MinimumParallelMeshSize = VTK_FOAMFILE_PARALLEL_CELLS_SIZE;
 }
 
 //------------------------------------------------------------------------------
@@ -11153,6 +11867,8 @@ void vtkOpenFOAMReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "CacheMesh: " << this->CacheMesh << endl;
   os << indent << "ReadZones: " << this->ReadZones << endl;
   os << indent << "AddDimensionsToArrayNames: " << this->AddDimensionsToArrayNames << endl;
+  os << indent << "MinimumParallelListSize: " << this->MinimumParallelListSize << endl;
+  os << indent << "MinimumParallelMeshSize: " << this->MinimumParallelMeshSize << endl;
 
   this->PrintTimes(os, indent);
 
@@ -11311,7 +12027,10 @@ int vtkOpenFOAMReader::RequestData(vtkInformation* vtkNotUsed(request),
       .empty())
   {
     ret = reader->RequestData(output);
-    this->Parent->CurrentReaderIndex++;
+    if (!this->Parent->ConcurrentSubReaders)
+    {
+      this->Parent->CurrentReaderIndex++;
+    }
   }
   else
   {
@@ -11336,7 +12055,10 @@ int vtkOpenFOAMReader::RequestData(vtkInformation* vtkNotUsed(request),
       {
         ret = 0;
       }
-      this->Parent->CurrentReaderIndex++;
+      if (!this->Parent->ConcurrentSubReaders)
+      {
+        this->Parent->CurrentReaderIndex++;
+      }
     }
   }
 
@@ -11750,6 +12472,11 @@ void vtkOpenFOAMReader::UpdateStatus()
 //------------------------------------------------------------------------------
 void vtkOpenFOAMReader::UpdateProgress(double amount)
 {
+  if (this->Parent->ConcurrentSubReaders)
+  {
+    // The progress is reported by the parent once all the sub-readers are done
+    return;
+  }
   this->vtkAlgorithm::UpdateProgress(
     (static_cast<double>(this->Parent->CurrentReaderIndex) + amount) /
     static_cast<double>(this->Parent->NumberOfReaders));
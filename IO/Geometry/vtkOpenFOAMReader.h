@@ -332,6 +332,20 @@ public:
   vtkBooleanMacro(Use64BitFloats, bool);
   ///@}
 
+  ///@{
+  /**
+   * Lists of at least MinimumParallelListSize values are parsed or converted
+   * in parallel with vtkSMPTools, and internal meshes of at least
+   * MinimumParallelMeshSize cells are assembled in parallel. Smaller ones are
+   * read serially, as the parallel overhead would outweigh the gain.
+   * Defaults are 65536 and 16384.
+   */
+  vtkSetClampMacro(MinimumParallelListSize, vtkIdType, 1, VTK_ID_MAX);
+  vtkGetMacro(MinimumParallelListSize, vtkIdType);
+  vtkSetClampMacro(MinimumParallelMeshSize, vtkIdType, 1, VTK_ID_MAX);
+  vtkGetMacro(MinimumParallelMeshSize, vtkIdType);
+  ///@}
+
   void SetRefresh()
   {
     this->Refresh = true;
@@ -392,6 +406,10 @@ protected:
   // The data of internal mesh are copied to cell zones
   bool CopyDataToCellZones;
 
+  // Sizes from which lists and internal meshes are read in parallel
+  vtkIdType MinimumParallelListSize;
+  vtkIdType MinimumParallelMeshSize;
+
   char* FileName;
   vtkCharArray* CasePath;
   vtkCollection* Readers;
@@ -427,6 +445,8 @@ protected:
   int NumberOfReaders;
   // index of the active reader
   int CurrentReaderIndex;
+  // sub-readers are executed concurrently, the progress is not tracked per reader
+  bool ConcurrentSubReaders = false;
 
   vtkOpenFOAMReader();
   ~vtkOpenFOAMReader() override;
@@ -18,6 +18,10 @@
 #include "vtkTransformFilter.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <vtksys/SystemTools.hxx>
+
+#include <array>
+
 namespace
 {
 enum supportedDataSetTypes
@@ -172,6 +176,44 @@ bool TestTemporalStaticMesh(
   return true;
 }
 
+//----------------------------------------------------------------------------
+bool TestTemporalMeshContentHash(const std::string& tempDir, const std::string& baseName)
+{
+  // The cleaning filter regenerates an identical mesh every time step,
+  // which updates its MeshMTime while its content does not change.
+  vtkNew<vtkSpatioTemporalHarmonicsSource> harmonics;
+  vtkNew<vtkCleanUnstructuredGrid> clean;
+  clean->SetInputConnection(harmonics->GetOutputPort());
+
+  std::array<unsigned long, 2> fileSizes;
+  for (int useHash = 0; useHash < 2; ++useHash)
+  {
+    vtkNew<vtkHDFWriter> HDFWriter;
+    HDFWriter->SetInputConnection(clean->GetOutputPort());
+    std::string tempPath = tempDir + "/HDFWriter_" + baseName;
+    tempPath += (useHash ? "_hash.vtkhdf" : "_nohash.vtkhdf");
+    HDFWriter->SetFileName(tempPath.c_str());
+    HDFWriter->SetWriteAllTimeSteps(true);
+    HDFWriter->SetUseMeshContentHash(useHash != 0);
+    if (!HDFWriter->Write())
+    {
+      vtkLog(ERROR, "An error occured while writing " << tempPath);
+      return false;
+    }
+    fileSizes[useHash] = vtksys::SystemTools::FileLength(tempPath);
+  }
+
+  // Geometry should only have been written once when hashing the mesh content
+  if (fileSizes[1] >= fileSizes[0])
+  {
+    vtkLog(ERROR,
+      "Expected a smaller file when using mesh content hash, got "
+        << fileSizes[1] << " bytes instead of " << fileSizes[0]);
+    return false;
+  }
+  return true;
+}
+
 //----------------------------------------------------------------------------
 int TestHDFWriterTemporal(int argc, char* argv[])
 {
@@ -212,5 +254,6 @@ int TestHDFWriterTemporal(int argc, char* argv[])
     tempDir, "transient_static_sphere_ug_source", ::supportedDataSetTypes::vtkUnstructuredGridType);
   result &= TestTemporalStaticMesh(
     tempDir, "transient_static_sphere_polydata_source", ::supportedDataSetTypes::vtkPolyDataType);
+  result &= TestTemporalMeshContentHash(tempDir, "transient_harmonics_content_hash");
   return result ? EXIT_SUCCESS : EXIT_FAILURE;
 }
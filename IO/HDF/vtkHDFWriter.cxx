@@ -3,6 +3,8 @@
 #include "vtkHDFWriter.h"
 
 #include "vtkAbstractArray.h"
+#include "vtkArrayDispatch.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataAssembly.h"
 #include "vtkDataObjectTree.h"
 #include "vtkDataObjectTreeIterator.h"
@@ -20,12 +22,16 @@
 #include "vtkObjectFactory.h"
 #include "vtkPartitionedDataSet.h"
 #include "vtkPartitionedDataSetCollection.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 
 #include "vtkPolyData.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <cstring>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkHDFWriter);
 vtkCxxSetObjectMacro(vtkHDFWriter, Controller, vtkMultiProcessController);
@@ -39,6 +45,115 @@ constexpr hsize_t SINGLE_COLUMN = 1;
 hsize_t PRIMITIVE_CHUNK[] = { 1, NUM_POLY_DATA_TOPOS };
 hsize_t SMALL_CHUNK[] = { 1, 1 }; // Used for chunked arrays where values are read one by one
 
+// 64-bit FNV-1a parameters used to hash mesh content
+constexpr vtkTypeUInt64 FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr vtkTypeUInt64 FNV_PRIME = 1099511628211ULL;
+// Number of array values hashed by a single task
+constexpr vtkIdType HASH_BLOCK_SIZE = 1 << 16;
+
+/**
+ * Accumulate the bytes of the given value in the FNV-1a hash.
+ */
+template <typename T>
+void HashValue(vtkTypeUInt64& hash, const T& value)
+{
+  unsigned char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+  for (unsigned char byte : bytes)
+  {
+    hash ^= byte;
+    hash *= FNV_PRIME;
+  }
+}
+
+/**
+ * Hash the values of a data array. The array is split in fixed-size blocks hashed in parallel,
+ * and block hashes are then combined in order so the result does not depend on the number of
+ * threads.
+ */
+struct HashArrayWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, vtkTypeUInt64& hash)
+  {
+    using ValueT = vtk::GetAPIType<ArrayT>;
+    const auto values = vtk::DataArrayValueRange(array);
+    const vtkIdType numValues = values.size();
+    const vtkIdType numBlocks = (numValues + HASH_BLOCK_SIZE - 1) / HASH_BLOCK_SIZE;
+    std::vector<vtkTypeUInt64> blockHashes(numBlocks);
+
+    vtkSMPTools::For(0, numBlocks,
+      [&](vtkIdType beginBlock, vtkIdType endBlock)
+      {
+        for (vtkIdType block = beginBlock; block < endBlock; ++block)
+        {
+          vtkTypeUInt64 blockHash = FNV_OFFSET_BASIS;
+          const vtkIdType end = std::min(numValues, (block + 1) * HASH_BLOCK_SIZE);
+          for (vtkIdType valueId = block * HASH_BLOCK_SIZE; valueId < end; ++valueId)
+          {
+            ::HashValue(blockHash, static_cast<ValueT>(values[valueId]));
+          }
+          blockHashes[block] = blockHash;
+        }
+      });
+
+    ::HashValue(hash, array->GetDataType());
+    ::HashValue(hash, array->GetNumberOfComponents());
+    ::HashValue(hash, numValues);
+    for (vtkTypeUInt64 blockHash : blockHashes)
+    {
+      ::HashValue(hash, blockHash);
+    }
+  }
+};
+
+void HashArray(vtkTypeUInt64& hash, vtkDataArray* array)
+{
+  if (!array)
+  {
+    ::HashValue(hash, vtkIdType(-1));
+    return;
+  }
+  HashArrayWorker worker;
+  if (!vtkArrayDispatch::Dispatch::Execute(array, worker, hash))
+  {
+    worker(array, hash);
+  }
+}
+
+void HashCellArray(vtkTypeUInt64& hash, vtkCellArray* cells)
+{
+  if (!cells)
+  {
+    ::HashValue(hash, vtkIdType(-1));
+    return;
+  }
+  ::HashArray(hash, cells->GetOffsetsArray());
+  ::HashArray(hash, cells->GetConnectivityArray());
+}
+
+/**
+ * Compute a hash of the mesh part of a dataset: points, and cells topology.
+ */
+vtkTypeUInt64 ComputeMeshHash(vtkPointSet* input)
+{
+  vtkTypeUInt64 hash = FNV_OFFSET_BASIS;
+  ::HashArray(hash, input->GetPoints() ? input->GetPoints()->GetData() : nullptr);
+  if (auto* polyData = vtkPolyData::SafeDownCast(input))
+  {
+    ::HashCellArray(hash, polyData->GetVerts());
+    ::HashCellArray(hash, polyData->GetLines());
+    ::HashCellArray(hash, polyData->GetPolys());
+    ::HashCellArray(hash, polyData->GetStrips());
+  }
+  else if (auto* unstructuredGrid = vtkUnstructuredGrid::SafeDownCast(input))
+  {
+    ::HashArray(hash, unstructuredGrid->GetCellTypesArray());
+    ::HashCellArray(hash, unstructuredGrid->GetCells());
+  }
+  return hash;
+}
+
 /**
  * Return the name of a partitioned dataset in a pdc given its index.
  * If not set, generate a name based on the id.
@@ -224,6 +339,7 @@ void vtkHDFWriter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Overwrite: " << (this->Overwrite ? "yes" : "no") << "\n";
   os << indent << "WriteAllTimeSteps: " << (this->WriteAllTimeSteps ? "yes" : "no") << "\n";
   os << indent << "ChunkSize: " << this->ChunkSize << "\n";
+  os << indent << "UseMeshContentHash: " << (this->UseMeshContentHash ? "yes" : "no") << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -276,6 +392,8 @@ void vtkHDFWriter::WriteData()
     }
   }
 
+  this->UpdateCurrentStepMeshHash(input);
+
   // First time step is considered static mesh
   if (this->CurrentTimeIndex == 0)
   {
@@ -1329,7 +1447,15 @@ bool vtkHDFWriter::AppendDataArrayOffset(
 //------------------------------------------------------------------------------
 bool vtkHDFWriter::HasGeometryChangedFromPreviousStep(vtkDataSet* input)
 {
-  return input->GetMeshMTime() != this->PreviousStepMeshMTime;
+  const vtkMTimeType meshMTime = input->GetMeshMTime();
+  if (meshMTime == this->PreviousStepMeshMTime)
+  {
+    return false;
+  }
+
+  // The mesh has been modified, but may have been regenerated identically
+  return !(this->UseMeshContentHash && meshMTime == this->CurrentStepMeshMTime &&
+    this->CurrentStepMeshHash == this->PreviousStepMeshHash);
 }
 
 //------------------------------------------------------------------------------
@@ -1338,6 +1464,25 @@ void vtkHDFWriter::UpdatePreviousStepMeshMTime(vtkDataObject* input)
   if (auto dsInput = vtkDataSet::SafeDownCast(input))
   {
     this->PreviousStepMeshMTime = dsInput->GetMeshMTime();
+    this->PreviousStepMeshHash = this->CurrentStepMeshHash;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkHDFWriter::UpdateCurrentStepMeshHash(vtkDataObject* input)
+{
+  auto* psInput = vtkPointSet::SafeDownCast(input);
+  if (!this->UseMeshContentHash || !this->IsTemporal || !psInput)
+  {
+    return;
+  }
+
+  // Only hash the mesh again if it has been modified since the last hashed step
+  const vtkMTimeType meshMTime = psInput->GetMeshMTime();
+  if (this->CurrentTimeIndex == 0 || meshMTime != this->CurrentStepMeshMTime)
+  {
+    this->CurrentStepMeshHash = ::ComputeMeshHash(psInput);
+    this->CurrentStepMeshMTime = meshMTime;
   }
 }
 
@@ -183,6 +183,27 @@ public:
   vtkGetMacro(WriteDistributedOutput, bool);
   ///@}
 
+  ///@{
+  /**
+   * When writing time-dependent data, the points and cells of a step are only written if the
+   * mesh changed since the previous step. By default, this is decided by comparing the
+   * `MeshMTime` of the input between steps. Some sources regenerate an identical mesh at each
+   * time step though, which bumps its `MeshMTime` without changing its content.
+   *
+   * When set, a mesh whose `MeshMTime` changed is additionally compared to the previous step
+   * using a hash of its points, connectivity, offsets and cell types. If the content is
+   * identical, the mesh is considered static and is not written again: only field arrays are
+   * appended to the chunked datasets for that step.
+   *
+   * Hashing requires a full (multithreaded) pass over the geometry at each step.
+   * Only applies to vtkPolyData and vtkUnstructuredGrid inputs.
+   * Default is false.
+   */
+  vtkSetMacro(UseMeshContentHash, bool);
+  vtkGetMacro(UseMeshContentHash, bool);
+  vtkBooleanMacro(UseMeshContentHash, bool);
+  ///@}
+
 protected:
   /**
    * Override vtkWriter's ProcessRequest method, in order to dispatch the request
@@ -372,6 +393,12 @@ private:
    */
   void UpdatePreviousStepMeshMTime(vtkDataObject* input);
 
+  /**
+   * Compute the content hash of the current step mesh when UseMeshContentHash is set,
+   * so that it is only computed once per time step.
+   */
+  void UpdateCurrentStepMeshHash(vtkDataObject* input);
+
   class Implementation;
   std::unique_ptr<Implementation> Impl;
 
@@ -385,6 +412,7 @@ private:
   bool WriteDistributedOutput = true;
   int ChunkSize = 25000;
   int CompressionLevel = 0;
+  bool UseMeshContentHash = false;
 
   // Temporal-related private variables
   double* timeSteps = nullptr;
@@ -392,6 +420,9 @@ private:
   int CurrentTimeIndex = 0;
   int NumberOfTimeSteps = 0;
   vtkMTimeType PreviousStepMeshMTime = 0;
+  vtkMTimeType CurrentStepMeshMTime = 0;
+  vtkTypeUInt64 PreviousStepMeshHash = 0;
+  vtkTypeUInt64 CurrentStepMeshHash = 0;
 
   // Distributed-related variables
   vtkMultiProcessController* Controller = nullptr;
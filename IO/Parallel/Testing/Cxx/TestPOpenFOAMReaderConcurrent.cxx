@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compare the outputs of the serial and parallel code paths of the readers:
+// the lists are parsed and the meshes assembled in parallel whatever their
+// size, and the processor directories are read concurrently.
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+#include "vtkMPIController.h"
+#else
+#include "vtkDummyController.h"
+#endif
+
+#include "vtkPOpenFOAMReader.h"
+
+#include "vtkLogger.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkTestUtilities.h"
+
+#include <string>
+
+namespace
+{
+
+// Read the case once with the default settings, once with the parallel code
+// paths enabled whatever the sizes, and compare the outputs.
+bool CompareReads(const std::string& fileName, int caseType, double time, bool expectData)
+{
+  vtkNew<vtkPOpenFOAMReader> serial;
+  serial->SetFileName(fileName.c_str());
+  serial->SetCaseType(caseType);
+  serial->ReadZonesOn();
+  serial->UpdateInformation();
+  serial->EnableAllCellArrays();
+  serial->EnableAllPointArrays();
+  serial->EnableAllPatchArrays();
+  serial->UpdateTimeStep(time);
+
+  vtkNew<vtkPOpenFOAMReader> parallel;
+  parallel->SetFileName(fileName.c_str());
+  parallel->SetCaseType(caseType);
+  parallel->ReadZonesOn();
+  parallel->ReadProcessorsConcurrentlyOn();
+  parallel->SetMinimumParallelListSize(1);
+  parallel->SetMinimumParallelMeshSize(1);
+  parallel->UpdateInformation();
+  parallel->EnableAllCellArrays();
+  parallel->EnableAllPointArrays();
+  parallel->EnableAllPatchArrays();
+  parallel->UpdateTimeStep(time);
+
+  vtkMultiBlockDataSet* expected = serial->GetOutput();
+  vtkMultiBlockDataSet* result = parallel->GetOutput();
+  if (expectData && expected->GetNumberOfBlocks() == 0)
+  {
+    vtkLog(ERROR, "Nothing read from " << fileName);
+    return false;
+  }
+  if (!vtkTestUtilities::CompareDataObjects(expected, result))
+  {
+    vtkLog(ERROR, "The parallel read of " << fileName << " differs from the serial read");
+    return false;
+  }
+  return true;
+}
+
+} // End anonymous namespace
+
+int TestPOpenFOAMReaderConcurrent(int argc, char* argv[])
+{
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  vtkNew<vtkMPIController> controller;
+#else
+  vtkNew<vtkDummyController> controller;
+#endif
+  controller->Initialize(&argc, &argv);
+  int rank = controller->GetLocalProcessId();
+  vtkLogger::SetThreadName("rank=" + std::to_string(rank));
+  vtkMultiProcessController::SetGlobalController(controller);
+
+  int retVal = EXIT_SUCCESS;
+
+  // A reconstructed case, with ASCII lists, only read by the first process
+  char* filename =
+    vtkTestUtilities::ExpandDataFileName(argc, argv, "Data/OpenFOAM/cavity/cavity.foam");
+  if (!CompareReads(filename, vtkPOpenFOAMReader::RECONSTRUCTED_CASE, 0.5, rank == 0))
+  {
+    retVal = EXIT_FAILURE;
+  }
+  delete[] filename;
+
+  // A decomposed case, with several processor directories per process
+  filename =
+    vtkTestUtilities::ExpandDataFileName(argc, argv, "Data/OpenFOAM/mixerGgi/mixerGgi.foam");
+  if (!CompareReads(filename, vtkPOpenFOAMReader::DECOMPOSED_CASE, 0.5, true))
+  {
+    retVal = EXIT_FAILURE;
+  }
+  delete[] filename;
+
+  controller->Finalize();
+  return retVal;
+}
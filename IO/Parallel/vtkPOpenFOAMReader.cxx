@@ -65,12 +65,15 @@
 #include "vtkMultiBlockDataSet.h"
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkSortDataArray.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 
 #include <cctype>
 #include <cstring>
+#include <vector>
 
 //------------------------------------------------------------------------------
 
@@ -94,6 +97,8 @@ vtkSmartPointer<vtkOpenFOAMReader> NewFoamReader(vtkOpenFOAMReader* parent)
   reader->SetSkipZeroTime(parent->GetSkipZeroTime());
   reader->SetUse64BitLabels(parent->GetUse64BitLabels());
   reader->SetUse64BitFloats(parent->GetUse64BitFloats());
+  reader->SetMinimumParallelListSize(parent->GetMinimumParallelListSize());
+  reader->SetMinimumParallelMeshSize(parent->GetMinimumParallelMeshSize());
 
   return reader;
 }
@@ -370,6 +375,7 @@ void vtkPOpenFOAMReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Number of Processes: " << this->NumProcesses << endl;
   os << indent << "Process Id: " << this->ProcessId << endl;
   os << indent << "Controller: " << this->Controller << endl;
+  os << indent << "ReadProcessorsConcurrently: " << this->ReadProcessorsConcurrently << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -663,6 +669,7 @@ int vtkPOpenFOAMReader::RequestData(
     // append->AppendFieldDataOn();
 
     vtkOpenFOAMReader* reader;
+    std::vector<vtkSmartPointer<vtkOpenFOAMReader>> activeReaders;
     this->Superclass::CurrentReaderIndex = 0;
     this->Superclass::Readers->InitTraversal();
     while ((reader = vtkOpenFOAMReader::SafeDownCast(
@@ -679,6 +686,7 @@ int vtkPOpenFOAMReader::RequestData(
       if (reader->MakeMetaDataAtTimeStep(false))
       {
         append->AddInputConnection(reader->GetOutputPort());
+        activeReaders.emplace_back(reader);
       }
     }
 
@@ -691,6 +699,23 @@ int vtkPOpenFOAMReader::RequestData(
     }
     else
     {
+      if (this->ReadProcessorsConcurrently && activeReaders.size() > 1)
+      {
+        // The processor directories are independent: execute their readers
+        // concurrently, the append filter below then finds them up to date.
+        // The readers only share read-only settings of "this".
+        this->Superclass::ConcurrentSubReaders = true;
+        vtkSMPTools::For(0, static_cast<vtkIdType>(activeReaders.size()),
+          [&activeReaders](vtkIdType begin, vtkIdType end) {
+            for (vtkIdType readerI = begin; readerI < end; ++readerI)
+            {
+              activeReaders[readerI]->Update();
+            }
+          });
+        this->Superclass::ConcurrentSubReaders = false;
+        this->vtkAlgorithm::UpdateProgress(0.9);
+      }
+
       // reader->RequestInformation() and RequestData() are called
       // for all reader instances without setting UPDATE_TIME_STEPS
       append->Update();
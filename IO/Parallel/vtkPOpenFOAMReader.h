@@ -54,6 +54,19 @@ public:
   vtkGetObjectMacro(Controller, vtkMultiProcessController);
   ///@}
 
+  ///@{
+  /**
+   * When reading a decomposed case, execute the readers of the processor
+   * directories assigned to this process concurrently using vtkSMPTools.
+   * The progress is then only reported once all of them are done. The
+   * readers share the settings of this reader, which must not be modified
+   * during the update. Default is false.
+   */
+  vtkSetMacro(ReadProcessorsConcurrently, bool);
+  vtkGetMacro(ReadProcessorsConcurrently, bool);
+  vtkBooleanMacro(ReadProcessorsConcurrently, bool);
+  ///@}
+
 protected:
   vtkPOpenFOAMReader();
   ~vtkPOpenFOAMReader() override;
@@ -67,6 +80,7 @@ private:
   vtkMTimeType MTimeOld;
   int NumProcesses;
   int ProcessId;
+  bool ReadProcessorsConcurrently = false;
 
   vtkPOpenFOAMReader(const vtkPOpenFOAMReader&) = delete;
   void operator=(const vtkPOpenFOAMReader&) = delete;
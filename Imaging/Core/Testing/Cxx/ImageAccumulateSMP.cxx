@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that the threaded vtkImageAccumulate gives the same histograms as
+// the serial one, with and without stencil and for several components, and
+// test the coarse pass of the progressive mode.
+
+#include "vtkCallbackCommand.h"
+#include "vtkCommand.h"
+#include "vtkImageAccumulate.h"
+#include "vtkImageData.h"
+#include "vtkImageStencilData.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+bool Near(double a, double b)
+{
+  return std::abs(a - b) <= 1e-9 * (1.0 + std::abs(b));
+}
+
+// Sum of the bins of the output of the filter.
+vtkIdType BinTotal(vtkImageAccumulate* filter)
+{
+  vtkImageData* output = filter->GetOutput();
+  const vtkIdType* bins = static_cast<vtkIdType*>(output->GetScalarPointer());
+  vtkIdType total = 0;
+  for (vtkIdType i = 0; i < output->GetNumberOfPoints(); ++i)
+  {
+    total += bins[i];
+  }
+  return total;
+}
+
+bool SameResults(vtkImageAccumulate* serial, vtkImageAccumulate* threaded)
+{
+  serial->EnableSMPOff();
+  threaded->EnableSMPOn();
+  serial->Update();
+  threaded->Update();
+  vtkImageData* a = serial->GetOutput();
+  vtkImageData* b = threaded->GetOutput();
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints())
+  {
+    std::cerr << "Different numbers of bins" << std::endl;
+    return false;
+  }
+  const vtkIdType* binsA = static_cast<vtkIdType*>(a->GetScalarPointer());
+  const vtkIdType* binsB = static_cast<vtkIdType*>(b->GetScalarPointer());
+  for (vtkIdType i = 0; i < a->GetNumberOfPoints(); ++i)
+  {
+    if (binsA[i] != binsB[i])
+    {
+      std::cerr << "Bin " << i << ": " << binsB[i] << " instead of " << binsA[i] << std::endl;
+      return false;
+    }
+  }
+  if (serial->GetVoxelCount() != threaded->GetVoxelCount() || serial->GetVoxelCount() <= 0)
+  {
+    std::cerr << "Voxel count: " << threaded->GetVoxelCount() << " instead of "
+              << serial->GetVoxelCount() << std::endl;
+    return false;
+  }
+  for (int c = 0; c < 3; ++c)
+  {
+    if (serial->GetMin()[c] != threaded->GetMin()[c] ||
+      serial->GetMax()[c] != threaded->GetMax()[c] ||
+      !Near(serial->GetMean()[c], threaded->GetMean()[c]) ||
+      !Near(serial->GetStandardDeviation()[c], threaded->GetStandardDeviation()[c]))
+    {
+      std::cerr << "Different statistics for component " << c << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+struct CoarsePassInfo
+{
+  int Calls = 0;
+  bool CoarsePass = false;
+  vtkIdType VoxelCount = 0;
+  vtkIdType BinTotal = 0;
+};
+
+void CoarsePassCallback(vtkObject* caller, unsigned long, void* clientData, void*)
+{
+  vtkImageAccumulate* filter = static_cast<vtkImageAccumulate*>(caller);
+  CoarsePassInfo* info = static_cast<CoarsePassInfo*>(clientData);
+  info->Calls++;
+  info->CoarsePass = filter->GetCoarsePass();
+  info->VoxelCount = filter->GetVoxelCount();
+  info->BinTotal = BinTotal(filter);
+}
+}
+
+int ImageAccumulateSMP(int, char*[])
+{
+  // A random image with three components
+  vtkNew<vtkImageData> image;
+  image->SetExtent(-5, 54, 0, 36, 3, 23);
+  image->AllocateScalars(VTK_SHORT, 3);
+  short* ptr = static_cast<short*>(image->GetScalarPointer());
+  vtkMath::RandomSeed(5678);
+  for (vtkIdType i = 0; i < 3 * image->GetNumberOfPoints(); ++i)
+  {
+    ptr[i] = static_cast<short>(vtkMath::Random(-10.0, 60.0));
+  }
+
+  // A stencil with a varying number of spans per row
+  vtkNew<vtkImageStencilData> stencil;
+  stencil->SetExtent(image->GetExtent());
+  stencil->AllocateExtents();
+  for (int z = 3; z <= 23; ++z)
+  {
+    for (int y = 0; y <= 36; ++y)
+    {
+      stencil->InsertNextExtent(-5 + (y % 7), 10 + (z % 5), y, z);
+      stencil->InsertNextExtent(20 + (z % 5), 50 - (y % 3), y, z);
+    }
+  }
+
+  for (int i = 0; i < 6; ++i)
+  {
+    vtkNew<vtkImageAccumulate> filters[2];
+    for (vtkImageAccumulate* filter : filters)
+    {
+      filter->SetInputData(image);
+      if (i == 0)
+      {
+        // bins along the first component only
+        filter->SetComponentExtent(0, 49, 0, 0, 0, 0);
+      }
+      else
+      {
+        filter->SetComponentExtent(0, 20, 0, 20, 0, 20);
+        filter->SetComponentOrigin(-5.0, -5.0, -5.0);
+        filter->SetComponentSpacing(3.0, 3.0, 3.0);
+      }
+      if (i == 2 || i == 3)
+      {
+        filter->SetStencilData(stencil);
+        filter->SetReverseStencil(i == 3);
+      }
+      if (i == 4)
+      {
+        filter->IgnoreZeroOn();
+      }
+      if (i == 5)
+      {
+        // more bins than voxels, the serial path is used
+        filter->SetComponentExtent(0, 99, 0, 99, 0, 99);
+      }
+    }
+    if (!SameResults(filters[0], filters[1]))
+    {
+      std::cerr << "Test case " << i << " failed" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Progressive mode, with a one component image
+  vtkNew<vtkImageData> scalars;
+  scalars->SetExtent(0, 19, 0, 16, 0, 10);
+  scalars->AllocateScalars(VTK_UNSIGNED_CHAR, 1);
+  unsigned char* sptr = static_cast<unsigned char*>(scalars->GetScalarPointer());
+  for (vtkIdType i = 0; i < scalars->GetNumberOfPoints(); ++i)
+  {
+    sptr[i] = static_cast<unsigned char>(i % 200);
+  }
+
+  CoarsePassInfo info;
+  vtkNew<vtkCallbackCommand> callback;
+  callback->SetCallback(CoarsePassCallback);
+  callback->SetClientData(&info);
+  vtkNew<vtkImageAccumulate> progressive;
+  progressive->SetInputData(scalars);
+  progressive->ProgressiveOn();
+  progressive->SetProgressiveStride(3);
+  progressive->AddObserver(vtkCommand::UpdateDataEvent, callback);
+  progressive->Update();
+
+  // 7 x 6 x 4 voxels of the sampling grid, then all the voxels
+  const vtkIdType coarseCount = 7 * 6 * 4;
+  if (info.Calls != 1 || !info.CoarsePass || info.VoxelCount != coarseCount ||
+    info.BinTotal != coarseCount || progressive->GetCoarsePass() ||
+    progressive->GetVoxelCount() != scalars->GetNumberOfPoints() ||
+    BinTotal(progressive) != scalars->GetNumberOfPoints())
+  {
+    std::cerr << "Progressive mode failed: " << info.Calls << " " << info.VoxelCount << " "
+              << info.BinTotal << " " << progressive->GetVoxelCount() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,275 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkImageBrickCacheFilter passes its input unchanged for any
+// update extent, that each brick is read from the input only once, that the
+// cache stays within its memory limit, and that an aborted request does not
+// leave reads behind.
+
+#include "vtkCallbackCommand.h"
+#include "vtkCommand.h"
+#include "vtkImageBrickCacheFilter.h"
+#include "vtkImageData.h"
+#include "vtkImageDataStreamer.h"
+#include "vtkImageGaussianSmooth.h"
+#include "vtkNew.h"
+#include "vtkRTAnalyticSource.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+// 4x3x2 bricks of 16x16x16 points
+const int WholeExtent[6] = { 0, 63, 0, 47, 0, 31 };
+
+bool SameScalars(vtkImageData* a, vtkImageData* b, const int extent[6], double tolerance = 0.0)
+{
+  for (int z = extent[4]; z <= extent[5]; ++z)
+  {
+    for (int y = extent[2]; y <= extent[3]; ++y)
+    {
+      for (int x = extent[0]; x <= extent[1]; ++x)
+      {
+        double va = a->GetScalarComponentAsDouble(x, y, z, 0);
+        double vb = b->GetScalarComponentAsDouble(x, y, z, 0);
+        if (std::abs(va - vb) > tolerance)
+        {
+          std::cerr << "Scalar at (" << x << ", " << y << ", " << z << ") is " << va
+                    << " instead of " << vb << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// Check the brick counters of the cache, a negative value is not checked.
+bool CheckBricks(vtkImageBrickCacheFilter* cache, const char* step, vtkIdType misses,
+  vtkIdType hits, vtkIdType cached = -1)
+{
+  if ((misses >= 0 && cache->GetNumberOfBrickMisses() != misses) ||
+    (hits >= 0 && cache->GetNumberOfBrickHits() != hits) ||
+    (cached >= 0 && cache->GetNumberOfCachedBricks() != cached))
+  {
+    std::cerr << step << ": " << cache->GetNumberOfBrickMisses() << " misses, "
+              << cache->GetNumberOfBrickHits() << " hits and " << cache->GetNumberOfCachedBricks()
+              << " cached bricks instead of " << misses << ", " << hits << " and " << cached
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestExtents()
+{
+  vtkNew<vtkRTAnalyticSource> source;
+  source->SetWholeExtent(0, 63, 0, 47, 0, 31);
+  vtkNew<vtkRTAnalyticSource> reference;
+  reference->SetWholeExtent(0, 63, 0, 47, 0, 31);
+  reference->Update();
+
+  vtkNew<vtkImageBrickCacheFilter> cache;
+  cache->SetInputConnection(source->GetOutputPort());
+  cache->SetBrickSize(16, 16, 16);
+
+  // Only the two bricks that contain the extent are read, in one piece
+  const int extent1[6] = { 5, 20, 0, 15, 3, 10 };
+  cache->UpdateExtent(extent1);
+  if (!CheckBricks(cache, "First extent", 2, 0, 2) ||
+    !SameScalars(cache->GetOutput(), reference->GetOutput(), extent1))
+  {
+    return false;
+  }
+  const int read1[6] = { 0, 31, 0, 15, 0, 15 };
+  const int* sourceExtent = source->GetOutput()->GetExtent();
+  for (int i = 0; i < 6; ++i)
+  {
+    if (sourceExtent[i] != read1[i])
+    {
+      std::cerr << "The bricks were not read in one piece" << std::endl;
+      return false;
+    }
+  }
+
+  // An overlapping extent reads the missing bricks only
+  const int extent2[6] = { 10, 40, 4, 20, 0, 15 };
+  cache->UpdateExtent(extent2);
+  if (!CheckBricks(cache, "Overlapping extent", 6, 2) ||
+    !SameScalars(cache->GetOutput(), reference->GetOutput(), extent2))
+  {
+    return false;
+  }
+
+  // An extent within the cached bricks does not read anything
+  const int extent3[6] = { 16, 31, 0, 31, 0, 15 };
+  cache->UpdateExtent(extent3);
+  if (!CheckBricks(cache, "Cached extent", 6, 4) ||
+    !SameScalars(cache->GetOutput(), reference->GetOutput(), extent3))
+  {
+    return false;
+  }
+
+  cache->UpdateExtent(WholeExtent);
+  if (!CheckBricks(cache, "Whole extent", 24, -1, 24) ||
+    !SameScalars(cache->GetOutput(), reference->GetOutput(), WholeExtent))
+  {
+    return false;
+  }
+  if (cache->GetCacheMemorySize() != 24 * 16)
+  {
+    std::cerr << "The cache takes " << cache->GetCacheMemorySize() << " KiB instead of "
+              << 24 * 16 << std::endl;
+    return false;
+  }
+
+  // A modified input clears the cache
+  source->SetMaximum(100.0);
+  reference->SetMaximum(100.0);
+  reference->Update();
+  cache->UpdateExtent(extent1);
+  if (!CheckBricks(cache, "Modified input", 2, 0) ||
+    !SameScalars(cache->GetOutput(), reference->GetOutput(), extent1))
+  {
+    return false;
+  }
+
+  // So does a new brick size
+  cache->SetBrickSize(20, 20, 20);
+  cache->UpdateExtent(extent1);
+  if (!CheckBricks(cache, "New brick size", 2, -1, 2) ||
+    !SameScalars(cache->GetOutput(), reference->GetOutput(), extent1))
+  {
+    return false;
+  }
+  return true;
+}
+
+bool TestMemoryLimit()
+{
+  vtkNew<vtkRTAnalyticSource> source;
+  source->SetWholeExtent(0, 63, 0, 47, 0, 31);
+  source->Update();
+
+  // A brick of 16x16x16 floats takes 16 KiB, so that only 4 bricks are kept
+  vtkNew<vtkImageBrickCacheFilter> cache;
+  cache->SetInputConnection(source->GetOutputPort());
+  cache->SetBrickSize(16, 16, 16);
+  cache->SetMemoryLimit(64);
+  cache->UpdateExtent(WholeExtent);
+  if (!CheckBricks(cache, "Memory limit", -1, -1, 4) ||
+    !SameScalars(cache->GetOutput(), source->GetOutput(), WholeExtent))
+  {
+    return false;
+  }
+  if (cache->GetCacheMemorySize() > 64)
+  {
+    std::cerr << "The cache takes " << cache->GetCacheMemorySize() << " KiB" << std::endl;
+    return false;
+  }
+
+  // The last bricks are the ones that were kept
+  const int lastBrick[6] = { 48, 63, 32, 47, 16, 31 };
+  cache->UpdateExtent(lastBrick);
+  if (!CheckBricks(cache, "Last brick", 24, 1))
+  {
+    return false;
+  }
+  const int firstBrick[6] = { 0, 15, 0, 15, 0, 15 };
+  cache->UpdateExtent(firstBrick);
+  if (!CheckBricks(cache, "First brick", 25, -1) ||
+    !SameScalars(cache->GetOutput(), source->GetOutput(), firstBrick))
+  {
+    return false;
+  }
+  return true;
+}
+
+bool TestStreaming()
+{
+  vtkNew<vtkRTAnalyticSource> source;
+  source->SetWholeExtent(0, 63, 0, 47, 0, 31);
+  vtkNew<vtkImageBrickCacheFilter> cache;
+  cache->SetInputConnection(source->GetOutputPort());
+  cache->SetBrickSize(16, 16, 16);
+  vtkNew<vtkImageGaussianSmooth> smooth;
+  smooth->SetInputConnection(cache->GetOutputPort());
+  smooth->SetStandardDeviations(2.0, 2.0, 2.0);
+  vtkNew<vtkImageDataStreamer> streamer;
+  streamer->SetInputConnection(smooth->GetOutputPort());
+  streamer->SetNumberOfStreamDivisions(8);
+  streamer->Update();
+
+  // The pieces overlap, but each brick is read once
+  if (!CheckBricks(cache, "Streaming", 24, -1))
+  {
+    return false;
+  }
+  if (cache->GetNumberOfBrickHits() == 0)
+  {
+    std::cerr << "The overlapping pieces did not use the cached bricks" << std::endl;
+    return false;
+  }
+
+  vtkNew<vtkRTAnalyticSource> reference;
+  reference->SetWholeExtent(0, 63, 0, 47, 0, 31);
+  vtkNew<vtkImageGaussianSmooth> referenceSmooth;
+  referenceSmooth->SetInputConnection(reference->GetOutputPort());
+  referenceSmooth->SetStandardDeviations(2.0, 2.0, 2.0);
+  referenceSmooth->Update();
+  return SameScalars(streamer->GetOutput(), referenceSmooth->GetOutput(), WholeExtent, 1e-3);
+}
+
+// Abort the filter once it has read some of its boxes of bricks.
+void AbortAfterFirstRead(vtkObject* caller, unsigned long, void*, void* callData)
+{
+  double progress = *static_cast<double*>(callData);
+  if (progress > 0.0 && progress < 1.0)
+  {
+    static_cast<vtkAlgorithm*>(caller)->SetAbortExecute(1);
+  }
+}
+
+bool TestAbort()
+{
+  vtkNew<vtkRTAnalyticSource> source;
+  source->SetWholeExtent(0, 63, 0, 47, 0, 31);
+  source->Update();
+  vtkNew<vtkImageBrickCacheFilter> cache;
+  cache->SetInputConnection(source->GetOutputPort());
+  cache->SetBrickSize(16, 16, 16);
+
+  // With the middle brick cached, the two others are read separately
+  const int middleBrick[6] = { 16, 31, 0, 15, 0, 15 };
+  cache->UpdateExtent(middleBrick);
+  vtkNew<vtkCallbackCommand> abort;
+  abort->SetCallback(AbortAfterFirstRead);
+  unsigned long observer = cache->AddObserver(vtkCommand::ProgressEvent, abort);
+  const int extent[6] = { 0, 47, 0, 15, 0, 15 };
+  cache->UpdateExtent(extent);
+  cache->RemoveObserver(observer);
+  cache->SetAbortExecute(0);
+  if (!CheckBricks(cache, "Aborted request", 3, 1, 2))
+  {
+    return false;
+  }
+
+  // The next request starts over, for the same extent or another one
+  cache->UpdateExtent(extent);
+  if (!CheckBricks(cache, "Request after the abort", 4, 3, 3) ||
+    !SameScalars(cache->GetOutput(), source->GetOutput(), extent))
+  {
+    return false;
+  }
+  cache->UpdateExtent(WholeExtent);
+  return CheckBricks(cache, "Whole extent after the abort", 25, -1, 24) &&
+    SameScalars(cache->GetOutput(), source->GetOutput(), WholeExtent);
+}
+}
+
+int ImageBrickCacheFilter(int, char*[])
+{
+  return TestExtents() && TestMemoryLimit() && TestStreaming() && TestAbort() ? EXIT_SUCCESS
+                                                                               : EXIT_FAILURE;
+}
@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compare vtkImageRankFilter with a brute force computation of the ranks,
+// for the sliding histograms of 8-bit and 16-bit scalars and for the
+// partial sorts of the other types, and report the timings of a 7x7x7
+// median compared with vtkImageMedian3D.
+
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkImageMedian3D.h"
+#include "vtkImageRankFilter.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+void MakeImage(vtkImageData* image, int scalarType, int numComponents, const int dims[3],
+  double minValue, double maxValue)
+{
+  image->SetDimensions(dims[0], dims[1], dims[2]);
+  image->AllocateScalars(scalarType, numComponents);
+  vtkDataArray* scalars = image->GetPointData()->GetScalars();
+  vtkMath::RandomSeed(4521);
+  for (vtkIdType i = 0; i < scalars->GetNumberOfValues(); ++i)
+  {
+    scalars->SetVariantValue(i, static_cast<int>(vtkMath::Random(minValue, maxValue)));
+  }
+}
+
+// The value of the given rank in the neighborhood of a point.
+double BruteForceRank(vtkImageData* image, const int kernelSize[3], double rank, int x, int y,
+  int z, int comp)
+{
+  const int* extent = image->GetExtent();
+  std::vector<double> values;
+  for (int k = z - kernelSize[2] / 2; k < z - kernelSize[2] / 2 + kernelSize[2]; ++k)
+  {
+    for (int j = y - kernelSize[1] / 2; j < y - kernelSize[1] / 2 + kernelSize[1]; ++j)
+    {
+      for (int i = x - kernelSize[0] / 2; i < x - kernelSize[0] / 2 + kernelSize[0]; ++i)
+      {
+        if (i >= extent[0] && i <= extent[1] && j >= extent[2] && j <= extent[3] &&
+          k >= extent[4] && k <= extent[5])
+        {
+          values.push_back(image->GetScalarComponentAsDouble(i, j, k, comp));
+        }
+      }
+    }
+  }
+  std::sort(values.begin(), values.end());
+  return values[static_cast<size_t>(rank * (values.size() - 1) + 0.5)];
+}
+
+bool TestRanks(int scalarType, int numComponents, double minValue, double maxValue)
+{
+  const int dims[3] = { 23, 17, 11 };
+  vtkNew<vtkImageData> image;
+  MakeImage(image, scalarType, numComponents, dims, minValue, maxValue);
+
+  const int kernelSize[3] = { 5, 4, 3 };
+  const double ranks[5] = { 0.0, 0.25, 0.5, 0.8, 1.0 };
+  for (double rank : ranks)
+  {
+    vtkNew<vtkImageRankFilter> filter;
+    filter->SetInputData(image);
+    filter->SetKernelSize(kernelSize[0], kernelSize[1], kernelSize[2]);
+    filter->SetRank(rank);
+    filter->Update();
+    vtkImageData* output = filter->GetOutput();
+    if (output->GetScalarType() != scalarType)
+    {
+      std::cerr << "Wrong output scalar type " << output->GetScalarTypeAsString() << std::endl;
+      return false;
+    }
+    for (int z = 0; z < dims[2]; ++z)
+    {
+      for (int y = 0; y < dims[1]; ++y)
+      {
+        for (int x = 0; x < dims[0]; ++x)
+        {
+          for (int c = 0; c < numComponents; ++c)
+          {
+            const double value = output->GetScalarComponentAsDouble(x, y, z, c);
+            const double expected = BruteForceRank(image, kernelSize, rank, x, y, z, c);
+            if (value != expected)
+            {
+              std::cerr << image->GetScalarTypeAsString() << " rank " << rank << " at (" << x
+                        << ", " << y << ", " << z << "), component " << c << ": " << value
+                        << " instead of " << expected << std::endl;
+              return false;
+            }
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool TimeMedian()
+{
+  const int dims[3] = { 128, 128, 64 };
+  vtkNew<vtkImageData> image;
+  MakeImage(image, VTK_SHORT, 1, dims, -1024.0, 3071.0);
+
+  vtkNew<vtkTimerLog> timer;
+  vtkNew<vtkImageMedian3D> median;
+  median->SetInputData(image);
+  median->SetKernelSize(7, 7, 7);
+  timer->StartTimer();
+  median->Update();
+  timer->StopTimer();
+  std::cout << "7x7x7 median of 128x128x64 shorts, vtkImageMedian3D: " << timer->GetElapsedTime()
+            << "\n";
+
+  vtkNew<vtkImageRankFilter> rank;
+  rank->SetInputData(image);
+  rank->SetKernelSize(7, 7, 7);
+  timer->StartTimer();
+  rank->Update();
+  timer->StopTimer();
+  std::cout << "7x7x7 median of 128x128x64 shorts, vtkImageRankFilter: " << timer->GetElapsedTime()
+            << "\n";
+
+  // The neighborhoods away from the boundaries have an odd size, so that
+  // both filters give the same median.
+  int x = dims[0] / 2;
+  int y = dims[1] / 2;
+  int z = dims[2] / 2;
+  if (rank->GetOutput()->GetScalarComponentAsDouble(x, y, z, 0) !=
+    median->GetOutput()->GetScalarComponentAsDouble(x, y, z, 0))
+  {
+    std::cerr << "The median differs from the one of vtkImageMedian3D" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int ImageRankFilter(int, char*[])
+{
+  bool success = true;
+  success &= TestRanks(VTK_UNSIGNED_CHAR, 1, 0.0, 255.0);
+  success &= TestRanks(VTK_SIGNED_CHAR, 2, -128.0, 127.0);
+  success &= TestRanks(VTK_SHORT, 1, -1024.0, 3071.0);
+  success &= TestRanks(VTK_UNSIGNED_SHORT, 1, 0.0, 20.0);
+  success &= TestRanks(VTK_FLOAT, 1, -100.0, 100.0);
+  success &= TestRanks(VTK_INT, 3, -100000.0, 100000.0);
+  success &= TimeMedian();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
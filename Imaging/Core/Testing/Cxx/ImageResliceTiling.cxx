@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the tiled execution of vtkImageReslice and its row-wise
+// trilinear interpolation give the same output as the unoptimized code, and
+// report the timings of an oblique reslice with each of them.
+
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkImageReslice.h"
+#include "vtkImageStencilData.h"
+#include "vtkMath.h"
+#include "vtkMatrix4x4.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkTimerLog.h"
+#include "vtkTransform.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+void MakeImage(vtkImageData* image, int scalarType, int numComponents, int size)
+{
+  image->SetDimensions(size, size, size / 2);
+  image->SetSpacing(1.0, 1.0, 2.0);
+  image->AllocateScalars(scalarType, numComponents);
+  vtkDataArray* scalars = image->GetPointData()->GetScalars();
+  vtkMath::RandomSeed(7301);
+  for (vtkIdType i = 0; i < scalars->GetNumberOfValues(); ++i)
+  {
+    scalars->SetVariantValue(i, static_cast<int>(vtkMath::Random(0, 1000)));
+  }
+}
+
+enum Mode
+{
+  Reference,
+  Optimized,
+  Tiled
+};
+
+void SetUp(vtkImageReslice* reslice, vtkImageData* input, int interpolation, Mode mode)
+{
+  vtkNew<vtkTransform> transform;
+  transform->RotateWXYZ(30.0, 1.0, 2.0, 3.0);
+  vtkNew<vtkMatrix4x4> axes;
+  axes->DeepCopy(transform->GetMatrix());
+  axes->SetElement(0, 3, 40.0);
+  axes->SetElement(1, 3, 30.0);
+  axes->SetElement(2, 3, 40.0);
+
+  reslice->SetInputData(input);
+  reslice->SetResliceAxes(axes);
+  reslice->SetInterpolationMode(interpolation);
+  reslice->SetBackgroundLevel(-1.0);
+  reslice->SetOutputSpacing(0.9, 0.9, 1.5);
+  reslice->SetOutputOrigin(-40.0, -40.0, -10.0);
+  reslice->SetOutputExtent(0, 99, 0, 89, 0, 15);
+  reslice->GenerateStencilOutputOn();
+  reslice->SetOptimization(mode != Reference);
+  reslice->SetTiling(mode == Tiled);
+  reslice->SetTileSize(16, 8, 4);
+}
+
+bool SameStencils(vtkImageStencilData* a, vtkImageStencilData* b, const int extent[6])
+{
+  for (int z = extent[4]; z <= extent[5]; ++z)
+  {
+    for (int y = extent[2]; y <= extent[3]; ++y)
+    {
+      int iterA = 0;
+      int iterB = 0;
+      int r1A, r2A, r1B, r2B;
+      bool moreA, moreB;
+      do
+      {
+        moreA = a->GetNextExtent(r1A, r2A, extent[0], extent[1], y, z, iterA) != 0;
+        moreB = b->GetNextExtent(r1B, r2B, extent[0], extent[1], y, z, iterB) != 0;
+        if (moreA != moreB || (moreA && (r1A != r1B || r2A != r2B)))
+        {
+          std::cerr << "The stencils differ in row " << y << " of slice " << z << std::endl;
+          return false;
+        }
+      } while (moreA);
+    }
+  }
+  return true;
+}
+
+// The optimized and tiled outputs must match the reference exactly.
+bool TestModes(int scalarType, int numComponents, int interpolation)
+{
+  vtkNew<vtkImageData> input;
+  MakeImage(input, scalarType, numComponents, 64);
+
+  vtkNew<vtkImageReslice> reslices[3];
+  for (int mode = Reference; mode <= Tiled; ++mode)
+  {
+    SetUp(reslices[mode], input, interpolation, static_cast<Mode>(mode));
+    reslices[mode]->Update();
+  }
+
+  vtkDataArray* expected = reslices[Reference]->GetOutput()->GetPointData()->GetScalars();
+  for (int mode = Optimized; mode <= Tiled; ++mode)
+  {
+    vtkImageData* output = reslices[mode]->GetOutput();
+    vtkDataArray* result = output->GetPointData()->GetScalars();
+    if (result->GetNumberOfValues() != expected->GetNumberOfValues())
+    {
+      std::cerr << "Mode " << mode << ": wrong number of values" << std::endl;
+      return false;
+    }
+    for (vtkIdType i = 0; i < expected->GetNumberOfValues(); ++i)
+    {
+      if (result->GetVariantValue(i) != expected->GetVariantValue(i))
+      {
+        std::cerr << "Mode " << mode << ", interpolation " << interpolation << ": value " << i
+                  << " is " << result->GetVariantValue(i).ToDouble() << " instead of "
+                  << expected->GetVariantValue(i).ToDouble() << std::endl;
+        return false;
+      }
+    }
+    if (!SameStencils(reslices[mode]->GetStencilOutput(), reslices[Reference]->GetStencilOutput(),
+          output->GetExtent()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TimeModes()
+{
+  vtkNew<vtkImageData> input;
+  MakeImage(input, VTK_SHORT, 1, 256);
+
+  const char* names[3] = { "reference", "optimized", "tiled" };
+  vtkNew<vtkTimerLog> timer;
+  for (int mode = Reference; mode <= Tiled; ++mode)
+  {
+    vtkNew<vtkImageReslice> reslice;
+    SetUp(reslice, input, VTK_RESLICE_LINEAR, static_cast<Mode>(mode));
+    reslice->GenerateStencilOutputOff();
+    reslice->SetOutputSpacing(0.5, 0.5, 1.0);
+    reslice->SetOutputExtent(0, 255, 0, 255, 0, 63);
+    timer->StartTimer();
+    reslice->Update();
+    timer->StopTimer();
+    std::cout << "Oblique linear reslice of 256x256x64 voxels, " << names[mode] << ": "
+              << timer->GetElapsedTime() << "\n";
+  }
+  return true;
+}
+}
+
+int ImageResliceTiling(int, char*[])
+{
+  bool success = true;
+  const int interpolations[3] = { VTK_RESLICE_NEAREST, VTK_RESLICE_LINEAR, VTK_RESLICE_CUBIC };
+  for (int interpolation : interpolations)
+  {
+    success &= TestModes(VTK_SHORT, 1, interpolation);
+    success &= TestModes(VTK_FLOAT, 2, interpolation);
+    success &= TestModes(VTK_UNSIGNED_CHAR, 3, interpolation);
+  }
+  success &= TimeModes();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
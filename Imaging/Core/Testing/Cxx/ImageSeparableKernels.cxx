@@ -0,0 +1,383 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compare the passes of vtkImageSeparableKernels with a per-sample
+// convolution for all the axes and boundary modes, report the timings of
+// both, and check the filters built on them.
+
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkImageGaussianSmooth.h"
+#include "vtkImageGradient.h"
+#include "vtkImageSeparableConvolution.h"
+#include "vtkImageSeparableKernels.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+bool Near(double a, double b, double tol)
+{
+  return std::abs(a - b) <= tol * (1.0 + std::abs(b));
+}
+
+void FillRandom(vtkImageData* image, int scalarType, int numComponents, const int extent[6])
+{
+  image->SetExtent(const_cast<int*>(extent));
+  image->AllocateScalars(scalarType, numComponents);
+  vtkDataArray* scalars = image->GetPointData()->GetScalars();
+  vtkMath::RandomSeed(2183);
+  for (vtkIdType i = 0; i < scalars->GetNumberOfValues(); ++i)
+  {
+    scalars->SetVariantValue(i, static_cast<int>(vtkMath::Random(-1000, 1000)));
+  }
+}
+
+// The per-sample convolution, with the loop over the taps innermost.
+template <class T>
+void Reference(int axis, const std::vector<double>& kernel, int boundary, const T* inPtr,
+  const int inExt[6], const vtkIdType inIncs[3], float* outPtr, const int outExt[6],
+  const vtkIdType outIncs[3], int numComponents)
+{
+  const int size = static_cast<int>(kernel.size());
+  const int center = (size - 1) / 2;
+  double kernelSum = 0.0;
+  for (double w : kernel)
+  {
+    kernelSum += w;
+  }
+  for (int z = outExt[4]; z <= outExt[5]; ++z)
+  {
+    for (int y = outExt[2]; y <= outExt[3]; ++y)
+    {
+      for (int x = outExt[0]; x <= outExt[1]; ++x)
+      {
+        for (int c = 0; c < numComponents; ++c)
+        {
+          double sum = 0.0;
+          double validSum = 0.0;
+          bool clipped = false;
+          for (int t = 0; t < size; ++t)
+          {
+            int idx[3] = { x, y, z };
+            idx[axis] += t - center;
+            const int lo = inExt[2 * axis];
+            const int hi = inExt[2 * axis + 1];
+            if (idx[axis] < lo || idx[axis] > hi)
+            {
+              clipped = true;
+              if (boundary != vtkImageSeparableKernels::Clamp)
+              {
+                continue;
+              }
+              idx[axis] = std::min(std::max(idx[axis], lo), hi);
+            }
+            else
+            {
+              validSum += kernel[t];
+            }
+            sum += kernel[t] *
+              static_cast<double>(inPtr[(idx[0] - inExt[0]) * inIncs[0] +
+                (idx[1] - inExt[2]) * inIncs[1] + (idx[2] - inExt[4]) * inIncs[2] + c]);
+          }
+          if (boundary == vtkImageSeparableKernels::Renormalize && clipped && validSum != 0.0)
+          {
+            sum *= kernelSum / validSum;
+          }
+          outPtr[(x - outExt[0]) * outIncs[0] + (y - outExt[2]) * outIncs[1] +
+            (z - outExt[4]) * outIncs[2] + c] = static_cast<float>(sum);
+        }
+      }
+    }
+  }
+}
+
+// Convolve a region with both methods and compare the results.
+bool Compare(vtkImageData* input, const int inExt[6], const int outExt[6], int axis,
+  const std::vector<double>& kernel, int boundary, int outComponents, double times[2])
+{
+  const int numComponents = input->GetNumberOfScalarComponents();
+  vtkNew<vtkImageData> outputs[2];
+  vtkNew<vtkTimerLog> timer;
+  for (int method = 0; method < 2; ++method)
+  {
+    outputs[method]->SetExtent(const_cast<int*>(outExt));
+    outputs[method]->AllocateScalars(VTK_FLOAT, outComponents);
+    outputs[method]->GetPointData()->GetScalars()->Fill(0.0);
+    vtkIdType inIncs[3], outIncs[3];
+    input->GetIncrements(inIncs);
+    outputs[method]->GetIncrements(outIncs);
+    int ext[6];
+    std::copy(inExt, inExt + 6, ext);
+    const short* inPtr = static_cast<short*>(input->GetScalarPointerForExtent(ext));
+    float* outPtr = static_cast<float*>(outputs[method]->GetScalarPointer());
+    timer->StartTimer();
+    if (method == 0)
+    {
+      Reference(axis, kernel, boundary, inPtr, inExt, inIncs, outPtr, outExt, outIncs,
+        numComponents);
+    }
+    else
+    {
+      if (!vtkImageSeparableKernels::ConvolveAxis(axis, kernel.data(),
+            static_cast<int>(kernel.size()), boundary, inPtr, VTK_SHORT, inExt, inIncs, outPtr,
+            VTK_FLOAT, outExt, outIncs, numComponents))
+      {
+        std::cerr << "ConvolveAxis failed along axis " << axis << std::endl;
+        return false;
+      }
+    }
+    timer->StopTimer();
+    times[method] = timer->GetElapsedTime();
+  }
+
+  vtkDataArray* expected = outputs[0]->GetPointData()->GetScalars();
+  vtkDataArray* result = outputs[1]->GetPointData()->GetScalars();
+  for (vtkIdType i = 0; i < expected->GetNumberOfValues(); ++i)
+  {
+    const double value = result->GetVariantValue(i).ToDouble();
+    if (!Near(value, expected->GetVariantValue(i).ToDouble(), 1e-6))
+    {
+      std::cerr << "Axis " << axis << ", boundary " << boundary << ", value " << i << ": " << value
+                << " instead of " << expected->GetVariantValue(i).ToDouble() << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestKernels()
+{
+  // all the boundary modes, with regions that do not cover the whole input,
+  // and outputs with more components than the input
+  const int inExt[6] = { -3, 12, 0, 9, 2, 8 };
+  vtkNew<vtkImageData> input;
+  FillRandom(input, VTK_SHORT, 2, inExt);
+  const std::vector<double> kernels[3] = { { 0.25, 0.5, 0.25 }, { 1.0, -2.0, 0.0, 3.0, 0.5 },
+    { 2.0, 1.0 } };
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    for (int boundary = vtkImageSeparableKernels::Clamp;
+         boundary <= vtkImageSeparableKernels::Renormalize; ++boundary)
+    {
+      for (const std::vector<double>& kernel : kernels)
+      {
+        for (int grow = 0; grow < 2; ++grow)
+        {
+          // the output may extend beyond the input only along the axis
+          int outExt[6];
+          std::copy(inExt, inExt + 6, outExt);
+          outExt[2 * axis] -= 2 * grow;
+          outExt[2 * axis + 1] += 2 * grow;
+          outExt[2 * ((axis + 1) % 3)] += grow;
+          double times[2];
+          if (!Compare(input, inExt, outExt, axis, kernel, boundary, 2, times) ||
+            !Compare(input, inExt, outExt, axis, kernel, boundary, 3, times))
+          {
+            return false;
+          }
+        }
+      }
+    }
+  }
+
+  // unsupported output types and invalid regions are rejected
+  vtkIdType incs[3];
+  input->GetIncrements(incs);
+  const double kernel[3] = { 1.0, 2.0, 1.0 };
+  short outValue;
+  if (vtkImageSeparableKernels::ConvolveAxis(0, kernel, 3, vtkImageSeparableKernels::Clamp,
+        input->GetScalarPointer(), VTK_SHORT, inExt, incs, &outValue, VTK_INT, inExt, incs, 1))
+  {
+    std::cerr << "ConvolveAxis accepted an unsupported output type" << std::endl;
+    return false;
+  }
+  const int badExt[6] = { -3, 12, 0, 10, 2, 8 };
+  if (vtkImageSeparableKernels::ConvolveAxis(0, kernel, 3, vtkImageSeparableKernels::Clamp,
+        input->GetScalarPointer(), VTK_SHORT, inExt, incs, &outValue, VTK_SHORT, badExt, incs, 1))
+  {
+    std::cerr << "ConvolveAxis accepted an output extent larger than the input" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TimeKernels()
+{
+  const int extent[6] = { 0, 255, 0, 255, 0, 63 };
+  vtkNew<vtkImageData> input;
+  FillRandom(input, VTK_SHORT, 1, extent);
+  std::vector<double> kernel(9);
+  for (int t = 0; t < 9; ++t)
+  {
+    kernel[t] = std::exp(-(t - 4) * (t - 4) / 8.0);
+  }
+
+  std::cout << "Convolution of 256x256x64 shorts with 9 taps (per-sample / separable kernels)\n";
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    double times[2];
+    if (!Compare(input, extent, extent, axis, kernel, vtkImageSeparableKernels::Clamp, 1, times))
+    {
+      return false;
+    }
+    std::cout << "axis " << axis << ": " << times[0] << " / " << times[1] << "\n";
+  }
+  return true;
+}
+
+// The output of vtkImageGaussianSmooth is a Gaussian normalized over the
+// whole extent.
+bool TestGaussianSmooth()
+{
+  const int extent[6] = { 0, 40, 0, 30, 0, 20 };
+  vtkNew<vtkImageData> input;
+  FillRandom(input, VTK_FLOAT, 1, extent);
+  vtkNew<vtkImageGaussianSmooth> smooth;
+  smooth->SetInputData(input);
+  smooth->SetStandardDeviations(2.0, 1.0, 1.5);
+  smooth->SetRadiusFactors(1.5, 2.0, 2.0);
+  smooth->Update();
+  vtkImageData* output = smooth->GetOutput();
+
+  const double stds[3] = { 2.0, 1.0, 1.5 };
+  const int radii[3] = { 3, 2, 3 };
+  const int i[3] = { 1, 15, 19 };
+  double sum = 0.0;
+  double weightSum = 0.0;
+  for (int z = i[2] - radii[2]; z <= i[2] + radii[2]; ++z)
+  {
+    for (int y = i[1] - radii[1]; y <= i[1] + radii[1]; ++y)
+    {
+      for (int x = i[0] - radii[0]; x <= i[0] + radii[0]; ++x)
+      {
+        if (x < extent[0] || x > extent[1] || y < extent[2] || y > extent[3] || z < extent[4] ||
+          z > extent[5])
+        {
+          continue;
+        }
+        const int d[3] = { x - i[0], y - i[1], z - i[2] };
+        double w = 1.0;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+          w *= std::exp(-d[axis] * d[axis] / (2.0 * stds[axis] * stds[axis]));
+        }
+        sum += w * input->GetScalarComponentAsDouble(x, y, z, 0);
+        weightSum += w;
+      }
+    }
+  }
+  const double value = output->GetScalarComponentAsDouble(i[0], i[1], i[2], 0);
+  if (!Near(value, sum / weightSum, 1e-5))
+  {
+    std::cerr << "vtkImageGaussianSmooth: " << value << " instead of " << sum / weightSum
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// vtkImageSeparableConvolution convolves (rather than correlates) and
+// replicates the edges of the input.
+bool TestSeparableConvolution()
+{
+  const int extent[6] = { 0, 20, 0, 4, 0, 3 };
+  vtkNew<vtkImageData> input;
+  FillRandom(input, VTK_SHORT, 1, extent);
+  vtkNew<vtkFloatArray> kernel;
+  kernel->InsertNextValue(1.0);
+  kernel->InsertNextValue(2.0);
+  kernel->InsertNextValue(4.0);
+  vtkNew<vtkImageSeparableConvolution> convolution;
+  convolution->SetInputData(input);
+  convolution->SetXKernel(kernel);
+  convolution->Update();
+  vtkImageData* output = convolution->GetOutput();
+  if (output->GetScalarType() != VTK_FLOAT)
+  {
+    std::cerr << "vtkImageSeparableConvolution: wrong output type" << std::endl;
+    return false;
+  }
+  for (int y = extent[2]; y <= extent[3]; ++y)
+  {
+    for (int x = extent[0]; x <= extent[1]; ++x)
+    {
+      double expected = 0.0;
+      for (int s = 0; s < 3; ++s)
+      {
+        const int xs = std::min(std::max(x + 1 - s, extent[0]), extent[1]);
+        expected += kernel->GetValue(s) * input->GetScalarComponentAsDouble(xs, y, 2, 0);
+      }
+      const double value = output->GetScalarComponentAsDouble(x, y, 2, 0);
+      if (!Near(value, expected, 1e-6))
+      {
+        std::cerr << "vtkImageSeparableConvolution at (" << x << ", " << y << "): " << value
+                  << " instead of " << expected << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// vtkImageGradient computes central differences, one sided at the edges.
+bool TestGradient()
+{
+  const int extent[6] = { 0, 9, 0, 7, 0, 5 };
+  vtkNew<vtkImageData> input;
+  FillRandom(input, VTK_SHORT, 1, extent);
+  input->SetSpacing(0.5, 1.0, 2.0);
+  vtkNew<vtkImageGradient> gradient;
+  gradient->SetInputData(input);
+  gradient->SetDimensionality(3);
+  gradient->Update();
+  vtkImageData* output = gradient->GetOutput();
+  if (output->GetNumberOfScalarComponents() != 3)
+  {
+    std::cerr << "vtkImageGradient: wrong number of components" << std::endl;
+    return false;
+  }
+  for (int z = extent[4]; z <= extent[5]; ++z)
+  {
+    for (int y = extent[2]; y <= extent[3]; ++y)
+    {
+      for (int x = extent[0]; x <= extent[1]; ++x)
+      {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+          int lo[3] = { x, y, z };
+          int hi[3] = { x, y, z };
+          lo[axis] = std::max(lo[axis] - 1, extent[2 * axis]);
+          hi[axis] = std::min(hi[axis] + 1, extent[2 * axis + 1]);
+          const double expected = (input->GetScalarComponentAsDouble(hi[0], hi[1], hi[2], 0) -
+                                    input->GetScalarComponentAsDouble(lo[0], lo[1], lo[2], 0)) *
+            0.5 / input->GetSpacing()[axis];
+          const double value = output->GetScalarComponentAsDouble(x, y, z, axis);
+          if (!Near(value, expected, 1e-12))
+          {
+            std::cerr << "vtkImageGradient at (" << x << ", " << y << ", " << z << "), axis "
+                      << axis << ": " << value << " instead of " << expected << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+}
+
+int ImageSeparableKernels(int, char*[])
+{
+  return TestKernels() && TimeKernels() && TestGaussianSmooth() && TestSeparableConvolution() &&
+      TestGradient()
+    ? EXIT_SUCCESS
+    : EXIT_FAILURE;
+}
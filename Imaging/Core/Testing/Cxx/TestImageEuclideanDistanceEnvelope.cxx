@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compare the distance maps of the Felzenszwalb algorithm of
+// vtkImageEuclideanDistance with a brute force computation and with the
+// Saito algorithm, and check its signed distances and closest features.
+
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkImageEuclideanDistance.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+bool Near(double a, double b)
+{
+  return std::abs(a - b) <= 1e-9 * (1.0 + std::abs(b));
+}
+
+// Squared distance between two voxels of an image.
+double Distance2(vtkImageData* image, vtkIdType a, vtkIdType b)
+{
+  double x[3], y[3];
+  image->GetPoint(a, x);
+  image->GetPoint(b, y);
+  return vtkMath::Distance2BetweenPoints(x, y);
+}
+
+// Smallest squared distance from a voxel to the voxels of the given kind.
+double BruteForce(vtkImageData* image, vtkIdType id, bool zero)
+{
+  double best = VTK_DOUBLE_MAX;
+  for (vtkIdType other = 0; other < image->GetNumberOfPoints(); ++other)
+  {
+    if ((image->GetPointData()->GetScalars()->GetComponent(other, 0) == 0) == zero)
+    {
+      best = std::min(best, Distance2(image, id, other));
+    }
+  }
+  return best;
+}
+
+bool TestEnvelope()
+{
+  // A sparse random mask on an anisotropic grid
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(17, 13, 9);
+  image->SetSpacing(1.0, 1.5, 0.7);
+  image->AllocateScalars(VTK_UNSIGNED_CHAR, 1);
+  vtkMath::RandomSeed(4321);
+  unsigned char* mask = static_cast<unsigned char*>(image->GetScalarPointer());
+  const vtkIdType numberOfPoints = image->GetNumberOfPoints();
+  for (vtkIdType id = 0; id < numberOfPoints; ++id)
+  {
+    mask[id] = vtkMath::Random() < 0.03 ? 0 : 1;
+  }
+
+  vtkNew<vtkImageEuclideanDistance> saito;
+  saito->SetInputData(image);
+  saito->SetAlgorithmToSaito();
+  saito->Update();
+  vtkDataArray* saitoMap = saito->GetOutput()->GetPointData()->GetScalars();
+
+  vtkNew<vtkImageEuclideanDistance> edt;
+  edt->SetInputData(image);
+  edt->SetAlgorithmToFelzenszwalb();
+  edt->GenerateClosestFeatureIdsOn();
+  edt->Update();
+  vtkImageData* output = edt->GetOutput();
+  vtkDataArray* map = output->GetPointData()->GetScalars();
+  vtkIdTypeArray* ids =
+    vtkArrayDownCast<vtkIdTypeArray>(output->GetPointData()->GetArray("ClosestFeatureIds"));
+  if (map->GetDataType() != VTK_DOUBLE || !ids || ids->GetNumberOfTuples() != numberOfPoints)
+  {
+    std::cerr << "Wrong output arrays" << std::endl;
+    return false;
+  }
+  for (vtkIdType id = 0; id < numberOfPoints; ++id)
+  {
+    const double expected = BruteForce(image, id, true);
+    if (!Near(map->GetComponent(id, 0), expected) || !Near(saitoMap->GetComponent(id, 0), expected))
+    {
+      std::cerr << "Wrong distance at " << id << ": " << map->GetComponent(id, 0) << " (Saito "
+                << saitoMap->GetComponent(id, 0) << ") instead of " << expected << std::endl;
+      return false;
+    }
+    const vtkIdType feature = ids->GetValue(id);
+    if (feature < 0 || feature >= numberOfPoints || mask[feature] != 0 ||
+      !Near(Distance2(image, id, feature), expected))
+    {
+      std::cerr << "Wrong closest feature " << feature << " at " << id << std::endl;
+      return false;
+    }
+  }
+
+  // Signed distances
+  edt->SignedDistanceOn();
+  edt->Update();
+  map = output->GetPointData()->GetScalars();
+  ids = vtkArrayDownCast<vtkIdTypeArray>(output->GetPointData()->GetArray("ClosestFeatureIds"));
+  if (!ids)
+  {
+    std::cerr << "No closest features with signed distances" << std::endl;
+    return false;
+  }
+  for (vtkIdType id = 0; id < numberOfPoints; ++id)
+  {
+    const bool inside = mask[id] != 0;
+    const double expected = inside ? BruteForce(image, id, true) : -BruteForce(image, id, false);
+    if (!Near(map->GetComponent(id, 0), expected))
+    {
+      std::cerr << "Wrong signed distance at " << id << ": " << map->GetComponent(id, 0)
+                << " instead of " << expected << std::endl;
+      return false;
+    }
+    const vtkIdType feature = ids->GetValue(id);
+    if ((mask[feature] != 0) == inside || !Near(Distance2(image, id, feature), std::abs(expected)))
+    {
+      std::cerr << "Wrong closest feature " << feature << " at " << id
+                << " with signed distances" << std::endl;
+      return false;
+    }
+  }
+
+  // No closest features unless requested
+  edt->GenerateClosestFeatureIdsOff();
+  edt->Update();
+  if (output->GetPointData()->GetArray("ClosestFeatureIds"))
+  {
+    std::cerr << "Closest features generated without being requested" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestImageEuclideanDistanceEnvelope(int, char*[])
+{
+  return TestEnvelope() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,12 +1,90 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 
-// Test the IsInside method of vtkImageStencilData.
+// Test the IsInside, Add, Subtract and Replace methods of vtkImageStencilData.
 
 #include "vtkImageStencilData.h"
 #include "vtkSmartPointer.h"
 #include "vtkTesting.h"
 
+//------------------------------------------------------------------------------
+// Fill a stencil with two runs per row, that move from row to row
+static void FillTestStencil(vtkImageStencilData* stencil, int extent[6], int seed)
+{
+  stencil->SetExtent(extent);
+  stencil->AllocateExtents();
+  for (int idZ = extent[4]; idZ <= extent[5]; idZ++)
+  {
+    for (int idY = extent[2]; idY <= extent[3]; idY++)
+    {
+      int r1 = extent[0] + (7 * idY + 3 * idZ + seed) % 15;
+      stencil->InsertNextExtent(r1, r1 + 5 + seed, idY, idZ);
+      r1 += 10 + seed;
+      stencil->InsertNextExtent(r1, r1 + (idY + idZ) % 4, idY, idZ);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Check the result of a logical operation voxel by voxel
+static bool TestLogicalOperation(int operation)
+{
+  int extent1[6] = { 0, 39, 0, 29, 0, 19 };
+  int extent2[6] = { 10, 49, 5, 34, 5, 24 };
+  vtkSmartPointer<vtkImageStencilData> stencil1 = vtkSmartPointer<vtkImageStencilData>::New();
+  vtkSmartPointer<vtkImageStencilData> stencil2 = vtkSmartPointer<vtkImageStencilData>::New();
+  vtkSmartPointer<vtkImageStencilData> result = vtkSmartPointer<vtkImageStencilData>::New();
+  FillTestStencil(stencil1, extent1, 0);
+  FillTestStencil(stencil2, extent2, 2);
+  result->DeepCopy(stencil1);
+
+  const char* name = "Add";
+  if (operation == 0)
+  {
+    result->Add(stencil2);
+  }
+  else if (operation == 1)
+  {
+    name = "Subtract";
+    result->Subtract(stencil2);
+  }
+  else
+  {
+    name = "Replace";
+    result->Replace(stencil2);
+  }
+
+  for (int idZ = -1; idZ <= 25; idZ++)
+  {
+    for (int idY = -1; idY <= 35; idY++)
+    {
+      for (int idX = -1; idX <= 50; idX++)
+      {
+        bool a = (stencil1->IsInside(idX, idY, idZ) != 0);
+        bool b = (stencil2->IsInside(idX, idY, idZ) != 0);
+        bool expected = (a || b);
+        if (operation == 1)
+        {
+          expected = (a && !b);
+        }
+        else if (operation == 2)
+        {
+          // the voxels of the second stencil replace the overlapping part
+          bool overlap = (idX >= extent2[0] && idX <= extent1[1] && idY >= extent2[2] &&
+            idY <= extent1[3] && idZ >= extent2[4] && idZ <= extent1[5]);
+          expected = (overlap ? b : a);
+        }
+        if ((result->IsInside(idX, idY, idZ) != 0) != expected)
+        {
+          cerr << name << " failed at (" << idX << ", " << idY << ", " << idZ << ")\n";
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 int TestImageStencilDataMethods(int argc, char* argv[])
 {
@@ -40,5 +118,14 @@ int TestImageStencilDataMethods(int argc, char* argv[])
     }
   }
 
+  // Test the logical operations, which process the rows in parallel
+  for (int operation = 0; operation < 3; operation++)
+  {
+    if (!TestLogicalOperation(operation))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,541 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkImageBrickCacheFilter.h"
+
+#include "vtkDataArray.h"
+#include "vtkDemandDrivenPipeline.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkImageBrickCacheFilter);
+
+//------------------------------------------------------------------------------
+class vtkImageBrickCacheFilter::vtkInternals
+{
+public:
+  struct Brick
+  {
+    vtkSmartPointer<vtkImageData> Data;
+    vtkIdType Size; // in bytes
+    std::list<vtkIdType>::iterator Use;
+  };
+
+  // The cached bricks by index, and their indices from the most recently
+  // used to the least recently used.
+  std::unordered_map<vtkIdType, Brick> Bricks;
+  std::list<vtkIdType> UseOrder;
+  vtkIdType MemorySize = 0;
+
+  // The layout of the bricks, and the time of the input pipeline when the
+  // cached bricks were read.
+  int WholeExtent[6] = { 0, -1, 0, -1, 0, -1 };
+  int BrickSize[3] = { 1, 1, 1 };
+  int Dimensions[3] = { 0, 0, 0 };
+  vtkMTimeType InputTime = 0;
+
+  // The boxes of bricks to read from the input for the current request, as
+  // ranges of brick indices, the next box to read, and the update extent of
+  // the request.
+  std::vector<int> Reads;
+  size_t CurrentRead = 0;
+  int RequestExtent[6] = { 0, -1, 0, -1, 0, -1 };
+
+  void Clear()
+  {
+    this->Bricks.clear();
+    this->UseOrder.clear();
+    this->MemorySize = 0;
+  }
+
+  // Forget the boxes left to read, so that the next pass starts a request.
+  void ResetReads()
+  {
+    this->Reads.clear();
+    this->CurrentRead = 0;
+  }
+
+  bool SameLayout(const int wholeExtent[6], const int brickSize[3]) const
+  {
+    return std::equal(wholeExtent, wholeExtent + 6, this->WholeExtent) &&
+      std::equal(brickSize, brickSize + 3, this->BrickSize);
+  }
+
+  void SetLayout(const int wholeExtent[6], const int brickSize[3])
+  {
+    std::copy(wholeExtent, wholeExtent + 6, this->WholeExtent);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      this->BrickSize[axis] = std::max(brickSize[axis], 1);
+      int size = wholeExtent[2 * axis + 1] - wholeExtent[2 * axis] + 1;
+      this->Dimensions[axis] =
+        (size > 0 ? (size + this->BrickSize[axis] - 1) / this->BrickSize[axis] : 0);
+    }
+  }
+
+  vtkIdType GetIndex(int i, int j, int k) const
+  {
+    return i + this->Dimensions[0] * (j + static_cast<vtkIdType>(this->Dimensions[1]) * k);
+  }
+
+  // Get the range of the bricks that overlap an extent within the whole extent.
+  void GetBrickRange(const int extent[6], int range[6]) const
+  {
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      int origin = this->WholeExtent[2 * axis];
+      range[2 * axis] = (extent[2 * axis] - origin) / this->BrickSize[axis];
+      range[2 * axis + 1] = (extent[2 * axis + 1] - origin) / this->BrickSize[axis];
+    }
+  }
+
+  // Get the range of the bricks that are entirely within an extent, return
+  // false if there are none.
+  bool GetInnerBrickRange(const int extent[6], int range[6]) const
+  {
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      int origin = this->WholeExtent[2 * axis];
+      int lo = std::max(extent[2 * axis], origin) - origin;
+      range[2 * axis] = (lo + this->BrickSize[axis] - 1) / this->BrickSize[axis];
+      range[2 * axis + 1] = (extent[2 * axis + 1] >= this->WholeExtent[2 * axis + 1]
+          ? this->Dimensions[axis] - 1
+          : (extent[2 * axis + 1] - origin + 1) / this->BrickSize[axis] - 1);
+      if (range[2 * axis] > range[2 * axis + 1])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Get the extent of a range of bricks.
+  void GetExtent(const int range[6], int extent[6]) const
+  {
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      int origin = this->WholeExtent[2 * axis];
+      int size = this->BrickSize[axis];
+      extent[2 * axis] = origin + range[2 * axis] * size;
+      extent[2 * axis + 1] =
+        std::min(origin + (range[2 * axis + 1] + 1) * size - 1, this->WholeExtent[2 * axis + 1]);
+    }
+  }
+
+  // Find a cached brick, and mark it as the most recently used.
+  Brick* Find(vtkIdType index)
+  {
+    auto iter = this->Bricks.find(index);
+    if (iter == this->Bricks.end())
+    {
+      return nullptr;
+    }
+    this->UseOrder.splice(this->UseOrder.begin(), this->UseOrder, iter->second.Use);
+    return &iter->second;
+  }
+
+  void Insert(vtkIdType index, vtkImageData* data, vtkIdType size)
+  {
+    this->UseOrder.push_front(index);
+    Brick& brick = this->Bricks[index];
+    brick.Data = data;
+    brick.Size = size;
+    brick.Use = this->UseOrder.begin();
+    this->MemorySize += size;
+  }
+
+  // Discard the least recently used bricks until the memory limit is met.
+  void Evict(vtkIdType memoryLimit)
+  {
+    while (this->MemorySize > memoryLimit && !this->UseOrder.empty())
+    {
+      auto iter = this->Bricks.find(this->UseOrder.back());
+      this->MemorySize -= iter->second.Size;
+      this->Bricks.erase(iter);
+      this->UseOrder.pop_back();
+    }
+  }
+
+  // Divide the bricks of a range that are not cached into boxes, each box
+  // being grown along X, then Y, then Z while all its bricks are missing.
+  // Return the number of bricks to read.
+  vtkIdType PlanReads(const int range[6])
+  {
+    this->Reads.clear();
+    int n[3];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      n[axis] = range[2 * axis + 1] - range[2 * axis] + 1;
+    }
+    std::vector<char> missing(static_cast<size_t>(n[0]) * n[1] * n[2]);
+    auto at = [&](int i, int j, int k) -> char& {
+      size_t offset = (k - range[4]) * static_cast<size_t>(n[1]) + (j - range[2]);
+      return missing[offset * n[0] + (i - range[0])];
+    };
+    for (int k = range[4]; k <= range[5]; ++k)
+    {
+      for (int j = range[2]; j <= range[3]; ++j)
+      {
+        for (int i = range[0]; i <= range[1]; ++i)
+        {
+          at(i, j, k) = (this->Bricks.count(this->GetIndex(i, j, k)) == 0);
+        }
+      }
+    }
+    auto allMissing = [&](const int box[6]) -> bool {
+      for (int k = box[4]; k <= box[5]; ++k)
+      {
+        for (int j = box[2]; j <= box[3]; ++j)
+        {
+          for (int i = box[0]; i <= box[1]; ++i)
+          {
+            if (!at(i, j, k))
+            {
+              return false;
+            }
+          }
+        }
+      }
+      return true;
+    };
+
+    vtkIdType count = 0;
+    for (int k = range[4]; k <= range[5]; ++k)
+    {
+      for (int j = range[2]; j <= range[3]; ++j)
+      {
+        for (int i = range[0]; i <= range[1]; ++i)
+        {
+          if (!at(i, j, k))
+          {
+            continue;
+          }
+          int box[6] = { i, i, j, j, k, k };
+          for (int axis = 0; axis < 3; ++axis)
+          {
+            int next[6];
+            std::copy(box, box + 6, next);
+            while (next[2 * axis + 1] < range[2 * axis + 1])
+            {
+              next[2 * axis] = ++next[2 * axis + 1];
+              if (!allMissing(next))
+              {
+                break;
+              }
+              box[2 * axis + 1] = next[2 * axis + 1];
+            }
+          }
+          for (int kk = box[4]; kk <= box[5]; ++kk)
+          {
+            for (int jj = box[2]; jj <= box[3]; ++jj)
+            {
+              for (int ii = box[0]; ii <= box[1]; ++ii)
+              {
+                at(ii, jj, kk) = 0;
+              }
+            }
+          }
+          this->Reads.insert(this->Reads.end(), box, box + 6);
+          count += static_cast<vtkIdType>(box[1] - box[0] + 1) * (box[3] - box[2] + 1) *
+            (box[5] - box[4] + 1);
+        }
+      }
+    }
+    return count;
+  }
+};
+
+namespace
+{
+// Clip an extent to another one, return false if the result is empty.
+bool vtkImageBrickCacheClip(int extent[6], const int bounds[6])
+{
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    extent[2 * axis] = std::max(extent[2 * axis], bounds[2 * axis]);
+    extent[2 * axis + 1] = std::min(extent[2 * axis + 1], bounds[2 * axis + 1]);
+    if (extent[2 * axis] > extent[2 * axis + 1])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkImageBrickCacheFilter::vtkImageBrickCacheFilter()
+{
+  this->BrickSize[0] = 64;
+  this->BrickSize[1] = 64;
+  this->BrickSize[2] = 64;
+  this->MemoryLimit = 1048576;
+  this->NumberOfBrickHits = 0;
+  this->NumberOfBrickMisses = 0;
+  this->Internals = new vtkInternals;
+}
+
+//------------------------------------------------------------------------------
+vtkImageBrickCacheFilter::~vtkImageBrickCacheFilter()
+{
+  delete this->Internals;
+}
+
+//------------------------------------------------------------------------------
+void vtkImageBrickCacheFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "BrickSize: " << this->BrickSize[0] << " " << this->BrickSize[1] << " "
+     << this->BrickSize[2] << "\n";
+  os << indent << "MemoryLimit: " << this->MemoryLimit << "\n";
+  os << indent << "NumberOfCachedBricks: " << this->GetNumberOfCachedBricks() << "\n";
+  os << indent << "NumberOfBrickHits: " << this->NumberOfBrickHits << "\n";
+  os << indent << "NumberOfBrickMisses: " << this->NumberOfBrickMisses << "\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkImageBrickCacheFilter::ClearCache()
+{
+  this->Internals->Clear();
+  this->NumberOfBrickHits = 0;
+  this->NumberOfBrickMisses = 0;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkImageBrickCacheFilter::GetNumberOfCachedBricks()
+{
+  return static_cast<vtkIdType>(this->Internals->Bricks.size());
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkImageBrickCacheFilter::GetCacheMemorySize()
+{
+  return static_cast<unsigned long>((this->Internals->MemorySize + 1023) / 1024);
+}
+
+//------------------------------------------------------------------------------
+int vtkImageBrickCacheFilter::RequestUpdateExtent(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInternals* internals = this->Internals;
+
+  int wholeExt[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExt);
+  vtkDemandDrivenPipeline* inputExecutive =
+    vtkDemandDrivenPipeline::SafeDownCast(this->GetInputExecutive(0, 0));
+  vtkMTimeType inputTime = (inputExecutive ? inputExecutive->GetPipelineMTime() : 0);
+  int outExt[6];
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt);
+
+  // A request for another extent, or after a change of the input or of the
+  // layout, while boxes are left to read is a new request: the previous one
+  // was interrupted before its last pass.
+  bool sameLayout = internals->SameLayout(wholeExt, this->BrickSize);
+  if (internals->CurrentRead != 0 &&
+    (inputTime != internals->InputTime || !sameLayout ||
+      !std::equal(outExt, outExt + 6, internals->RequestExtent)))
+  {
+    internals->ResetReads();
+  }
+
+  // At the first pass of a request, find the bricks that must be read
+  if (internals->CurrentRead == 0)
+  {
+    if (inputTime != internals->InputTime || !sameLayout)
+    {
+      this->ClearCache();
+      internals->SetLayout(wholeExt, this->BrickSize);
+      internals->InputTime = inputTime;
+    }
+    internals->Evict(static_cast<vtkIdType>(this->MemoryLimit) * 1024);
+
+    internals->Reads.clear();
+    std::copy(outExt, outExt + 6, internals->RequestExtent);
+    if (vtkImageBrickCacheClip(outExt, wholeExt))
+    {
+      int range[6];
+      internals->GetBrickRange(outExt, range);
+      this->NumberOfBrickMisses += internals->PlanReads(range);
+    }
+  }
+
+  // Request the next box of bricks, or nothing if all bricks are cached
+  int inExt[6] = { 0, -1, 0, -1, 0, -1 };
+  if (internals->CurrentRead < internals->Reads.size() / 6)
+  {
+    internals->GetExtent(&internals->Reads[6 * internals->CurrentRead], inExt);
+  }
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), inExt, 6);
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkImageBrickCacheFilter::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkImageData* output = vtkImageData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkImageData* input = vtkImageData::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
+  vtkInternals* internals = this->Internals;
+  size_t numberOfReads = internals->Reads.size() / 6;
+  vtkIdType memoryLimit = static_cast<vtkIdType>(this->MemoryLimit) * 1024;
+
+  // At the first pass, copy the cached bricks to the output
+  int outExt[6];
+  if (internals->CurrentRead == 0)
+  {
+    this->AllocateOutputData(output, outInfo);
+    output->GetExtent(outExt);
+    int clipExt[6] = { outExt[0], outExt[1], outExt[2], outExt[3], outExt[4], outExt[5] };
+    if (vtkImageBrickCacheClip(clipExt, internals->WholeExtent))
+    {
+      int range[6];
+      internals->GetBrickRange(clipExt, range);
+      for (int k = range[4]; k <= range[5]; ++k)
+      {
+        for (int j = range[2]; j <= range[3]; ++j)
+        {
+          for (int i = range[0]; i <= range[1]; ++i)
+          {
+            vtkInternals::Brick* brick = internals->Find(internals->GetIndex(i, j, k));
+            if (brick)
+            {
+              int ext[6];
+              brick->Data->GetExtent(ext);
+              vtkImageBrickCacheClip(ext, clipExt);
+              output->CopyAndCastFrom(brick->Data, ext);
+              output->GetPointData()->GetScalars()->SetName(
+                brick->Data->GetPointData()->GetScalars()->GetName());
+              this->NumberOfBrickHits++;
+            }
+          }
+        }
+      }
+    }
+    if (numberOfReads > 0)
+    {
+      // Tell the pipeline to loop over the reads.
+      request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 1);
+    }
+  }
+  else
+  {
+    output->GetExtent(outExt);
+  }
+
+  if (numberOfReads > 0 && this->CheckAbort())
+  {
+    // Stop looping, the bricks read so far stay cached.
+    request->Remove(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING());
+    internals->ResetReads();
+    return 1;
+  }
+
+  if (internals->CurrentRead < numberOfReads)
+  {
+    // Copy the bricks that were read to the output and to the cache
+    const int* range = &internals->Reads[6 * internals->CurrentRead];
+    int readExt[6];
+    internals->GetExtent(range, readExt);
+    int inExt[6];
+    input->GetExtent(inExt);
+    vtkDataArray* inScalars = input->GetPointData()->GetScalars();
+    int copyExt[6] = { readExt[0], readExt[1], readExt[2], readExt[3], readExt[4], readExt[5] };
+    vtkImageBrickCacheClip(copyExt, inExt);
+    if (!inScalars || !std::equal(readExt, readExt + 6, copyExt))
+    {
+      vtkErrorMacro("The input does not contain the requested extent.");
+      request->Remove(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING());
+      internals->ResetReads();
+      return 0;
+    }
+
+    if (vtkImageBrickCacheClip(copyExt, outExt))
+    {
+      output->CopyAndCastFrom(input, copyExt);
+      output->GetPointData()->GetScalars()->SetName(inScalars->GetName());
+    }
+    this->CacheBricks(input, range, true);
+
+    // Also keep the other whole bricks of the input, while they fit
+    int inRange[6];
+    if (internals->GetInnerBrickRange(inExt, inRange))
+    {
+      this->CacheBricks(input, inRange, false);
+    }
+    internals->Evict(memoryLimit);
+
+    this->UpdateProgress(
+      static_cast<double>(internals->CurrentRead + 1) / static_cast<double>(numberOfReads));
+
+    internals->CurrentRead++;
+    if (internals->CurrentRead == numberOfReads)
+    {
+      // Tell the pipeline to stop looping.
+      request->Remove(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING());
+      internals->ResetReads();
+    }
+  }
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkImageBrickCacheFilter::CacheBricks(vtkImageData* input, const int range[6], bool evict)
+{
+  vtkInternals* internals = this->Internals;
+  vtkIdType memoryLimit = static_cast<vtkIdType>(this->MemoryLimit) * 1024;
+  vtkDataArray* inScalars = input->GetPointData()->GetScalars();
+  int numComponents = inScalars->GetNumberOfComponents();
+  int scalarType = inScalars->GetDataType();
+
+  for (int k = range[4]; k <= range[5]; ++k)
+  {
+    for (int j = range[2]; j <= range[3]; ++j)
+    {
+      for (int i = range[0]; i <= range[1]; ++i)
+      {
+        vtkIdType index = internals->GetIndex(i, j, k);
+        if (internals->Bricks.count(index))
+        {
+          continue;
+        }
+        int brickRange[6] = { i, i, j, j, k, k };
+        int ext[6];
+        internals->GetExtent(brickRange, ext);
+        vtkIdType size = static_cast<vtkIdType>(ext[1] - ext[0] + 1) * (ext[3] - ext[2] + 1) *
+          (ext[5] - ext[4] + 1) * numComponents * inScalars->GetDataTypeSize();
+        if (!evict && internals->MemorySize + size > memoryLimit)
+        {
+          return;
+        }
+        vtkSmartPointer<vtkImageData> brick = vtkSmartPointer<vtkImageData>::New();
+        brick->SetExtent(ext);
+        brick->AllocateScalars(scalarType, numComponents);
+        brick->CopyAndCastFrom(input, ext);
+        brick->GetPointData()->GetScalars()->SetName(inScalars->GetName());
+        internals->Insert(index, brick, size);
+        if (evict)
+        {
+          internals->Evict(memoryLimit);
+        }
+      }
+    }
+  }
+}
+VTK_ABI_NAMESPACE_END
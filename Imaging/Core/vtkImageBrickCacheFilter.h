@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkImageBrickCacheFilter
+ * @brief   Caches fixed-size bricks of an image within a memory limit.
+ *
+ * vtkImageBrickCacheFilter divides the whole extent of its input into bricks
+ * of BrickSize points, and keeps the bricks read by previous updates. A
+ * request for an update extent is served from the cached bricks, and only the
+ * missing bricks are requested from the input, merged into as few boxes as
+ * possible. When the cached bricks take more memory than MemoryLimit, the
+ * least recently used bricks are discarded.
+ *
+ * Put this filter after a reader that can read parts of its whole extent, and
+ * stream the pipeline with vtkImageDataStreamer. Each voxel is then read once,
+ * even when the pieces of the streamer overlap because of the kernels of the
+ * filters in between, and volumes larger than memory can be filtered.
+ *
+ * Like vtkImageDataStreamer, only the point scalars are passed. The cache is
+ * cleared when the input pipeline is modified or the brick size is changed.
+ * An aborted update stops reading, and keeps the bricks read so far.
+ *
+ * @sa
+ * vtkImageDataStreamer vtkImageCacheFilter
+ */
+
+#ifndef vtkImageBrickCacheFilter_h
+#define vtkImageBrickCacheFilter_h
+
+#include "vtkImageAlgorithm.h"
+#include "vtkImagingCoreModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKIMAGINGCORE_EXPORT vtkImageBrickCacheFilter : public vtkImageAlgorithm
+{
+public:
+  static vtkImageBrickCacheFilter* New();
+  vtkTypeMacro(vtkImageBrickCacheFilter, vtkImageAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * The number of points of a brick along each axis. The bricks at the upper
+   * bounds of the whole extent are smaller. The default is 64x64x64.
+   */
+  vtkSetVector3Macro(BrickSize, int);
+  vtkGetVector3Macro(BrickSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * The maximum memory used by the cached bricks, in kibibytes (1024 bytes).
+   * The default is 1048576, that is 1 GiB. The image that is output is not
+   * counted.
+   */
+  vtkSetMacro(MemoryLimit, unsigned long);
+  vtkGetMacro(MemoryLimit, unsigned long);
+  ///@}
+
+  /**
+   * Discard all the cached bricks, and reset the hit and miss counts.
+   */
+  void ClearCache();
+
+  /**
+   * Get the number of bricks in the cache.
+   */
+  vtkIdType GetNumberOfCachedBricks();
+
+  /**
+   * Get the memory used by the cached bricks, in kibibytes.
+   */
+  unsigned long GetCacheMemorySize();
+
+  ///@{
+  /**
+   * The number of bricks that were taken from the cache, and the number of
+   * bricks that were requested from the input, since the cache was cleared.
+   */
+  vtkGetMacro(NumberOfBrickHits, vtkIdType);
+  vtkGetMacro(NumberOfBrickMisses, vtkIdType);
+  ///@}
+
+protected:
+  vtkImageBrickCacheFilter();
+  ~vtkImageBrickCacheFilter() override;
+
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  int BrickSize[3];
+  unsigned long MemoryLimit;
+  vtkIdType NumberOfBrickHits;
+  vtkIdType NumberOfBrickMisses;
+
+private:
+  vtkImageBrickCacheFilter(const vtkImageBrickCacheFilter&) = delete;
+  void operator=(const vtkImageBrickCacheFilter&) = delete;
+
+  // Copy the bricks of a range of brick indices from the input to the cache.
+  // If evict is set, the least recently used bricks are discarded to make
+  // room for them, otherwise the bricks that do not fit are not cached.
+  void CacheBricks(vtkImageData* input, const int range[6], bool evict);
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
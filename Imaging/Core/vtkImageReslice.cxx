@@ -27,6 +27,7 @@
 #undef VTK_USE_UINT64
 #define VTK_USE_UINT64 0
 
+#include <algorithm>
 #include <cfloat>
 #include <climits>
 #include <cmath>
@@ -96,6 +97,10 @@ vtkImageReslice::vtkImageReslice()
   this->SlabSliceSpacingFraction = 1.0;
 
   this->Optimization = 1; // turn off when you're paranoid
+  this->Tiling = 0;
+  this->TileSize[0] = 64;
+  this->TileSize[1] = 32;
+  this->TileSize[2] = 8;
 
   // for rescaling the data
   this->ScalarShift = 0.0;
@@ -227,6 +232,9 @@ void vtkImageReslice::PrintSelf(ostream& os, vtkIndent indent)
      << "SlabTrapezoidIntegration: " << (this->SlabTrapezoidIntegration ? "On\n" : "Off\n");
   os << indent << "SlabSliceSpacingFraction: " << this->SlabSliceSpacingFraction << "\n";
   os << indent << "Optimization: " << (this->Optimization ? "On\n" : "Off\n");
+  os << indent << "Tiling: " << (this->Tiling ? "On\n" : "Off\n");
+  os << indent << "TileSize: " << this->TileSize[0] << " " << this->TileSize[1] << " "
+     << this->TileSize[2] << "\n";
   os << indent << "ScalarShift: " << this->ScalarShift << "\n";
   os << indent << "ScalarScale: " << this->ScalarScale << "\n";
   os << indent << "BackgroundColor: " << this->BackgroundColor[0] << " " << this->BackgroundColor[1]
@@ -1943,6 +1951,127 @@ void vtkResliceApplyTransform(
   inPoint[2] = inInvMatrix[6] * x + inInvMatrix[7] * y + inInvMatrix[8] * z;
 }
 
+//------------------------------------------------------------------------------
+// Trilinear interpolation of a row of output samples that all lie within the
+// bounds of the input, for affine transformations. The computation is the
+// one of vtkImageInterpolator with the clamp border mode, but the dispatch on
+// the scalar type and the bounds checks are done once per row instead of
+// once per sample, which leaves a loop without any call or branch.
+template <class F, class T>
+struct vtkImageResliceTrilinearRow
+{
+  static void Interpolate(const vtkInterpolationInfo* info, const F inPoint1[4],
+    const F xAxis[4], int idX, int n, F* outPtr);
+};
+
+//------------------------------------------------------------------------------
+template <class F, class T>
+void vtkImageResliceTrilinearRow<F, T>::Interpolate(const vtkInterpolationInfo* info,
+  const F inPoint1[4], const F xAxis[4], int idX, int n, F* outPtr)
+{
+  const T* inPtr = static_cast<const T*>(info->Pointer);
+  const int* inExt = info->Extent;
+  const vtkIdType* inInc = info->Increments;
+  const int numscalars = info->NumberOfComponents;
+
+  for (int idXmax = idX + n - 1; idX <= idXmax; idX++)
+  {
+    F point[3];
+    point[0] = inPoint1[0] + idX * xAxis[0];
+    point[1] = inPoint1[1] + idX * xAxis[1];
+    point[2] = inPoint1[2] + idX * xAxis[2];
+
+    F fx, fy, fz;
+    int inIdX0 = vtkInterpolationMath::Floor(point[0], fx);
+    int inIdY0 = vtkInterpolationMath::Floor(point[1], fy);
+    int inIdZ0 = vtkInterpolationMath::Floor(point[2], fz);
+
+    int inIdX1 = vtkInterpolationMath::Clamp(inIdX0 + (fx != 0), inExt[0], inExt[1]);
+    int inIdY1 = vtkInterpolationMath::Clamp(inIdY0 + (fy != 0), inExt[2], inExt[3]);
+    int inIdZ1 = vtkInterpolationMath::Clamp(inIdZ0 + (fz != 0), inExt[4], inExt[5]);
+    inIdX0 = vtkInterpolationMath::Clamp(inIdX0, inExt[0], inExt[1]);
+    inIdY0 = vtkInterpolationMath::Clamp(inIdY0, inExt[2], inExt[3]);
+    inIdZ0 = vtkInterpolationMath::Clamp(inIdZ0, inExt[4], inExt[5]);
+
+    vtkIdType factY0 = inIdY0 * inInc[1];
+    vtkIdType factY1 = inIdY1 * inInc[1];
+    vtkIdType factZ0 = inIdZ0 * inInc[2];
+    vtkIdType factZ1 = inIdZ1 * inInc[2];
+
+    vtkIdType i00 = factY0 + factZ0;
+    vtkIdType i01 = factY0 + factZ1;
+    vtkIdType i10 = factY1 + factZ0;
+    vtkIdType i11 = factY1 + factZ1;
+
+    F rx = 1 - fx;
+    F ry = 1 - fy;
+    F rz = 1 - fz;
+
+    F ryrz = ry * rz;
+    F fyrz = fy * rz;
+    F ryfz = ry * fz;
+    F fyfz = fy * fz;
+
+    const T* inPtr0 = inPtr + inIdX0 * inInc[0];
+    const T* inPtr1 = inPtr + inIdX1 * inInc[0];
+    for (int c = 0; c < numscalars; c++)
+    {
+      *outPtr++ =
+        (rx * (ryrz * inPtr0[i00] + ryfz * inPtr0[i01] + fyrz * inPtr0[i10] + fyfz * inPtr0[i11]) +
+          fx * (ryrz * inPtr1[i00] + ryfz * inPtr1[i01] + fyrz * inPtr1[i10] + fyfz * inPtr1[i11]));
+      inPtr0++;
+      inPtr1++;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <class F>
+void vtkGetTrilinearRowFunc(void (**trilinear)(const vtkInterpolationInfo* info,
+                              const F inPoint1[4], const F xAxis[4], int idX, int n, F* outPtr),
+  int scalarType)
+{
+  switch (scalarType)
+  {
+    vtkTemplateAliasMacro(*trilinear = &(vtkImageResliceTrilinearRow<F, VTK_TT>::Interpolate));
+    default:
+      *trilinear = nullptr;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Check whether all the samples of a row lie within the bounds of the input.
+template <class F>
+bool vtkResliceRowInBounds(vtkAbstractImageInterpolator* interpolator, const F inPoint1[4],
+  const F xAxis[4], int idXmin, int idXmax)
+{
+  // check the ends first, this rejects most of the rows that cross a boundary
+  int ends[2] = { idXmin, idXmax };
+  for (int idX : ends)
+  {
+    F point[3];
+    point[0] = inPoint1[0] + idX * xAxis[0];
+    point[1] = inPoint1[1] + idX * xAxis[1];
+    point[2] = inPoint1[2] + idX * xAxis[2];
+    if (!interpolator->CheckBoundsIJK(point))
+    {
+      return false;
+    }
+  }
+  for (int idX = idXmin + 1; idX < idXmax; idX++)
+  {
+    F point[3];
+    point[0] = inPoint1[0] + idX * xAxis[0];
+    point[1] = inPoint1[1] + idX * xAxis[1];
+    point[2] = inPoint1[2] + idX * xAxis[2];
+    if (!interpolator->CheckBoundsIJK(point))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 // the main execute function
 template <class F>
@@ -2016,6 +2145,23 @@ void vtkImageResliceExecute(vtkImageReslice* self, vtkDataArray* scalars,
     optimizeNearest = true;
   }
 
+  // is the row-wise trilinear interpolation possible?
+  void (*trilinear)(const vtkInterpolationInfo* info, const F inPoint1[4], const F xAxis[4],
+    int idX, int n, F* outPtr) = nullptr;
+  vtkInterpolationInfo trilinearInfo{};
+  if (interpolationMode == VTK_LINEAR_INTERPOLATION && borderMode == VTK_IMAGE_BORDER_CLAMP &&
+    !(newtrans || perspective) && fullSize == scalars->GetNumberOfTuples() && nsamples <= 1 &&
+    self->GetOptimization())
+  {
+    vtkGetTrilinearRowFunc(&trilinear, inputScalarType);
+    int component = std::max(std::min(componentOffset, scalars->GetNumberOfComponents() - 1), 0);
+    trilinearInfo.Pointer =
+      static_cast<const char*>(scalars->GetVoidPointer(0)) + component * inputScalarSize;
+    std::copy(inExt, inExt + 6, trilinearInfo.Extent);
+    std::copy(inInc, inInc + 3, trilinearInfo.Increments);
+    trilinearInfo.NumberOfComponents = inComponents;
+  }
+
   // get pixel information
   int scalarType = outData->GetScalarType();
   int scalarSize = outData->GetScalarSize();
@@ -2076,265 +2222,327 @@ void vtkImageResliceExecute(vtkImageReslice* self, vtkDataArray* scalars,
   vtkGetSetPixelsFunc(&setpixels, scalarType, outComponents);
   vtkGetCompositeFunc(&composite, self->GetSlabMode(), self->GetSlabTrapezoidIntegration());
 
+  // the output is traversed in tiles if requested, else as a single tile
+  int tileSize[3] = { outExt[1] - outExt[0] + 1, outExt[3] - outExt[2] + 1,
+    outExt[5] - outExt[4] + 1 };
+  bool tiling = (self->GetTiling() != 0);
+  if (tiling)
+  {
+    for (int i = 0; i < 3; i++)
+    {
+      tileSize[i] = std::max(std::min(self->GetTileSize()[i], tileSize[i]), 1);
+    }
+  }
+  int numTiles[3];
+  for (int i = 0; i < 3; i++)
+  {
+    numTiles[i] = (outExt[2 * i + 1] - outExt[2 * i] + tileSize[i]) / tileSize[i];
+  }
+  int totalTiles = numTiles[0] * numTiles[1] * numTiles[2];
+
   // create some variables for when we march through the data
-  int idY = outExt[2] - 1;
-  int idZ = outExt[4] - 1;
   F inPoint0[4] = { 0.0, 0.0, 0.0, 0.0 };
   F inPoint1[4] = { 0.0, 0.0, 0.0, 0.0 };
-
-  // create an iterator to march through the data
-  vtkImagePointDataIterator iter(outData, outExt, stencil, self, threadId);
   char* outPtr0 = static_cast<char*>(vtkImagePointDataIterator::GetVoidPointer(outData));
-  for (; !iter.IsAtEnd(); iter.NextSpan())
-  {
-    int span = static_cast<int>(iter.SpanEndId() - iter.GetId());
-    outPtr = outPtr0 + iter.GetId() * scalarSize * outComponents;
 
-    if (!iter.IsInStencil())
+  for (int tile = 0; tile < totalTiles && !self->GetAbortExecute(); tile++)
+  {
+    int tileExt[6];
+    int tileIdx[3] = { tile % numTiles[0], (tile / numTiles[0]) % numTiles[1],
+      tile / (numTiles[0] * numTiles[1]) };
+    for (int i = 0; i < 3; i++)
     {
-      // clear any regions that are outside the stencil
-      setpixels(outPtr, background, outComponents, span);
+      tileExt[2 * i] = outExt[2 * i] + tileIdx[i] * tileSize[i];
+      tileExt[2 * i + 1] = std::min(tileExt[2 * i] + tileSize[i] - 1, outExt[2 * i + 1]);
     }
-    else
+    int idY = tileExt[2] - 1;
+    int idZ = tileExt[4] - 1;
+
+    // create an iterator to march through the data, the progress of the
+    // tiles is reported below instead of by the iterator
+    vtkImagePointDataIterator iter(
+      outData, tileExt, stencil, (tiling ? nullptr : self), threadId);
+    for (; !iter.IsAtEnd(); iter.NextSpan())
     {
-      // get output index, and compute position in input image
-      int outIndex[3];
-      iter.GetIndex(outIndex);
+      int span = static_cast<int>(iter.SpanEndId() - iter.GetId());
+      outPtr = outPtr0 + iter.GetId() * scalarSize * outComponents;
 
-      // if Z index increased, then advance position along Z axis
-      if (outIndex[2] > idZ)
+      if (!iter.IsInStencil())
       {
-        idZ = outIndex[2];
-        inPoint0[0] = origin[0] + idZ * zAxis[0];
-        inPoint0[1] = origin[1] + idZ * zAxis[1];
-        inPoint0[2] = origin[2] + idZ * zAxis[2];
-        inPoint0[3] = origin[3] + idZ * zAxis[3];
-        idY = outExt[2] - 1;
+        // clear any regions that are outside the stencil
+        setpixels(outPtr, background, outComponents, span);
       }
-
-      // if Y index increased, then advance position along Y axis
-      if (outIndex[1] > idY)
+      else
       {
-        idY = outIndex[1];
-        inPoint1[0] = inPoint0[0] + idY * yAxis[0];
-        inPoint1[1] = inPoint0[1] + idY * yAxis[1];
-        inPoint1[2] = inPoint0[2] + idY * yAxis[2];
-        inPoint1[3] = inPoint0[3] + idY * yAxis[3];
-      }
+        // get output index, and compute position in input image
+        int outIndex[3];
+        iter.GetIndex(outIndex);
 
-      // march through one row of the output image
-      int idXmin = outIndex[0];
-      int idXmax = idXmin + span - 1;
+        // if Z index increased, then advance position along Z axis
+        if (outIndex[2] > idZ)
+        {
+          idZ = outIndex[2];
+          inPoint0[0] = origin[0] + idZ * zAxis[0];
+          inPoint0[1] = origin[1] + idZ * zAxis[1];
+          inPoint0[2] = origin[2] + idZ * zAxis[2];
+          inPoint0[3] = origin[3] + idZ * zAxis[3];
+          idY = tileExt[2] - 1;
+        }
 
-      if (!optimizeNearest)
-      {
-        bool wasInBounds = true;
-        bool isInBounds = true;
-        int startIdX = idXmin;
-        int idX = idXmin;
-        F* tmpPtr = floatPtr;
+        // if Y index increased, then advance position along Y axis
+        if (outIndex[1] > idY)
+        {
+          idY = outIndex[1];
+          inPoint1[0] = inPoint0[0] + idY * yAxis[0];
+          inPoint1[1] = inPoint0[1] + idY * yAxis[1];
+          inPoint1[2] = inPoint0[2] + idY * yAxis[2];
+          inPoint1[3] = inPoint0[3] + idY * yAxis[3];
+        }
+
+        // march through one row of the output image
+        int idXmin = outIndex[0];
+        int idXmax = idXmin + span - 1;
 
-        while (startIdX <= idXmax)
+        if (trilinear && vtkResliceRowInBounds(interpolator, inPoint1, xAxis, idXmin, idXmax))
         {
-          for (; idX <= idXmax && isInBounds == wasInBounds; idX++)
+          // the whole row is within the input, interpolate it in one call
+          trilinear(&trilinearInfo, inPoint1, xAxis, idXmin, span, floatPtr);
+
+          if (outputStencil)
           {
-            F inPoint2[4];
-            inPoint2[0] = inPoint1[0] + idX * xAxis[0];
-            inPoint2[1] = inPoint1[1] + idX * xAxis[1];
-            inPoint2[2] = inPoint1[2] + idX * xAxis[2];
-            inPoint2[3] = inPoint1[3] + idX * xAxis[3];
-
-            F inPoint3[4];
-            F* inPoint = inPoint2;
-            isInBounds = false;
-
-            int sampleCount = 0;
-            for (int sample = 0; sample < nsamples; sample++)
-            {
-              if (nsamples > 1)
-              {
-                double s = sample - 0.5 * (nsamples - 1);
-                s *= slabSampleSpacing;
-                inPoint3[0] = inPoint2[0] + s * zAxis[0];
-                inPoint3[1] = inPoint2[1] + s * zAxis[1];
-                inPoint3[2] = inPoint2[2] + s * zAxis[2];
-                inPoint3[3] = inPoint2[3] + s * zAxis[3];
-                inPoint = inPoint3;
-              }
+            outputStencil->InsertNextExtent(idXmin, idXmax, idY, idZ);
+          }
 
-              if (perspective)
-              { // only do perspective if necessary
-                F f = 1 / inPoint[3];
-                inPoint[0] *= f;
-                inPoint[1] *= f;
-                inPoint[2] *= f;
-              }
+          if (rescaleScalars)
+          {
+            vtkImageResliceRescaleScalars(floatPtr, inComponents, span, scalarShift, scalarScale);
+          }
 
-              if (newtrans)
-              { // apply the AbstractTransform if there is one
-                vtkResliceApplyTransform(newtrans, inPoint, inOrigin, inInvMatrix);
+          if (convertScalars)
+          {
+            (self->*convertScalars)(floatPtr, outPtr, vtkTypeTraits<F>::VTKTypeID(), inComponents,
+              span, idXmin, idY, idZ, threadId);
+          }
+          else
+          {
+            convertpixels(outPtr, floatPtr, outComponents, span);
+          }
+        }
+        else if (!optimizeNearest)
+        {
+          bool wasInBounds = true;
+          bool isInBounds = true;
+          int startIdX = idXmin;
+          int idX = idXmin;
+          F* tmpPtr = floatPtr;
+
+          while (startIdX <= idXmax)
+          {
+            for (; idX <= idXmax && isInBounds == wasInBounds; idX++)
+            {
+              F inPoint2[4];
+              inPoint2[0] = inPoint1[0] + idX * xAxis[0];
+              inPoint2[1] = inPoint1[1] + idX * xAxis[1];
+              inPoint2[2] = inPoint1[2] + idX * xAxis[2];
+              inPoint2[3] = inPoint1[3] + idX * xAxis[3];
+
+              F inPoint3[4];
+              F* inPoint = inPoint2;
+              isInBounds = false;
+
+              int sampleCount = 0;
+              for (int sample = 0; sample < nsamples; sample++)
+              {
+                if (nsamples > 1)
+                {
+                  double s = sample - 0.5 * (nsamples - 1);
+                  s *= slabSampleSpacing;
+                  inPoint3[0] = inPoint2[0] + s * zAxis[0];
+                  inPoint3[1] = inPoint2[1] + s * zAxis[1];
+                  inPoint3[2] = inPoint2[2] + s * zAxis[2];
+                  inPoint3[3] = inPoint2[3] + s * zAxis[3];
+                  inPoint = inPoint3;
+                }
+
+                if (perspective)
+                { // only do perspective if necessary
+                  F f = 1 / inPoint[3];
+                  inPoint[0] *= f;
+                  inPoint[1] *= f;
+                  inPoint[2] *= f;
+                }
+
+                if (newtrans)
+                { // apply the AbstractTransform if there is one
+                  vtkResliceApplyTransform(newtrans, inPoint, inOrigin, inInvMatrix);
+                }
+
+                if (interpolator->CheckBoundsIJK(inPoint))
+                {
+                  // do the interpolation
+                  sampleCount++;
+                  isInBounds = true;
+                  interpolator->InterpolateIJK(inPoint, tmpPtr);
+                  tmpPtr += inComponents;
+                }
               }
 
-              if (interpolator->CheckBoundsIJK(inPoint))
+              tmpPtr -= sampleCount * inComponents;
+              if (sampleCount > 1)
               {
-                // do the interpolation
-                sampleCount++;
-                isInBounds = true;
-                interpolator->InterpolateIJK(inPoint, tmpPtr);
-                tmpPtr += inComponents;
+                composite(tmpPtr, inComponents, sampleCount);
               }
-            }
+              tmpPtr += inComponents;
 
-            tmpPtr -= sampleCount * inComponents;
-            if (sampleCount > 1)
-            {
-              composite(tmpPtr, inComponents, sampleCount);
+              // set "was in" to "is in" if first pixel
+              wasInBounds = ((idX > idXmin) ? wasInBounds : isInBounds);
             }
-            tmpPtr += inComponents;
 
-            // set "was in" to "is in" if first pixel
-            wasInBounds = ((idX > idXmin) ? wasInBounds : isInBounds);
-          }
+            // write a segment to the output
+            int endIdX = idX - 1 - (isInBounds != wasInBounds);
+            int numpixels = endIdX - startIdX + 1;
 
-          // write a segment to the output
-          int endIdX = idX - 1 - (isInBounds != wasInBounds);
-          int numpixels = endIdX - startIdX + 1;
-
-          if (wasInBounds)
-          {
-            if (outputStencil)
+            if (wasInBounds)
             {
-              outputStencil->InsertNextExtent(startIdX, endIdX, idY, idZ);
-            }
+              if (outputStencil)
+              {
+                outputStencil->InsertNextExtent(startIdX, endIdX, idY, idZ);
+              }
 
-            if (rescaleScalars)
-            {
-              vtkImageResliceRescaleScalars(
-                floatPtr, inComponents, idXmax - idXmin + 1, scalarShift, scalarScale);
-            }
+              if (rescaleScalars)
+              {
+                vtkImageResliceRescaleScalars(
+                  floatPtr, inComponents, idXmax - idXmin + 1, scalarShift, scalarScale);
+              }
 
-            if (convertScalars)
-            {
-              (self->*convertScalars)(tmpPtr - inComponents * (idX - startIdX), outPtr,
-                vtkTypeTraits<F>::VTKTypeID(), inComponents, numpixels, startIdX, idY, idZ,
-                threadId);
+              if (convertScalars)
+              {
+                (self->*convertScalars)(tmpPtr - inComponents * (idX - startIdX), outPtr,
+                  vtkTypeTraits<F>::VTKTypeID(), inComponents, numpixels, startIdX, idY, idZ,
+                  threadId);
 
-              outPtr = static_cast<char*>(outPtr) + numpixels * outComponents * scalarSize;
+                outPtr = static_cast<char*>(outPtr) + numpixels * outComponents * scalarSize;
+              }
+              else
+              {
+                convertpixels(
+                  outPtr, tmpPtr - inComponents * (idX - startIdX), outComponents, numpixels);
+              }
             }
             else
             {
-              convertpixels(
-                outPtr, tmpPtr - inComponents * (idX - startIdX), outComponents, numpixels);
+              setpixels(outPtr, background, outComponents, numpixels);
             }
-          }
-          else
-          {
-            setpixels(outPtr, background, outComponents, numpixels);
-          }
 
-          startIdX += numpixels;
-          wasInBounds = isInBounds;
+            startIdX += numpixels;
+            wasInBounds = isInBounds;
+          }
         }
-      }
-      else // optimize for nearest-neighbor interpolation
-      {
-        const char* inPtrTmp0 = static_cast<const char*>(inPtr);
-        char* outPtrTmp = static_cast<char*>(outPtr);
+        else // optimize for nearest-neighbor interpolation
+        {
+          const char* inPtrTmp0 = static_cast<const char*>(inPtr);
+          char* outPtrTmp = static_cast<char*>(outPtr);
 
-        vtkIdType inIncX = inInc[0] * inputScalarSize;
-        vtkIdType inIncY = inInc[1] * inputScalarSize;
-        vtkIdType inIncZ = inInc[2] * inputScalarSize;
+          vtkIdType inIncX = inInc[0] * inputScalarSize;
+          vtkIdType inIncY = inInc[1] * inputScalarSize;
+          vtkIdType inIncZ = inInc[2] * inputScalarSize;
 
-        int inExtX = inExt[1] - inExt[0] + 1;
-        int inExtY = inExt[3] - inExt[2] + 1;
-        int inExtZ = inExt[5] - inExt[4] + 1;
+          int inExtX = inExt[1] - inExt[0] + 1;
+          int inExtY = inExt[3] - inExt[2] + 1;
+          int inExtZ = inExt[5] - inExt[4] + 1;
 
-        int startIdX = idXmin;
-        int endIdX = idXmin - 1;
-        bool isInBounds = false;
-        int bytesPerPixel = inputScalarSize * inComponents;
+          int startIdX = idXmin;
+          int endIdX = idXmin - 1;
+          bool isInBounds = false;
+          int bytesPerPixel = inputScalarSize * inComponents;
 
-        for (int iidX = idXmin; iidX <= idXmax; iidX++)
-        {
-          F inPoint[3];
-          inPoint[0] = inPoint1[0] + iidX * xAxis[0];
-          inPoint[1] = inPoint1[1] + iidX * xAxis[1];
-          inPoint[2] = inPoint1[2] + iidX * xAxis[2];
+          for (int iidX = idXmin; iidX <= idXmax; iidX++)
+          {
+            F inPoint[3];
+            inPoint[0] = inPoint1[0] + iidX * xAxis[0];
+            inPoint[1] = inPoint1[1] + iidX * xAxis[1];
+            inPoint[2] = inPoint1[2] + iidX * xAxis[2];
 
-          int inIdX = vtkInterpolationMath::Round(inPoint[0]) - inExt[0];
-          int inIdY = vtkInterpolationMath::Round(inPoint[1]) - inExt[2];
-          int inIdZ = vtkInterpolationMath::Round(inPoint[2]) - inExt[4];
+            int inIdX = vtkInterpolationMath::Round(inPoint[0]) - inExt[0];
+            int inIdY = vtkInterpolationMath::Round(inPoint[1]) - inExt[2];
+            int inIdZ = vtkInterpolationMath::Round(inPoint[2]) - inExt[4];
 
-          if (inIdX >= 0 && inIdX < inExtX && inIdY >= 0 && inIdY < inExtY && inIdZ >= 0 &&
-            inIdZ < inExtZ)
-          {
-            if (!isInBounds)
+            if (inIdX >= 0 && inIdX < inExtX && inIdY >= 0 && inIdY < inExtY && inIdZ >= 0 &&
+              inIdZ < inExtZ)
             {
-              // clear leading out-of-bounds pixels
-              startIdX = iidX;
-              isInBounds = true;
-              setpixels(outPtr, background, outComponents, startIdX - idXmin);
-              outPtrTmp = static_cast<char*>(outPtr);
-            }
-            // set the final index that was within input bounds
-            endIdX = iidX;
+              if (!isInBounds)
+              {
+                // clear leading out-of-bounds pixels
+                startIdX = iidX;
+                isInBounds = true;
+                setpixels(outPtr, background, outComponents, startIdX - idXmin);
+                outPtrTmp = static_cast<char*>(outPtr);
+              }
+              // set the final index that was within input bounds
+              endIdX = iidX;
 
-            // perform nearest-neighbor interpolation via pixel copy
-            const char* inPtrTmp = inPtrTmp0 + inIdX * inIncX + inIdY * inIncY + inIdZ * inIncZ;
+              // perform nearest-neighbor interpolation via pixel copy
+              const char* inPtrTmp = inPtrTmp0 + inIdX * inIncX + inIdY * inIncY + inIdZ * inIncZ;
 
-            // when memcpy is used with a constant size, the compiler will
-            // optimize away the function call and use the minimum number
-            // of instructions necessary to perform the copy
-            switch (bytesPerPixel)
+              // when memcpy is used with a constant size, the compiler will
+              // optimize away the function call and use the minimum number
+              // of instructions necessary to perform the copy
+              switch (bytesPerPixel)
+              {
+                case 1:
+                  outPtrTmp[0] = inPtrTmp[0];
+                  break;
+                case 2:
+                  memcpy(outPtrTmp, inPtrTmp, 2);
+                  break;
+                case 3:
+                  memcpy(outPtrTmp, inPtrTmp, 3);
+                  break;
+                case 4:
+                  memcpy(outPtrTmp, inPtrTmp, 4);
+                  break;
+                case 8:
+                  memcpy(outPtrTmp, inPtrTmp, 8);
+                  break;
+                case 12:
+                  memcpy(outPtrTmp, inPtrTmp, 12);
+                  break;
+                case 16:
+                  memcpy(outPtrTmp, inPtrTmp, 16);
+                  break;
+                default:
+                  int oc = 0;
+                  do
+                  {
+                    outPtrTmp[oc] = inPtrTmp[oc];
+                  } while (++oc != bytesPerPixel);
+                  break;
+              }
+              outPtrTmp += bytesPerPixel;
+            }
+            else if (isInBounds)
             {
-              case 1:
-                outPtrTmp[0] = inPtrTmp[0];
-                break;
-              case 2:
-                memcpy(outPtrTmp, inPtrTmp, 2);
-                break;
-              case 3:
-                memcpy(outPtrTmp, inPtrTmp, 3);
-                break;
-              case 4:
-                memcpy(outPtrTmp, inPtrTmp, 4);
-                break;
-              case 8:
-                memcpy(outPtrTmp, inPtrTmp, 8);
-                break;
-              case 12:
-                memcpy(outPtrTmp, inPtrTmp, 12);
-                break;
-              case 16:
-                memcpy(outPtrTmp, inPtrTmp, 16);
-                break;
-              default:
-                int oc = 0;
-                do
-                {
-                  outPtrTmp[oc] = inPtrTmp[oc];
-                } while (++oc != bytesPerPixel);
-                break;
+              // leaving input bounds
+              break;
             }
-            outPtrTmp += bytesPerPixel;
-          }
-          else if (isInBounds)
-          {
-            // leaving input bounds
-            break;
           }
-        }
 
-        // clear trailing out-of-bounds pixels
-        outPtr = outPtrTmp;
-        setpixels(outPtr, background, outComponents, idXmax - endIdX);
+          // clear trailing out-of-bounds pixels
+          outPtr = outPtrTmp;
+          setpixels(outPtr, background, outComponents, idXmax - endIdX);
 
-        if (outputStencil && endIdX >= startIdX)
-        {
-          outputStencil->InsertNextExtent(startIdX, endIdX, idY, idZ);
+          if (outputStencil && endIdX >= startIdX)
+          {
+            outputStencil->InsertNextExtent(startIdX, endIdX, idY, idZ);
+          }
         }
       }
     }
+
+    if (tiling && threadId == 0)
+    {
+      self->UpdateProgress(static_cast<double>(tile + 1) / totalTiles);
+    }
   }
 
   vtkFreeBackgroundPixel(&background);
@@ -308,6 +308,29 @@ public:
   vtkBooleanMacro(Optimization, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Traverse the output in tiles of TileSize voxels instead of row by row
+   * (default off). When an oblique slice or volume is extracted from a large
+   * input, the input voxels needed by a tile stay in the cache, which is not
+   * the case for the voxels needed by full rows of the output. The output is
+   * the same with or without tiling. Tiling is not used for the permutation
+   * matrices, whose interpolation weights are precomputed anyway.
+   */
+  vtkSetMacro(Tiling, vtkTypeBool);
+  vtkGetMacro(Tiling, vtkTypeBool);
+  vtkBooleanMacro(Tiling, vtkTypeBool);
+  ///@}
+
+  ///@{
+  /**
+   * The size of the tiles along the output axes, in voxels, when Tiling is
+   * on (default 64, 32, 8).
+   */
+  vtkSetVector3Macro(TileSize, int);
+  vtkGetVector3Macro(TileSize, int);
+  ///@}
+
   ///@{
   /**
    * Set a value to add to all the output voxels.
@@ -514,6 +537,8 @@ protected:
   vtkTypeBool Border;
   int InterpolationMode;
   vtkTypeBool Optimization;
+  vtkTypeBool Tiling;
+  int TileSize[3];
   int SlabMode;
   int SlabNumberOfSlices;
   vtkTypeBool SlabTrapezoidIntegration;
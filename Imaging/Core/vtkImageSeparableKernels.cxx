@@ -0,0 +1,349 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkImageSeparableKernels.h"
+
+#include "vtkTemplateAliasMacro.h"
+
+#include <algorithm>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+
+namespace
+{
+// Number of scalars accumulated at once by the passes along Y and Z, small
+// enough for the accumulator and the input rows to stay in the L1 cache.
+const int vtkImageSeparableKernelsBlockSize = 512;
+
+//------------------------------------------------------------------------------
+// The nonzero taps of a kernel, as offsets from the output sample.
+struct vtkImageSeparableKernelsTaps
+{
+  std::vector<int> Offsets;
+  std::vector<double> Weights;
+  int Low;  // offset of the first tap of the kernel
+  int High; // offset of the last tap of the kernel
+  double Sum;
+
+  vtkImageSeparableKernelsTaps(const double* kernel, int size)
+  {
+    const int center = (size - 1) / 2;
+    this->Low = -center;
+    this->High = size - 1 - center;
+    this->Sum = 0.0;
+    for (int t = 0; t < size; ++t)
+    {
+      this->Sum += kernel[t];
+      if (kernel[t] != 0.0)
+      {
+        this->Offsets.push_back(t - center);
+        this->Weights.push_back(kernel[t]);
+      }
+    }
+  }
+
+  int GetNumberOfTaps() const { return static_cast<int>(this->Offsets.size()); }
+
+  // The factor applied to the output sample at position i for the
+  // Renormalize mode, when the input covers the positions lo to hi.
+  double GetScale(int i, int lo, int hi) const
+  {
+    if (i + this->Low >= lo && i + this->High <= hi)
+    {
+      return 1.0;
+    }
+    double validSum = 0.0;
+    for (int t = 0; t < this->GetNumberOfTaps(); ++t)
+    {
+      const int p = i + this->Offsets[t];
+      if (p >= lo && p <= hi)
+      {
+        validSum += this->Weights[t];
+      }
+    }
+    return (validSum != 0.0 ? this->Sum / validSum : 1.0);
+  }
+};
+
+//------------------------------------------------------------------------------
+// Convolve along X. Each row is gathered into a padded buffer, with the
+// boundary mode applied to the padding, and the taps are applied one at a
+// time to the whole row so that the inner loop is vectorized.
+template <class TIn, class TOut>
+void vtkImageSeparableKernelsConvolveX(const vtkImageSeparableKernelsTaps& taps, int boundary,
+  const TIn* inPtr, const int inExt[6], const vtkIdType inIncs[3], TOut* outPtr,
+  const int outExt[6], const vtkIdType outIncs[3], int numComponents)
+{
+  const int n = outExt[1] - outExt[0] + 1;
+  const int pad0 = -taps.Low;
+  const int pad1 = taps.High;
+  const int numTaps = taps.GetNumberOfTaps();
+  const bool renormalize = (boundary == vtkImageSeparableKernels::Renormalize);
+
+  // the buffer holds the positions outExt[0] - pad0 to outExt[1] + pad1,
+  // of which [begin, end) are within the input extent
+  std::vector<double> row(n + pad0 + pad1);
+  std::vector<double> acc(n);
+  const int first = outExt[0] - pad0;
+  const int begin = std::min(std::max(inExt[0] - first, 0), static_cast<int>(row.size()));
+  const int end = std::max(std::min(inExt[1] - first + 1, static_cast<int>(row.size())), begin);
+
+  std::vector<double> scale;
+  if (renormalize)
+  {
+    scale.resize(n);
+    for (int i = 0; i < n; ++i)
+    {
+      scale[i] = taps.GetScale(outExt[0] + i, inExt[0], inExt[1]);
+    }
+  }
+
+  const vtkIdType inInc0 = inIncs[0];
+  const vtkIdType outInc0 = outIncs[0];
+  for (int idxZ = outExt[4]; idxZ <= outExt[5]; ++idxZ)
+  {
+    for (int idxY = outExt[2]; idxY <= outExt[3]; ++idxY)
+    {
+      const TIn* inRow = inPtr + (idxY - inExt[2]) * inIncs[1] + (idxZ - inExt[4]) * inIncs[2];
+      TOut* outRow = outPtr + (idxY - outExt[2]) * outIncs[1] + (idxZ - outExt[4]) * outIncs[2];
+      for (int c = 0; c < numComponents; ++c)
+      {
+        // gather the row, the interior is a plain conversion loop
+        const TIn* inSrc = inRow + (first + begin - inExt[0]) * inInc0 + c;
+        for (int j = begin; j < end; ++j)
+        {
+          row[j] = static_cast<double>(inSrc[(j - begin) * inInc0]);
+        }
+        double lowValue = 0.0;
+        double highValue = 0.0;
+        if (boundary == vtkImageSeparableKernels::Clamp)
+        {
+          lowValue = static_cast<double>(inRow[c]);
+          highValue = static_cast<double>(inRow[(inExt[1] - inExt[0]) * inInc0 + c]);
+        }
+        std::fill(row.begin(), row.begin() + begin, lowValue);
+        std::fill(row.begin() + end, row.end(), highValue);
+
+        std::fill(acc.begin(), acc.end(), 0.0);
+        double* accPtr = acc.data();
+        for (int t = 0; t < numTaps; ++t)
+        {
+          const double w = taps.Weights[t];
+          const double* src = row.data() + pad0 + taps.Offsets[t];
+          for (int i = 0; i < n; ++i)
+          {
+            accPtr[i] += w * src[i];
+          }
+        }
+
+        TOut* outDst = outRow + c;
+        if (renormalize)
+        {
+          for (int i = 0; i < n; ++i)
+          {
+            outDst[i * outInc0] = static_cast<TOut>(accPtr[i] * scale[i]);
+          }
+        }
+        else
+        {
+          for (int i = 0; i < n; ++i)
+          {
+            outDst[i * outInc0] = static_cast<TOut>(accPtr[i]);
+          }
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Convolve along Y or Z. Every output row is the weighted sum of whole input
+// rows; the rows are processed in blocks that fit in the L1 cache, and the
+// boundary mode only changes which input rows are summed.
+template <class TIn, class TOut>
+void vtkImageSeparableKernelsConvolveYZ(int axis, const vtkImageSeparableKernelsTaps& taps,
+  int boundary, const TIn* inPtr, const int inExt[6], const vtkIdType inIncs[3], TOut* outPtr,
+  const int outExt[6], const vtkIdType outIncs[3], int numComponents)
+{
+  const int other = 3 - axis; // the axis that is neither X nor the convolution axis
+  const int inLo = inExt[2 * axis];
+  const int inHi = inExt[2 * axis + 1];
+  const int numTaps = taps.GetNumberOfTaps();
+  const int nx = outExt[1] - outExt[0] + 1;
+  const bool inContiguous = (inIncs[0] == numComponents);
+  const bool outContiguous = (outIncs[0] == numComponents);
+  const int blockX = std::max(vtkImageSeparableKernelsBlockSize / numComponents, 1);
+
+  // the rows summed for each output row, and their weights
+  const int numRows = outExt[2 * axis + 1] - outExt[2 * axis] + 1;
+  std::vector<vtkIdType> rowOffsets(static_cast<size_t>(numRows) * numTaps);
+  std::vector<double> rowWeights(static_cast<size_t>(numRows) * numTaps);
+  std::vector<int> rowTaps(numRows);
+  for (int j = 0; j < numRows; ++j)
+  {
+    const int pos = outExt[2 * axis] + j;
+    const double scale =
+      (boundary == vtkImageSeparableKernels::Renormalize ? taps.GetScale(pos, inLo, inHi) : 1.0);
+    int count = 0;
+    for (int t = 0; t < numTaps; ++t)
+    {
+      int p = pos + taps.Offsets[t];
+      if (p < inLo || p > inHi)
+      {
+        if (boundary != vtkImageSeparableKernels::Clamp)
+        {
+          continue;
+        }
+        p = (p < inLo ? inLo : inHi);
+      }
+      rowOffsets[j * numTaps + count] = (p - inLo) * inIncs[axis];
+      rowWeights[j * numTaps + count] = taps.Weights[t] * scale;
+      ++count;
+    }
+    rowTaps[j] = count;
+  }
+
+  std::vector<double> acc(static_cast<size_t>(blockX) * numComponents);
+  double* accPtr = acc.data();
+  for (int idxO = outExt[2 * other]; idxO <= outExt[2 * other + 1]; ++idxO)
+  {
+    const TIn* inPlane =
+      inPtr + (outExt[0] - inExt[0]) * inIncs[0] + (idxO - inExt[2 * other]) * inIncs[other];
+    TOut* outPlane = outPtr + (idxO - outExt[2 * other]) * outIncs[other];
+    for (int x0 = 0; x0 < nx; x0 += blockX)
+    {
+      const int bx = std::min(blockX, nx - x0);
+      const int bn = bx * numComponents;
+      for (int j = 0; j < numRows; ++j)
+      {
+        std::fill(acc.begin(), acc.begin() + bn, 0.0);
+        const vtkIdType* offsets = rowOffsets.data() + j * numTaps;
+        const double* weights = rowWeights.data() + j * numTaps;
+        for (int t = 0; t < rowTaps[j]; ++t)
+        {
+          const double w = weights[t];
+          const TIn* src = inPlane + x0 * inIncs[0] + offsets[t];
+          if (inContiguous)
+          {
+            for (int i = 0; i < bn; ++i)
+            {
+              accPtr[i] += w * static_cast<double>(src[i]);
+            }
+          }
+          else
+          {
+            for (int x = 0; x < bx; ++x)
+            {
+              for (int c = 0; c < numComponents; ++c)
+              {
+                accPtr[x * numComponents + c] += w * static_cast<double>(src[x * inIncs[0] + c]);
+              }
+            }
+          }
+        }
+
+        TOut* dst = outPlane + j * outIncs[axis] + x0 * outIncs[0];
+        if (outContiguous)
+        {
+          for (int i = 0; i < bn; ++i)
+          {
+            dst[i] = static_cast<TOut>(accPtr[i]);
+          }
+        }
+        else
+        {
+          for (int x = 0; x < bx; ++x)
+          {
+            for (int c = 0; c < numComponents; ++c)
+            {
+              dst[x * outIncs[0] + c] = static_cast<TOut>(accPtr[x * numComponents + c]);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <class TIn, class TOut>
+void vtkImageSeparableKernelsConvolve(int axis, const vtkImageSeparableKernelsTaps& taps,
+  int boundary, const TIn* inPtr, const int inExt[6], const vtkIdType inIncs[3], void* outPtr,
+  const int outExt[6], const vtkIdType outIncs[3], int numComponents)
+{
+  if (axis == 0)
+  {
+    vtkImageSeparableKernelsConvolveX(taps, boundary, inPtr, inExt, inIncs,
+      static_cast<TOut*>(outPtr), outExt, outIncs, numComponents);
+  }
+  else
+  {
+    vtkImageSeparableKernelsConvolveYZ(axis, taps, boundary, inPtr, inExt, inIncs,
+      static_cast<TOut*>(outPtr), outExt, outIncs, numComponents);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Dispatch on the output type, which is the input type, float or double.
+template <class TIn>
+bool vtkImageSeparableKernelsDispatch(int axis, const vtkImageSeparableKernelsTaps& taps,
+  int boundary, const TIn* inPtr, int inType, const int inExt[6], const vtkIdType inIncs[3],
+  void* outPtr, int outType, const int outExt[6], const vtkIdType outIncs[3], int numComponents)
+{
+  if (outType == inType)
+  {
+    vtkImageSeparableKernelsConvolve<TIn, TIn>(
+      axis, taps, boundary, inPtr, inExt, inIncs, outPtr, outExt, outIncs, numComponents);
+  }
+  else if (outType == VTK_FLOAT)
+  {
+    vtkImageSeparableKernelsConvolve<TIn, float>(
+      axis, taps, boundary, inPtr, inExt, inIncs, outPtr, outExt, outIncs, numComponents);
+  }
+  else if (outType == VTK_DOUBLE)
+  {
+    vtkImageSeparableKernelsConvolve<TIn, double>(
+      axis, taps, boundary, inPtr, inExt, inIncs, outPtr, outExt, outIncs, numComponents);
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+bool vtkImageSeparableKernels::ConvolveAxis(int axis, const double* kernel, int kernelSize,
+  int boundary, const void* inPtr, int inType, const int inExt[6], const vtkIdType inIncs[3],
+  void* outPtr, int outType, const int outExt[6], const vtkIdType outIncs[3], int numComponents)
+{
+  if (axis < 0 || axis > 2 || !kernel || kernelSize < 1 || numComponents < 1 ||
+    boundary < Clamp || boundary > Renormalize || inExt[2 * axis] > inExt[2 * axis + 1])
+  {
+    return false;
+  }
+  for (int i = 0; i < 3; ++i)
+  {
+    if (outExt[2 * i] > outExt[2 * i + 1])
+    {
+      return true; // nothing to do
+    }
+    if (i != axis && (outExt[2 * i] < inExt[2 * i] || outExt[2 * i + 1] > inExt[2 * i + 1]))
+    {
+      return false;
+    }
+  }
+
+  vtkImageSeparableKernelsTaps taps(kernel, kernelSize);
+  switch (inType)
+  {
+    vtkTemplateAliasMacro(return vtkImageSeparableKernelsDispatch(axis, taps, boundary,
+      static_cast<const VTK_TT*>(inPtr), inType, inExt, inIncs, outPtr, outType, outExt, outIncs,
+      numComponents));
+    default:
+      return false;
+  }
+}
+
+VTK_ABI_NAMESPACE_END
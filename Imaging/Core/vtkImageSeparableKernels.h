@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkImageSeparableKernels
+ * @brief   shared 1D convolution passes for separable image filters
+ *
+ * vtkImageSeparableKernels applies a 1D kernel along one axis of an image
+ * region. Filters with separable kernels (Gaussian smoothing, separable
+ * convolution, central difference gradients) call it once per axis instead
+ * of carrying their own loops.
+ *
+ * The passes are written for vectorization by the compiler: along X, each
+ * row is gathered into a padded buffer and the kernel is applied tap by tap
+ * over the whole row, and along Y and Z, whole rows of the input are
+ * accumulated into blocks small enough to stay in the L1 cache. Taps with a
+ * zero weight are skipped. Samples outside of the input extent are handled
+ * without padding the image, with the boundary modes:
+ *
+ * - Clamp: the samples at the edge of the input extent are repeated.
+ * - Zero: the samples outside of the input extent are zero.
+ * - Renormalize: the taps outside of the input extent are dropped, and the
+ *   result is scaled so that the remaining weights have the sum of the kernel.
+ *
+ * The scalars are accumulated in double precision and cast to the output
+ * type. All the methods are thread safe.
+ *
+ * @sa
+ * vtkImageGaussianSmooth vtkImageSeparableConvolution vtkImageGradient
+ */
+
+#ifndef vtkImageSeparableKernels_h
+#define vtkImageSeparableKernels_h
+
+#include "vtkImagingCoreModule.h" // For export macro
+#include "vtkSystemIncludes.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKIMAGINGCORE_EXPORT vtkImageSeparableKernels
+{
+public:
+  /**
+   * How the samples outside of the input extent are handled.
+   */
+  enum BoundaryMode
+  {
+    Clamp = 0,
+    Zero = 1,
+    Renormalize = 2
+  };
+
+  /**
+   * Correlate the region outExt of an image with a kernel along an axis:
+   * out(i) = sum_t kernel[t] * in(i + t - (kernelSize - 1) / 2).
+   * The pointers point to the first sample of inExt and outExt, the
+   * increments are in scalars as given by vtkImageData::GetIncrements(),
+   * and the first numComponents components of each sample are processed.
+   * Along the other axes, outExt must be within inExt. The output type must
+   * be the input type, VTK_FLOAT or VTK_DOUBLE. Return false if the types or
+   * the parameters are not supported.
+   */
+  static bool ConvolveAxis(int axis, const double* kernel, int kernelSize, int boundary,
+    const void* inPtr, int inType, const int inExt[6], const vtkIdType inIncs[3], void* outPtr,
+    int outType, const int outExt[6], const vtkIdType outIncs[3], int numComponents);
+
+protected:
+  vtkImageSeparableKernels() = default;
+  ~vtkImageSeparableKernels() = default;
+
+private:
+  vtkImageSeparableKernels(const vtkImageSeparableKernels&) = delete;
+  void operator=(const vtkImageSeparableKernels&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkImageSeparableKernels.h
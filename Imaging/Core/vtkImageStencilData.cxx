@@ -10,6 +10,7 @@
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 #include <cmath>
@@ -855,11 +856,20 @@ void vtkImageStencilData::LogicalOperationInPlace(vtkImageStencilData* stencil,
     }
   }
 
-  // Iterate over the intersected extent
-  for (int idz = extent[4]; idz <= extent[5]; idz++)
+  // Iterate over the intersected extent, each row is independent of the
+  // others so the rows are done in parallel
+  int ySize = extent[3] - extent[2] + 1;
+  vtkIdType numRows = static_cast<vtkIdType>(ySize) * (extent[5] - extent[4] + 1);
+  if (ySize <= 0 || numRows <= 0)
   {
-    for (int idy = extent[2]; idy <= extent[3]; idy++)
+    return;
+  }
+  vtkSMPTools::For(0, numRows, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType row = begin; row < end; row++)
     {
+      int idy = extent[2] + static_cast<int>(row % ySize);
+      int idz = extent[4] + static_cast<int>(row / ySize);
+
       int incr = vtkImageStencilDataIndex(stencil->Extent, idy, idz);
       int clistlen2 = stencil->ExtentListLengths[incr];
       int* clist2 = stencil->ExtentLists[incr];
@@ -898,7 +908,7 @@ void vtkImageStencilData::LogicalOperationInPlace(vtkImageStencilData* stencil,
         delete[] clist1;
       }
     }
-  }
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -950,7 +960,7 @@ void vtkImageStencilData::Subtract(vtkImageStencilData* stencil1)
 //------------------------------------------------------------------------------
 void vtkImageStencilData::Replace(vtkImageStencilData* stencil1)
 {
-  int extent[6], extent1[6], extent2[6], r1, r2, idy, idz, iter = 0;
+  int extent[6], extent1[6], extent2[6];
   stencil1->GetExtent(extent1);
   this->GetExtent(extent2);
 
@@ -969,10 +979,16 @@ void vtkImageStencilData::Replace(vtkImageStencilData* stencil1)
   extent[4] = (extent1[4] < extent2[4]) ? extent2[4] : extent1[4];
   extent[5] = (extent1[5] > extent2[5]) ? extent2[5] : extent1[5];
 
-  for (idz = extent[4]; idz <= extent[5]; idz++, iter = 0)
-  {
-    for (idy = extent[2]; idy <= extent[3]; idy++, iter = 0)
+  // Each row is independent of the others, so the rows are done in parallel
+  int ySize = extent[3] - extent[2] + 1;
+  vtkIdType numRows = static_cast<vtkIdType>(ySize) * (extent[5] - extent[4] + 1);
+  vtkSMPTools::For(0, numRows, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType row = begin; row < end; row++)
     {
+      int idy = extent[2] + static_cast<int>(row % ySize);
+      int idz = extent[4] + static_cast<int>(row / ySize);
+      int r1, r2, iter = 0;
+
       this->RemoveExtent(extent[0], extent[1], idy, idz);
 
       int moreSubExtents = 1;
@@ -986,7 +1002,7 @@ void vtkImageStencilData::Replace(vtkImageStencilData* stencil1)
         }
       }
     }
-  }
+  });
 
   this->Modified();
 }
@@ -1501,28 +1517,32 @@ void vtkImageStencilRaster::FillStencilData(
       }
     }
 
-    // copy the result to all other slices
+    // copy the result to all other slices, which only read the first
+    // slice and are independent of each other, so they are done in parallel
     if (zmin < zmax)
     {
-      for (int idY = ymin; idY <= ymax; idY++)
-      {
-        int r1, r2;
-        int yz[2];
+      vtkSMPTools::For(zmin + 1, zmax + 1, [&](int zbegin, int zend) {
+        for (int idY = ymin; idY <= ymax; idY++)
+        {
+          int r1, r2;
+          int yz[2];
+          int yzCopy[2];
 
-        yz[yj - 1] = idY;
-        yz[2 - yj] = zmin;
+          yz[yj - 1] = idY;
+          yz[2 - yj] = zmin;
+          yzCopy[yj - 1] = idY;
 
-        int iter = 0;
-        while (data->GetNextExtent(r1, r2, xmin, xmax, yz[0], yz[1], iter))
-        {
-          for (int idZ = zmin + 1; idZ <= zmax; idZ++)
+          int iter = 0;
+          while (data->GetNextExtent(r1, r2, xmin, xmax, yz[0], yz[1], iter))
           {
-            yz[2 - yj] = idZ;
-            data->InsertNextExtent(r1, r2, yz[0], yz[1]);
+            for (int idZ = zbegin; idZ < zend; idZ++)
+            {
+              yzCopy[2 - yj] = idZ;
+              data->InsertNextExtent(r1, r2, yzCopy[0], yzCopy[1]);
+            }
           }
-          yz[2 - yj] = zmin;
         }
-      }
+      });
     }
   }
 }
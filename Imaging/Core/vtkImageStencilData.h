@@ -8,6 +8,8 @@
  * efficient both in terms of speed and storage space.  The stencil extents
  * are stored for each x-row across the image (multiple extents per row if
  * necessary) and can be retrieved via the GetNextExtent() method.
+ * Since the rows are independent, Add(), Subtract() and Replace() process
+ * them in parallel with vtkSMPTools.
  * @sa
  * vtkImageStencilSource vtkImageStencil
  */
@@ -261,7 +263,9 @@ public:
 
   /**
    * Fill the specified extent of a vtkImageStencilData with the raster,
-   * after permuting the raster according to xj and yj.
+   * after permuting the raster according to xj and yj. When the extent
+   * has several slices, the slices after the first one are copied from it
+   * in parallel.
    */
   void FillStencilData(vtkImageStencilData* data, const int extent[6], int xj = 0, int yj = 1);
 
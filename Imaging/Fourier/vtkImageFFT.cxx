@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkImageFFT.h"
 
+#include "vtkFFT.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -9,6 +10,7 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageFFT);
@@ -53,15 +55,11 @@ int vtkImageFFT::IterativeRequestUpdateExtent(vtkInformation* input, vtkInformat
 
 //------------------------------------------------------------------------------
 // This templated execute method handles any type input, but the output
-// is always doubles.
+// is always doubles. The lines of each slice are transformed as a batch.
 template <class T>
 void vtkImageFFTExecute(vtkImageFFT* self, vtkImageData* inData, int inExt[6], T* inPtr,
   vtkImageData* outData, int outExt[6], double* outPtr, int id)
 {
-  vtkImageComplex* inComplex;
-  vtkImageComplex* outComplex;
-  vtkImageComplex* pComplex;
-  //
   int inMin0, inMax0;
   vtkIdType inInc0, inInc1, inInc2;
   T *inPtr0, *inPtr1, *inPtr2;
@@ -101,68 +99,98 @@ void vtkImageFFTExecute(vtkImageFFT* self, vtkImageData* inData, int inExt[6], T
     return;
   }
 
-  // Allocate the arrays of complex numbers
-  inComplex = new vtkImageComplex[inSize0];
-  outComplex = new vtkImageComplex[inSize0];
+  // A real input goes through the real transform, that computes the positive
+  // frequencies for half the work. The negative frequencies are their
+  // conjugates.
+  const bool realInput = (numberOfComponents == 1);
+  const std::size_t lineSize = static_cast<std::size_t>(inSize0);
+  const std::size_t spectrumSize = realInput ? lineSize / 2 + 1 : lineSize;
+  const std::size_t numberOfLines = static_cast<std::size_t>(outMax1 - outMin1 + 1);
+  std::vector<vtkFFT::ScalarNumber> realLines(realInput ? lineSize * numberOfLines : 0);
+  std::vector<vtkFFT::ComplexNumber> complexLines(realInput ? 0 : lineSize * numberOfLines);
+  std::vector<vtkFFT::ComplexNumber> spectra(spectrumSize * numberOfLines);
 
   target = static_cast<unsigned long>(
-    (outMax2 - outMin2 + 1) * (outMax1 - outMin1 + 1) * self->GetNumberOfIterations() / 50.0);
+    (outMax2 - outMin2 + 1) * self->GetNumberOfIterations() / 50.0);
   target++;
 
   // loop over other axes
   inPtr2 = inPtr;
   outPtr2 = outPtr;
-  for (idx2 = outMin2; idx2 <= outMax2; ++idx2)
+  for (idx2 = outMin2; !self->AbortExecute && idx2 <= outMax2; ++idx2)
   {
+    if (!id)
+    {
+      if (!(count % target))
+      {
+        self->UpdateProgress(count / (50.0 * target) + startProgress);
+      }
+      count++;
+    }
+
+    // copy the lines of the slice
     inPtr1 = inPtr2;
-    outPtr1 = outPtr2;
-    for (idx1 = outMin1; !self->AbortExecute && idx1 <= outMax1; ++idx1)
+    for (idx1 = 0; idx1 < static_cast<int>(numberOfLines); ++idx1)
     {
-      if (!id)
+      inPtr0 = inPtr1;
+      if (realInput)
       {
-        if (!(count % target))
+        vtkFFT::ScalarNumber* line = realLines.data() + idx1 * lineSize;
+        for (idx0 = 0; idx0 < inSize0; ++idx0)
         {
-          self->UpdateProgress(count / (50.0 * target) + startProgress);
+          line[idx0] = static_cast<vtkFFT::ScalarNumber>(*inPtr0);
+          inPtr0 += inInc0;
         }
-        count++;
       }
-      // copy into complex numbers
-      inPtr0 = inPtr1;
-      pComplex = inComplex;
-      for (idx0 = inMin0; idx0 <= inMax0; ++idx0)
-      {
-        pComplex->Real = static_cast<double>(*inPtr0);
-        pComplex->Imag = 0.0;
-        if (numberOfComponents > 1)
-        { // yes we have an imaginary input
-          pComplex->Imag = static_cast<double>(inPtr0[1]);
+      else
+      { // yes we have an imaginary input
+        vtkFFT::ComplexNumber* line = complexLines.data() + idx1 * lineSize;
+        for (idx0 = 0; idx0 < inSize0; ++idx0)
+        {
+          line[idx0].r = static_cast<vtkFFT::ScalarNumber>(*inPtr0);
+          line[idx0].i = static_cast<vtkFFT::ScalarNumber>(inPtr0[1]);
+          inPtr0 += inInc0;
         }
-        inPtr0 += inInc0;
-        ++pComplex;
       }
+      inPtr1 += inInc1;
+    }
 
-      // Call the method that performs the fft
-      self->ExecuteFft(inComplex, outComplex, inSize0);
+    // Transform all the lines of the slice
+    if (realInput)
+    {
+      vtkFFT::BatchRFft(realLines.data(), lineSize, numberOfLines, spectra.data());
+    }
+    else
+    {
+      vtkFFT::BatchFft(complexLines.data(), lineSize, numberOfLines, spectra.data());
+    }
 
-      // copy into output
+    // copy into output
+    outPtr1 = outPtr2;
+    for (idx1 = 0; idx1 < static_cast<int>(numberOfLines); ++idx1)
+    {
+      const vtkFFT::ComplexNumber* spectrum = spectra.data() + idx1 * spectrumSize;
       outPtr0 = outPtr1;
-      pComplex = outComplex + (outMin0 - inMin0);
       for (idx0 = outMin0; idx0 <= outMax0; ++idx0)
       {
-        *outPtr0 = static_cast<double>(pComplex->Real);
-        outPtr0[1] = static_cast<double>(pComplex->Imag);
+        const std::size_t k = static_cast<std::size_t>(idx0 - inMin0);
+        if (k < spectrumSize)
+        {
+          *outPtr0 = static_cast<double>(spectrum[k].r);
+          outPtr0[1] = static_cast<double>(spectrum[k].i);
+        }
+        else
+        {
+          *outPtr0 = static_cast<double>(spectrum[lineSize - k].r);
+          outPtr0[1] = -static_cast<double>(spectrum[lineSize - k].i);
+        }
         outPtr0 += outInc0;
-        ++pComplex;
       }
-      inPtr1 += inInc1;
       outPtr1 += outInc1;
     }
     inPtr2 += inInc2;
     outPtr2 += outInc2;
   }
-
-  delete[] inComplex;
-  delete[] outComplex;
 }
 
 //------------------------------------------------------------------------------
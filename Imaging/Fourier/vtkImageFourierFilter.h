@@ -106,6 +106,7 @@ public:
    * This function calculates the whole fft of an array.
    * The contents of the input array are changed.
    * (It is engineered for no decimation)
+   * To transform many arrays of the same size, vtkFFT::BatchFft() is faster.
    */
   void ExecuteFft(vtkImageComplex* in, vtkImageComplex* out, int N);
 
@@ -113,6 +114,7 @@ public:
    * This function calculates the whole fft of an array.
    * The contents of the input array are changed.
    * (It is engineered for no decimation)
+   * To transform many arrays of the same size, vtkFFT::BatchIFft() is faster.
    */
   void ExecuteRfft(vtkImageComplex* in, vtkImageComplex* out, int N);
 
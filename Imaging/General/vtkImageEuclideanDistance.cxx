@@ -2,13 +2,20 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkImageEuclideanDistance.h"
 
+#include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <cmath>
+#include <limits>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageEuclideanDistance);
@@ -21,6 +28,8 @@ vtkImageEuclideanDistance::vtkImageEuclideanDistance()
   this->Initialize = 1;
   this->ConsiderAnisotropy = 1;
   this->Algorithm = VTK_EDT_SAITO;
+  this->SignedDistance = 0;
+  this->GenerateClosestFeatureIds = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -616,6 +625,204 @@ static void vtkImageEuclideanDistanceExecuteSaitoCached(
   free(temp);
   free(sq);
 }
+//------------------------------------------------------------------------------
+// Lower envelope of the parabolas weight * (p - q)^2 + f[q] for q in [0, n),
+// from Felzenszwalb and Huttenlocher. For each p in [0, n), d[p] receives the
+// value of the lowest parabola at p, and arg[p] its root q. v and z are work
+// arrays of sizes n and n + 1.
+static void vtkImageEuclideanDistanceEnvelope(
+  const double* f, int n, double weight, int* v, double* z, double* d, int* arg)
+{
+  const double infinity = std::numeric_limits<double>::infinity();
+  int k = 0;
+  v[0] = 0;
+  z[0] = -infinity;
+  z[1] = infinity;
+  for (int q = 1; q < n; ++q)
+  {
+    const double fq = f[q] + weight * q * q;
+    double s = (fq - (f[v[k]] + weight * v[k] * v[k])) / (2.0 * weight * (q - v[k]));
+    while (k > 0 && s <= z[k])
+    {
+      --k;
+      s = (fq - (f[v[k]] + weight * v[k] * v[k])) / (2.0 * weight * (q - v[k]));
+    }
+    ++k;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = infinity;
+  }
+
+  k = 0;
+  for (int p = 0; p < n; ++p)
+  {
+    while (z[k + 1] < p)
+    {
+      ++k;
+    }
+    const double dp = p - v[k];
+    d[p] = weight * dp * dp + f[v[k]];
+    arg[p] = v[k];
+  }
+}
+
+//------------------------------------------------------------------------------
+// One pass of the Felzenszwalb algorithm along the axis of the current
+// iteration. The lines of voxels along this axis are independent, so they
+// are processed in parallel, each with thread local buffers.
+template <class T>
+class vtkImageEuclideanDistanceEnvelopeFunctor
+{
+public:
+  const T* InPtr;
+  vtkIdType InIncs[3];
+  double* OutPtr;
+  vtkIdType OutIncs[3];
+  int Size[3];
+  const vtkIdType* InIds; // closest features of the previous pass, if any
+  vtkIdType* OutIds;      // closest features, if requested
+  double Weight;
+  double MaximumDistance;
+  bool Binary; // the input is a mask whose zero voxels are the features
+  bool Signed;
+
+  struct LineBuffers
+  {
+    std::vector<double> F; // squared distances to the zero voxels
+    std::vector<double> G; // squared distances to the non-zero voxels
+    std::vector<double> DF;
+    std::vector<double> DG;
+    std::vector<double> Z;
+    std::vector<int> V;
+    std::vector<int> ArgF;
+    std::vector<int> ArgG;
+    std::vector<unsigned char> Inside;
+  };
+  vtkSMPThreadLocal<LineBuffers> Buffers;
+
+  void Initialize()
+  {
+    LineBuffers& buffers = this->Buffers.Local();
+    const size_t n = static_cast<size_t>(this->Size[0]);
+    buffers.F.resize(n);
+    buffers.DF.resize(n);
+    buffers.Z.resize(n + 1);
+    buffers.V.resize(n);
+    buffers.ArgF.resize(n);
+    if (this->Signed)
+    {
+      buffers.G.resize(n);
+      buffers.DG.resize(n);
+      buffers.ArgG.resize(n);
+      buffers.Inside.resize(n);
+    }
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    LineBuffers& buffers = this->Buffers.Local();
+    const int n = this->Size[0];
+    const double maxDist = this->MaximumDistance;
+    for (vtkIdType line = begin; line < end; ++line)
+    {
+      const vtkIdType idx1 = line % this->Size[1];
+      const vtkIdType idx2 = line / this->Size[1];
+      const T* inPtr = this->InPtr + idx1 * this->InIncs[1] + idx2 * this->InIncs[2];
+      const vtkIdType outId = idx1 * this->OutIncs[1] + idx2 * this->OutIncs[2];
+      double* outPtr = this->OutPtr + outId;
+
+      // A signed map stores the distances to the zero voxels as positive
+      // values and the distances to the non-zero voxels as negative values,
+      // each voxel being at distance 0 of the voxels of the other kind.
+      for (int p = 0; p < n; ++p)
+      {
+        const double value = static_cast<double>(inPtr[p * this->InIncs[0]]);
+        if (this->Signed)
+        {
+          const bool inside = this->Binary ? value != 0.0 : value > 0.0;
+          buffers.Inside[p] = inside ? 1 : 0;
+          buffers.F[p] = inside ? (this->Binary ? maxDist : value) : 0.0;
+          buffers.G[p] = inside ? 0.0 : (this->Binary ? maxDist : -value);
+        }
+        else
+        {
+          buffers.F[p] = this->Binary ? (value != 0.0 ? maxDist : 0.0) : value;
+        }
+      }
+
+      vtkImageEuclideanDistanceEnvelope(buffers.F.data(), n, this->Weight, buffers.V.data(),
+        buffers.Z.data(), buffers.DF.data(), buffers.ArgF.data());
+      if (this->Signed)
+      {
+        vtkImageEuclideanDistanceEnvelope(buffers.G.data(), n, this->Weight, buffers.V.data(),
+          buffers.Z.data(), buffers.DG.data(), buffers.ArgG.data());
+      }
+
+      for (int p = 0; p < n; ++p)
+      {
+        const bool outside = this->Signed && !buffers.Inside[p];
+        outPtr[p * this->OutIncs[0]] = outside ? -buffers.DG[p] : buffers.DF[p];
+        if (this->OutIds)
+        {
+          const int arg = outside ? buffers.ArgG[p] : buffers.ArgF[p];
+          const vtkIdType featureId = outId + arg * this->OutIncs[0];
+          this->OutIds[outId + p * this->OutIncs[0]] =
+            this->InIds ? this->InIds[featureId] : featureId;
+        }
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+
+//------------------------------------------------------------------------------
+// Execute one pass of the Felzenszwalb algorithm. The first pass reads the
+// input image, the next ones the squared distances of the previous pass.
+template <class T>
+static void vtkImageEuclideanDistanceExecuteFelzenszwalb(vtkImageEuclideanDistance* self,
+  vtkImageData* inData, const T* inPtr, vtkImageData* outData, int outExt[6], double* outPtr,
+  const vtkIdType* inIds, vtkIdType* outIds)
+{
+  int outMin0, outMax0, outMin1, outMax1, outMin2, outMax2;
+
+  // Reorder axes
+  self->PermuteExtent(outExt, outMin0, outMax0, outMin1, outMax1, outMin2, outMax2);
+
+  vtkIdType inIncrements[3];
+  vtkIdType outIncrements[3];
+  inData->GetIncrements(inIncrements);
+  outData->GetIncrements(outIncrements);
+
+  vtkImageEuclideanDistanceEnvelopeFunctor<T> functor;
+  self->PermuteIncrements(inIncrements, functor.InIncs[0], functor.InIncs[1], functor.InIncs[2]);
+  self->PermuteIncrements(
+    outIncrements, functor.OutIncs[0], functor.OutIncs[1], functor.OutIncs[2]);
+  functor.InPtr = inPtr;
+  functor.OutPtr = outPtr;
+  functor.Size[0] = outMax0 - outMin0 + 1;
+  functor.Size[1] = outMax1 - outMin1 + 1;
+  functor.Size[2] = outMax2 - outMin2 + 1;
+  functor.InIds = inIds;
+  functor.OutIds = outIds;
+  functor.MaximumDistance = self->GetMaximumDistance();
+  functor.Signed = self->GetSignedDistance() != 0;
+  functor.Binary =
+    self->GetIteration() == 0 && (self->GetInitialize() == 1 || self->GetSignedDistance());
+
+  double spacing = 1.0;
+  if (self->GetConsiderAnisotropy())
+  {
+    spacing = outData->GetSpacing()[self->GetIteration()];
+  }
+  functor.Weight = spacing * spacing;
+
+  if (functor.Size[0] > 0)
+  {
+    vtkSMPTools::For(0, static_cast<vtkIdType>(functor.Size[1]) * functor.Size[2], functor);
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkImageEuclideanDistance::AllocateOutputScalars(
   vtkImageData* outData, int outExt[6], vtkInformation* outInfo)
@@ -679,6 +886,42 @@ int vtkImageEuclideanDistance::IterativeRequestData(vtkInformation* vtkNotUsed(r
     return 1;
   }
 
+  // The closest features are only computed by the Felzenszwalb algorithm.
+  const char* idsName = "ClosestFeatureIds";
+  outData->GetPointData()->RemoveArray(idsName);
+  if (this->GetAlgorithm() == VTK_EDT_FELZENSZWALB)
+  {
+    const vtkIdType* inIds = nullptr;
+    vtkIdType* outIds = nullptr;
+    if (this->GenerateClosestFeatureIds)
+    {
+      vtkNew<vtkIdTypeArray> ids;
+      ids->SetName(idsName);
+      ids->SetNumberOfTuples(outData->GetNumberOfPoints());
+      outData->GetPointData()->AddArray(ids);
+      outIds = ids->GetPointer(0);
+      vtkIdTypeArray* previousIds =
+        vtkArrayDownCast<vtkIdTypeArray>(inData->GetPointData()->GetArray(idsName));
+      if (this->GetIteration() > 0 && previousIds)
+      {
+        inIds = previousIds->GetPointer(0);
+      }
+    }
+
+    switch (inData->GetScalarType())
+    {
+      vtkTemplateMacro(vtkImageEuclideanDistanceExecuteFelzenszwalb(this, inData,
+        static_cast<const VTK_TT*>(inPtr), outData, outExt, static_cast<double*>(outPtr), inIds,
+        outIds));
+      default:
+        vtkErrorMacro(<< "Execute: Unknown ScalarType");
+        return 1;
+    }
+
+    this->UpdateProgress((this->GetIteration() + 1.0) / 3.0);
+    return 1;
+  }
+
   if (this->GetIteration() == 0)
   {
     switch (inData->GetScalarType())
@@ -736,9 +979,16 @@ void vtkImageEuclideanDistance::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << "Saito\n";
   }
+  else if (this->Algorithm == VTK_EDT_FELZENSZWALB)
+  {
+    os << "Felzenszwalb\n";
+  }
   else
   {
     os << "Saito Cached\n";
   }
+  os << indent << "Signed Distance: " << (this->SignedDistance ? "On\n" : "Off\n");
+  os << indent << "Generate Closest Feature Ids: "
+     << (this->GenerateClosestFeatureIds ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
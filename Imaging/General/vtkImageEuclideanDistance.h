@@ -19,6 +19,14 @@
  * slow it very significantly. In that case, one should use
  * vtkImageEuclideanDistance::SetAlgorithmToSaitoCached() instead for better performance.
  *
+ * For large images, vtkImageEuclideanDistance::SetAlgorithmToFelzenszwalb()
+ * selects the separable lower envelope algorithm of Felzenszwalb and
+ * Huttenlocher (also described by Meijster et al.), which is exact and linear
+ * in the number of voxels. Each axis pass processes the lines of voxels in
+ * parallel with vtkSMPTools. This algorithm can also produce a signed
+ * distance (see SignedDistance) and the id of the closest feature voxel of
+ * each voxel (see GenerateClosestFeatureIds).
+ *
  * References:
  *
  * T. Saito and J.I. Toriwaki. New algorithms for Euclidean distance
@@ -28,6 +36,13 @@
  * O. Cuisenaire. Distance Transformation: fast algorithms and applications
  * to medical image processing. PhD Thesis, Universite catholique de Louvain,
  * October 1999. http://ltswww.epfl.ch/~cuisenai/papers/oc_thesis.pdf
+ *
+ * P.F. Felzenszwalb and D.P. Huttenlocher. Distance Transforms of Sampled
+ * Functions. Theory of Computing, 8(19). pp. 415--428, 2012.
+ *
+ * A. Meijster, J.B.T.M. Roerdink and W.H. Hesselink. A General Algorithm for
+ * Computing Distance Transforms in Linear Time. Mathematical Morphology and
+ * its Applications to Image and Signal Processing. pp. 331--340, 2000.
  */
 
 #ifndef vtkImageEuclideanDistance_h
@@ -38,6 +53,7 @@
 
 #define VTK_EDT_SAITO_CACHED 0
 #define VTK_EDT_SAITO 1
+#define VTK_EDT_FELZENSZWALB 2
 
 VTK_ABI_NAMESPACE_BEGIN
 class VTKIMAGINGGENERAL_EXPORT vtkImageEuclideanDistance : public vtkImageDecomposeFilter
@@ -83,12 +99,39 @@ public:
    * Selects a Euclidean DT algorithm.
    * 1. Saito
    * 2. Saito-cached
-   * More algorithms will be added later on.
+   * 3. Felzenszwalb: parallel lower envelope of parabolas
    */
   vtkSetMacro(Algorithm, int);
   vtkGetMacro(Algorithm, int);
   void SetAlgorithmToSaito() { this->SetAlgorithm(VTK_EDT_SAITO); }
   void SetAlgorithmToSaitoCached() { this->SetAlgorithm(VTK_EDT_SAITO_CACHED); }
+  void SetAlgorithmToFelzenszwalb() { this->SetAlgorithm(VTK_EDT_FELZENSZWALB); }
+  ///@}
+
+  ///@{
+  /**
+   * Compute a signed distance map. Voxels with a non-zero input value keep
+   * their (positive) squared distance to the nearest zero voxel, and zero
+   * voxels get minus their squared distance to the nearest non-zero voxel.
+   * The input is then always used as a binary mask, as with Initialize on.
+   * Only used by the Felzenszwalb algorithm. Default is off.
+   */
+  vtkSetMacro(SignedDistance, vtkTypeBool);
+  vtkGetMacro(SignedDistance, vtkTypeBool);
+  vtkBooleanMacro(SignedDistance, vtkTypeBool);
+  ///@}
+
+  ///@{
+  /**
+   * Add to the output a vtkIdTypeArray, named "ClosestFeatureIds", holding for
+   * each voxel the point id of the voxel its distance is measured to: the
+   * closest zero voxel, or for the zero voxels of a signed distance map the
+   * closest non-zero voxel. Zero voxels of an unsigned map are their own
+   * closest feature. Only used by the Felzenszwalb algorithm. Default is off.
+   */
+  vtkSetMacro(GenerateClosestFeatureIds, vtkTypeBool);
+  vtkGetMacro(GenerateClosestFeatureIds, vtkTypeBool);
+  vtkBooleanMacro(GenerateClosestFeatureIds, vtkTypeBool);
   ///@}
 
   int IterativeRequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
@@ -101,6 +144,8 @@ protected:
   vtkTypeBool Initialize;
   vtkTypeBool ConsiderAnisotropy;
   int Algorithm;
+  vtkTypeBool SignedDistance;
+  vtkTypeBool GenerateClosestFeatureIds;
 
   // Replaces "EnlargeOutputUpdateExtent"
   virtual void AllocateOutputScalars(vtkImageData* outData, int outExt[6], vtkInformation* outInfo);
@@ -3,12 +3,14 @@
 #include "vtkImageGaussianSmooth.h"
 
 #include "vtkImageData.h"
+#include "vtkImageSeparableKernels.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageGaussianSmooth);
@@ -119,212 +121,42 @@ void vtkImageGaussianSmooth::InternalRequestUpdateExtent(int* inExt, int* wholeE
 }
 
 //------------------------------------------------------------------------------
-// For a given position along the convolution axis, this method loops over
-// all other axes, and performs the convolution. Boundary conditions handled
-// previously.
-template <class T>
-void vtkImageGaussianSmoothExecute(vtkImageGaussianSmooth* self, int axis, double* kernel,
-  int kernelSize, vtkImageData* inData, T* inPtrC, vtkImageData* outData, int outExt[6], T* outPtrC,
-  int* pcycle, int target, int* pcount, int total)
+// This method convolves over one axis. The input extent is clipped to the
+// whole extent (see InternalRequestUpdateExtent), so the kernel is normalized
+// again over the part of it that lies within the input extent.
+void vtkImageGaussianSmooth::ExecuteAxis(int axis, vtkImageData* inData, int inExt[6],
+  vtkImageData* outData, int outExt[6], int* vtkNotUsed(pcycle), int vtkNotUsed(target),
+  int* pcount, int total, vtkInformation* vtkNotUsed(inInfo))
 {
-  int maxC, max0 = 0, max1 = 0;
-  int idxC, idx0, idx1, idxK;
-  vtkIdType inIncs[3], outIncs[3];
-  vtkIdType inInc0 = 0, inInc1 = 0, inIncK, outInc0 = 0, outInc1 = 0;
-  T *outPtr1, *outPtr0;
-  T *inPtr1, *inPtr0, *inPtrK;
-  double *ptrK, sum;
-
-  // I am counting on the fact that tight loops (component on outside)
-  // is more important than cache misses from shuffled access.
-
-  // Do the correct shuffling of the axes (increments, extents)
-  inData->GetIncrements(inIncs);
-  outData->GetIncrements(outIncs);
-  inIncK = inIncs[axis];
-  maxC = outData->GetNumberOfScalarComponents();
-  switch (axis)
-  {
-    case 0:
-      inInc0 = inIncs[1];
-      inInc1 = inIncs[2];
-      outInc0 = outIncs[1];
-      outInc1 = outIncs[2];
-      max0 = outExt[3] - outExt[2] + 1;
-      max1 = outExt[5] - outExt[4] + 1;
-      break;
-    case 1:
-      inInc0 = inIncs[0];
-      inInc1 = inIncs[2];
-      outInc0 = outIncs[0];
-      outInc1 = outIncs[2];
-      max0 = outExt[1] - outExt[0] + 1;
-      max1 = outExt[5] - outExt[4] + 1;
-      break;
-    case 2:
-      inInc0 = inIncs[0];
-      inInc1 = inIncs[1];
-      outInc0 = outIncs[0];
-      outInc1 = outIncs[1];
-      max0 = outExt[1] - outExt[0] + 1;
-      max1 = outExt[3] - outExt[2] + 1;
-      break;
-  }
-
-  for (idxC = 0; idxC < maxC; ++idxC)
+  if (this->AbortExecute)
   {
-    inPtr1 = inPtrC;
-    outPtr1 = outPtrC;
-    for (idx1 = 0; !self->AbortExecute && idx1 < max1; ++idx1)
-    {
-      inPtr0 = inPtr1;
-      outPtr0 = outPtr1;
-      for (idx0 = 0; idx0 < max0; ++idx0)
-      {
-        inPtrK = inPtr0;
-        ptrK = kernel;
-        sum = 0.0;
-        // too bad this short loop has to be the inner most loop
-        for (idxK = 0; idxK < kernelSize; ++idxK)
-        {
-          sum += *ptrK * static_cast<double>(*inPtrK);
-          ++ptrK;
-          inPtrK += inIncK;
-        }
-        *outPtr0 = static_cast<T>(sum);
-        inPtr0 += inInc0;
-        outPtr0 += outInc0;
-      }
-      inPtr1 += inInc1;
-      outPtr1 += outInc1;
-      // we finished a row ... do we update ???
-      if (total)
-      { // yes this is the main thread
-        *pcycle += max0;
-        if (*pcycle > target)
-        { // yes
-          *pcycle -= target;
-          *pcount += target;
-          self->UpdateProgress(static_cast<double>(*pcount) / static_cast<double>(total));
-          // fprintf(stderr, "count: %d, total: %d, progress: %f\n",
-          //*pcount, total, (double)(*pcount) / (double)total);
-        }
-      }
-    }
-
-    ++inPtrC;
-    ++outPtrC;
+    return;
   }
-}
 
-//------------------------------------------------------------------------------
-template <class T>
-size_t vtkImageGaussianSmoothGetTypeSize(T*)
-{
-  return sizeof(T);
-}
+  int radius = static_cast<int>(this->StandardDeviations[axis] * this->RadiusFactors[axis]);
+  std::vector<double> kernel(2 * radius + 1);
+  this->ComputeKernel(kernel.data(), -radius, radius, this->StandardDeviations[axis]);
 
-//------------------------------------------------------------------------------
-// This method convolves over one axis. It loops over the convolved axis,
-// and handles boundary conditions.
-void vtkImageGaussianSmooth::ExecuteAxis(int axis, vtkImageData* inData, int inExt[6],
-  vtkImageData* outData, int outExt[6], int* pcycle, int target, int* pcount, int total,
-  vtkInformation* inInfo)
-{
-  int idxA, max;
-  int wholeExtent[6], wholeMax, wholeMin;
-  double* kernel;
-  // previousClip and currentClip rembers that the previous was not clipped
-  // keeps from recomputing kernels for center pixels.
-  int kernelSize = 0;
-  int kernelLeftClip, kernelRightClip;
-  int previousClipped, currentClipped;
-  int radius, size;
-  void* inPtr;
-  void* outPtr;
-  int coords[3];
-  vtkIdType outIncs[3], outIncA;
-
-  // Get the correct starting pointer of the output
-  outPtr = outData->GetScalarPointerForExtent(outExt);
+  vtkIdType inIncs[3], outIncs[3];
+  inData->GetIncrements(inIncs);
   outData->GetIncrements(outIncs);
-  outIncA = outIncs[axis];
-
-  // trick to account for the scalar type of the output(used to be only float)
-  switch (outData->GetScalarType())
+  int numComponents = outData->GetNumberOfScalarComponents();
+  if (!vtkImageSeparableKernels::ConvolveAxis(axis, kernel.data(), 2 * radius + 1,
+        vtkImageSeparableKernels::Renormalize, inData->GetScalarPointerForExtent(inExt),
+        inData->GetScalarType(), inExt, inIncs, outData->GetScalarPointerForExtent(outExt),
+        outData->GetScalarType(), outExt, outIncs, numComponents))
   {
-    vtkTemplateMacro(outIncA *=
-      static_cast<vtkIdType>(vtkImageGaussianSmoothGetTypeSize(static_cast<VTK_TT*>(nullptr))));
-    default:
-      vtkErrorMacro("Unknown scalar type");
-      return;
+    vtkErrorMacro("Unknown scalar type");
+    return;
   }
 
-  // Determine default starting position of input
-  coords[0] = inExt[0];
-  coords[1] = inExt[2];
-  coords[2] = inExt[4];
-
-  // get whole extent for boundary checking ...
-  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
-  wholeMin = wholeExtent[axis * 2];
-  wholeMax = wholeExtent[axis * 2 + 1];
-
-  // allocate memory for the kernel
-  radius = static_cast<int>(this->StandardDeviations[axis] * this->RadiusFactors[axis]);
-  size = 2 * radius + 1;
-  kernel = new double[size];
-
-  // loop over the convolution axis
-  previousClipped = currentClipped = 1;
-  max = outExt[axis * 2 + 1];
-  for (idxA = outExt[axis * 2]; idxA <= max; ++idxA)
+  // this is the main thread, update the progress
+  if (total)
   {
-    // left boundary condition
-    coords[axis] = idxA - radius;
-    kernelLeftClip = wholeMin - coords[axis];
-    if (kernelLeftClip > 0)
-    { // front of kernel is cut off ("kernelStart" samples)
-      coords[axis] += kernelLeftClip;
-    }
-    else
-    {
-      kernelLeftClip = 0;
-    }
-    // Right boundary condition
-    kernelRightClip = (idxA + radius) - wholeMax;
-    if (kernelRightClip < 0)
-    {
-      kernelRightClip = 0;
-    }
-
-    // We can only use previous kernel if it is not clipped and new
-    // kernel is also not clipped.
-    currentClipped = kernelLeftClip + kernelRightClip;
-    if (currentClipped || previousClipped)
-    {
-      this->ComputeKernel(kernel, -radius + kernelLeftClip, radius - kernelRightClip,
-        static_cast<double>(this->StandardDeviations[axis]));
-      kernelSize = size - kernelLeftClip - kernelRightClip;
-    }
-    previousClipped = currentClipped;
-
-    /* now do the convolution on the rest of the axes */
-    inPtr = inData->GetScalarPointer(coords);
-    switch (inData->GetScalarType())
-    {
-      vtkTemplateMacro(vtkImageGaussianSmoothExecute(this, axis, kernel, kernelSize, inData,
-        static_cast<VTK_TT*>(inPtr), outData, outExt, static_cast<VTK_TT*>(outPtr), pcycle, target,
-        pcount, total));
-      default:
-        vtkErrorMacro("Unknown scalar type");
-        return;
-    }
-    outPtr = static_cast<void*>(static_cast<unsigned char*>(outPtr) + outIncA);
+    *pcount += (outExt[1] - outExt[0] + 1) * (outExt[3] - outExt[2] + 1) *
+      (outExt[5] - outExt[4] + 1) * numComponents;
+    this->UpdateProgress(static_cast<double>(*pcount) / static_cast<double>(total));
   }
-
-  // get rid of temporary kernel
-  delete[] kernel;
 }
 
 //------------------------------------------------------------------------------
@@ -4,6 +4,7 @@
 
 #include "vtkDataArray.h"
 #include "vtkImageData.h"
+#include "vtkImageSeparableKernels.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
@@ -119,108 +120,40 @@ int vtkImageGradient::RequestUpdateExtent(
 }
 
 //------------------------------------------------------------------------------
-// This execute method handles boundaries.
-// it handles boundaries. Pixels are just replicated to get values
-// out of extent.
-template <class T>
-void vtkImageGradientExecute(vtkImageGradient* self, vtkImageData* inData, T* inPtr,
-  vtkImageData* outData, double* outPtr, int outExt[6], int id)
+// This execute method handles boundaries. Pixels are just replicated to get
+// values out of extent. Each axis is a central difference computed by
+// vtkImageSeparableKernels, written to its component of the output.
+static bool vtkImageGradientExecute(vtkImageGradient* self, vtkImageData* inData,
+  vtkDataArray* inArray, vtkImageData* outData, int outExt[6], int id)
 {
-  int idxX, idxY, idxZ;
-  int maxX, maxY, maxZ;
-  vtkIdType inIncX, inIncY, inIncZ;
-  vtkIdType outIncX, outIncY, outIncZ;
-  unsigned long count = 0;
-  unsigned long target;
-  int axesNum;
+  // The input array covers the extent of the input data.
   int* inExt = inData->GetExtent();
-  int* wholeExtent;
-  vtkIdType inIncs[3];
-  double r[3], d;
-  int useZMin, useZMax, useYMin, useYMax, useXMin, useXMax;
-
-  // find the region to loop over
-  maxX = outExt[1] - outExt[0];
-  maxY = outExt[3] - outExt[2];
-  maxZ = outExt[5] - outExt[4];
-  target = static_cast<unsigned long>((maxZ + 1) * (maxY + 1) / 50.0);
-  target++;
-
-  // Get the dimensionality of the gradient.
-  axesNum = self->GetDimensionality();
-
-  // Get increments to march through data
-  inData->GetContinuousIncrements(outExt, inIncX, inIncY, inIncZ);
-  outData->GetContinuousIncrements(outExt, outIncX, outIncY, outIncZ);
+  vtkIdType inIncs[3], outIncs[3];
+  inData->GetIncrements(inArray, inIncs);
+  outData->GetIncrements(outIncs);
+  double* outPtr = static_cast<double*>(outData->GetScalarPointerForExtent(outExt));
 
   // The data spacing is important for computing the gradient.
   // central differences (2 * ratio).
-  // Negative because below we have (min - max) for dx ...
+  double r[3];
   inData->GetSpacing(r);
-  r[0] = -0.5 / r[0];
-  r[1] = -0.5 / r[1];
-  r[2] = -0.5 / r[2];
-
-  // get some other info we need
-  inData->GetIncrements(inIncs);
-  wholeExtent = inData->GetExtent();
 
-  // Move the pointer to the correct starting position.
-  inPtr += (outExt[0] - inExt[0]) * inIncs[0] + (outExt[2] - inExt[2]) * inIncs[1] +
-    (outExt[4] - inExt[4]) * inIncs[2];
-
-  // Loop through output pixels
-  for (idxZ = 0; idxZ <= maxZ; idxZ++)
+  int axesNum = self->GetDimensionality();
+  for (int axis = 0; axis < axesNum && !self->AbortExecute; ++axis)
   {
-    useZMin = ((idxZ + outExt[4]) <= wholeExtent[4]) ? 0 : -inIncs[2];
-    useZMax = ((idxZ + outExt[4]) >= wholeExtent[5]) ? 0 : inIncs[2];
-    for (idxY = 0; !self->AbortExecute && idxY <= maxY; idxY++)
+    double kernel[3] = { -0.5 / r[axis], 0.0, 0.5 / r[axis] };
+    if (!vtkImageSeparableKernels::ConvolveAxis(axis, kernel, 3, vtkImageSeparableKernels::Clamp,
+          inArray->GetVoidPointer(0), inArray->GetDataType(), inExt, inIncs, outPtr + axis,
+          VTK_DOUBLE, outExt, outIncs, 1))
     {
-      if (!id)
-      {
-        if (!(count % target))
-        {
-          self->UpdateProgress(count / (50.0 * target));
-        }
-        count++;
-      }
-      useYMin = ((idxY + outExt[2]) <= wholeExtent[2]) ? 0 : -inIncs[1];
-      useYMax = ((idxY + outExt[2]) >= wholeExtent[3]) ? 0 : inIncs[1];
-      for (idxX = 0; idxX <= maxX; idxX++)
-      {
-        useXMin = ((idxX + outExt[0]) <= wholeExtent[0]) ? 0 : -inIncs[0];
-        useXMax = ((idxX + outExt[0]) >= wholeExtent[1]) ? 0 : inIncs[0];
-
-        // do X axis
-        d = static_cast<double>(inPtr[useXMin]);
-        d -= static_cast<double>(inPtr[useXMax]);
-        d *= r[0]; // multiply by the data spacing
-        *outPtr = d;
-        outPtr++;
-
-        // do y axis
-        d = static_cast<double>(inPtr[useYMin]);
-        d -= static_cast<double>(inPtr[useYMax]);
-        d *= r[1]; // multiply by the data spacing
-        *outPtr = d;
-        outPtr++;
-        if (axesNum == 3)
-        {
-          // do z axis
-          d = static_cast<double>(inPtr[useZMin]);
-          d -= static_cast<double>(inPtr[useZMax]);
-          d *= r[2]; // multiply by the data spacing
-          *outPtr = d;
-          outPtr++;
-        }
-        inPtr++;
-      }
-      outPtr += outIncY;
-      inPtr += inIncY;
+      return false;
+    }
+    if (!id)
+    {
+      self->UpdateProgress(static_cast<double>(axis + 1) / axesNum);
     }
-    outPtr += outIncZ;
-    inPtr += inIncZ;
   }
+  return true;
 }
 
 int vtkImageGradient::RequestData(
@@ -312,15 +245,9 @@ void vtkImageGradient::ThreadedRequestData(vtkInformation*, vtkInformationVector
     return;
   }
 
-  void* inPtr = inputArray->GetVoidPointer(0);
-  double* outPtr = static_cast<double*>(output->GetScalarPointerForExtent(outExt));
-  switch (inputArray->GetDataType())
+  if (!vtkImageGradientExecute(this, input, inputArray, output, outExt, threadId))
   {
-    vtkTemplateMacro(vtkImageGradientExecute(
-      this, input, static_cast<VTK_TT*>(inPtr), output, outPtr, outExt, threadId));
-    default:
-      vtkErrorMacro("Execute: Unknown ScalarType " << input->GetScalarType());
-      return;
+    vtkErrorMacro("Execute: Unknown ScalarType " << inputArray->GetDataType());
   }
 }
 VTK_ABI_NAMESPACE_END
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkImageRankFilter.h"
+
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkImageRankKernels.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkImageRankFilter);
+
+//------------------------------------------------------------------------------
+// Construct an instance of vtkImageRankFilter filter.
+vtkImageRankFilter::vtkImageRankFilter()
+{
+  this->Rank = 0.5;
+  this->SetKernelSize(1, 1, 1);
+  this->HandleBoundaries = 1;
+}
+
+//------------------------------------------------------------------------------
+vtkImageRankFilter::~vtkImageRankFilter() = default;
+
+//------------------------------------------------------------------------------
+void vtkImageRankFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Rank: " << this->Rank << endl;
+}
+
+//------------------------------------------------------------------------------
+// This method sets the size of the neighborhood.  It also sets the
+// default middle of the neighborhood.
+void vtkImageRankFilter::SetKernelSize(int size0, int size1, int size2)
+{
+  if (this->KernelSize[0] == size0 && this->KernelSize[1] == size1 && this->KernelSize[2] == size2)
+  {
+    return;
+  }
+
+  this->KernelSize[0] = size0;
+  this->KernelMiddle[0] = size0 / 2;
+  this->KernelSize[1] = size1;
+  this->KernelMiddle[1] = size1 / 2;
+  this->KernelSize[2] = size2;
+  this->KernelMiddle[2] = size2 / 2;
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkImageRankFilter::ThreadedRequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* vtkNotUsed(outputVector),
+  vtkImageData*** inData, vtkImageData** outData, int outExt[6], int id)
+{
+  vtkDataArray* inArray = this->GetInputArrayToProcess(0, inputVector);
+  if (!inArray)
+  {
+    return;
+  }
+  if (id == 0)
+  {
+    outData[0]->GetPointData()->GetScalars()->SetName(inArray->GetName());
+  }
+
+  // this filter expects that input is the same type as output.
+  if (inArray->GetDataType() != outData[0]->GetScalarType())
+  {
+    vtkErrorMacro(<< "Execute: input data type, " << inArray->GetDataType()
+                  << ", must match out ScalarType " << outData[0]->GetScalarType());
+    return;
+  }
+
+  // vtkImageRankKernels reports its errors
+  vtkImageRankKernels::Execute(this->Rank, this->KernelSize, this->KernelMiddle, nullptr,
+    inData[0][0], inArray, outData[0], outExt, this, id);
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkImageRankFilter
+ * @brief   Rank filter: minimum, median, maximum or any percentile.
+ *
+ * vtkImageRankFilter replaces each pixel with the value of a given rank
+ * among the values of a rectangular neighborhood around that pixel. The
+ * rank is a fraction, 0 giving the minimum, 0.5 the median and 1 the
+ * maximum. Unlike vtkImageMedian3D, the two middle values of neighborhoods
+ * with an even number of pixels are not averaged: the value that is output
+ * is always one of the values of the neighborhood.
+ *
+ * For 8-bit and 16-bit scalars, a histogram of the neighborhood slides along
+ * each row of the image, so that large kernels, such as 7x7x7 or more, are
+ * much faster than with vtkImageMedian3D.
+ *
+ * @sa
+ * vtkImageMedian3D vtkImageRankKernels
+ */
+
+#ifndef vtkImageRankFilter_h
+#define vtkImageRankFilter_h
+
+#include "vtkImageSpatialAlgorithm.h"
+#include "vtkImagingGeneralModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKIMAGINGGENERAL_EXPORT vtkImageRankFilter : public vtkImageSpatialAlgorithm
+{
+public:
+  static vtkImageRankFilter* New();
+  vtkTypeMacro(vtkImageRankFilter, vtkImageSpatialAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * This method sets the size of the neighborhood.  It also sets the
+   * default middle of the neighborhood.
+   */
+  void SetKernelSize(int size0, int size1, int size2);
+
+  ///@{
+  /**
+   * The rank of the value that is output, as a fraction between 0 and 1.
+   * Among the n sorted values of a neighborhood, the value at index
+   * rank * (n - 1), rounded, is output. The default is 0.5, the median.
+   */
+  vtkSetClampMacro(Rank, double, 0.0, 1.0);
+  vtkGetMacro(Rank, double);
+  void SetRankToMinimum() { this->SetRank(0.0); }
+  void SetRankToMedian() { this->SetRank(0.5); }
+  void SetRankToMaximum() { this->SetRank(1.0); }
+  ///@}
+
+protected:
+  vtkImageRankFilter();
+  ~vtkImageRankFilter() override;
+
+  double Rank;
+
+  void ThreadedRequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector, vtkImageData*** inData, vtkImageData** outData,
+    int outExt[6], int id) override;
+
+private:
+  vtkImageRankFilter(const vtkImageRankFilter&) = delete;
+  void operator=(const vtkImageRankFilter&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,405 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkImageRankKernels.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+
+namespace
+{
+//------------------------------------------------------------------------------
+// A run of the neighborhood along X, as offsets from the output point.
+struct vtkImageRankKernelsRun
+{
+  int Y;
+  int Z;
+  int X0;
+  int X1;
+};
+
+//------------------------------------------------------------------------------
+// Split the kernel, or the nonzero points of its mask, into runs along X.
+std::vector<vtkImageRankKernelsRun> vtkImageRankKernelsMakeRuns(
+  const int kernelSize[3], const int kernelMiddle[3], const unsigned char* mask)
+{
+  std::vector<vtkImageRankKernelsRun> runs;
+  for (int k = 0; k < kernelSize[2]; ++k)
+  {
+    for (int j = 0; j < kernelSize[1]; ++j)
+    {
+      const unsigned char* row = (mask ? mask + (k * kernelSize[1] + j) * kernelSize[0] : nullptr);
+      int i = 0;
+      while (i < kernelSize[0])
+      {
+        if (row && !row[i])
+        {
+          ++i;
+          continue;
+        }
+        int i1 = i;
+        while (i1 + 1 < kernelSize[0] && (!row || row[i1 + 1]))
+        {
+          ++i1;
+        }
+        vtkImageRankKernelsRun run = { j - kernelMiddle[1], k - kernelMiddle[2],
+          i - kernelMiddle[0], i1 - kernelMiddle[0] };
+        runs.push_back(run);
+        i = i1 + 1;
+      }
+    }
+  }
+  return runs;
+}
+
+//------------------------------------------------------------------------------
+// The index, among n sorted values, of the value with the given rank.
+vtkIdType vtkImageRankKernelsIndex(double rank, vtkIdType n)
+{
+  vtkIdType k = static_cast<vtkIdType>(rank * (n - 1) + 0.5);
+  return std::min(std::max(k, static_cast<vtkIdType>(0)), n - 1);
+}
+
+//------------------------------------------------------------------------------
+// A histogram with one bin per value, and coarse bins that count the values
+// of 2^Shift fine bins. It tracks the bin of the last rank that was found,
+// and the number of values below it, so that the next rank is found by
+// walking from there, skipping the coarse bins that are not crossed.
+class vtkImageRankKernelsHistogram
+{
+public:
+  vtkImageRankKernelsHistogram(int bits)
+    : Fine(static_cast<size_t>(1) << bits, 0)
+    , Coarse(static_cast<size_t>(1) << (bits - bits / 2), 0)
+    , Shift(bits / 2)
+    , Position(0)
+    , Below(0)
+    , Count(0)
+  {
+  }
+
+  void Add(int bin)
+  {
+    ++this->Fine[bin];
+    ++this->Coarse[bin >> this->Shift];
+    ++this->Count;
+    this->Below += (bin < this->Position);
+  }
+
+  void Remove(int bin)
+  {
+    --this->Fine[bin];
+    --this->Coarse[bin >> this->Shift];
+    --this->Count;
+    this->Below -= (bin < this->Position);
+  }
+
+  vtkIdType GetCount() const { return this->Count; }
+
+  // Find the bin of the value at index k among the sorted values.
+  int Find(vtkIdType k)
+  {
+    const int coarseMask = (1 << this->Shift) - 1;
+    int p = this->Position;
+    vtkIdType below = this->Below;
+    while (below > k)
+    {
+      if ((p & coarseMask) == 0 && below - this->Coarse[(p >> this->Shift) - 1] > k)
+      {
+        p -= coarseMask + 1;
+        below -= this->Coarse[p >> this->Shift];
+      }
+      else
+      {
+        below -= this->Fine[--p];
+      }
+    }
+    while (below + this->Fine[p] <= k)
+    {
+      if ((p & coarseMask) == 0 && below + this->Coarse[p >> this->Shift] <= k)
+      {
+        below += this->Coarse[p >> this->Shift];
+        p += coarseMask + 1;
+      }
+      else
+      {
+        below += this->Fine[p++];
+      }
+    }
+    this->Position = p;
+    this->Below = below;
+    return p;
+  }
+
+private:
+  std::vector<int> Fine;
+  std::vector<int> Coarse;
+  int Shift;
+  int Position;
+  vtkIdType Below;
+  vtkIdType Count;
+};
+
+//------------------------------------------------------------------------------
+// The rows of the input that the runs cover for one row of the output.
+template <class T>
+struct vtkImageRankKernelsRow
+{
+  const T* Ptr; // the input point at the lower X bound of the input extent
+  int X0;
+  int X1;
+};
+
+//------------------------------------------------------------------------------
+// Slide a histogram along a row, for 8-bit and 16-bit integers.
+template <class T>
+void vtkImageRankKernelsSlide(vtkImageRankKernelsHistogram& hist,
+  const std::vector<vtkImageRankKernelsRow<T>>& rows, double rank, int inMin, int inMax,
+  vtkIdType inInc, const T* inPtr, int outMin, int outMax, T* outPtr, vtkIdType outInc)
+{
+  const int offset = static_cast<int>(std::numeric_limits<T>::min());
+
+  // Fill the histogram with the neighborhood of the first point
+  for (const auto& row : rows)
+  {
+    int x0 = std::max(outMin + row.X0, inMin);
+    int x1 = std::min(outMin + row.X1, inMax);
+    for (int x = x0; x <= x1; ++x)
+    {
+      hist.Add(static_cast<int>(row.Ptr[(x - inMin) * inInc]) - offset);
+    }
+  }
+
+  for (int x = outMin; x <= outMax; ++x)
+  {
+    vtkIdType n = hist.GetCount();
+    *outPtr = (n > 0 ? static_cast<T>(hist.Find(vtkImageRankKernelsIndex(rank, n)) + offset)
+                     : inPtr[(x - inMin) * inInc]);
+    outPtr += outInc;
+
+    // Move the neighborhood to the next point
+    for (const auto& row : rows)
+    {
+      int xr = x + row.X0;
+      if (xr >= inMin && xr <= inMax)
+      {
+        hist.Remove(static_cast<int>(row.Ptr[(xr - inMin) * inInc]) - offset);
+      }
+      int xa = x + 1 + row.X1;
+      if (xa >= inMin && xa <= inMax)
+      {
+        hist.Add(static_cast<int>(row.Ptr[(xa - inMin) * inInc]) - offset);
+      }
+    }
+  }
+
+  // Empty the histogram for the next row
+  for (const auto& row : rows)
+  {
+    int x0 = std::max(outMax + 1 + row.X0, inMin);
+    int x1 = std::min(outMax + 1 + row.X1, inMax);
+    for (int x = x0; x <= x1; ++x)
+    {
+      hist.Remove(static_cast<int>(row.Ptr[(x - inMin) * inInc]) - offset);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Gather and partially sort each neighborhood of a row, for the other types.
+template <class T>
+void vtkImageRankKernelsSelect(std::vector<T>& values,
+  const std::vector<vtkImageRankKernelsRow<T>>& rows, double rank, int inMin, int inMax,
+  vtkIdType inInc, const T* inPtr, int outMin, int outMax, T* outPtr, vtkIdType outInc)
+{
+  for (int x = outMin; x <= outMax; ++x)
+  {
+    values.clear();
+    for (const auto& row : rows)
+    {
+      int x0 = std::max(x + row.X0, inMin);
+      int x1 = std::min(x + row.X1, inMax);
+      for (int xx = x0; xx <= x1; ++xx)
+      {
+        values.push_back(row.Ptr[(xx - inMin) * inInc]);
+      }
+    }
+    vtkIdType n = static_cast<vtkIdType>(values.size());
+    if (n == 0)
+    {
+      *outPtr = inPtr[(x - inMin) * inInc];
+    }
+    else
+    {
+      vtkIdType k = vtkImageRankKernelsIndex(rank, n);
+      if (k == 0)
+      {
+        *outPtr = *std::min_element(values.begin(), values.end());
+      }
+      else if (k == n - 1)
+      {
+        *outPtr = *std::max_element(values.begin(), values.end());
+      }
+      else
+      {
+        std::nth_element(values.begin(), values.begin() + k, values.end());
+        *outPtr = values[k];
+      }
+    }
+    outPtr += outInc;
+  }
+}
+
+//------------------------------------------------------------------------------
+template <class T>
+void vtkImageRankKernelsExecute(double rank, const std::vector<vtkImageRankKernelsRun>& runs,
+  vtkImageData* inData, vtkDataArray* inArray, const T* inPtr, vtkImageData* outData,
+  const int outExt[6], T* outPtr, vtkAlgorithm* self, int threadId)
+{
+  const bool useHistogram = std::is_integral<T>::value && sizeof(T) <= 2;
+  const int* inExt = inData->GetExtent();
+  vtkIdType inInc[3];
+  inData->GetIncrements(inArray, inInc);
+  vtkIdType outInc[3];
+  outData->GetIncrements(outInc);
+  int numComps = inArray->GetNumberOfComponents();
+
+  vtkImageRankKernelsHistogram hist(useHistogram ? 8 * static_cast<int>(sizeof(T)) : 0);
+  std::vector<T> values;
+  std::vector<vtkImageRankKernelsRow<T>> rows;
+  rows.reserve(runs.size());
+
+  unsigned long count = 0;
+  unsigned long target = static_cast<unsigned long>(
+    numComps * (outExt[5] - outExt[4] + 1) * (outExt[3] - outExt[2] + 1) / 50.0);
+  target++;
+
+  for (int c = 0; c < numComps; ++c)
+  {
+    for (int z = outExt[4]; z <= outExt[5]; ++z)
+    {
+      for (int y = outExt[2]; y <= outExt[3]; ++y)
+      {
+        if (self)
+        {
+          if (self->AbortExecute)
+          {
+            return;
+          }
+          if (!threadId)
+          {
+            if (!(count % target))
+            {
+              self->UpdateProgress(count / (50.0 * target));
+            }
+            count++;
+          }
+        }
+
+        // The runs whose rows are within the input
+        rows.clear();
+        for (const auto& run : runs)
+        {
+          int yy = y + run.Y;
+          int zz = z + run.Z;
+          if (yy >= inExt[2] && yy <= inExt[3] && zz >= inExt[4] && zz <= inExt[5])
+          {
+            vtkImageRankKernelsRow<T> row = { inPtr + c + (yy - inExt[2]) * inInc[1] +
+                (zz - inExt[4]) * inInc[2],
+              run.X0, run.X1 };
+            rows.push_back(row);
+          }
+        }
+
+        const T* inRow = inPtr + c + (y - inExt[2]) * inInc[1] + (z - inExt[4]) * inInc[2];
+        T* outRow = outPtr + c + (y - outExt[2]) * outInc[1] + (z - outExt[4]) * outInc[2];
+        if (useHistogram)
+        {
+          vtkImageRankKernelsSlide(hist, rows, rank, inExt[0], inExt[1], inInc[0], inRow,
+            outExt[0], outExt[1], outRow, outInc[0]);
+        }
+        else
+        {
+          vtkImageRankKernelsSelect(values, rows, rank, inExt[0], inExt[1], inInc[0], inRow,
+            outExt[0], outExt[1], outRow, outInc[0]);
+        }
+      }
+    }
+  }
+}
+} // end anonymous namespace
+
+//------------------------------------------------------------------------------
+bool vtkImageRankKernels::Execute(double rank, const int kernelSize[3], const int kernelMiddle[3],
+  const unsigned char* mask, vtkImageData* inData, vtkDataArray* inArray, vtkImageData* outData,
+  const int outExt[6], vtkAlgorithm* self, int threadId)
+{
+  if (!inData || !inArray || !outData)
+  {
+    vtkErrorWithObjectMacro(self, << "Execute: missing input or output data");
+    return false;
+  }
+  if (!(rank >= 0.0 && rank <= 1.0))
+  {
+    vtkErrorWithObjectMacro(self, << "Execute: rank " << rank << " is not between 0 and 1");
+    return false;
+  }
+  if (inArray->GetDataType() != outData->GetScalarType() ||
+    inArray->GetNumberOfComponents() != outData->GetNumberOfScalarComponents())
+  {
+    vtkErrorWithObjectMacro(self, << "Execute: output scalars of type "
+                                  << outData->GetScalarTypeAsString() << " with "
+                                  << outData->GetNumberOfScalarComponents()
+                                  << " components do not match the input array of type "
+                                  << inArray->GetDataTypeAsString() << " with "
+                                  << inArray->GetNumberOfComponents() << " components");
+    return false;
+  }
+  const int* inExt = inData->GetExtent();
+  for (int i = 0; i < 3; ++i)
+  {
+    if (kernelSize[i] < 1)
+    {
+      vtkErrorWithObjectMacro(self, << "Execute: kernel size " << kernelSize[i] << " along axis "
+                                    << i << " is not positive");
+      return false;
+    }
+    if (outExt[2 * i] > outExt[2 * i + 1])
+    {
+      return true; // nothing to do
+    }
+    if (outExt[2 * i] < inExt[2 * i] || outExt[2 * i + 1] > inExt[2 * i + 1])
+    {
+      vtkErrorWithObjectMacro(self, << "Execute: output extent along axis " << i << ", "
+                                    << outExt[2 * i] << " to " << outExt[2 * i + 1]
+                                    << ", is not within the input extent " << inExt[2 * i]
+                                    << " to " << inExt[2 * i + 1]);
+      return false;
+    }
+  }
+
+  std::vector<vtkImageRankKernelsRun> runs =
+    vtkImageRankKernelsMakeRuns(kernelSize, kernelMiddle, mask);
+  void* inPtr = inArray->GetVoidPointer(0);
+  void* outPtr = outData->GetScalarPointerForExtent(const_cast<int*>(outExt));
+  switch (inArray->GetDataType())
+  {
+    vtkTemplateMacro(vtkImageRankKernelsExecute(rank, runs, inData, inArray,
+      static_cast<const VTK_TT*>(inPtr), outData, outExt, static_cast<VTK_TT*>(outPtr), self,
+      threadId));
+    default:
+      vtkErrorWithObjectMacro(
+        self, << "Execute: unknown scalar type " << inArray->GetDataTypeAsString());
+      return false;
+  }
+  return true;
+}
+
+VTK_ABI_NAMESPACE_END
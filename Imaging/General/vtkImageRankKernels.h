@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkImageRankKernels
+ * @brief   shared rank (order statistic) kernel for neighborhood filters
+ *
+ * vtkImageRankKernels replaces each point of an image region with the value
+ * of a given rank among the points of its neighborhood: the minimum, the
+ * median, the maximum or any percentile in between. It is the engine of
+ * vtkImageRankFilter, vtkImageContinuousDilate3D and
+ * vtkImageContinuousErode3D.
+ *
+ * The neighborhood is stored as runs of points along X. For 8-bit and 16-bit
+ * scalars, a histogram of the neighborhood slides along each row: moving to
+ * the next point adds and removes one point per run, and the rank is found by
+ * walking a two-level histogram from the rank of the previous point. The cost
+ * per point grows with the number of runs, that is with the area of the
+ * kernel across X, instead of its volume. For the other scalar types, the
+ * values of each neighborhood are gathered and partially sorted.
+ *
+ * All the methods are thread safe.
+ *
+ * @sa
+ * vtkImageRankFilter vtkImageContinuousDilate3D vtkImageContinuousErode3D
+ */
+
+#ifndef vtkImageRankKernels_h
+#define vtkImageRankKernels_h
+
+#include "vtkImagingGeneralModule.h" // For export macro
+#include "vtkSystemIncludes.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkAlgorithm;
+class vtkDataArray;
+class vtkImageData;
+
+class VTKIMAGINGGENERAL_EXPORT vtkImageRankKernels
+{
+public:
+  /**
+   * Compute the region outExt of outData from the array inArray of inData.
+   * The rank is a fraction between 0 (the minimum) and 1 (the maximum), the
+   * value that is output being the one at index rank * (n - 1), rounded,
+   * among the n sorted values of the neighborhood. The neighborhood is the
+   * box of kernelSize points with the output point at kernelMiddle, clipped
+   * to the extent of inData. If a mask is given, it has kernelSize points
+   * with X varying fastest, and only the points where it is nonzero are in
+   * the neighborhood. Each component is processed separately. The output
+   * type must be the input type. If self is given, the thread with the
+   * threadId 0 reports progress to it, and all threads stop when it aborts.
+   * Return false if the parameters are not supported, after reporting why
+   * as an error of self.
+   */
+  static bool Execute(double rank, const int kernelSize[3], const int kernelMiddle[3],
+    const unsigned char* mask, vtkImageData* inData, vtkDataArray* inArray, vtkImageData* outData,
+    const int outExt[6], vtkAlgorithm* self, int threadId);
+
+protected:
+  vtkImageRankKernels() = default;
+  ~vtkImageRankKernels() = default;
+
+private:
+  vtkImageRankKernels(const vtkImageRankKernels&) = delete;
+  void operator=(const vtkImageRankKernels&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkImageRankKernels.h
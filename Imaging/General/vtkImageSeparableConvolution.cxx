@@ -4,75 +4,20 @@
 
 #include "vtkFloatArray.h"
 #include "vtkImageData.h"
+#include "vtkImageSeparableKernels.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageSeparableConvolution);
 vtkCxxSetObjectMacro(vtkImageSeparableConvolution, XKernel, vtkFloatArray);
 vtkCxxSetObjectMacro(vtkImageSeparableConvolution, YKernel, vtkFloatArray);
 vtkCxxSetObjectMacro(vtkImageSeparableConvolution, ZKernel, vtkFloatArray);
 
-// Actually do the convolution
-static void ExecuteConvolve(
-  float* kernel, int kernelSize, float* image, float* outImage, int imageSize)
-{
-
-  // Consider the kernel to be centered at (int) ( (kernelSize - 1 ) / 2.0 )
-
-  int center = static_cast<int>((kernelSize - 1) / 2.0);
-  int i, j, k, kStart, iStart, iEnd, count;
-
-  for (i = 0; i < imageSize; ++i)
-  {
-    outImage[i] = 0.0;
-
-    //    iStart = i - center;
-    //    if ( iStart < 0 )
-    //      {
-    //      iStart = 0;
-    //      }
-
-    //    iEnd = i + center;
-    //    if ( iEnd > imageSize - 1 )
-    //      {
-    //      iEnd = imageSize - 1;
-    //      }
-
-    // Handle padding
-    iStart = i - center;
-    k = kernelSize - 1;
-    while (iStart < 0)
-    {
-      outImage[i] += image[0] * kernel[k];
-      ++iStart;
-      --k;
-    }
-
-    iEnd = i + center;
-    k = 0;
-    while (iEnd > imageSize - 1)
-    {
-      outImage[i] += image[imageSize - 1] * kernel[k];
-      ++k;
-      --iEnd;
-    }
-
-    kStart = center + i;
-    if (kStart > kernelSize - 1)
-    {
-      kStart = kernelSize - 1;
-    }
-    count = iEnd - iStart + 1;
-    for (j = 0; j < count; ++j)
-    {
-      outImage[i] += image[j + iStart] * kernel[kStart - j];
-    }
-  }
-}
-
 // Description:
 // Overload standard modified time function. If kernel arrays are modified,
 // then this object is modified as well.
@@ -182,39 +127,13 @@ int vtkImageSeparableConvolution::IterativeRequestUpdateExtent(
   return 1;
 }
 
-template <class T>
-void vtkImageSeparableConvolutionExecute(vtkImageSeparableConvolution* self, vtkImageData* inData,
-  vtkImageData* outData, T* vtkNotUsed(dummy), int* inExt, int* outExt)
+//------------------------------------------------------------------------------
+// Convolve along the axis of the current iteration. The samples beyond the
+// input extent are replicated from its edges.
+static bool vtkImageSeparableConvolutionExecute(
+  vtkImageSeparableConvolution* self, vtkImageData* inData, vtkImageData* outData, int* inExt,
+  int* outExt)
 {
-  T *inPtr0, *inPtr1, *inPtr2;
-  float *outPtr0, *outPtr1, *outPtr2;
-  vtkIdType inInc0, inInc1, inInc2;
-  vtkIdType outInc0, outInc1, outInc2;
-  int inMin0, inMax0, inMin1, inMax1, inMin2, inMax2;
-  int outMin0, outMax0, outMin1, outMax1, outMin2, outMax2;
-  int idx0, idx1, idx2;
-  int i;
-  unsigned long count = 0;
-  unsigned long target;
-
-  // Reorder axes (the in and out extents are assumed to be the same)
-  // (see intercept cache update)
-  self->PermuteExtent(outExt, outMin0, outMax0, outMin1, outMax1, outMin2, outMax2);
-  self->PermuteExtent(inExt, inMin0, inMax0, inMin1, inMax1, inMin2, inMax2);
-
-  // Compute the increments into a local array as `GetIncrements()` introduces
-  // a data race on `vtkImageData::Increments`.
-  vtkIdType inIncrements[3];
-  vtkIdType outIncrements[3];
-  inData->GetIncrements(inIncrements);
-  outData->GetIncrements(outIncrements);
-
-  self->PermuteIncrements(inIncrements, inInc0, inInc1, inInc2);
-  self->PermuteIncrements(outIncrements, outInc0, outInc1, outInc2);
-
-  target = static_cast<unsigned long>((inMax2 - inMin2 + 1) * (inMax1 - inMin1 + 1) / 50.0);
-  target++;
-
   vtkFloatArray* KernelArray = nullptr;
   switch (self->GetIteration())
   {
@@ -228,80 +147,30 @@ void vtkImageSeparableConvolutionExecute(vtkImageSeparableConvolution* self, vtk
       KernelArray = self->GetZKernel();
       break;
   }
-  int kernelSize = 0;
-  float* kernel = nullptr;
-
-  if (KernelArray)
-  {
-    // Allocate the arrays
-    kernelSize = KernelArray->GetNumberOfTuples();
-    kernel = new float[kernelSize];
-    // Copy the kernel
-    for (i = 0; i < kernelSize; i++)
-    {
-      kernel[i] = KernelArray->GetValue(i);
-    }
-  }
 
-  int imageSize = inMax0 + 1;
-  float* image = new float[imageSize];
-  float* outImage = new float[imageSize];
-  float* imagePtr;
-
-  // loop over all the extra axes
-  inPtr2 = static_cast<T*>(inData->GetScalarPointerForExtent(inExt));
-  outPtr2 = static_cast<float*>(outData->GetScalarPointerForExtent(outExt));
-  for (idx2 = inMin2; idx2 <= inMax2; ++idx2)
+  // ConvolveAxis() computes a correlation, so the kernel is reversed.
+  // If we don't have a kernel, the input is just copied to the output.
+  std::vector<double> kernel(1, 1.0);
+  if (KernelArray && KernelArray->GetNumberOfTuples() > 0)
   {
-    inPtr1 = inPtr2;
-    outPtr1 = outPtr2;
-    for (idx1 = inMin1; !self->AbortExecute && idx1 <= inMax1; ++idx1)
+    int kernelSize = static_cast<int>(KernelArray->GetNumberOfTuples());
+    kernel.resize(kernelSize);
+    for (int i = 0; i < kernelSize; i++)
     {
-      if (!(count % target))
-      {
-        self->UpdateProgress(count / (50.0 * target));
-      }
-      count++;
-      inPtr0 = inPtr1;
-      imagePtr = image;
-      for (idx0 = inMin0; idx0 <= inMax0; ++idx0)
-      {
-        *imagePtr = static_cast<float>(*inPtr0);
-        inPtr0 += inInc0;
-        ++imagePtr;
-      }
-
-      // Call the method that performs the convolution
-      if (kernel)
-      {
-        ExecuteConvolve(kernel, kernelSize, image, outImage, imageSize);
-        imagePtr = outImage;
-      }
-      else
-      {
-        // If we don't have a kernel, just copy to the output
-        imagePtr = image;
-      }
-
-      // Copy to output, be aware that we only copy to the extent that was asked for
-      outPtr0 = outPtr1;
-      imagePtr = imagePtr + (outMin0 - inMin0);
-      for (idx0 = outMin0; idx0 <= outMax0; ++idx0)
-      {
-        *outPtr0 = (*imagePtr);
-        outPtr0 += outInc0;
-        ++imagePtr;
-      }
-      inPtr1 += inInc1;
-      outPtr1 += outInc1;
+      kernel[i] = KernelArray->GetValue(kernelSize - 1 - i);
     }
-    inPtr2 += inInc2;
-    outPtr2 += outInc2;
   }
 
-  delete[] image;
-  delete[] outImage;
-  delete[] kernel;
+  vtkIdType inIncs[3], outIncs[3];
+  inData->GetIncrements(inIncs);
+  outData->GetIncrements(outIncs);
+  self->UpdateProgress(0.0);
+  bool valid = vtkImageSeparableKernels::ConvolveAxis(self->GetIteration(), kernel.data(),
+    static_cast<int>(kernel.size()), vtkImageSeparableKernels::Clamp,
+    inData->GetScalarPointerForExtent(inExt), inData->GetScalarType(), inExt, inIncs,
+    outData->GetScalarPointerForExtent(outExt), VTK_FLOAT, outExt, outIncs, 1);
+  self->UpdateProgress(1.0);
+  return valid;
 }
 
 //------------------------------------------------------------------------------
@@ -358,15 +227,12 @@ int vtkImageSeparableConvolution::IterativeRequestData(vtkInformation* vtkNotUse
     return 1;
   }
 
-  // choose which templated function to call.
-  switch (inData->GetScalarType())
+  if (!vtkImageSeparableConvolutionExecute(this, inData, outData,
+        inInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT()),
+        outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT())))
   {
-    vtkTemplateMacro(vtkImageSeparableConvolutionExecute(this, inData, outData,
-      static_cast<VTK_TT*>(nullptr), inInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT()),
-      outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT())));
-    default:
-      vtkErrorMacro(<< "Execute: Unknown ScalarType");
-      return 1;
+    vtkErrorMacro(<< "Execute: Unknown ScalarType");
+    return 1;
   }
 
   return 1;
@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that ParallelLabeling of vtkImageConnectivityFilter gives the same
+// output as the flood fill, for all the extraction and label modes.
+
+#include "vtkDataArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageConnectivityFilter.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <iostream>
+
+namespace
+{
+bool SameArrays(const char* name, vtkDataArray* a, vtkDataArray* b)
+{
+  if (a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents())
+  {
+    std::cerr << name << ": " << a->GetNumberOfTuples() << " tuples instead of "
+              << b->GetNumberOfTuples() << std::endl;
+    return false;
+  }
+  const int numComp = a->GetNumberOfComponents();
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetComponent(i / numComp, i % numComp) != b->GetComponent(i / numComp, i % numComp))
+    {
+      std::cerr << name << ": value " << i << " differs" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Run the filter with and without ParallelLabeling and compare the results.
+bool Compare(vtkImageConnectivityFilter* serial, vtkImageConnectivityFilter* parallel,
+  const int* updateExtent)
+{
+  serial->ParallelLabelingOff();
+  parallel->ParallelLabelingOn();
+  vtkImageConnectivityFilter* filters[2] = { serial, parallel };
+  for (vtkImageConnectivityFilter* filter : filters)
+  {
+    if (updateExtent)
+    {
+      filter->UpdateExtent(updateExtent);
+    }
+    else
+    {
+      filter->Update();
+    }
+  }
+  if (serial->GetNumberOfExtractedRegions() != parallel->GetNumberOfExtractedRegions())
+  {
+    std::cerr << "Extracted " << parallel->GetNumberOfExtractedRegions() << " regions instead of "
+              << serial->GetNumberOfExtractedRegions() << std::endl;
+    return false;
+  }
+  if (!SameArrays("Labels", parallel->GetOutput()->GetPointData()->GetScalars(),
+        serial->GetOutput()->GetPointData()->GetScalars()) ||
+    !SameArrays("RegionLabels", parallel->GetExtractedRegionLabels(),
+      serial->GetExtractedRegionLabels()) ||
+    !SameArrays(
+      "RegionSizes", parallel->GetExtractedRegionSizes(), serial->GetExtractedRegionSizes()) ||
+    !SameArrays("RegionSeedIds", parallel->GetExtractedRegionSeedIds(),
+      serial->GetExtractedRegionSeedIds()) ||
+    !SameArrays("RegionExtents", parallel->GetExtractedRegionExtents(),
+      serial->GetExtractedRegionExtents()))
+  {
+    return false;
+  }
+  return true;
+}
+}
+
+int TestImageConnectivityFilterParallel(int, char*[])
+{
+  // A random image with many regions of all sizes
+  vtkNew<vtkImageData> image;
+  image->SetExtent(-3, 60, 2, 50, 0, 20);
+  image->AllocateScalars(VTK_SHORT, 1);
+  short* ptr = static_cast<short*>(image->GetScalarPointer());
+  vtkMath::RandomSeed(1234);
+  for (vtkIdType i = 0; i < image->GetNumberOfPoints(); ++i)
+  {
+    ptr[i] = static_cast<short>(vtkMath::Random(0.0, 100.0));
+  }
+
+  vtkNew<vtkPoints> seedPoints;
+  seedPoints->InsertNextPoint(10.0, 10.0, 5.0);
+  seedPoints->InsertNextPoint(30.0, 20.0, 10.0);
+  seedPoints->InsertNextPoint(31.0, 20.0, 10.0);
+  seedPoints->InsertNextPoint(-2.0, 49.0, 19.0);
+  seedPoints->InsertNextPoint(100.0, 0.0, 0.0);
+  vtkNew<vtkUnsignedCharArray> seedScalars;
+  seedScalars->InsertNextValue(2);
+  seedScalars->InsertNextValue(5);
+  seedScalars->InsertNextValue(7);
+  seedScalars->InsertNextValue(0);
+  seedScalars->InsertNextValue(9);
+  vtkNew<vtkPolyData> seedData;
+  seedData->SetPoints(seedPoints);
+  seedData->GetPointData()->SetScalars(seedScalars);
+
+  const int subExtent[6] = { 0, 40, 10, 30, 5, 5 };
+  for (int i = 0; i < 10; i++)
+  {
+    vtkNew<vtkImageConnectivityFilter> filters[2];
+    for (vtkImageConnectivityFilter* filter : filters)
+    {
+      filter->SetInputData(image);
+      filter->SetScalarRange(40, 100);
+      filter->GenerateRegionExtentsOn();
+      if (i == 1)
+      {
+        // Many regions, some are pruned to fit in unsigned char labels
+        filter->SetScalarRange(70, 100);
+      }
+      else if (i == 2)
+      {
+        filter->SetExtractionModeToLargestRegion();
+      }
+      else if (i == 3)
+      {
+        filter->SetSizeRange(2, 10);
+        filter->SetLabelModeToSizeRank();
+        filter->SetLabelScalarTypeToInt();
+      }
+      else if (i == 4)
+      {
+        filter->SetSeedData(seedData);
+      }
+      else if (i == 5)
+      {
+        filter->SetSeedData(seedData);
+        filter->SetExtractionModeToAllRegions();
+        filter->SetLabelModeToSizeRank();
+        filter->SetLabelScalarTypeToUnsignedShort();
+      }
+      else if (i == 6)
+      {
+        filter->SetSeedData(seedData);
+        filter->SetExtractionModeToLargestRegion();
+        filter->GenerateRegionExtentsOff();
+      }
+      else if (i == 7)
+      {
+        filter->SetScalarRange(70, 100);
+        filter->SetLabelModeToConstantValue();
+        filter->SetLabelConstantValue(3);
+        filter->GenerateRegionExtentsOff();
+      }
+      else if (i == 8)
+      {
+        filter->SetScalarRange(70, 100);
+        filter->SetExtractionModeToLargestRegion();
+      }
+    }
+    if (!Compare(filters[0], filters[1], i == 9 ? subExtent : nullptr))
+    {
+      std::cerr << "Test case " << i << " failed" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compare vtkImageContinuousDilate3D and vtkImageContinuousErode3D with a
+// brute force maximum and minimum over the ellipsoidal neighborhoods.
+
+#include "vtkDataArray.h"
+#include "vtkImageContinuousDilate3D.h"
+#include "vtkImageContinuousErode3D.h"
+#include "vtkImageData.h"
+#include "vtkImageEllipsoidSource.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+// The maximum (or minimum) of the neighborhood of a point, where the mask
+// is nonzero.
+double BruteForce(vtkImageData* image, vtkImageData* mask, const int kernelSize[3], bool dilate,
+  int x, int y, int z, int comp)
+{
+  const int* extent = image->GetExtent();
+  double result = image->GetScalarComponentAsDouble(x, y, z, comp);
+  for (int k = 0; k < kernelSize[2]; ++k)
+  {
+    for (int j = 0; j < kernelSize[1]; ++j)
+    {
+      for (int i = 0; i < kernelSize[0]; ++i)
+      {
+        int xx = x + i - kernelSize[0] / 2;
+        int yy = y + j - kernelSize[1] / 2;
+        int zz = z + k - kernelSize[2] / 2;
+        if (mask->GetScalarComponentAsDouble(i, j, k, 0) != 0.0 && xx >= extent[0] &&
+          xx <= extent[1] && yy >= extent[2] && yy <= extent[3] && zz >= extent[4] &&
+          zz <= extent[5])
+        {
+          double value = image->GetScalarComponentAsDouble(xx, yy, zz, comp);
+          result = (dilate ? std::max(result, value) : std::min(result, value));
+        }
+      }
+    }
+  }
+  return result;
+}
+
+bool TestDilateErode(int scalarType, int numComponents)
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(21, 18, 9);
+  image->AllocateScalars(scalarType, numComponents);
+  vtkDataArray* scalars = image->GetPointData()->GetScalars();
+  vtkMath::RandomSeed(1234);
+  for (vtkIdType i = 0; i < scalars->GetNumberOfValues(); ++i)
+  {
+    scalars->SetVariantValue(i, static_cast<int>(vtkMath::Random(-500.0, 500.0)));
+  }
+
+  const int kernelSize[3] = { 7, 6, 3 };
+  vtkNew<vtkImageEllipsoidSource> ellipse;
+  ellipse->SetWholeExtent(0, kernelSize[0] - 1, 0, kernelSize[1] - 1, 0, kernelSize[2] - 1);
+  ellipse->SetCenter(
+    (kernelSize[0] - 1) * 0.5, (kernelSize[1] - 1) * 0.5, (kernelSize[2] - 1) * 0.5);
+  ellipse->SetRadius(kernelSize[0] * 0.5, kernelSize[1] * 0.5, kernelSize[2] * 0.5);
+  ellipse->Update();
+  vtkImageData* mask = ellipse->GetOutput();
+
+  vtkNew<vtkImageContinuousDilate3D> dilate;
+  dilate->SetInputData(image);
+  dilate->SetKernelSize(kernelSize[0], kernelSize[1], kernelSize[2]);
+  dilate->Update();
+  vtkNew<vtkImageContinuousErode3D> erode;
+  erode->SetInputData(image);
+  erode->SetKernelSize(kernelSize[0], kernelSize[1], kernelSize[2]);
+  erode->Update();
+
+  const int* extent = image->GetExtent();
+  for (int z = extent[4]; z <= extent[5]; ++z)
+  {
+    for (int y = extent[2]; y <= extent[3]; ++y)
+    {
+      for (int x = extent[0]; x <= extent[1]; ++x)
+      {
+        for (int c = 0; c < numComponents; ++c)
+        {
+          const double maximum = BruteForce(image, mask, kernelSize, true, x, y, z, c);
+          const double minimum = BruteForce(image, mask, kernelSize, false, x, y, z, c);
+          if (dilate->GetOutput()->GetScalarComponentAsDouble(x, y, z, c) != maximum ||
+            erode->GetOutput()->GetScalarComponentAsDouble(x, y, z, c) != minimum)
+          {
+            std::cerr << image->GetScalarTypeAsString() << " at (" << x << ", " << y << ", " << z
+                      << "), component " << c << ": dilate "
+                      << dilate->GetOutput()->GetScalarComponentAsDouble(x, y, z, c)
+                      << " instead of " << maximum << ", erode "
+                      << erode->GetOutput()->GetScalarComponentAsDouble(x, y, z, c)
+                      << " instead of " << minimum << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestImageContinuousDilateErode(int, char*[])
+{
+  bool success = true;
+  success &= TestDilateErode(VTK_SHORT, 1);
+  success &= TestDilateErode(VTK_UNSIGNED_CHAR, 2);
+  success &= TestDilateErode(VTK_FLOAT, 1);
+  success &= TestDilateErode(VTK_DOUBLE, 2);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
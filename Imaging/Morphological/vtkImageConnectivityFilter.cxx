@@ -16,6 +16,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTemplateAliasMacro.h"
@@ -50,6 +51,8 @@ vtkImageConnectivityFilter::vtkImageConnectivityFilter()
 
   this->GenerateRegionExtents = 0;
 
+  this->ParallelLabeling = 0;
+
   this->ExtractedRegionLabels = vtkIdTypeArray::New();
   this->ExtractedRegionSizes = vtkIdTypeArray::New();
   this->ExtractedRegionSeedIds = vtkIdTypeArray::New();
@@ -223,6 +226,9 @@ protected:
   // A functor to assist in comparing region sizes.
   struct CompareSize;
 
+  // The runs of voxels of the regions, labeled by connectivity.
+  class Runs;
+
   // Remove all but the largest region from the output image.
   template <class OT>
   static void PruneAllButLargest(vtkImageData* outData, OT* outPtr, vtkImageStencilData* stencil,
@@ -245,11 +251,12 @@ protected:
   static vtkIdType Fill(OT* outPtr, vtkIdType outInc[3], int outLimits[6], unsigned char* maskPtr,
     int maxIdx[3], int fillExtent[6], std::stack<vtkICF::Seed>& seedStack);
 
-  // Add a region to the list of regions.
+  // Add a region to the list of regions.  If outData is nullptr, the
+  // output image is not modified, only the list of regions.
   template <class OT>
   static void AddRegion(vtkImageData* outData, OT* outPtr, vtkImageStencilData* stencil,
     int extent[6], vtkIdType sizeRange[2], vtkICF::RegionVector& regionInfo, vtkIdType voxelCount,
-    vtkIdType regionId, int regionExtent[6], int extractionMode);
+    vtkIdType regionId, int regionExtent[6], int extractionMode, vtkIdType component = -1);
 
   // Fill the ExtractedRegionSizes and ExtractedRegionLabels arrays.
   static void GenerateRegionArrays(vtkImageConnectivityFilter* self,
@@ -286,6 +293,12 @@ protected:
     vtkImageStencilData* stencil, OT* outPtr, unsigned char* maskPtr, int extent[6],
     vtkICF::RegionVector& regionInfo);
 
+  // Execute method for ParallelLabeling, with or without seeds.
+  template <class OT>
+  static void ParallelExecute(vtkImageConnectivityFilter* self, vtkImageData* outData,
+    vtkDataSet* seedData, vtkImageStencilData* stencil, OT* outPtr, unsigned char* maskPtr,
+    int extent[6], vtkICF::RegionVector& regionInfo);
+
 public:
   // Create a bit mask from the input
   template <class IT>
@@ -352,9 +365,10 @@ private:
 // region struct: size and id
 struct vtkICF::Region
 {
-  Region(vtkIdType s, vtkIdType i, const int e[6])
+  Region(vtkIdType s, vtkIdType i, const int e[6], vtkIdType c = -1)
     : size(s)
     , id(i)
+    , component(c)
   {
     extent[0] = e[0];
     extent[1] = e[1];
@@ -366,6 +380,7 @@ struct vtkICF::Region
   Region()
     : size(0)
     , id(0)
+    , component(-1)
   {
     extent[0] = extent[1] = extent[2] = 0;
     extent[3] = extent[4] = extent[5] = 0;
@@ -373,6 +388,7 @@ struct vtkICF::Region
 
   vtkIdType size;
   vtkIdType id;
+  vtkIdType component; // for ParallelExecute()
   int extent[6];
 };
 
@@ -534,10 +550,13 @@ void vtkICF::PruneAllButLargest(vtkImageData* outData, OT* outPtr, vtkImageStenc
 {
   // clip the extent with the output extent
   int outExt[6];
-  outData->GetExtent(outExt);
-  if (!vtkICF::IntersectExtents(outExt, extent, outExt))
+  if (outData)
   {
-    return;
+    outData->GetExtent(outExt);
+    if (!vtkICF::IntersectExtents(outExt, extent, outExt))
+    {
+      return;
+    }
   }
 
   // find the largest region
@@ -548,6 +567,10 @@ void vtkICF::PruneAllButLargest(vtkImageData* outData, OT* outPtr, vtkImageStenc
     OT t = std::distance(regionInfo.begin(), largest);
     regionInfo[1] = *largest;
     regionInfo.erase(regionInfo.begin() + 2, regionInfo.end());
+    if (!outData)
+    {
+      return;
+    }
 
     // remove all other regions from the output
     vtkImageStencilIterator<OT> iter(outData, stencil, outExt);
@@ -581,10 +604,13 @@ void vtkICF::PruneSmallestRegion(vtkImageData* outData, OT* outPtr, vtkImageSten
 {
   // clip the extent with the output extent
   int outExt[6];
-  outData->GetExtent(outExt);
-  if (!vtkICF::IntersectExtents(outExt, extent, outExt))
+  if (outData)
   {
-    return;
+    outData->GetExtent(outExt);
+    if (!vtkICF::IntersectExtents(outExt, extent, outExt))
+    {
+      return;
+    }
   }
 
   // find the smallest region
@@ -594,6 +620,10 @@ void vtkICF::PruneSmallestRegion(vtkImageData* outData, OT* outPtr, vtkImageSten
     // get the index to the smallest value and remove it
     OT t = std::distance(regionInfo.begin(), smallest);
     regionInfo.erase(smallest);
+    if (!outData)
+    {
+      return;
+    }
 
     // remove the corresponding region from the output
     vtkImageStencilIterator<OT> iter(outData, stencil, outExt);
@@ -650,6 +680,10 @@ void vtkICF::PruneBySize(vtkImageData* outData, OT* outPtr, vtkImageStencilData*
   {
     // resize regionInfo
     regionInfo.resize(m);
+    if (!outData)
+    {
+      return;
+    }
 
     // clip the extent with the output extent
     int outExt[6];
@@ -787,9 +821,9 @@ vtkIdType vtkICF::Fill(OT* outPtr, vtkIdType outInc[3], int outLimits[6], unsign
 template <class OT>
 void vtkICF::AddRegion(vtkImageData* outData, OT* outPtr, vtkImageStencilData* stencil,
   int extent[6], vtkIdType sizeRange[2], vtkICF::RegionVector& regionInfo, vtkIdType voxelCount,
-  vtkIdType regionId, int regionExtent[6], int extractionMode)
+  vtkIdType regionId, int regionExtent[6], int extractionMode, vtkIdType component)
 {
-  regionInfo.push_back(vtkICF::Region(voxelCount, regionId, regionExtent));
+  regionInfo.push_back(vtkICF::Region(voxelCount, regionId, regionExtent, component));
   // check if the label value has reached its maximum, and if so,
   // remove some of the regions
   if (regionInfo.size() > static_cast<size_t>(vtkTypeTraits<OT>::Max()))
@@ -1281,6 +1315,449 @@ void vtkICF::SeedlessExecute(vtkImageConnectivityFilter* self, vtkImageData* out
   }
 }
 
+//------------------------------------------------------------------------------
+// The runs of consecutive voxels along x whose bits are not set in the
+// bitmask.  Each run is linked to the overlapping runs of the neighboring
+// rows with a union-find, and the connected runs are numbered in the order
+// of their first voxel, i.e. in the order in which SeedlessExecute() would
+// find them.
+class vtkICF::Runs
+{
+public:
+  // Find and label the runs, maxIdx is the size of the mask minus one.
+  void Build(const unsigned char* maskPtr, const int maxIdx[3]);
+
+  // Get the component of a voxel, or -1 if the voxel is not in a region.
+  vtkIdType FindComponent(const int idx[3]) const;
+
+  vtkIdType GetNumberOfRows() const { return this->NumberOfRows; }
+  vtkIdType GetNumberOfComponents() const { return this->NumberOfComponents; }
+
+  int Dimensions[3];
+  std::vector<vtkIdType> RowOffsets; // first run of each row
+  std::vector<int> RunBegin;         // first x index of each run
+  std::vector<int> RunEnd;           // last x index of each run
+  std::vector<vtkIdType> Component;  // component of each run
+
+protected:
+  // Call f(x0, x1) for each run of a row.
+  template <class F>
+  static void ForEachRun(const unsigned char* maskPtr, int nx, vtkIdType row, F&& f);
+
+  vtkIdType Find(vtkIdType run);
+  void Union(vtkIdType run1, vtkIdType run2);
+  void UnionRows(vtkIdType row, vtkIdType neighborRow);
+
+  vtkIdType NumberOfRows = 0;
+  vtkIdType NumberOfComponents = 0;
+  std::vector<vtkIdType> Parent; // the root of a tree is its smallest run
+};
+
+//------------------------------------------------------------------------------
+template <class F>
+void vtkICF::Runs::ForEachRun(const unsigned char* maskPtr, int nx, vtkIdType row, F&& f)
+{
+  vtkIdType bitOffset = row * nx;
+  int x = 0;
+  while (x < nx)
+  {
+    // skip the voxels that are not in a region, a byte at a time if possible
+    while (x < nx)
+    {
+      vtkIdType b = bitOffset + x;
+      unsigned char byte = maskPtr[b >> 3];
+      if ((b & 0x7) == 0 && byte == 0xff && x + 8 <= nx)
+      {
+        x += 8;
+      }
+      else if ((byte >> (b & 0x7)) & 1)
+      {
+        x++;
+      }
+      else
+      {
+        break;
+      }
+    }
+    if (x == nx)
+    {
+      break;
+    }
+
+    // find the end of the run
+    int x0 = x;
+    while (x < nx)
+    {
+      vtkIdType b = bitOffset + x;
+      unsigned char byte = maskPtr[b >> 3];
+      if ((b & 0x7) == 0 && byte == 0 && x + 8 <= nx)
+      {
+        x += 8;
+      }
+      else if (((byte >> (b & 0x7)) & 1) == 0)
+      {
+        x++;
+      }
+      else
+      {
+        break;
+      }
+    }
+    f(x0, x - 1);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkICF::Runs::Build(const unsigned char* maskPtr, const int maxIdx[3])
+{
+  for (int k = 0; k < 3; k++)
+  {
+    this->Dimensions[k] = maxIdx[k] + 1;
+  }
+  const int nx = this->Dimensions[0];
+  const vtkIdType ny = this->Dimensions[1];
+  this->NumberOfRows = ny * this->Dimensions[2];
+  this->RowOffsets.assign(this->NumberOfRows + 1, 0);
+
+  // count the runs of each row, then store them
+  vtkSMPTools::For(0, this->NumberOfRows, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType row = begin; row < end; row++)
+    {
+      vtkIdType count = 0;
+      vtkICF::Runs::ForEachRun(maskPtr, nx, row, [&count](int, int) { count++; });
+      this->RowOffsets[row + 1] = count;
+    }
+  });
+  for (vtkIdType row = 0; row < this->NumberOfRows; row++)
+  {
+    this->RowOffsets[row + 1] += this->RowOffsets[row];
+  }
+  vtkIdType numberOfRuns = this->RowOffsets[this->NumberOfRows];
+  this->RunBegin.resize(numberOfRuns);
+  this->RunEnd.resize(numberOfRuns);
+  this->Parent.resize(numberOfRuns);
+  vtkSMPTools::For(0, this->NumberOfRows, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType row = begin; row < end; row++)
+    {
+      vtkIdType run = this->RowOffsets[row];
+      vtkICF::Runs::ForEachRun(maskPtr, nx, row, [this, &run](int x0, int x1) {
+        this->RunBegin[run] = x0;
+        this->RunEnd[run] = x1;
+        this->Parent[run] = run;
+        run++;
+      });
+    }
+  });
+
+  // split the rows into tiles (slabs of whole slices for 3D images), and
+  // link the runs within each tile concurrently: the trees of a tile only
+  // contain runs of the tile, so the tiles do not interfere
+  vtkIdType numberOfTiles = 4 * vtkSMPTools::GetEstimatedNumberOfThreads();
+  vtkIdType tileRows;
+  if (this->Dimensions[2] > 1)
+  {
+    tileRows = ny * ((this->Dimensions[2] + numberOfTiles - 1) / numberOfTiles);
+  }
+  else
+  {
+    tileRows = (ny + numberOfTiles - 1) / numberOfTiles;
+  }
+  numberOfTiles = (this->NumberOfRows + tileRows - 1) / tileRows;
+
+  vtkSMPTools::For(0, numberOfTiles, 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType tile = begin; tile < end; tile++)
+    {
+      vtkIdType firstRow = tile * tileRows;
+      vtkIdType lastRow = std::min(firstRow + tileRows, this->NumberOfRows);
+      for (vtkIdType row = firstRow; row < lastRow; row++)
+      {
+        if (row % ny != 0 && row - 1 >= firstRow)
+        {
+          this->UnionRows(row, row - 1);
+        }
+        if (row - ny >= firstRow)
+        {
+          this->UnionRows(row, row - ny);
+        }
+      }
+    }
+  });
+
+  // merge the tiles across their faces
+  for (vtkIdType tile = 1; tile < numberOfTiles; tile++)
+  {
+    vtkIdType firstRow = tile * tileRows;
+    vtkIdType lastRow = std::min(firstRow + ny, this->NumberOfRows);
+    for (vtkIdType row = firstRow; row < lastRow; row++)
+    {
+      if (row == firstRow && row % ny != 0)
+      {
+        this->UnionRows(row, row - 1);
+      }
+      if (row - ny >= 0)
+      {
+        this->UnionRows(row, row - ny);
+      }
+    }
+  }
+
+  // number the components, parents always precede their children
+  this->Component.resize(numberOfRuns);
+  this->NumberOfComponents = 0;
+  for (vtkIdType run = 0; run < numberOfRuns; run++)
+  {
+    vtkIdType parent = this->Parent[run];
+    this->Component[run] =
+      (parent == run ? this->NumberOfComponents++ : this->Component[parent]);
+  }
+  std::vector<vtkIdType>().swap(this->Parent);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkICF::Runs::FindComponent(const int idx[3]) const
+{
+  vtkIdType row = idx[2];
+  row = row * this->Dimensions[1] + idx[1];
+  auto first = this->RunEnd.begin() + this->RowOffsets[row];
+  auto last = this->RunEnd.begin() + this->RowOffsets[row + 1];
+  auto it = std::lower_bound(first, last, idx[0]);
+  if (it == last)
+  {
+    return -1;
+  }
+  vtkIdType run = std::distance(this->RunEnd.begin(), it);
+  return (this->RunBegin[run] <= idx[0] ? this->Component[run] : -1);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkICF::Runs::Find(vtkIdType run)
+{
+  // find the root, with path halving
+  while (this->Parent[run] != run)
+  {
+    this->Parent[run] = this->Parent[this->Parent[run]];
+    run = this->Parent[run];
+  }
+  return run;
+}
+
+//------------------------------------------------------------------------------
+void vtkICF::Runs::Union(vtkIdType run1, vtkIdType run2)
+{
+  run1 = this->Find(run1);
+  run2 = this->Find(run2);
+  if (run1 < run2)
+  {
+    this->Parent[run2] = run1;
+  }
+  else if (run2 < run1)
+  {
+    this->Parent[run1] = run2;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkICF::Runs::UnionRows(vtkIdType row, vtkIdType neighborRow)
+{
+  // link the overlapping runs of the two rows
+  vtkIdType run1 = this->RowOffsets[row];
+  vtkIdType end1 = this->RowOffsets[row + 1];
+  vtkIdType run2 = this->RowOffsets[neighborRow];
+  vtkIdType end2 = this->RowOffsets[neighborRow + 1];
+  while (run1 < end1 && run2 < end2)
+  {
+    if (this->RunBegin[run1] <= this->RunEnd[run2] && this->RunBegin[run2] <= this->RunEnd[run1])
+    {
+      this->Union(run1, run2);
+    }
+    if (this->RunEnd[run1] < this->RunEnd[run2])
+    {
+      run1++;
+    }
+    else
+    {
+      run2++;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Label the regions with vtkICF::Runs, then add them to the list of regions
+// in the order of SeededExecute() and SeedlessExecute(), with the same
+// pruning, and finally write the labels into the output.
+template <class OT>
+void vtkICF::ParallelExecute(vtkImageConnectivityFilter* self, vtkImageData* outData,
+  vtkDataSet* seedData, vtkImageStencilData* stencil, OT* outPtr, unsigned char* maskPtr,
+  int extent[6], vtkICF::RegionVector& regionInfo)
+{
+  // Get execution parameters
+  int extractionMode = self->GetExtractionMode();
+  vtkIdType sizeRange[2];
+  self->GetSizeRange(sizeRange);
+  bool generateExtents = (self->GetGenerateRegionExtents() != 0);
+
+  vtkIdType outInc[3];
+  outData->GetIncrements(outInc);
+
+  int outExt[6];
+  outData->GetExtent(outExt);
+
+  // Indexing will go from 0 to maxIdX, and the lower limit if "extent" will
+  // be subtracted from outExt.  If outExt was the same as extent, then nullptr
+  // is returned, else outExt is returned.
+  int maxIdx[3];
+  int* outLimits = vtkICF::ZeroBaseExtent(extent, outExt, maxIdx);
+
+  vtkICF::Runs runs;
+  runs.Build(maskPtr, maxIdx);
+
+  // the size and extent of each component, the extent is the position
+  // of the first voxel unless extent generation was requested
+  vtkIdType numberOfComponents = runs.GetNumberOfComponents();
+  vtkICF::RegionVector components;
+  components.resize(numberOfComponents);
+  for (vtkIdType row = 0; row < runs.GetNumberOfRows(); row++)
+  {
+    int yIdx = static_cast<int>(row % runs.Dimensions[1]);
+    int zIdx = static_cast<int>(row / runs.Dimensions[1]);
+    for (vtkIdType run = runs.RowOffsets[row]; run < runs.RowOffsets[row + 1]; run++)
+    {
+      vtkICF::Region& region = components[runs.Component[run]];
+      int x0 = runs.RunBegin[run];
+      int x1 = runs.RunEnd[run];
+      if (region.size == 0)
+      {
+        region.id = -1;
+        region.extent[0] = x0;
+        region.extent[1] = (generateExtents ? x1 : x0);
+        region.extent[2] = region.extent[3] = yIdx;
+        region.extent[4] = region.extent[5] = zIdx;
+      }
+      else if (generateExtents)
+      {
+        // the rows are visited in order of increasing z
+        region.extent[0] = std::min(region.extent[0], x0);
+        region.extent[1] = std::max(region.extent[1], x1);
+        region.extent[2] = std::min(region.extent[2], yIdx);
+        region.extent[3] = std::max(region.extent[3], yIdx);
+        region.extent[5] = zIdx;
+      }
+      region.size += x1 - x0 + 1;
+    }
+  }
+
+  // add the seeded regions, in the order of the seeds
+  std::vector<unsigned char> added(numberOfComponents, 0);
+  if (seedData)
+  {
+    double spacing[3];
+    double origin[3];
+    outData->GetOrigin(origin);
+    outData->GetSpacing(spacing);
+
+    vtkIdType nPoints = seedData->GetNumberOfPoints();
+    vtkDataArray* scalars = seedData->GetPointData()->GetScalars();
+
+    for (vtkIdType i = 0; i < nPoints; i++)
+    {
+      if (scalars && scalars->GetComponent(i, 0) == 0)
+      {
+        continue;
+      }
+
+      double point[3];
+      seedData->GetPoint(i, point);
+      int idx[3];
+      bool outOfBounds = false;
+
+      // convert point from data coords to image index
+      for (int j = 0; j < 3; j++)
+      {
+        idx[j] = vtkMath::Floor((point[j] - origin[j]) / spacing[j] + 0.5);
+        idx[j] -= extent[2 * j];
+        outOfBounds |= (idx[j] < 0 || idx[j] > maxIdx[j]);
+      }
+
+      if (outOfBounds)
+      {
+        continue;
+      }
+
+      vtkIdType c = runs.FindComponent(idx);
+      if (c < 0 || added[c])
+      {
+        continue;
+      }
+      added[c] = 1;
+
+      vtkICF::Region& region = components[c];
+      int seedExtent[6] = { idx[0], idx[0], idx[1], idx[1], idx[2], idx[2] };
+      vtkICF::AddRegion<OT>(nullptr, outPtr, stencil, extent, sizeRange, regionInfo, region.size,
+        i, (generateExtents ? region.extent : seedExtent), extractionMode, c);
+    }
+  }
+
+  // if no seeds, or if AllRegions selected, add all the other regions
+  if (!seedData || extractionMode == vtkImageConnectivityFilter::AllRegions)
+  {
+    for (vtkIdType c = 0; c < numberOfComponents; c++)
+    {
+      vtkICF::Region& region = components[c];
+      if (added[c] ||
+        (region.size == 1 && static_cast<OT>(regionInfo.size()) == vtkTypeTraits<OT>::Max()))
+      {
+        continue;
+      }
+      vtkICF::AddRegion<OT>(nullptr, outPtr, stencil, extent, sizeRange, regionInfo, region.size,
+        -1, region.extent, extractionMode, c);
+    }
+  }
+
+  // the label of each component is the index of its region
+  std::vector<OT> labels(numberOfComponents, 0);
+  for (size_t i = 1; i < regionInfo.size(); i++)
+  {
+    labels[regionInfo[i].component] = static_cast<OT>(i);
+  }
+
+  // write the labels into the output
+  vtkSMPTools::For(0, runs.GetNumberOfRows(), [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType row = begin; row < end; row++)
+    {
+      int yIdx = static_cast<int>(row % runs.Dimensions[1]);
+      int zIdx = static_cast<int>(row / runs.Dimensions[1]);
+      int xMin = 0;
+      int xMax = maxIdx[0];
+      if (outLimits)
+      {
+        if (yIdx < outLimits[2] || yIdx > outLimits[3] || zIdx < outLimits[4] ||
+          zIdx > outLimits[5])
+        {
+          continue;
+        }
+        xMin = outLimits[0];
+        xMax = outLimits[1];
+        yIdx -= outLimits[2];
+        zIdx -= outLimits[4];
+      }
+      OT* outRow = outPtr + yIdx * outInc[1] + zIdx * outInc[2];
+      for (vtkIdType run = runs.RowOffsets[row]; run < runs.RowOffsets[row + 1]; run++)
+      {
+        OT label = labels[runs.Component[run]];
+        int x0 = std::max(runs.RunBegin[run], xMin);
+        int x1 = std::min(runs.RunEnd[run], xMax);
+        if (label != 0)
+        {
+          for (int xIdx = x0; xIdx <= x1; xIdx++)
+          {
+            outRow[(xIdx - xMin) * outInc[0]] = label;
+          }
+        }
+      }
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 // This templated function executes the filter for any type of data.
 template <class OT>
@@ -1297,14 +1774,25 @@ void vtkICF::ExecuteOutput(vtkImageConnectivityFilter* self, vtkImageData* outDa
   if (seedData)
   {
     seedScalars = seedData->GetPointData()->GetScalars();
-    vtkICF::SeededExecute(self, outData, seedData, stencil, outPtr, maskPtr, extent, regionInfo);
   }
 
-  // if no seeds, or if AllRegions selected, search for all regions
-  int extractionMode = self->GetExtractionMode();
-  if (!seedData || extractionMode == vtkImageConnectivityFilter::AllRegions)
+  if (self->GetParallelLabeling())
+  {
+    vtkICF::ParallelExecute(self, outData, seedData, stencil, outPtr, maskPtr, extent, regionInfo);
+  }
+  else
   {
-    vtkICF::SeedlessExecute(self, outData, stencil, outPtr, maskPtr, extent, regionInfo);
+    if (seedData)
+    {
+      vtkICF::SeededExecute(self, outData, seedData, stencil, outPtr, maskPtr, extent, regionInfo);
+    }
+
+    // if no seeds, or if AllRegions selected, search for all regions
+    int extractionMode = self->GetExtractionMode();
+    if (!seedData || extractionMode == vtkImageConnectivityFilter::AllRegions)
+    {
+      vtkICF::SeedlessExecute(self, outData, stencil, outPtr, maskPtr, extent, regionInfo);
+    }
   }
 
   // do final relabelling and other bookkeeping
@@ -1486,6 +1974,8 @@ void vtkImageConnectivityFilter::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "GenerateRegionExtents: " << (this->GenerateRegionExtents ? "On\n" : "Off\n");
 
+  os << indent << "ParallelLabeling: " << (this->ParallelLabeling ? "On\n" : "Off\n");
+
   os << indent << "SeedConnection: " << this->GetSeedConnection() << "\n";
 
   os << indent << "StencilConnection: " << this->GetStencilConnection() << "\n";
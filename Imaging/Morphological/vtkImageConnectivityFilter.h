@@ -44,6 +44,10 @@
  * is called.  These extents can be useful for cropping the output
  * of the filter.
  *
+ * For large images, ParallelLabelingOn() replaces the flood fill with
+ * a parallel union-find labeling of the runs of voxels, which gives
+ * the same output.
+ *
  * @sa
  * vtkConnectivityFilter, vtkPolyDataConnectivityFilter, vtkmImageConnectivity
  */
@@ -242,6 +246,20 @@ public:
   vtkGetMacro(ActiveComponent, int);
   ///@}
 
+  ///@{
+  /**
+   * Label the regions with a parallel algorithm instead of a flood fill.
+   * The image is split into tiles (slabs of rows) whose runs of voxels
+   * are labeled concurrently with a union-find, then the tiles are merged
+   * across their faces.  The labels, the region arrays and the pruning
+   * of the regions are identical to those of the flood fill.  The default
+   * is off.
+   */
+  vtkSetMacro(ParallelLabeling, vtkTypeBool);
+  vtkBooleanMacro(ParallelLabeling, vtkTypeBool);
+  vtkGetMacro(ParallelLabeling, vtkTypeBool);
+  ///@}
+
 protected:
   vtkImageConnectivityFilter();
   ~vtkImageConnectivityFilter() override;
@@ -255,6 +273,7 @@ protected:
   int ActiveComponent;
   int LabelScalarType;
   vtkTypeBool GenerateRegionExtents;
+  vtkTypeBool ParallelLabeling;
 
   vtkIdTypeArray* ExtractedRegionLabels;
   vtkIdTypeArray* ExtractedRegionSizes;
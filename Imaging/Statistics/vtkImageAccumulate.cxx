@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkImageAccumulate.h"
 
+#include "vtkCommand.h"
 #include "vtkImageData.h"
 #include "vtkImageStencilData.h"
 #include "vtkImageStencilIterator.h"
@@ -9,9 +10,13 @@
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageAccumulate);
@@ -38,6 +43,11 @@ vtkImageAccumulate::vtkImageAccumulate()
   this->VoxelCount = 0;
   this->IgnoreZero = 0;
 
+  this->EnableSMP = true;
+  this->Progressive = 0;
+  this->ProgressiveStride = 4;
+  this->CoarsePass = false;
+
   // we have the image input and the optional stencil input
   this->SetNumberOfInputPorts(2);
 }
@@ -105,109 +115,271 @@ vtkImageStencilData* vtkImageAccumulate::GetStencil()
 }
 
 //------------------------------------------------------------------------------
-// This templated function executes the filter for any type of data.
+namespace
+{
+// The bins and the statistics accumulated by one thread.
+struct vtkImageAccumulateLocal
+{
+  std::vector<vtkIdType> Bins;
+  double Sum[3];
+  double SumSqr[3];
+  double Min[3];
+  double Max[3];
+  vtkIdType VoxelCount;
+};
+
+// Accumulate the voxels of a range of rows of the input, where the rows
+// are numbered along y then z, every Stride rows.
 template <class T>
-int vtkImageAccumulateExecute(vtkImageAccumulate* self, vtkImageData* inData, T*,
-  vtkImageData* outData, vtkIdType* outPtr, double min[3], double max[3], double mean[3],
-  double standardDeviation[3], vtkIdType* voxelCount, int* updateExtent)
+class vtkImageAccumulateFunctor
 {
-  // variables used to compute statistics (filter handles max 3 components)
-  double sum[3];
-  sum[0] = sum[1] = sum[2] = 0.0;
-  double sumSqr[3];
-  sumSqr[0] = sumSqr[1] = sumSqr[2] = 0.0;
-  min[0] = min[1] = min[2] = VTK_DOUBLE_MAX;
-  max[0] = max[1] = max[2] = VTK_DOUBLE_MIN;
-  standardDeviation[0] = standardDeviation[1] = standardDeviation[2] = 0.0;
-  *voxelCount = 0;
-
-  // input's number of components is used as output dimensionality
-  int numC = inData->GetNumberOfScalarComponents();
-  if (numC > 3)
+public:
+  vtkImageAccumulate* Algorithm; // for progress, only if not threaded
+  vtkImageData* InData;
+  vtkImageStencilData* Stencil;
+  bool ReverseStencil;
+  bool IgnoreZero;
+  int NumberOfComponents;
+  int Extent[6];
+  int Stride;
+  int RowsPerSlice;
+  int OutExtent[6];
+  vtkIdType OutIncs[3];
+  double Origin[3];
+  double Spacing[3];
+  vtkIdType NumberOfBins;
+  vtkSMPThreadLocal<vtkImageAccumulateLocal> Local;
+
+  // Results of Reduce()
+  vtkIdType* OutPtr;
+  vtkImageAccumulateLocal Result;
+
+  void Initialize()
   {
-    return 0;
+    vtkImageAccumulateLocal& local = this->Local.Local();
+    local.Bins.assign(this->NumberOfBins, 0);
+    for (int idxC = 0; idxC < 3; ++idxC)
+    {
+      local.Sum[idxC] = 0.0;
+      local.SumSqr[idxC] = 0.0;
+      local.Min[idxC] = VTK_DOUBLE_MAX;
+      local.Max[idxC] = VTK_DOUBLE_MIN;
+    }
+    local.VoxelCount = 0;
   }
 
-  // get information for output data
-  int outExtent[6];
-  outData->GetExtent(outExtent);
-  vtkIdType outIncs[3];
-  outData->GetIncrements(outIncs);
-  double origin[3];
-  outData->GetOrigin(origin);
-  double spacing[3];
-  outData->GetSpacing(spacing);
-
-  // zero count in every bin
-  vtkIdType size = 1;
-  size *= (outExtent[1] - outExtent[0] + 1);
-  size *= (outExtent[3] - outExtent[2] + 1);
-  size *= (outExtent[5] - outExtent[4] + 1);
-  for (vtkIdType j = 0; j < size; j++)
+  void operator()(vtkIdType begin, vtkIdType end)
   {
-    outPtr[j] = 0;
+    vtkImageAccumulateLocal& local = this->Local.Local();
+    int box[6] = { this->Extent[0], this->Extent[1], 0, 0, 0, 0 };
+    vtkIdType row = begin;
+    while (row < end)
+    {
+      int y = static_cast<int>(row % this->RowsPerSlice);
+      int z = static_cast<int>(row / this->RowsPerSlice);
+      vtkIdType n = 1;
+      if (this->Stride == 1 && y == 0 && end - row >= this->RowsPerSlice)
+      {
+        // as many whole slices as possible
+        n = ((end - row) / this->RowsPerSlice) * this->RowsPerSlice;
+        box[2] = this->Extent[2];
+        box[3] = this->Extent[3];
+        box[5] = z + static_cast<int>(n / this->RowsPerSlice) - 1 + this->Extent[4];
+      }
+      else if (this->Stride == 1)
+      {
+        // the rest of the slice
+        n = std::min(end - row, static_cast<vtkIdType>(this->RowsPerSlice - y));
+        box[2] = this->Extent[2] + y;
+        box[3] = box[2] + static_cast<int>(n) - 1;
+        box[5] = z + this->Extent[4];
+      }
+      else
+      {
+        box[2] = box[3] = this->Extent[2] + y * this->Stride;
+        box[5] = this->Extent[4] + z * this->Stride;
+      }
+      box[4] = this->Extent[4] + z * this->Stride;
+      this->AccumulateBox(box, local);
+      row += n;
+    }
   }
 
-  vtkImageStencilData* stencil = self->GetStencil();
-  bool reverseStencil = (self->GetReverseStencil() != 0);
-  bool ignoreZero = (self->GetIgnoreZero() != 0);
-
-  vtkImageStencilIterator<T> inIter(inData, stencil, updateExtent, self);
-
-  while (!inIter.IsAtEnd())
+  void AccumulateBox(const int box[6], vtkImageAccumulateLocal& local)
   {
-    if (inIter.IsInStencil() ^ reverseStencil)
+    const int numC = this->NumberOfComponents;
+    const int stride = this->Stride;
+    vtkImageStencilIterator<T> inIter(this->InData, this->Stencil, box, this->Algorithm);
+    for (; !inIter.IsAtEnd(); inIter.NextSpan())
     {
-      T* inPtr = inIter.BeginSpan();
-      T* spanEndPtr = inIter.EndSpan();
-
-      while (inPtr != spanEndPtr)
+      if (inIter.IsInStencil() ^ this->ReverseStencil)
       {
-        // find the bin for this pixel.
-        bool outOfBounds = false;
-        vtkIdType* outPtrC = outPtr;
-        for (int idxC = 0; idxC < numC; ++idxC)
+        T* inPtr = inIter.BeginSpan();
+        vtkIdType n = (inIter.EndSpan() - inPtr) / numC;
+        vtkIdType i = 0;
+        if (stride > 1)
+        {
+          // only take the voxels on the sampling grid
+          i = (stride - (inIter.GetIndex()[0] - this->Extent[0]) % stride) % stride;
+        }
+        for (; i < n; i += stride)
         {
-          double v = static_cast<double>(*inPtr++);
-          if (!ignoreZero || v != 0)
-          {
-            // gather statistics
-            sum[idxC] += v;
-            sumSqr[idxC] += v * v;
-            if (v > max[idxC])
-            {
-              max[idxC] = v;
-            }
-            if (v < min[idxC])
-            {
-              min[idxC] = v;
-            }
-            (*voxelCount)++;
-          }
-
-          // compute the index
-          int outIdx = vtkMath::Floor((v - origin[idxC]) / spacing[idxC]);
-
-          // verify that it is in range
-          if (outIdx >= outExtent[idxC * 2] && outIdx <= outExtent[idxC * 2 + 1])
-          {
-            outPtrC += (outIdx - outExtent[idxC * 2]) * outIncs[idxC];
-          }
-          else
-          {
-            outOfBounds = true;
-          }
+          this->AccumulateVoxel(inPtr + i * numC, local);
         }
+      }
+    }
+  }
 
-        // increment the bin
-        if (!outOfBounds)
+  void AccumulateVoxel(const T* inPtr, vtkImageAccumulateLocal& local)
+  {
+    // find the bin for this pixel.
+    bool outOfBounds = false;
+    vtkIdType bin = 0;
+    for (int idxC = 0; idxC < this->NumberOfComponents; ++idxC)
+    {
+      double v = static_cast<double>(*inPtr++);
+      if (!this->IgnoreZero || v != 0)
+      {
+        // gather statistics
+        local.Sum[idxC] += v;
+        local.SumSqr[idxC] += v * v;
+        if (v > local.Max[idxC])
         {
-          ++(*outPtrC);
+          local.Max[idxC] = v;
         }
+        if (v < local.Min[idxC])
+        {
+          local.Min[idxC] = v;
+        }
+        local.VoxelCount++;
+      }
+
+      // compute the index
+      int outIdx = vtkMath::Floor((v - this->Origin[idxC]) / this->Spacing[idxC]);
+
+      // verify that it is in range
+      if (outIdx >= this->OutExtent[idxC * 2] && outIdx <= this->OutExtent[idxC * 2 + 1])
+      {
+        bin += (outIdx - this->OutExtent[idxC * 2]) * this->OutIncs[idxC];
+      }
+      else
+      {
+        outOfBounds = true;
+      }
+    }
+
+    // increment the bin
+    if (!outOfBounds)
+    {
+      ++local.Bins[bin];
+    }
+  }
+
+  void Reduce()
+  {
+    vtkImageAccumulateLocal& result = this->Result;
+    std::fill(this->OutPtr, this->OutPtr + this->NumberOfBins, 0);
+    for (int idxC = 0; idxC < 3; ++idxC)
+    {
+      result.Sum[idxC] = 0.0;
+      result.SumSqr[idxC] = 0.0;
+      result.Min[idxC] = VTK_DOUBLE_MAX;
+      result.Max[idxC] = VTK_DOUBLE_MIN;
+    }
+    result.VoxelCount = 0;
+
+    for (vtkImageAccumulateLocal& local : this->Local)
+    {
+      for (vtkIdType j = 0; j < this->NumberOfBins; j++)
+      {
+        this->OutPtr[j] += local.Bins[j];
       }
+      for (int idxC = 0; idxC < 3; ++idxC)
+      {
+        result.Sum[idxC] += local.Sum[idxC];
+        result.SumSqr[idxC] += local.SumSqr[idxC];
+        result.Min[idxC] = std::min(result.Min[idxC], local.Min[idxC]);
+        result.Max[idxC] = std::max(result.Max[idxC], local.Max[idxC]);
+      }
+      result.VoxelCount += local.VoxelCount;
     }
+  }
+};
+} // end anonymous namespace
+
+//------------------------------------------------------------------------------
+// This templated function executes the filter for any type of data.
+// Only one voxel every "stride" voxels along each axis is accumulated.
+template <class T>
+int vtkImageAccumulateExecute(vtkImageAccumulate* self, vtkImageData* inData, T*,
+  vtkImageData* outData, vtkIdType* outPtr, double min[3], double max[3], double mean[3],
+  double standardDeviation[3], vtkIdType* voxelCount, int* updateExtent, int stride)
+{
+  // input's number of components is used as output dimensionality
+  int numC = inData->GetNumberOfScalarComponents();
+  if (numC > 3)
+  {
+    return 0;
+  }
+
+  vtkImageAccumulateFunctor<T> functor;
+  functor.InData = inData;
+  functor.Stencil = self->GetStencil();
+  functor.ReverseStencil = (self->GetReverseStencil() != 0);
+  functor.IgnoreZero = (self->GetIgnoreZero() != 0);
+  functor.NumberOfComponents = numC;
+  functor.Stride = stride;
+  std::copy(updateExtent, updateExtent + 6, functor.Extent);
+
+  // get information for output data
+  outData->GetExtent(functor.OutExtent);
+  outData->GetIncrements(functor.OutIncs);
+  outData->GetOrigin(functor.Origin);
+  outData->GetSpacing(functor.Spacing);
+  functor.OutPtr = outPtr;
+
+  vtkIdType size = 1;
+  size *= (functor.OutExtent[1] - functor.OutExtent[0] + 1);
+  size *= (functor.OutExtent[3] - functor.OutExtent[2] + 1);
+  size *= (functor.OutExtent[5] - functor.OutExtent[4] + 1);
+  functor.NumberOfBins = size;
+
+  // the number of sampled rows
+  vtkIdType sizes[3];
+  for (int k = 0; k < 3; k++)
+  {
+    int n = updateExtent[2 * k + 1] - updateExtent[2 * k] + 1;
+    sizes[k] = (n > 0 ? (n + stride - 1) / stride : 0);
+  }
+  functor.RowsPerSlice = static_cast<int>(sizes[1]);
+  vtkIdType numberOfRows = sizes[1] * sizes[2];
+
+  // use threads only if the merge of the bins is cheaper than the voxels
+  bool threaded = self->GetEnableSMP() && numberOfRows > 1 &&
+    size * vtkSMPTools::GetEstimatedNumberOfThreads() <= sizes[0] * numberOfRows;
+  if (threaded)
+  {
+    functor.Algorithm = nullptr;
+    vtkSMPTools::For(0, numberOfRows, functor);
+  }
+  else
+  {
+    functor.Algorithm = self;
+    functor.Initialize();
+    functor(0, numberOfRows);
+    functor.Reduce();
+  }
 
-    inIter.NextSpan();
+  const vtkImageAccumulateLocal& result = functor.Result;
+  *voxelCount = result.VoxelCount;
+  double sum[3];
+  double sumSqr[3];
+  for (int idxC = 0; idxC < 3; ++idxC)
+  {
+    min[idxC] = result.Min[idxC];
+    max[idxC] = result.Max[idxC];
+    sum[idxC] = result.Sum[idxC];
+    sumSqr[idxC] = result.SumSqr[idxC];
   }
 
   // initialize the statistics
@@ -284,15 +456,34 @@ int vtkImageAccumulate::RequestData(vtkInformation* vtkNotUsed(request),
     return 0;
   }
 
+  // in progressive mode, a coarse pass on a subsample precedes the full pass
+  int firstPass = (this->Progressive && this->ProgressiveStride > 1 ? 0 : 1);
   int retVal = 0;
-  switch (inData->GetScalarType())
+  for (int pass = firstPass; pass < 2; ++pass)
   {
-    vtkTemplateMacro(retVal = vtkImageAccumulateExecute(this, inData, static_cast<VTK_TT*>(inPtr),
-                       outData, static_cast<vtkIdType*>(outPtr), this->Min, this->Max, this->Mean,
-                       this->StandardDeviation, &this->VoxelCount, uExt));
-    default:
-      vtkErrorMacro(<< "Execute: Unknown ScalarType");
-      return 0;
+    int stride = (pass == 0 ? this->ProgressiveStride : 1);
+    switch (inData->GetScalarType())
+    {
+      vtkTemplateMacro(retVal = vtkImageAccumulateExecute(this, inData,
+                         static_cast<VTK_TT*>(inPtr), outData, static_cast<vtkIdType*>(outPtr),
+                         this->Min, this->Max, this->Mean, this->StandardDeviation,
+                         &this->VoxelCount, uExt, stride));
+      default:
+        vtkErrorMacro(<< "Execute: Unknown ScalarType");
+        return 0;
+    }
+
+    if (pass == 0)
+    {
+      if (!retVal || this->GetAbortExecute())
+      {
+        break;
+      }
+      // let the observers use the coarse histogram
+      this->CoarsePass = true;
+      this->InvokeEvent(vtkCommand::UpdateDataEvent);
+      this->CoarsePass = false;
+    }
   }
 
   return retVal;
@@ -370,6 +561,9 @@ void vtkImageAccumulate::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Stencil: " << this->GetStencil() << "\n";
   os << indent << "ReverseStencil: " << (this->ReverseStencil ? "On\n" : "Off\n");
   os << indent << "IgnoreZero: " << (this->IgnoreZero ? "On" : "Off") << "\n";
+  os << indent << "EnableSMP: " << (this->EnableSMP ? "On" : "Off") << "\n";
+  os << indent << "Progressive: " << (this->Progressive ? "On" : "Off") << "\n";
+  os << indent << "ProgressiveStride: " << this->ProgressiveStride << "\n";
 
   os << indent << "ComponentOrigin: ( " << this->ComponentOrigin[0] << ", "
      << this->ComponentOrigin[1] << ", " << this->ComponentOrigin[2] << " )\n";
@@ -20,6 +20,12 @@
  * option with vtkImageMask may result in results being slightly off since 0
  * could be a valid value from your input.
  *
+ * The accumulation is done in parallel with vtkSMPTools, each thread
+ * counting into its own copy of the bins, unless EnableSMP is off.
+ * In progressive mode, a coarse histogram of a subsample of the input is
+ * made available to the observers of vtkCommand::UpdateDataEvent before
+ * the histogram of the whole input is computed.
+ *
  */
 
 #ifndef vtkImageAccumulate_h
@@ -123,6 +129,47 @@ public:
   vtkBooleanMacro(IgnoreZero, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Accumulate in parallel with vtkSMPTools.  Each thread counts into its
+   * own copy of the bins, and the copies are added at the end, so this is
+   * only done when there are fewer bins than voxels per thread.  Initial
+   * value is true.
+   */
+  vtkSetMacro(EnableSMP, bool);
+  vtkGetMacro(EnableSMP, bool);
+  vtkBooleanMacro(EnableSMP, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Progressive mode.  When on, the filter first accumulates a subsample
+   * of the input, made of one voxel every ProgressiveStride voxels along
+   * each axis, and invokes vtkCommand::UpdateDataEvent while the output
+   * and the statistics hold the result of this coarse pass.  It then
+   * accumulates the whole input as usual.  The coarse counts are not
+   * rescaled.  Initial value is false.
+   */
+  vtkSetMacro(Progressive, vtkTypeBool);
+  vtkGetMacro(Progressive, vtkTypeBool);
+  vtkBooleanMacro(Progressive, vtkTypeBool);
+  ///@}
+
+  ///@{
+  /**
+   * The sampling stride of the coarse pass of the progressive mode.
+   * Initial value is 4.
+   */
+  vtkSetClampMacro(ProgressiveStride, int, 1, VTK_INT_MAX);
+  vtkGetMacro(ProgressiveStride, int);
+  ///@}
+
+  /**
+   * Return true while the coarse pass of the progressive mode is
+   * reported, i.e. from the observers of vtkCommand::UpdateDataEvent.
+   */
+  vtkGetMacro(CoarsePass, bool);
+
 protected:
   vtkImageAccumulate();
   ~vtkImageAccumulate() override;
@@ -145,6 +192,11 @@ protected:
 
   vtkTypeBool ReverseStencil;
 
+  bool EnableSMP;
+  vtkTypeBool Progressive;
+  int ProgressiveStride;
+  bool CoarsePass;
+
   int FillInputPortInformation(int port, vtkInformation* info) override;
 
 private:
@@ -11,6 +11,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <algorithm>
 #include <cmath>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -74,15 +75,40 @@ vtkImageData* vtkImageStencil::GetBackgroundInput()
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-// copy a pixel, advance the output pointer but not the input pointer
+// copy a run of contiguous pixels as one block, which lets the compiler and
+// the standard library use wide (vector) copies instead of a per-pixel loop
 
 template <class T>
-inline void vtkCopyPixel(T*& out, const T* in, int numscalars)
+inline void vtkCopyRun(T* out, const T* in, vtkIdType n)
 {
-  do
+  std::copy(in, in + n, out);
+}
+
+//------------------------------------------------------------------------------
+// fill a run of numpixels pixels with a single pixel value, for multiple
+// components the filled part is copied onto itself with doubling block sizes
+
+template <class T>
+inline void vtkFillRun(T* out, const T* pixel, int numscalars, vtkIdType numpixels)
+{
+  if (numpixels <= 0)
   {
-    *out++ = *in++;
-  } while (--numscalars);
+    return;
+  }
+  if (numscalars == 1)
+  {
+    std::fill(out, out + numpixels, *pixel);
+    return;
+  }
+  std::copy(pixel, pixel + numscalars, out);
+  vtkIdType filled = numscalars;
+  vtkIdType total = numpixels * numscalars;
+  while (filled < total)
+  {
+    vtkIdType n = std::min(filled, total - filled);
+    std::copy(out, out + n, out + filled);
+    filled += n;
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -154,24 +180,20 @@ void vtkImageStencilExecute(vtkImageStencil* self, vtkImageData* inData, T*, vtk
       T* outPtr = outIter.BeginSpan();
       T* outSpanEndPtr = outIter.EndSpan();
 
-      T* tmpPtr = inPtr;
-      int tmpInc = numscalars;
-      if (!(outIter.IsInStencil() ^ reverseStencil))
+      // the span is a run of pixels that are all inside or all outside
+      vtkIdType spanSize = static_cast<vtkIdType>(outSpanEndPtr - outPtr);
+      if (outIter.IsInStencil() ^ reverseStencil)
       {
-        tmpPtr = background;
-        tmpInc = 0;
+        vtkCopyRun(outPtr, inPtr, spanSize);
       }
-
-      // move inPtr forward by the span size
-      inPtr += (outSpanEndPtr - outPtr);
-
-      while (outPtr != outSpanEndPtr)
+      else
       {
-        // CopyPixel increments outPtr but not tmpPtr
-        vtkCopyPixel(outPtr, tmpPtr, numscalars);
-        tmpPtr += tmpInc;
+        vtkFillRun(outPtr, background, numscalars, spanSize / numscalars);
       }
 
+      // move inPtr forward by the span size
+      inPtr += spanSize;
+
       outIter.NextSpan();
 
       // this occurs at the end of a full row
@@ -199,22 +221,13 @@ void vtkImageStencilExecute(vtkImageStencil* self, vtkImageData* inData, T*, vtk
       T* outPtr = outIter.BeginSpan();
       T* outSpanEndPtr = outIter.EndSpan();
 
-      T* tmpPtr = inPtr;
-      if (!(outIter.IsInStencil() ^ reverseStencil))
-      {
-        tmpPtr = inPtr2;
-      }
+      // copy the run from the input or from the background input
+      vtkIdType spanSize = static_cast<vtkIdType>(outSpanEndPtr - outPtr);
+      vtkCopyRun(outPtr, ((outIter.IsInStencil() ^ reverseStencil) ? inPtr : inPtr2), spanSize);
 
       // move inPtr forward by the span size
-      inPtr += (outSpanEndPtr - outPtr);
-      inPtr2 += (outSpanEndPtr - outPtr);
-
-      while (outPtr != outSpanEndPtr)
-      {
-        // CopyPixel increments outPtr but not tmpPtr
-        vtkCopyPixel(outPtr, tmpPtr, numscalars);
-        tmpPtr += numscalars;
-      }
+      inPtr += spanSize;
+      inPtr2 += spanSize;
 
       outIter.NextSpan();
 